@@ -0,0 +1,153 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file CaptureHardware.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Hardware decorator which records the serial stream
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef ROS_CAPTURE_HARDWARE_H_
+#define ROS_CAPTURE_HARDWARE_H_
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdint.h>
+/* -------------------------------------------------------------------------------*/
+
+namespace ros
+{
+
+/* Capture Format ----------------------------------------------------------------*/
+/*
+ * A capture starts with the 4 byte magic "RSC1", followed by one record
+ * per hardware call in call order, integers little endian:
+ *
+ *   'T' u32     time() returned the value
+ *   'R' u8      read() returned the byte
+ *   'E'         read() returned -1
+ *   'W' u16 ... write() of u16 bytes, followed by the bytes
+ */
+constexpr uint8_t   CAPTURE_MAGIC[4]  = {'R', 'S', 'C', '1'};
+constexpr uint8_t   CAPTURE_TIME      = 'T';
+constexpr uint8_t   CAPTURE_READ      = 'R';
+constexpr uint8_t   CAPTURE_EMPTY     = 'E';
+constexpr uint8_t   CAPTURE_WRITE     = 'W';
+/* -------------------------------------------------------------------------------*/
+
+/**
+ * @brief Hardware which records all calls to another hardware
+ *
+ * Every read(), time() and write() is passed on to Hardware and recorded
+ * to the sink. The sink needs a method
+ * void capture(const uint8_t* data, uint32_t size), e.g. a file on the
+ * host or a RAM buffer on the device. Without sink the calls are only
+ * passed on. A capture can be replayed with ReplayHardware of the tests.
+ *
+ * @tparam Hardware Hardware which is captured
+ * @tparam Sink     Receiver of the capture
+ */
+template<class Hardware, class Sink>
+class CaptureHardware : public Hardware
+{
+  public:
+
+    CaptureHardware(void) :
+    Hardware(),
+    _sink(nullptr)
+    {
+
+    }
+
+    /**
+     * @brief Start recording to sink, nullptr stops recording
+     */
+    void setSink(Sink* sink)
+    {
+      _sink = sink;
+      if(_sink)
+      {
+        _sink->capture(CAPTURE_MAGIC, sizeof(CAPTURE_MAGIC));
+      }
+    }
+
+    int read()
+    {
+      const int data = Hardware::read();
+
+      if(_sink)
+      {
+        const uint8_t record[2] = {data < 0 ? CAPTURE_EMPTY : CAPTURE_READ, static_cast<uint8_t>(data)};
+        _sink->capture(record, data < 0 ? 1u : 2u);
+      }
+      return data;
+    }
+
+    void write(uint8_t* data, int length)
+    {
+      if(_sink)
+      {
+        const uint8_t record[3] = {CAPTURE_WRITE, static_cast<uint8_t>(length & 0xff),
+                                   static_cast<uint8_t>((length >> 8) & 0xff)};
+        _sink->capture(record, sizeof(record));
+        _sink->capture(data, static_cast<uint32_t>(length));
+      }
+      Hardware::write(data, length);
+    }
+
+    unsigned long time()
+    {
+      const uint32_t value = static_cast<uint32_t>(Hardware::time());
+
+      if(_sink)
+      {
+        const uint8_t record[5] = {CAPTURE_TIME,
+                                   static_cast<uint8_t>(value), static_cast<uint8_t>(value >> 8),
+                                   static_cast<uint8_t>(value >> 16), static_cast<uint8_t>(value >> 24)};
+        _sink->capture(record, sizeof(record));
+      }
+      return value;
+    }
+
+  protected:
+
+    Sink*   _sink;  //!< Receiver of the capture, nullptr if not recording
+};
+
+}; /* namespace ros */
+
+#endif /* ROS_CAPTURE_HARDWARE_H_ */
@@ -0,0 +1,378 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file STMDmaCopy.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Asynchronous memory copies on the DMA2 memory to memory stream
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef ROS_STM32_DMA_COPY_H_
+#define ROS_STM32_DMA_COPY_H_
+
+/* Includes ----------------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(STM32F4)
+  #include "stm32f4xx_hal.h"
+  #include "stm32f4xx_hal_dma.h"
+#else
+  #error "Please specify STM hardware type e.g. STM32F3 or STM32F4"
+#endif
+
+#ifdef __cplusplus
+};
+#endif
+
+/* -------------------------------------------------------------------------------*/
+
+namespace ros
+{
+
+/* Copy Configuration ------------------------------------------------------------*/
+constexpr uint32_t  STM_DMA_COPY_THRESHOLD  = 256u;     //!< Smaller copies use memcpy, see dma_copy_bench
+constexpr uint8_t   STM_DMA_COPY_QUEUE      = 8u;       //!< Copies waiting for the stream
+constexpr uint32_t  STM_DMA_COPY_MAX_ITEMS  = 65535u;   //!< NDTR limit, larger copies run in parts
+/* -------------------------------------------------------------------------------*/
+
+/**
+ * @brief Called once a copy is complete, from the DMA interrupt or, for
+ *        copies done by the CPU, from copy()
+ */
+typedef void (*DmaCopyCallback)(void* arg);
+
+/**
+ * @brief Copy service on a DMA2 stream in memory to memory mode
+ * 
+ * Copies of at least the threshold are queued for the DMA and complete in
+ * the stream interrupt, which the application forwards to irq(). Smaller
+ * copies, copies while the queue is full and copies without a stream are
+ * done with memcpy() right away. Copies between word aligned buffers move
+ * words and the last bytes in a second part, all others move bytes. Source
+ * and destination must stay untouched until the callback.
+ * Only DMA2 can access memory on both ports, DMA1 streams do not work.
+ */
+class STMDmaCopy
+{
+  public:
+
+    /**
+     * @brief Construct a new STMDmaCopy object
+     * 
+     * @param stream DMA2 stream used for all copies, nullptr for CPU only
+     * @param threshold Smallest copy done by the DMA
+     */
+    explicit STMDmaCopy(DMA_Stream_TypeDef* stream = DMA2_Stream0,
+                        const uint32_t threshold = STM_DMA_COPY_THRESHOLD) :
+    _hdma(),
+    _threshold(threshold),
+    _queue(),
+    _head(0u),
+    _size(0u),
+    _part(0u),
+    _length(0u),
+    _dma_copies(0u),
+    _cpu_copies(0u),
+    _errors(0u)
+    {
+      _hdma.Instance = stream;
+    }
+
+    /**
+     * @brief Configure the stream, the application enables its interrupt
+     */
+    void init()
+    {
+      _head = 0u;
+      _size = 0u;
+      _part = 0u;
+
+      if(nullptr == _hdma.Instance)
+      {
+        return;
+      }
+
+      __HAL_RCC_DMA2_CLK_ENABLE();
+
+      _hdma.Init.Channel              = DMA_CHANNEL_0;
+      _hdma.Init.Direction            = DMA_MEMORY_TO_MEMORY;
+      _hdma.Init.PeriphInc            = DMA_PINC_ENABLE;
+      _hdma.Init.MemInc               = DMA_MINC_ENABLE;
+      _hdma.Init.PeriphDataAlignment  = DMA_PDATAALIGN_WORD;
+      _hdma.Init.MemDataAlignment     = DMA_MDATAALIGN_WORD;
+      _hdma.Init.Mode                 = DMA_NORMAL;
+      _hdma.Init.Priority             = DMA_PRIORITY_LOW;
+      _hdma.Init.FIFOMode             = DMA_FIFOMODE_ENABLE;
+      _hdma.Init.FIFOThreshold        = DMA_FIFO_THRESHOLD_FULL;
+      _hdma.Init.MemBurst             = DMA_MBURST_SINGLE;
+      _hdma.Init.PeriphBurst          = DMA_PBURST_SINGLE;
+      if(HAL_OK != HAL_DMA_Init(&_hdma))
+      {
+        _hdma.Instance = nullptr;
+        return;
+      }
+
+      _hdma.Parent            = this;
+      _hdma.XferCpltCallback  = &STMDmaCopy::transferComplete;
+      _hdma.XferErrorCallback = &STMDmaCopy::transferError;
+    }
+
+    /**
+     * @brief Copy size bytes from src to dst and call done afterwards
+     * 
+     * @return true The copy was queued for the DMA, the CPU finishes it if
+     *              the stream fails
+     * @return false The copy was done by the CPU, done was called already
+     */
+    bool copy(void* dst, const void* src, const uint32_t size, DmaCopyCallback done = nullptr, void* arg = nullptr)
+    {
+      if((nullptr == _hdma.Instance) || (0u == size) || (size < _threshold))
+      {
+        copyOnCpu(dst, src, size, done, arg);
+        return false;
+      }
+
+      // The stream interrupt takes jobs from the queue and a copy() from an
+      // interrupt may add one, so the queue is only checked with both masked
+      const uint32_t primask = __get_PRIMASK();
+      __disable_irq();
+      if(STM_DMA_COPY_QUEUE == _size)
+      {
+        __set_PRIMASK(primask);
+        copyOnCpu(dst, src, size, done, arg);
+        return false;
+      }
+      Job& job  = _queue[(_head + _size) % STM_DMA_COPY_QUEUE];
+      job.dst   = static_cast<uint8_t*>(dst);
+      job.src   = static_cast<const uint8_t*>(src);
+      job.size  = size;
+      job.done  = done;
+      job.arg   = arg;
+      _size++;
+      if(1u == _size)
+      {
+        start();
+      }
+      __set_PRIMASK(primask);
+      return true;
+    }
+
+    /**
+     * @brief Stream interrupt, forwarded by the application
+     */
+    void irq()
+    {
+      HAL_DMA_IRQHandler(&_hdma);
+    }
+
+    /**
+     * @brief Whether copies are queued or running
+     */
+    bool busy() const
+    {
+      return 0u != _size;
+    }
+
+    uint32_t getThreshold() const
+    {
+      return _threshold;
+    }
+
+    void setThreshold(const uint32_t threshold)
+    {
+      _threshold = threshold;
+    }
+
+    uint32_t getDmaCopies() const
+    {
+      return _dma_copies;
+    }
+
+    uint32_t getCpuCopies() const
+    {
+      return _cpu_copies;
+    }
+
+    /**
+     * @brief Copies the DMA failed on or did not start, they were finished
+     *        by the CPU
+     */
+    uint32_t getErrors() const
+    {
+      return _errors;
+    }
+
+#ifndef BUILD_TESTS
+  protected:
+#endif
+
+    /**
+     * @brief Queued copy
+     */
+    struct Job
+    {
+      uint8_t*        dst;
+      const uint8_t*  src;
+      uint32_t        size;
+      DmaCopyCallback done;
+      void*           arg;
+    };
+
+    /**
+     * @brief Copy with the CPU right away and call done
+     */
+    void copyOnCpu(void* dst, const void* src, const uint32_t size, DmaCopyCallback done, void* arg)
+    {
+      memcpy(dst, src, size);
+      _cpu_copies++;
+      if(nullptr != done)
+      {
+        done(arg);
+      }
+    }
+
+    /**
+     * @brief Start the next part of the oldest job, the CPU finishes the job
+     *        if the stream does not start
+     */
+    void start()
+    {
+      const Job& job = _queue[_head];
+      const uint32_t left = job.size - _part;
+      const bool words = (left >= 4u) && (0u == ((reinterpret_cast<uintptr_t>(job.dst + _part) |
+                                                  reinterpret_cast<uintptr_t>(job.src + _part)) & 3u));
+      const uint32_t width = words ? 4u : 1u;
+      const uint32_t items = ((left / width) > STM_DMA_COPY_MAX_ITEMS) ? STM_DMA_COPY_MAX_ITEMS : (left / width);
+
+      MODIFY_REG(_hdma.Instance->CR, DMA_SxCR_PSIZE | DMA_SxCR_MSIZE,
+                 words ? (DMA_PDATAALIGN_WORD | DMA_MDATAALIGN_WORD) : (DMA_PDATAALIGN_BYTE | DMA_MDATAALIGN_BYTE));
+      _length = items * width;
+      if(HAL_OK != HAL_DMA_Start_IT(&_hdma, static_cast<uint32_t>(reinterpret_cast<uintptr_t>(job.src + _part)),
+                                    static_cast<uint32_t>(reinterpret_cast<uintptr_t>(job.dst + _part)), items))
+      {
+        finishOnCpu();
+      }
+    }
+
+    /**
+     * @brief Copy the rest of the oldest job with the CPU and complete it,
+     *        the callback must come in any case
+     */
+    void finishOnCpu()
+    {
+      const Job& job = _queue[_head];
+
+      _errors++;
+      memcpy(job.dst + _part, job.src + _part, job.size - _part);
+      _length = job.size - _part;
+      complete(false);
+    }
+
+    /**
+     * @brief A part is done, continue the job or finish it and start the next
+     * 
+     * @param dma false if the CPU finished the job, it only counts as error
+     */
+    void complete(const bool dma)
+    {
+      Job& job = _queue[_head];
+
+      _part += _length;
+      if(_part < job.size)
+      {
+        start();
+        return;
+      }
+
+      const DmaCopyCallback done = job.done;
+      void* const arg = job.arg;
+      _head = static_cast<uint8_t>((_head + 1u) % STM_DMA_COPY_QUEUE);
+      _size--;
+      _part = 0u;
+      if(dma)
+      {
+        _dma_copies++;
+      }
+      if(0u != _size)
+      {
+        start();
+      }
+      if(nullptr != done)
+      {
+        done(arg);
+      }
+    }
+
+    static void transferComplete(DMA_HandleTypeDef* hdma)
+    {
+      static_cast<STMDmaCopy*>(hdma->Parent)->complete(true);
+    }
+
+    static void transferError(DMA_HandleTypeDef* hdma)
+    {
+      // FIFO and direct mode errors leave the stream running until its TC,
+      // only a transfer error stops it
+      if(0u == (hdma->ErrorCode & HAL_DMA_ERROR_TE))
+      {
+        return;
+      }
+
+      static_cast<STMDmaCopy*>(hdma->Parent)->finishOnCpu();
+    }
+
+    DMA_HandleTypeDef   _hdma;                        //!< Memory to memory stream
+    uint32_t            _threshold;                   //!< Smallest copy for the DMA
+    Job                 _queue[STM_DMA_COPY_QUEUE];   //!< Jobs, the oldest one runs
+    uint8_t             _head;                        //!< Oldest job
+    volatile uint8_t    _size;                        //!< Jobs queued or running
+    uint32_t            _part;                        //!< Bytes of the oldest job done
+    uint32_t            _length;                      //!< Bytes of the running part
+    uint32_t            _dma_copies;                  //!< Copies done by the DMA
+    uint32_t            _cpu_copies;                  //!< Copies done by memcpy
+    uint32_t            _errors;                      //!< Copies the DMA failed on
+};
+
+}; /* namespace ros */
+
+#endif /* ROS_STM32_DMA_COPY_H_*/
@@ -45,14 +45,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef ROS_STM32_HARDWARE_H_
 #define ROS_STM32_HARDWARE_H_
 
-#ifdef __cplusplus
-extern "C" {
-#endif
-
 /* Includes ----------------------------------------------------------------------*/
 
 #include <stdint.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 #if defined(STM32F4)
   #include "stm32f4xx_hal.h"
   #include "stm32f4xx_hal_uart.h"
@@ -60,35 +60,50 @@ extern "C" {
   #error "Please specify STM hardware type e.g. STM32F3 or STM32F4"
 #endif
 
+#ifdef __cplusplus
+};
+#endif
+
 /* -------------------------------------------------------------------------------*/
 
 namespace ros
 {
 
 /* Hardware Configuration --------------------------------------------------------*/
-constexpr uint16_t  STM_HW_BUF_SIZE = 512u;   //!< Size of tx/rx buffer
+constexpr uint16_t  STM_HW_BUF_SIZE = 512u;   //!< Default size of the tx and rx ring
 constexpr uint32_t  STM_HW_DEF_BAUD = 57600u; //!< Default rosserial baudrate
 
-extern UART_HandleTypeDef huart2; //!< Standard serial interface of nucleo boards
+extern "C" UART_HandleTypeDef huart2; //!< Standard serial interface of nucleo boards
 /* -------------------------------------------------------------------------------*/
 
 /**
  * @brief Class representing STM32 device as rosserial hardware
+ * 
+ * Several nodes on different USARTs each instantiate the template with
+ * their own UART handle, the ring size only costs the RAM of one link.
+ * 
+ * This class has no transport: write() discards its data, so there is no
+ * tx buffer, and nothing feeds the rx ring, it only provides configuration, clocks and the ring reader
+ * for tests and ports. STMHardwareLL_ sends and receives through DMA, the
+ * default ros::NodeHandle uses it.
+ * 
+ * @tparam SERIAL   UART handle of the link
+ * @tparam RX_SIZE  Size of the rx ring, a power of two
  */
-class STMHardware
+template<UART_HandleTypeDef& SERIAL = huart2,
+         uint16_t RX_SIZE = STM_HW_BUF_SIZE>
+class STMHardware_
 {
+  static_assert((RX_SIZE != 0u) && ((RX_SIZE & (RX_SIZE - 1u)) == 0u), "RX_SIZE must be a power of two");
+
   public:
 
     /**
-     * @brief Construct a new STMHardware object
-     * 
-     * @param serial Reference to serial interface
+     * @brief Construct a new STMHardware_ object
      */
-    STMHardware(void) :
-    _serial(huart2),
+    STMHardware_(void) :
+    _serial(SERIAL),
     _baud(STM_HW_DEF_BAUD),
-    _tx_buffer(),
-    _tx_size(0u),
     _rx_buffer(),
     _rx_read_pos(0u),
     _rx_size(0u)
@@ -104,17 +119,39 @@ class STMHardware
       // Set baudrate from serial device
       _baud = _serial.Init.BaudRate;
 
-      // Reset arrays
-      for(uint16_t idx = 0u; idx < STM_HW_BUF_SIZE; idx++)
+      // Reset array
+      for(uint16_t idx = 0u; idx < RX_SIZE; idx++)
       {
-        _tx_buffer[0] = 0u;
-        _rx_buffer[0] = 0u;
+        _rx_buffer[idx] = 0u;
       }
 
       // Reset values
-      _tx_size      = 0;
       _rx_read_pos  = 0;
       _rx_size      = 0;
+
+      // Start cycle counter
+      CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+      DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+
+    /**
+     * @brief Read the DWT cycle counter, clock of ros::CycleProfiler
+     * 
+     * @return uint32_t Core clock cycles since start, wraps around
+     */
+    static uint32_t cycles()
+    {
+      return DWT->CYCCNT;
+    }
+
+    /**
+     * @brief Milliseconds since start from the HAL time base
+     * 
+     * @return unsigned long Current HAL tick, wraps around
+     */
+    unsigned long time()
+    {
+      return HAL_GetTick();
     }
 
     /**
@@ -132,21 +169,25 @@ class STMHardware
       }
 
       // Read data from buffer
-      const int value = _rx_buffer[_rx_read_pos++];
+      const int value = _rx_buffer[_rx_read_pos];
+      _rx_read_pos = static_cast<uint16_t>((_rx_read_pos + 1u) & (RX_SIZE - 1u));
       _rx_size--;
       
       return value;
     }
 
     /**
-     * @brief Write data via serial interface
+     * @brief Write data via serial interface, not bound to the UART
+     * 
+     * Data is discarded, see STMHardwareLL_ for a transport.
      * 
      * @param data Pointer to array containing data
      * @param size Size of data to send
      */
     void write(uint8_t* data, const uint16_t size)
     {
-
+      (void) data;
+      (void) size;
     }
 
 #ifndef BUILD_TESTS
@@ -156,19 +197,17 @@ class STMHardware
     UART_HandleTypeDef&   _serial; //!< Serial interface
     uint32_t              _baud;   //!< Baudrate
 
-    uint8_t     _tx_buffer[STM_HW_BUF_SIZE];  //!< Data to transmit
-    uint16_t    _tx_size;                     //!< Size of data to transmit
-
-    uint8_t     _rx_buffer[STM_HW_BUF_SIZE];  //!< Received data
-    uint16_t    _rx_read_pos;                 //!< Current read position in buffer
-    uint16_t    _rx_size;                     //!< Amount of data in buffer
+    uint8_t     _rx_buffer[RX_SIZE];  //!< Received data, ring
+    uint16_t    _rx_read_pos;         //!< Current read position in ring
+    uint16_t    _rx_size;             //!< Amount of data in ring
 };
 
+/**
+ * @brief Nucleo serial with the default ring size
+ */
+typedef STMHardware_<> STMHardware;
+
 
 }; /* namespace ros */
 
-#ifdef __cplusplus
-};
-#endif
-
 #endif /* ROS_STM32_HARDWARE_H_*/
\ No newline at end of file
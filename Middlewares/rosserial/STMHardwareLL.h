@@ -0,0 +1,411 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file STMHardwareLL.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief STM32 hardware for rosserial driving USART and DMA at register level
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef ROS_STM32_HARDWARE_LL_H_
+#define ROS_STM32_HARDWARE_LL_H_
+
+/* Includes ----------------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <string.h>
+
+#include "STMHardware.h"
+
+/* -------------------------------------------------------------------------------*/
+
+namespace ros
+{
+
+/* Register Helpers --------------------------------------------------------------*/
+namespace ll
+{
+
+constexpr uint32_t DMA_STREAM_FLAGS = 0x3Du;  //!< FEIF, DMEIF, TEIF, HTIF and TCIF of one stream
+
+/**
+ * @brief Controller of a DMA stream, the controllers are 1 kB aligned
+ */
+inline DMA_TypeDef* dmaController(DMA_Stream_TypeDef* stream)
+{
+  return reinterpret_cast<DMA_TypeDef*>(reinterpret_cast<uintptr_t>(stream) & ~static_cast<uintptr_t>(0x3FFu));
+}
+
+/**
+ * @brief Number of a DMA stream within its controller
+ */
+inline uint32_t dmaStreamIndex(DMA_Stream_TypeDef* stream)
+{
+  return static_cast<uint32_t>(((reinterpret_cast<uintptr_t>(stream) & 0x3FFu) - 0x10u) / 0x18u);
+}
+
+/**
+ * @brief Position of the flags of a stream in its (L|H)ISR and (L|H)IFCR
+ */
+inline uint32_t dmaFlagShift(DMA_Stream_TypeDef* stream)
+{
+  static const uint8_t shift[4] = {0u, 6u, 16u, 22u};
+  return shift[dmaStreamIndex(stream) & 3u];
+}
+
+inline void dmaClearFlags(DMA_Stream_TypeDef* stream)
+{
+  DMA_TypeDef* dma = dmaController(stream);
+
+  if(dmaStreamIndex(stream) < 4u)
+  {
+    dma->LIFCR = DMA_STREAM_FLAGS << dmaFlagShift(stream);
+  }
+  else
+  {
+    dma->HIFCR = DMA_STREAM_FLAGS << dmaFlagShift(stream);
+  }
+}
+
+/**
+ * @brief Stream of a DMA controller by its number
+ */
+inline DMA_Stream_TypeDef* dmaStream(DMA_TypeDef* dma, const uint32_t index)
+{
+  return reinterpret_cast<DMA_Stream_TypeDef*>(reinterpret_cast<uintptr_t>(dma) + 0x10u + 0x18u * index);
+}
+
+/**
+ * @brief 32 bit bus address of a register or buffer
+ */
+inline uint32_t busAddress(volatile const void* address)
+{
+  return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(address));
+}
+
+/**
+ * @brief Start a stream which was configured before
+ */
+inline void dmaStart(DMA_Stream_TypeDef* stream, volatile const void* memory, const uint16_t count)
+{
+  dmaClearFlags(stream);
+  stream->M0AR  = busAddress(memory);
+  stream->NDTR  = count;
+  stream->CR   |= DMA_SxCR_EN;
+}
+
+} /* namespace ll */
+/* -------------------------------------------------------------------------------*/
+
+/**
+ * @brief DMA stream binding of a peripheral, see the request mapping of the
+ *        reference manual (e.g. USART2 rx on DMA1 stream 5 channel 4)
+ * 
+ * @tparam CONTROLLER DMA controller, 1 or 2
+ * @tparam STREAM     Stream of the controller, 0 to 7
+ * @tparam CHANNEL    Channel of the peripheral on the stream, 0 to 7
+ */
+template<uint8_t CONTROLLER, uint8_t STREAM, uint8_t CHANNEL>
+struct STMDmaStream
+{
+  static_assert((CONTROLLER == 1u) || (CONTROLLER == 2u), "CONTROLLER must be 1 or 2");
+  static_assert(STREAM < 8u, "STREAM must be 0 to 7");
+  static_assert(CHANNEL < 8u, "CHANNEL must be 0 to 7");
+
+  static constexpr uint32_t channel = static_cast<uint32_t>(CHANNEL) << DMA_SxCR_CHSEL_Pos; //!< CHSEL of the stream
+
+  static DMA_Stream_TypeDef* stream()
+  {
+    return ll::dmaStream((CONTROLLER == 1u) ? DMA1 : DMA2, STREAM);
+  }
+};
+
+/**
+ * @brief STM32 hardware which drives its USART and both DMA streams without
+ *        the HAL UART driver
+ * 
+ * The USART has to be configured by HAL_UART_Init() (baudrate, pins and
+ * clocks), init() then takes over: a circular DMA receives into the rx
+ * buffer and a normal DMA sends the tx ring. The application forwards two
+ * interrupts, the USART interrupt (IDLE) to usartIrq() and the tx stream
+ * interrupt (TC) to txDmaIrq(). Both handlers only touch a few registers
+ * compared to HAL_UART_IRQHandler() and HAL_DMA_IRQHandler().
+ * 
+ * A write() is queued as a whole or refused, so the host never sees a frame
+ * with its tail missing. The ring holds TX_CAPACITY = TX_SIZE - 1 bytes,
+ * NodeHandle_ checks it against its OUTPUT_SIZE at compile time. Streamed
+ * frames may be larger than the ring: NodeHandle_ asks txSpace() before
+ * each piece and fails the piece instead of writing it, the stream is then
+ * retried or aborted by its sender.
+ * 
+ * @tparam SERIAL   UART handle of the link, its instance is driven
+ * @tparam RX_DMA   STMDmaStream receiving from the USART
+ * @tparam TX_DMA   STMDmaStream transmitting to the USART
+ * @tparam TX_SIZE  Size of the tx ring, a power of two
+ * @tparam RX_SIZE  Size of the rx ring, a power of two
+ */
+template<UART_HandleTypeDef& SERIAL = huart2,
+         typename RX_DMA = STMDmaStream<1u, 5u, 4u>,
+         typename TX_DMA = STMDmaStream<1u, 6u, 4u>,
+         uint16_t TX_SIZE = 2u * STM_HW_BUF_SIZE,
+         uint16_t RX_SIZE = STM_HW_BUF_SIZE>
+class STMHardwareLL_
+{
+  static_assert((TX_SIZE != 0u) && ((TX_SIZE & (TX_SIZE - 1u)) == 0u), "TX_SIZE must be a power of two");
+  static_assert((RX_SIZE != 0u) && ((RX_SIZE & (RX_SIZE - 1u)) == 0u), "RX_SIZE must be a power of two");
+
+  public:
+
+    enum { TX_CAPACITY = TX_SIZE - 1u };  //!< Largest write() which is not dropped
+
+    /**
+     * @brief Construct a new STMHardwareLL_ object
+     */
+    STMHardwareLL_(void) :
+    _usart(nullptr),
+    _rx_buffer(),
+    _rx_read_pos(0u),
+    _rx_idle(false),
+    _tx_buffer(),
+    _tx_head(0u),
+    _tx_tail(0u),
+    _tx_busy(0u),
+    _tx_dropped(0u)
+    {
+
+    }
+
+    /**
+     * @brief Start both DMA streams and the IDLE interrupt
+     */
+    void init()
+    {
+      DMA_Stream_TypeDef* rx_stream = RX_DMA::stream();
+      DMA_Stream_TypeDef* tx_stream = TX_DMA::stream();
+
+      _usart        = SERIAL.Instance;
+      _rx_read_pos  = 0u;
+      _rx_idle      = false;
+      _tx_head      = 0u;
+      _tx_tail      = 0u;
+      _tx_busy      = 0u;
+      _tx_dropped   = 0u;
+
+      // Receive stream, circular over the whole buffer
+      rx_stream->CR   = 0u;
+      rx_stream->PAR  = ll::busAddress(&_usart->DR);
+      rx_stream->CR   = RX_DMA::channel | DMA_SxCR_MINC | DMA_SxCR_CIRC;
+      ll::dmaStart(rx_stream, _rx_buffer, RX_SIZE);
+
+      // Transmit stream, started by write() and txDmaIrq()
+      tx_stream->CR   = 0u;
+      tx_stream->PAR  = ll::busAddress(&_usart->DR);
+      tx_stream->CR   = TX_DMA::channel | DMA_SxCR_DIR_0 | DMA_SxCR_MINC | DMA_SxCR_TCIE;
+
+      _usart->CR3 |= USART_CR3_DMAR | USART_CR3_DMAT;
+      _usart->CR1 |= USART_CR1_IDLEIE;
+
+      // Start cycle counter
+      CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+      DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+
+    /**
+     * @brief Read the DWT cycle counter, clock of ros::CycleProfiler
+     */
+    static uint32_t cycles()
+    {
+      return DWT->CYCCNT;
+    }
+
+    /**
+     * @brief Milliseconds since start from the HAL time base
+     */
+    unsigned long time()
+    {
+      return HAL_GetTick();
+    }
+
+    /**
+     * @brief Read next received byte
+     * 
+     * @return int Received byte or -1 if nothing was received
+     */
+    int read()
+    {
+      const uint16_t write_pos = static_cast<uint16_t>((RX_SIZE - RX_DMA::stream()->NDTR) & (RX_SIZE - 1u));
+
+      if(_rx_read_pos == write_pos)
+      {
+        return -1;
+      }
+
+      const int value = _rx_buffer[_rx_read_pos];
+      _rx_read_pos = static_cast<uint16_t>((_rx_read_pos + 1u) & (RX_SIZE - 1u));
+      return value;
+    }
+
+    /**
+     * @brief Free bytes in the tx ring, the largest write() queued now
+     */
+    int txSpace() const
+    {
+      return static_cast<uint16_t>((_tx_tail - _tx_head - 1u) & (TX_SIZE - 1u));
+    }
+
+    /**
+     * @brief Queue data in the tx ring and start the DMA if it is idle
+     * 
+     * @return false if the data does not fit into txSpace(), nothing of it
+     *         is queued then
+     */
+    bool write(uint8_t* data, const int size)
+    {
+      // The interrupt only frees space, it cannot shrink after this check
+      if((size < 0) || (size > txSpace()))
+      {
+        _tx_dropped++;
+        return false;
+      }
+
+      const uint16_t length = static_cast<uint16_t>(size);
+      const uint16_t first = ((TX_SIZE - _tx_head) < length) ? static_cast<uint16_t>(TX_SIZE - _tx_head) : length;
+
+      memcpy(&_tx_buffer[_tx_head], data, first);
+      memcpy(_tx_buffer, &data[first], length - first);
+
+      // The tx interrupt must not see the new head before the check
+      const uint32_t primask = __get_PRIMASK();
+      __disable_irq();
+      _tx_head = static_cast<uint16_t>((_tx_head + length) & (TX_SIZE - 1u));
+      if(0u == _tx_busy)
+      {
+        startTx();
+      }
+      __set_PRIMASK(primask);
+      return true;
+    }
+
+    /**
+     * @brief USART interrupt, an IDLE line ends a received burst
+     */
+    void usartIrq()
+    {
+      if(_usart->SR & USART_SR_IDLE)
+      {
+        // IDLE is cleared by reading SR and then DR
+        (void)_usart->DR;
+        _rx_idle = true;
+      }
+    }
+
+    /**
+     * @brief Transmit stream interrupt, a chunk of the tx ring is out
+     */
+    void txDmaIrq()
+    {
+      ll::dmaClearFlags(TX_DMA::stream());
+      _tx_tail = static_cast<uint16_t>((_tx_tail + _tx_busy) & (TX_SIZE - 1u));
+      _tx_busy = 0u;
+      if(_tx_head != _tx_tail)
+      {
+        startTx();
+      }
+    }
+
+    /**
+     * @brief Whether the line went idle after data since the last call,
+     *        lets the main loop spin only when a burst arrived
+     */
+    bool rxIdle()
+    {
+      const bool idle = _rx_idle;
+      _rx_idle = false;
+      return idle;
+    }
+
+    /**
+     * @brief Writes dropped because they did not fit the tx ring
+     */
+    uint32_t getTxDropped() const
+    {
+      return _tx_dropped;
+    }
+
+#ifndef BUILD_TESTS
+  protected:
+#endif
+
+    /**
+     * @brief Send the queued data up to the end of the ring
+     */
+    void startTx()
+    {
+      const uint16_t head = _tx_head;
+      const uint16_t count = (head >= _tx_tail) ? static_cast<uint16_t>(head - _tx_tail)
+                                                : static_cast<uint16_t>(TX_SIZE - _tx_tail);
+
+      if(0u != count)
+      {
+        _tx_busy = count;
+        ll::dmaStart(TX_DMA::stream(), &_tx_buffer[_tx_tail], count);
+      }
+    }
+
+    USART_TypeDef*        _usart;       //!< USART of the link
+
+    uint8_t               _rx_buffer[RX_SIZE];  //!< Target of the receive DMA
+    uint16_t              _rx_read_pos;                 //!< Next byte to read
+    volatile bool         _rx_idle;                     //!< IDLE seen since the last rxIdle()
+
+    uint8_t               _tx_buffer[TX_SIZE];  //!< Tx ring
+    volatile uint16_t     _tx_head;                     //!< Next byte to queue
+    volatile uint16_t     _tx_tail;                     //!< First byte not sent
+    volatile uint16_t     _tx_busy;                     //!< Bytes in the running DMA
+    uint32_t              _tx_dropped;                  //!< Writes dropped on a full ring
+};
+
+/**
+ * @brief Nucleo serial on USART2 with DMA1 stream 5 and 6, the tx ring holds
+ *        a frame of the default node handle while another one is sent
+ */
+typedef STMHardwareLL_<> STMHardwareLL;
+
+}; /* namespace ros */
+
+#endif /* ROS_STM32_HARDWARE_LL_H_*/
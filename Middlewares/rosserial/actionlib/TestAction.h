@@ -47,6 +47,21 @@ namespace actionlib
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return TestAction::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->action_goal.wireLength(inbuffer, offset, size);
+      offset = this->action_result.wireLength(inbuffer, offset, size);
+      offset = this->action_feedback.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "actionlib/TestAction"; };
     const char * getMD5(){ return "991e87a72802262dfbe5d1b3cf6efc9a"; };
 
@@ -47,6 +47,21 @@ namespace actionlib
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return TestActionFeedback::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = this->status.wireLength(inbuffer, offset, size);
+      offset = this->feedback.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "actionlib/TestActionFeedback"; };
     const char * getMD5(){ return "6d3d0bf7fb3dda24779c010a9f3eb7cb"; };
 
@@ -47,6 +47,21 @@ namespace actionlib
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return TestActionResult::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = this->status.wireLength(inbuffer, offset, size);
+      offset = this->result.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "actionlib/TestActionResult"; };
     const char * getMD5(){ return "3d669e3a63aa986c667ea7b0f46ce85e"; };
 
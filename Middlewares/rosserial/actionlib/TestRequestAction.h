@@ -47,6 +47,21 @@ namespace actionlib
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return TestRequestAction::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->action_goal.wireLength(inbuffer, offset, size);
+      offset = this->action_result.wireLength(inbuffer, offset, size);
+      offset = this->action_feedback.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "actionlib/TestRequestAction"; };
     const char * getMD5(){ return "dc44b1f4045dbf0d1db54423b3b86b30"; };
 
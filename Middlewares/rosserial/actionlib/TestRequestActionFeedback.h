@@ -47,6 +47,21 @@ namespace actionlib
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return TestRequestActionFeedback::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = this->status.wireLength(inbuffer, offset, size);
+      offset = this->feedback.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "actionlib/TestRequestActionFeedback"; };
     const char * getMD5(){ return "aae20e09065c3809e8a8e87c4c8953fd"; };
 
@@ -47,6 +47,21 @@ namespace actionlib
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return TestRequestActionGoal::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = this->goal_id.wireLength(inbuffer, offset, size);
+      offset = this->goal.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "actionlib/TestRequestActionGoal"; };
     const char * getMD5(){ return "1889556d3fef88f821c7cb004e4251f3"; };
 
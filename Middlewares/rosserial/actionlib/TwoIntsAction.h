@@ -47,6 +47,21 @@ namespace actionlib
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return TwoIntsAction::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->action_goal.wireLength(inbuffer, offset, size);
+      offset = this->action_result.wireLength(inbuffer, offset, size);
+      offset = this->action_feedback.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "actionlib/TwoIntsAction"; };
     const char * getMD5(){ return "6d1aa538c4bd6183a2dfb7fcac41ee50"; };
 
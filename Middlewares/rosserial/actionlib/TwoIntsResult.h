@@ -23,44 +23,31 @@ namespace actionlib
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      union {
-        int64_t real;
-        uint64_t base;
-      } u_sum;
-      u_sum.real = this->sum;
-      *(outbuffer + offset + 0) = (u_sum.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_sum.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_sum.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_sum.base >> (8 * 3)) & 0xFF;
-      *(outbuffer + offset + 4) = (u_sum.base >> (8 * 4)) & 0xFF;
-      *(outbuffer + offset + 5) = (u_sum.base >> (8 * 5)) & 0xFF;
-      *(outbuffer + offset + 6) = (u_sum.base >> (8 * 6)) & 0xFF;
-      *(outbuffer + offset + 7) = (u_sum.base >> (8 * 7)) & 0xFF;
-      offset += sizeof(this->sum);
+      offset += encode(outbuffer + offset, this->sum);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      union {
-        int64_t real;
-        uint64_t base;
-      } u_sum;
-      u_sum.base = 0;
-      u_sum.base |= ((uint64_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_sum.base |= ((uint64_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_sum.base |= ((uint64_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_sum.base |= ((uint64_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      u_sum.base |= ((uint64_t) (*(inbuffer + offset + 4))) << (8 * 4);
-      u_sum.base |= ((uint64_t) (*(inbuffer + offset + 5))) << (8 * 5);
-      u_sum.base |= ((uint64_t) (*(inbuffer + offset + 6))) << (8 * 6);
-      u_sum.base |= ((uint64_t) (*(inbuffer + offset + 7))) << (8 * 7);
-      this->sum = u_sum.real;
-      offset += sizeof(this->sum);
+      offset += decode(inbuffer + offset, this->sum);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return TwoIntsResult::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 8);
+      return offset;
+    }
+
     const char * getType(){ return "actionlib/TwoIntsResult"; };
     const char * getMD5(){ return "b88405221c77b1878a3cbbfff53428d7"; };
 
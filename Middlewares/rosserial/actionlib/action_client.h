@@ -0,0 +1,283 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file action_client.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Action client tracking a single goal
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef ROS_ACTION_CLIENT_H_
+#define ROS_ACTION_CLIENT_H_
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdint.h>
+#include <string.h>
+
+#include "ros/node_handle.h"
+#include "actionlib/action_topics.h"
+#include "actionlib_msgs/GoalID.h"
+#include "actionlib_msgs/GoalStatus.h"
+#include "actionlib_msgs/GoalStatusArray.h"
+/* -------------------------------------------------------------------------------*/
+
+namespace actionlib
+{
+
+/**
+ * @brief Action client tracking one goal at a time
+ *
+ * sendGoal() publishes the goal and returns at once, a new goal replaces
+ * the tracked one. The state follows the status list of the server, the
+ * done callback is called with the result and the feedback callback with
+ * every feedback of the tracked goal. Everything happens within spinOnce().
+ *
+ * Goal ids are <ns>-<count>-<sec>.<nsec>, which is unique as long as no
+ * other client of the same action uses the same namespace and time.
+ *
+ * @tparam NodeHandleT  Type of the node handle used for publishing
+ * @tparam ActionT      Generated action message, e.g. actionlib::TestAction
+ */
+template<typename NodeHandleT, typename ActionT>
+class ActionClient
+{
+public:
+  typedef typename ActionT::_action_goal_type ActionGoal;
+  typedef typename ActionT::_action_result_type ActionResult;
+  typedef typename ActionT::_action_feedback_type ActionFeedback;
+  typedef typename ActionGoal::_goal_type Goal;
+  typedef typename ActionResult::_result_type Result;
+  typedef typename ActionFeedback::_feedback_type Feedback;
+  typedef actionlib_msgs::GoalStatus GoalStatus;
+
+  typedef void (*DoneCallbackT)(uint8_t, const Result &);
+  typedef void (*FeedbackCallbackT)(const Feedback &);
+
+  ActionClient(const char *ns, DoneCallbackT done_cb = 0, FeedbackCallbackT feedback_cb = 0) :
+    nh_(0),
+    ns_(ns),
+    status_sub_(topics_.make(ACTION_STATUS, ns), &ActionClient::statusCallback, this),
+    feedback_sub_(topics_.make(ACTION_FEEDBACK, ns), &ActionClient::feedbackCallback, this),
+    result_sub_(topics_.make(ACTION_RESULT, ns), &ActionClient::resultCallback, this),
+    goal_pub_(topics_.make(ACTION_GOAL, ns), &goal_msg_),
+    cancel_pub_(topics_.make(ACTION_CANCEL, ns), &cancel_msg_),
+    done_cb_(done_cb),
+    feedback_cb_(feedback_cb),
+    count_(0),
+    tracking_(false),
+    done_(false),
+    state_(GoalStatus::LOST)
+  {
+    id_[0] = '\0';
+  }
+
+  void init(NodeHandleT &nh)
+  {
+    nh_ = &nh;
+    nh.subscribe(status_sub_);
+    nh.subscribe(feedback_sub_);
+    nh.subscribe(result_sub_);
+    nh.advertise(goal_pub_);
+    nh.advertise(cancel_pub_);
+  }
+
+  /**
+   * @brief Send a goal, it replaces the goal tracked so far
+   *
+   * @return false if the goal could not be published
+   */
+  bool sendGoal(const Goal &goal)
+  {
+    if (!nh_)
+      return false;
+
+    const ros::Time now = nh_->now();
+    makeId(now);
+
+    goal_msg_.header.stamp = now;
+    goal_msg_.goal_id.stamp = now;
+    goal_msg_.goal_id.id = id_;
+    goal_msg_.goal = goal;
+
+    tracking_ = goal_pub_.publish(goal_msg_) > 0;
+    state_ = tracking_ ? (uint8_t) GoalStatus::PENDING : (uint8_t) GoalStatus::LOST;
+    return tracking_;
+  }
+
+  /* Ask the server to cancel the tracked goal */
+  bool cancelGoal()
+  {
+    if (!tracking_ || isDone())
+      return false;
+
+    cancel_msg_.stamp = ros::Time();
+    cancel_msg_.id = id_;
+    return cancel_pub_.publish(cancel_msg_) > 0;
+  }
+
+  /* Status of the tracked goal as reported by the server, LOST if none */
+  uint8_t getState() const
+  {
+    return state_;
+  }
+
+  /* The result of the tracked goal was received */
+  bool isDone() const
+  {
+    return tracking_ && done_;
+  }
+
+  const char *getGoalId() const
+  {
+    return id_;
+  }
+
+private:
+  void makeId(const ros::Time &stamp)
+  {
+    char number[3][11];
+    const uint32_t values[3] = {++count_, stamp.sec, stamp.nsec};
+    size_t length[3];
+    for (int i = 0; i < 3; i++)
+      length[i] = formatUnsigned(number[i], values[i]);
+
+    /* leave room for the separators and numbers, cut the namespace */
+    size_t ns_length = strlen(ns_);
+    const size_t rest = 3 + length[0] + length[1] + length[2];
+    if (ns_length > ACTION_ID_LEN - 1 - rest)
+      ns_length = ACTION_ID_LEN - 1 - rest;
+
+    char *p = id_;
+    memcpy(p, ns_, ns_length);
+    p += ns_length;
+    *p++ = '-';
+    memcpy(p, number[0], length[0]);
+    p += length[0];
+    *p++ = '-';
+    memcpy(p, number[1], length[1]);
+    p += length[1];
+    *p++ = '.';
+    memcpy(p, number[2], length[2]);
+    p[length[2]] = '\0';
+    done_ = false;
+  }
+
+  static size_t formatUnsigned(char *out, uint32_t number)
+  {
+    char digits[10];
+    size_t length = 0;
+    do
+    {
+      digits[length++] = '0' + (number % 10);
+      number /= 10;
+    }
+    while (number > 0);
+
+    for (size_t i = 0; i < length; i++)
+      out[i] = digits[length - 1 - i];
+    return length;
+  }
+
+  bool isTracked(const char *id) const
+  {
+    return tracking_ && (strcmp(id, id_) == 0);
+  }
+
+  void statusCallback(const actionlib_msgs::GoalStatusArray &msg)
+  {
+    if (!tracking_ || done_)
+      return;
+
+    for (uint32_t i = 0; i < msg.status_list_length; i++)
+    {
+      if (isTracked(msg.status_list[i].goal_id.id))
+      {
+        /* terminal states are taken from the result */
+        const uint8_t status = msg.status_list[i].status;
+        if ((status == GoalStatus::PENDING) || (status == GoalStatus::ACTIVE) ||
+            (status == GoalStatus::PREEMPTING) || (status == GoalStatus::RECALLING))
+          state_ = status;
+        return;
+      }
+    }
+  }
+
+  void feedbackCallback(const ActionFeedback &msg)
+  {
+    if (!isTracked(msg.status.goal_id.id) || done_)
+      return;
+
+    state_ = msg.status.status;
+    if (feedback_cb_)
+      feedback_cb_(msg.feedback);
+  }
+
+  void resultCallback(const ActionResult &msg)
+  {
+    if (!isTracked(msg.status.goal_id.id) || done_)
+      return;
+
+    state_ = msg.status.status;
+    done_ = true;
+    if (done_cb_)
+      done_cb_(state_, msg.result);
+  }
+
+  NodeHandleT *nh_;
+  const char *ns_;
+  ActionTopics topics_;
+  ros::Subscriber<actionlib_msgs::GoalStatusArray, ActionClient> status_sub_;
+  ros::Subscriber<ActionFeedback, ActionClient> feedback_sub_;
+  ros::Subscriber<ActionResult, ActionClient> result_sub_;
+  ActionGoal goal_msg_;
+  actionlib_msgs::GoalID cancel_msg_;
+  ros::StaticPublisher<ActionGoal, NodeHandleT> goal_pub_;
+  ros::StaticPublisher<actionlib_msgs::GoalID, NodeHandleT> cancel_pub_;
+
+  DoneCallbackT done_cb_;
+  FeedbackCallbackT feedback_cb_;
+  uint32_t count_;
+  bool tracking_;
+  bool done_;
+  uint8_t state_;
+  char id_[ACTION_ID_LEN];
+};
+
+}
+
+#endif /* ROS_ACTION_CLIENT_H_ */
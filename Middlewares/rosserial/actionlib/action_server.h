@@ -0,0 +1,395 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file action_server.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Action server with fixed goal slots
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef ROS_ACTION_SERVER_H_
+#define ROS_ACTION_SERVER_H_
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdint.h>
+#include <string.h>
+
+#include "ros/node_handle.h"
+#include "actionlib/action_topics.h"
+#include "actionlib_msgs/GoalID.h"
+#include "actionlib_msgs/GoalStatus.h"
+#include "actionlib_msgs/GoalStatusArray.h"
+/* -------------------------------------------------------------------------------*/
+
+namespace actionlib
+{
+
+/**
+ * @brief Action server with a fixed number of goal slots
+ *
+ * Speaks the actionlib protocol on <ns>/goal, cancel, status, feedback and
+ * result. A received goal is handed to the goal callback, which accepts or
+ * rejects it right away and returns. The goal is then worked on from the
+ * main loop, which reports progress with publishFeedback() and ends the
+ * goal with setSucceeded(), setAborted() or setCanceled(). A cancel request
+ * moves the goal to PREEMPTING and calls the cancel callback. Nothing
+ * blocks spinOnce().
+ *
+ * update() publishes the status list periodically and when a status
+ * changed. Finished goals stay in the list for STATUS_KEEP_MS or until
+ * their slot is needed.
+ *
+ * The goal passed to the goal callback points into the receive buffer,
+ * copy what is needed. Texts are not copied and have to stay valid.
+ *
+ * @tparam NodeHandleT  Type of the node handle used for publishing
+ * @tparam ActionT      Generated action message, e.g. actionlib::TestAction
+ * @tparam MAX_GOALS    Number of goal slots
+ */
+template<typename NodeHandleT, typename ActionT, int MAX_GOALS = 2>
+class ActionServer
+{
+public:
+  typedef typename ActionT::_action_goal_type ActionGoal;
+  typedef typename ActionT::_action_result_type ActionResult;
+  typedef typename ActionT::_action_feedback_type ActionFeedback;
+  typedef typename ActionGoal::_goal_type Goal;
+  typedef typename ActionResult::_result_type Result;
+  typedef typename ActionFeedback::_feedback_type Feedback;
+  typedef actionlib_msgs::GoalStatus GoalStatus;
+
+  /* Index of a goal slot */
+  typedef int GoalHandle;
+
+  /* Returns true to accept the goal */
+  typedef bool (*GoalCallbackT)(GoalHandle, const Goal &);
+  typedef void (*CancelCallbackT)(GoalHandle);
+
+  enum { STATUS_KEEP_MS = 5000 };
+
+  ActionServer(const char *ns, GoalCallbackT goal_cb, CancelCallbackT cancel_cb = 0,
+               const uint32_t feedback_period_ms = 100, const uint32_t status_period_ms = 200) :
+    nh_(0),
+    goal_sub_(topics_.make(ACTION_GOAL, ns), &ActionServer::goalCallback, this),
+    cancel_sub_(topics_.make(ACTION_CANCEL, ns), &ActionServer::cancelCallback, this),
+    status_pub_(topics_.make(ACTION_STATUS, ns), &status_msg_),
+    result_pub_(topics_.make(ACTION_RESULT, ns), &result_msg_),
+    feedback_pub_(topics_.make(ACTION_FEEDBACK, ns), &feedback_msg_),
+    goal_cb_(goal_cb),
+    cancel_cb_(cancel_cb),
+    feedback_period_ms_(feedback_period_ms),
+    status_period_ms_(status_period_ms),
+    last_status_ms_(0),
+    status_changed_(true)
+  {
+    for (int i = 0; i < MAX_GOALS; i++)
+      slots_[i].used = false;
+    status_msg_.status_list = status_list_;
+  }
+
+  void init(NodeHandleT &nh)
+  {
+    nh_ = &nh;
+    nh.subscribe(goal_sub_);
+    nh.subscribe(cancel_sub_);
+    nh.advertise(status_pub_);
+    nh.advertise(result_pub_);
+    nh.advertise(feedback_pub_);
+  }
+
+  /**
+   * @brief Publish the status list when due, call from the main loop
+   *
+   * @return Result of publish() if the list was published, else 0
+   */
+  int update()
+  {
+    if (!nh_ || !nh_->connected())
+      return 0;
+
+    const unsigned long now = nh_->getHardware()->time();
+    for (int i = 0; i < MAX_GOALS; i++)
+    {
+      Slot &s = slots_[i];
+      if (s.used && isTerminal(s.status) && ((now - s.finished_ms) >= STATUS_KEEP_MS))
+      {
+        s.used = false;
+        status_changed_ = true;
+      }
+    }
+
+    if (!status_changed_ && ((now - last_status_ms_) < status_period_ms_))
+      return 0;
+
+    int length = 0;
+    for (int i = 0; i < MAX_GOALS; i++)
+    {
+      if (slots_[i].used)
+        fillStatus(slots_[i], status_list_[length++]);
+    }
+    status_msg_.header.stamp = nh_->now();
+    status_msg_.status_list_length = length;
+
+    last_status_ms_ = now;
+    status_changed_ = false;
+    return status_pub_.publish(status_msg_);
+  }
+
+  /**
+   * @brief Publish feedback of an active goal
+   *
+   * @return false if the goal is not active or its last feedback was
+   *         published less than the feedback period ago
+   */
+  bool publishFeedback(const GoalHandle goal, const Feedback &feedback)
+  {
+    if (!isActive(goal))
+      return false;
+
+    Slot &s = slots_[goal];
+    const unsigned long now = nh_->getHardware()->time();
+    if (s.feedback_sent && ((now - s.feedback_ms) < feedback_period_ms_))
+      return false;
+
+    s.feedback_sent = true;
+    s.feedback_ms = now;
+    feedback_msg_.header.stamp = nh_->now();
+    fillStatus(s, feedback_msg_.status);
+    feedback_msg_.feedback = feedback;
+    return feedback_pub_.publish(feedback_msg_) > 0;
+  }
+
+  bool setSucceeded(const GoalHandle goal, const Result &result, const char *text = "")
+  {
+    return finish(goal, GoalStatus::SUCCEEDED, result, text);
+  }
+
+  bool setAborted(const GoalHandle goal, const Result &result, const char *text = "")
+  {
+    return finish(goal, GoalStatus::ABORTED, result, text);
+  }
+
+  bool setCanceled(const GoalHandle goal, const Result &result, const char *text = "")
+  {
+    return finish(goal, GoalStatus::PREEMPTED, result, text);
+  }
+
+  /* Goal is accepted and not finished yet */
+  bool isActive(const GoalHandle goal) const
+  {
+    return (goal >= 0) && (goal < MAX_GOALS) && slots_[goal].used &&
+           ((slots_[goal].status == GoalStatus::ACTIVE) || (slots_[goal].status == GoalStatus::PREEMPTING));
+  }
+
+  bool isCancelRequested(const GoalHandle goal) const
+  {
+    return isActive(goal) && (slots_[goal].status == GoalStatus::PREEMPTING);
+  }
+
+  /* Status of the goal, LOST if the slot is not in use */
+  uint8_t getStatus(const GoalHandle goal) const
+  {
+    if ((goal < 0) || (goal >= MAX_GOALS) || !slots_[goal].used)
+      return GoalStatus::LOST;
+    return slots_[goal].status;
+  }
+
+  const char *getGoalId(const GoalHandle goal) const
+  {
+    return ((goal >= 0) && (goal < MAX_GOALS)) ? slots_[goal].id : "";
+  }
+
+private:
+  struct Slot
+  {
+    bool used;
+    bool feedback_sent;
+    uint8_t status;
+    ros::Time stamp;
+    unsigned long feedback_ms;
+    unsigned long finished_ms;
+    const char *text;
+    char id[ACTION_ID_LEN];
+  };
+
+  static bool isTerminal(const uint8_t status)
+  {
+    return (status != GoalStatus::PENDING) && (status != GoalStatus::ACTIVE) &&
+           (status != GoalStatus::PREEMPTING) && (status != GoalStatus::RECALLING);
+  }
+
+  void fillStatus(const Slot &s, GoalStatus &status) const
+  {
+    status.goal_id.stamp = s.stamp;
+    status.goal_id.id = s.id;
+    status.status = s.status;
+    status.text = s.text;
+  }
+
+  int findGoal(const char *id) const
+  {
+    for (int i = 0; i < MAX_GOALS; i++)
+    {
+      if (slots_[i].used && (strcmp(slots_[i].id, id) == 0))
+        return i;
+    }
+    return -1;
+  }
+
+  /* Free slot, or the one of the goal which finished first */
+  int allocate() const
+  {
+    int oldest = -1;
+    for (int i = 0; i < MAX_GOALS; i++)
+    {
+      const Slot &s = slots_[i];
+      if (!s.used)
+        return i;
+      if (isTerminal(s.status) && ((oldest < 0) || ((long)(s.finished_ms - slots_[oldest].finished_ms) < 0)))
+        oldest = i;
+    }
+    return oldest;
+  }
+
+  bool finish(const GoalHandle goal, const uint8_t status, const Result &result, const char *text)
+  {
+    if (!isActive(goal))
+      return false;
+
+    Slot &s = slots_[goal];
+    s.status = status;
+    s.text = text;
+    s.finished_ms = nh_->getHardware()->time();
+    status_changed_ = true;
+
+    result_msg_.header.stamp = nh_->now();
+    fillStatus(s, result_msg_.status);
+    result_msg_.result = result;
+    result_pub_.publish(result_msg_);
+    return true;
+  }
+
+  void goalCallback(const ActionGoal &msg)
+  {
+    if (findGoal(msg.goal_id.id) >= 0)
+      return;
+
+    const int goal = (strlen(msg.goal_id.id) < ACTION_ID_LEN) ? allocate() : -1;
+    if (goal < 0)
+    {
+      /* answer without a slot, the id is valid during the callback */
+      result_msg_.header.stamp = nh_->now();
+      result_msg_.status.goal_id = msg.goal_id;
+      result_msg_.status.status = GoalStatus::REJECTED;
+      result_msg_.status.text = "No goal slot available";
+      result_msg_.result = Result();
+      result_pub_.publish(result_msg_);
+      return;
+    }
+
+    Slot &s = slots_[goal];
+    s.used = true;
+    s.feedback_sent = false;
+    s.status = GoalStatus::ACTIVE;
+    s.stamp = ((msg.goal_id.stamp.sec == 0) && (msg.goal_id.stamp.nsec == 0)) ? nh_->now() : msg.goal_id.stamp;
+    s.text = "";
+    strcpy(s.id, msg.goal_id.id);
+    status_changed_ = true;
+
+    if (!goal_cb_ || !goal_cb_(goal, msg.goal))
+    {
+      s.status = GoalStatus::REJECTED;
+      s.finished_ms = nh_->getHardware()->time();
+      result_msg_.header.stamp = nh_->now();
+      fillStatus(s, result_msg_.status);
+      result_msg_.result = Result();
+      result_pub_.publish(result_msg_);
+    }
+  }
+
+  /* Empty id and zero stamp cancel everything, a stamp cancels all goals
+   * up to it, an id cancels that goal */
+  void cancelCallback(const actionlib_msgs::GoalID &msg)
+  {
+    const bool all = (msg.id[0] == '\0') && (msg.stamp.sec == 0) && (msg.stamp.nsec == 0);
+    const bool by_stamp = (msg.stamp.sec != 0) || (msg.stamp.nsec != 0);
+
+    for (int i = 0; i < MAX_GOALS; i++)
+    {
+      Slot &s = slots_[i];
+      if (!s.used || (s.status != GoalStatus::ACTIVE))
+        continue;
+
+      const bool match = all || (strcmp(s.id, msg.id) == 0) ||
+                         (by_stamp && ((s.stamp.sec < msg.stamp.sec) ||
+                                       ((s.stamp.sec == msg.stamp.sec) && (s.stamp.nsec <= msg.stamp.nsec))));
+      if (match)
+      {
+        s.status = GoalStatus::PREEMPTING;
+        status_changed_ = true;
+        if (cancel_cb_)
+          cancel_cb_(i);
+      }
+    }
+  }
+
+  NodeHandleT *nh_;
+  ActionTopics topics_;
+  ros::Subscriber<ActionGoal, ActionServer> goal_sub_;
+  ros::Subscriber<actionlib_msgs::GoalID, ActionServer> cancel_sub_;
+  actionlib_msgs::GoalStatusArray status_msg_;
+  ActionResult result_msg_;
+  ActionFeedback feedback_msg_;
+  ros::StaticPublisher<actionlib_msgs::GoalStatusArray, NodeHandleT> status_pub_;
+  ros::StaticPublisher<ActionResult, NodeHandleT> result_pub_;
+  ros::StaticPublisher<ActionFeedback, NodeHandleT> feedback_pub_;
+
+  GoalCallbackT goal_cb_;
+  CancelCallbackT cancel_cb_;
+  uint32_t feedback_period_ms_;
+  uint32_t status_period_ms_;
+  unsigned long last_status_ms_;
+  bool status_changed_;
+
+  Slot slots_[MAX_GOALS];
+  GoalStatus status_list_[MAX_GOALS];
+};
+
+}
+
+#endif /* ROS_ACTION_SERVER_H_ */
@@ -0,0 +1,101 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file action_topics.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Topic names and limits shared by action server and client
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef ROS_ACTION_TOPICS_H_
+#define ROS_ACTION_TOPICS_H_
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdint.h>
+#include <string.h>
+/* -------------------------------------------------------------------------------*/
+
+namespace actionlib
+{
+
+enum
+{
+  ACTION_ID_LEN = 64,     //!< Size of a stored goal id including termination
+  ACTION_TOPIC_LEN = 64   //!< Size of a topic name including termination
+};
+
+enum ActionTopic
+{
+  ACTION_GOAL,
+  ACTION_CANCEL,
+  ACTION_STATUS,
+  ACTION_FEEDBACK,
+  ACTION_RESULT,
+  ACTION_TOPICS
+};
+
+/**
+ * @brief Names of the topics of an action, <ns>/goal etc.
+ *
+ * A namespace too long for ACTION_TOPIC_LEN is cut.
+ */
+class ActionTopics
+{
+public:
+  const char *make(const ActionTopic topic, const char *ns)
+  {
+    static const char *const suffix[ACTION_TOPICS] = {"/goal", "/cancel", "/status", "/feedback", "/result"};
+
+    char *name = names_[topic];
+    const size_t length = strlen(suffix[topic]);
+    size_t ns_length = strlen(ns);
+    if (ns_length > ACTION_TOPIC_LEN - 1 - length)
+      ns_length = ACTION_TOPIC_LEN - 1 - length;
+
+    memcpy(name, ns, ns_length);
+    memcpy(name + ns_length, suffix[topic], length + 1);
+    return name;
+  }
+
+private:
+  char names_[ACTION_TOPICS][ACTION_TOPIC_LEN];
+};
+
+}
+
+#endif /* ROS_ACTION_TOPICS_H_ */
@@ -27,49 +27,35 @@ namespace actionlib_msgs
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->stamp.sec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->stamp.sec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->stamp.sec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->stamp.sec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->stamp.sec);
-      *(outbuffer + offset + 0) = (this->stamp.nsec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->stamp.nsec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->stamp.nsec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->stamp.nsec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->stamp.nsec);
-      uint32_t length_id = strlen(this->id);
-      varToArr(outbuffer + offset, length_id);
-      offset += 4;
-      memcpy(outbuffer + offset, this->id, length_id);
-      offset += length_id;
+      offset += encode(outbuffer + offset, this->stamp.sec);
+      offset += encode(outbuffer + offset, this->stamp.nsec);
+      offset += encodeString(outbuffer + offset, this->id);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      this->stamp.sec =  ((uint32_t) (*(inbuffer + offset)));
-      this->stamp.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->stamp.sec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->stamp.sec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->stamp.sec);
-      this->stamp.nsec =  ((uint32_t) (*(inbuffer + offset)));
-      this->stamp.nsec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->stamp.nsec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->stamp.nsec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->stamp.nsec);
-      uint32_t length_id;
-      arrToVar(length_id, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_id; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_id-1]=0;
-      this->id = (char *)(inbuffer + offset-1);
-      offset += length_id;
+      offset += decode(inbuffer + offset, this->stamp.sec);
+      offset += decode(inbuffer + offset, this->stamp.nsec);
+      offset += decodeString(inbuffer + offset, this->id);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return GoalID::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkip(offset, size, 8);
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "actionlib_msgs/GoalID"; };
     const char * getMD5(){ return "302881f31927c1df708a2dbab0e80ee8"; };
 
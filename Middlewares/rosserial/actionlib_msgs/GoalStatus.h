@@ -41,13 +41,8 @@ namespace actionlib_msgs
     {
       int offset = 0;
       offset += this->goal_id.serialize(outbuffer + offset);
-      *(outbuffer + offset + 0) = (this->status >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->status);
-      uint32_t length_text = strlen(this->text);
-      varToArr(outbuffer + offset, length_text);
-      offset += 4;
-      memcpy(outbuffer + offset, this->text, length_text);
-      offset += length_text;
+      offset += encode(outbuffer + offset, this->status);
+      offset += encodeString(outbuffer + offset, this->text);
       return offset;
     }
 
@@ -55,20 +50,26 @@ namespace actionlib_msgs
     {
       int offset = 0;
       offset += this->goal_id.deserialize(inbuffer + offset);
-      this->status =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->status);
-      uint32_t length_text;
-      arrToVar(length_text, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_text; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_text-1]=0;
-      this->text = (char *)(inbuffer + offset-1);
-      offset += length_text;
+      offset += decode(inbuffer + offset, this->status);
+      offset += decodeString(inbuffer + offset, this->text);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return GoalStatus::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->goal_id.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 1);
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "actionlib_msgs/GoalStatus"; };
     const char * getMD5(){ return "d388f9b87b3c471f784434d671988d4a"; };
 
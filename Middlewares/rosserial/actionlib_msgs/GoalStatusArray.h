@@ -17,13 +17,14 @@ namespace actionlib_msgs
       typedef std_msgs::Header _header_type;
       _header_type header;
       uint32_t status_list_length;
+      uint32_t status_list_capacity;
       typedef actionlib_msgs::GoalStatus _status_list_type;
       _status_list_type st_status_list;
       _status_list_type * status_list;
 
     GoalStatusArray():
       header(),
-      status_list_length(0), status_list(NULL)
+      status_list_length(0), status_list_capacity(0), status_list(NULL)
     {
     }
 
@@ -31,11 +32,7 @@ namespace actionlib_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      *(outbuffer + offset + 0) = (this->status_list_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->status_list_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->status_list_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->status_list_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->status_list_length);
+      offset += encode(outbuffer + offset, this->status_list_length);
       for( uint32_t i = 0; i < status_list_length; i++){
       offset += this->status_list[i].serialize(outbuffer + offset);
       }
@@ -46,21 +43,28 @@ namespace actionlib_msgs
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      uint32_t status_list_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      status_list_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      status_list_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      status_list_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->status_list_length);
-      if(status_list_lengthT > status_list_length)
-        this->status_list = (actionlib_msgs::GoalStatus*)realloc(this->status_list, status_list_lengthT * sizeof(actionlib_msgs::GoalStatus));
-      status_list_length = status_list_lengthT;
-      for( uint32_t i = 0; i < status_list_length; i++){
-      offset += this->st_status_list.deserialize(inbuffer + offset);
-        memcpy( &(this->status_list[i]), &(this->st_status_list), sizeof(actionlib_msgs::GoalStatus));
-      }
+      offset += decodeMsgArray(inbuffer + offset, this->status_list, this->status_list_length, this->status_list_capacity);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return GoalStatusArray::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      uint32_t status_list_lengthT;
+      offset = wireCount(inbuffer, offset, size, status_list_lengthT, 17);
+      for( uint32_t i = 0; (i < status_list_lengthT) && (offset >= 0); i++){
+        offset = this->st_status_list.wireLength(inbuffer, offset, size);
+      }
+      return offset;
+    }
+
     const char * getType(){ return "actionlib_msgs/GoalStatusArray"; };
     const char * getMD5(){ return "8b2b82f13216d0a8ea88bd3af735e619"; };
 
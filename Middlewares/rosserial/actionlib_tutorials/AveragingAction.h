@@ -47,6 +47,21 @@ namespace actionlib_tutorials
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return AveragingAction::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->action_goal.wireLength(inbuffer, offset, size);
+      offset = this->action_result.wireLength(inbuffer, offset, size);
+      offset = this->action_feedback.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "actionlib_tutorials/AveragingAction"; };
     const char * getMD5(){ return "628678f2b4fa6a5951746a4a2d39e716"; };
 
@@ -32,99 +32,37 @@ namespace actionlib_tutorials
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_sample;
-      u_sample.real = this->sample;
-      *(outbuffer + offset + 0) = (u_sample.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_sample.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_sample.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_sample.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->sample);
-      union {
-        float real;
-        uint32_t base;
-      } u_data;
-      u_data.real = this->data;
-      *(outbuffer + offset + 0) = (u_data.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_data.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_data.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_data.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->data);
-      union {
-        float real;
-        uint32_t base;
-      } u_mean;
-      u_mean.real = this->mean;
-      *(outbuffer + offset + 0) = (u_mean.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_mean.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_mean.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_mean.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->mean);
-      union {
-        float real;
-        uint32_t base;
-      } u_std_dev;
-      u_std_dev.real = this->std_dev;
-      *(outbuffer + offset + 0) = (u_std_dev.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_std_dev.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_std_dev.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_std_dev.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->std_dev);
+      offset += encode(outbuffer + offset, this->sample);
+      offset += encode(outbuffer + offset, this->data);
+      offset += encode(outbuffer + offset, this->mean);
+      offset += encode(outbuffer + offset, this->std_dev);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_sample;
-      u_sample.base = 0;
-      u_sample.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_sample.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_sample.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_sample.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->sample = u_sample.real;
-      offset += sizeof(this->sample);
-      union {
-        float real;
-        uint32_t base;
-      } u_data;
-      u_data.base = 0;
-      u_data.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_data.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_data.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_data.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->data = u_data.real;
-      offset += sizeof(this->data);
-      union {
-        float real;
-        uint32_t base;
-      } u_mean;
-      u_mean.base = 0;
-      u_mean.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_mean.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_mean.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_mean.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->mean = u_mean.real;
-      offset += sizeof(this->mean);
-      union {
-        float real;
-        uint32_t base;
-      } u_std_dev;
-      u_std_dev.base = 0;
-      u_std_dev.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_std_dev.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_std_dev.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_std_dev.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->std_dev = u_std_dev.real;
-      offset += sizeof(this->std_dev);
+      offset += decode(inbuffer + offset, this->sample);
+      offset += decode(inbuffer + offset, this->data);
+      offset += decode(inbuffer + offset, this->mean);
+      offset += decode(inbuffer + offset, this->std_dev);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return AveragingFeedback::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 16);
+      return offset;
+    }
+
     const char * getType(){ return "actionlib_tutorials/AveragingFeedback"; };
     const char * getMD5(){ return "9e8dfc53c2f2a032ca33fa80ec46fd4f"; };
 
@@ -26,57 +26,33 @@ namespace actionlib_tutorials
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      union {
-        float real;
-        uint32_t base;
-      } u_mean;
-      u_mean.real = this->mean;
-      *(outbuffer + offset + 0) = (u_mean.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_mean.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_mean.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_mean.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->mean);
-      union {
-        float real;
-        uint32_t base;
-      } u_std_dev;
-      u_std_dev.real = this->std_dev;
-      *(outbuffer + offset + 0) = (u_std_dev.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_std_dev.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_std_dev.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_std_dev.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->std_dev);
+      offset += encode(outbuffer + offset, this->mean);
+      offset += encode(outbuffer + offset, this->std_dev);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      union {
-        float real;
-        uint32_t base;
-      } u_mean;
-      u_mean.base = 0;
-      u_mean.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_mean.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_mean.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_mean.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->mean = u_mean.real;
-      offset += sizeof(this->mean);
-      union {
-        float real;
-        uint32_t base;
-      } u_std_dev;
-      u_std_dev.base = 0;
-      u_std_dev.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_std_dev.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_std_dev.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_std_dev.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->std_dev = u_std_dev.real;
-      offset += sizeof(this->std_dev);
+      offset += decode(inbuffer + offset, this->mean);
+      offset += decode(inbuffer + offset, this->std_dev);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return AveragingResult::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 8);
+      return offset;
+    }
+
     const char * getType(){ return "actionlib_tutorials/AveragingResult"; };
     const char * getMD5(){ return "d5c7decf6df75ffb4367a05c1bcc7612"; };
 
@@ -47,6 +47,21 @@ namespace actionlib_tutorials
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return FibonacciAction::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->action_goal.wireLength(inbuffer, offset, size);
+      offset = this->action_result.wireLength(inbuffer, offset, size);
+      offset = this->action_feedback.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "actionlib_tutorials/FibonacciAction"; };
     const char * getMD5(){ return "f59df5767bf7634684781c92598b2406"; };
 
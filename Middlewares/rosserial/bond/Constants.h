@@ -12,12 +12,12 @@ namespace bond
   class Constants : public ros::Msg
   {
     public:
-      enum { DEAD_PUBLISH_PERIOD =  0.05 };
-      enum { DEFAULT_CONNECT_TIMEOUT =  10.0 };
-      enum { DEFAULT_HEARTBEAT_TIMEOUT =  4.0 };
-      enum { DEFAULT_DISCONNECT_TIMEOUT =  2.0 };
-      enum { DEFAULT_HEARTBEAT_PERIOD =  1.0 };
-      enum { DISABLE_HEARTBEAT_TIMEOUT_PARAM = /bond_disable_heartbeat_timeout };
+      static constexpr float DEAD_PUBLISH_PERIOD =  0.05f;
+      static constexpr float DEFAULT_CONNECT_TIMEOUT =  10.0f;
+      static constexpr float DEFAULT_HEARTBEAT_TIMEOUT =  4.0f;
+      static constexpr float DEFAULT_DISCONNECT_TIMEOUT =  2.0f;
+      static constexpr float DEFAULT_HEARTBEAT_PERIOD =  1.0f;
+      static constexpr const char* DISABLE_HEARTBEAT_TIMEOUT_PARAM = "/bond_disable_heartbeat_timeout";
 
     Constants()
     {
@@ -25,16 +25,32 @@ namespace bond
 
     virtual int serialize(unsigned char *outbuffer) const
     {
+      (void) outbuffer;
       int offset = 0;
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
+      (void) inbuffer;
       int offset = 0;
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return Constants::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      (void) size;
+      return offset;
+    }
+
     const char * getType(){ return "bond/Constants"; };
     const char * getMD5(){ return "6fc594dc1d7bd7919077042712f8c8b0"; };
 
@@ -40,43 +40,11 @@ namespace bond
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      uint32_t length_id = strlen(this->id);
-      varToArr(outbuffer + offset, length_id);
-      offset += 4;
-      memcpy(outbuffer + offset, this->id, length_id);
-      offset += length_id;
-      uint32_t length_instance_id = strlen(this->instance_id);
-      varToArr(outbuffer + offset, length_instance_id);
-      offset += 4;
-      memcpy(outbuffer + offset, this->instance_id, length_instance_id);
-      offset += length_instance_id;
-      union {
-        bool real;
-        uint8_t base;
-      } u_active;
-      u_active.real = this->active;
-      *(outbuffer + offset + 0) = (u_active.base >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->active);
-      union {
-        float real;
-        uint32_t base;
-      } u_heartbeat_timeout;
-      u_heartbeat_timeout.real = this->heartbeat_timeout;
-      *(outbuffer + offset + 0) = (u_heartbeat_timeout.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_heartbeat_timeout.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_heartbeat_timeout.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_heartbeat_timeout.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->heartbeat_timeout);
-      union {
-        float real;
-        uint32_t base;
-      } u_heartbeat_period;
-      u_heartbeat_period.real = this->heartbeat_period;
-      *(outbuffer + offset + 0) = (u_heartbeat_period.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_heartbeat_period.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_heartbeat_period.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_heartbeat_period.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->heartbeat_period);
+      offset += encodeString(outbuffer + offset, this->id);
+      offset += encodeString(outbuffer + offset, this->instance_id);
+      offset += encode(outbuffer + offset, this->active);
+      offset += encode(outbuffer + offset, this->heartbeat_timeout);
+      offset += encode(outbuffer + offset, this->heartbeat_period);
       return offset;
     }
 
@@ -84,57 +52,30 @@ namespace bond
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      uint32_t length_id;
-      arrToVar(length_id, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_id; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_id-1]=0;
-      this->id = (char *)(inbuffer + offset-1);
-      offset += length_id;
-      uint32_t length_instance_id;
-      arrToVar(length_instance_id, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_instance_id; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_instance_id-1]=0;
-      this->instance_id = (char *)(inbuffer + offset-1);
-      offset += length_instance_id;
-      union {
-        bool real;
-        uint8_t base;
-      } u_active;
-      u_active.base = 0;
-      u_active.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      this->active = u_active.real;
-      offset += sizeof(this->active);
-      union {
-        float real;
-        uint32_t base;
-      } u_heartbeat_timeout;
-      u_heartbeat_timeout.base = 0;
-      u_heartbeat_timeout.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_heartbeat_timeout.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_heartbeat_timeout.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_heartbeat_timeout.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->heartbeat_timeout = u_heartbeat_timeout.real;
-      offset += sizeof(this->heartbeat_timeout);
-      union {
-        float real;
-        uint32_t base;
-      } u_heartbeat_period;
-      u_heartbeat_period.base = 0;
-      u_heartbeat_period.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_heartbeat_period.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_heartbeat_period.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_heartbeat_period.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->heartbeat_period = u_heartbeat_period.real;
-      offset += sizeof(this->heartbeat_period);
+      offset += decodeString(inbuffer + offset, this->id);
+      offset += decodeString(inbuffer + offset, this->instance_id);
+      offset += decode(inbuffer + offset, this->active);
+      offset += decode(inbuffer + offset, this->heartbeat_timeout);
+      offset += decode(inbuffer + offset, this->heartbeat_period);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return Status::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 9);
+      return offset;
+    }
+
     const char * getType(){ return "bond/Status"; };
     const char * getMD5(){ return "eacc84bf5d65b6777d4c50f463dfb9c8"; };
 
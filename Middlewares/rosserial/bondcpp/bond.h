@@ -0,0 +1,263 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file bond.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Heartbeat bond with sub-second timeouts
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef ROS_BOND_H_
+#define ROS_BOND_H_
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdint.h>
+
+#include "ros/node_handle.h"
+#include "ros/subscriber.h"
+#include "bond/Constants.h"
+#include "bond/Status.h"
+/* -------------------------------------------------------------------------------*/
+
+namespace bond
+{
+
+/**
+ * @brief Heartbeat bond with a node on the host
+ *
+ * Both sides publish bond/Status on the same topic with the same id and
+ * their own instance id. The bond is formed by the first heartbeat of the
+ * peer and broken when no heartbeat arrived within the heartbeat timeout,
+ * or when the peer announces that it is going down. Unlike bondcpp a
+ * broken bond is formed again by the next heartbeat of the peer, so a
+ * short link loss does not need a restart. The peer may also be a new
+ * instance, e.g. after the host node restarted. A heartbeat is sent right
+ * after every topic negotiation and whenever the bond forms or breaks.
+ *
+ * Heartbeats carry no frame id and a short instance id, so a frame is
+ * 53 bytes plus the id. update() publishes the heartbeats and
+ * calls the callbacks, call it from the main loop. isAlive() only reads
+ * the time of the last heartbeat, so a control interrupt can call it to
+ * stop the motors within one heartbeat timeout, even if the main loop is
+ * stuck.
+ *
+ * @tparam NodeHandleT  Type of the node handle used for publishing
+ */
+template<typename NodeHandleT>
+class Bond : public ros::Subscriber_
+{
+public:
+  typedef void (*CallbackT)();
+
+  /**
+   * @param topic      Topic of the heartbeats, shared with the peer
+   * @param id         Id of the bond, has to match the peer
+   * @param on_broken  Called by update() when the bond breaks
+   * @param on_formed  Called by update() when the bond is formed
+   */
+  Bond(const char *topic, const char *id, CallbackT on_broken = 0, CallbackT on_formed = 0) :
+    nh_(0),
+    publisher_(topic, &status_msg_),
+    on_broken_(on_broken),
+    on_formed_(on_formed),
+    period_ms_((uint32_t)(Constants::DEFAULT_HEARTBEAT_PERIOD * 1000.0f)),
+    timeout_ms_((uint32_t)(Constants::DEFAULT_HEARTBEAT_TIMEOUT * 1000.0f)),
+    last_publish_ms_(0),
+    negotiation_(0),
+    last_receive_ms_(0),
+    peer_(false),
+    formed_(false),
+    active_(true)
+  {
+    topic_ = topic;
+    instance_id_[0] = '\0';
+    status_msg_.id = id;
+    status_msg_.instance_id = instance_id_;
+  }
+
+  /* Period of the own heartbeats in s, may be well below a second */
+  void setHeartbeatPeriod(const float period)
+  {
+    period_ms_ = (uint32_t)(period * 1000.0f);
+  }
+
+  /* Time without heartbeat of the peer after which the bond breaks, in s */
+  void setHeartbeatTimeout(const float timeout)
+  {
+    timeout_ms_ = (uint32_t)(timeout * 1000.0f);
+  }
+
+  void init(NodeHandleT &nh)
+  {
+    nh_ = &nh;
+    nh.subscribe(*this);
+    nh.advertise(publisher_);
+    /* send the first heartbeat with the first update after connecting */
+    negotiation_ = nh.getNegotiationCount();
+
+    /* the start up time tells instances of this firmware apart */
+    static const char hex[] = "0123456789abcdef";
+    uint32_t seed = nh.getHardware()->time() ^ (uint32_t)(uintptr_t) this;
+    for (int i = 0; i < 8; i++, seed >>= 4)
+      instance_id_[i] = hex[seed & 0xf];
+    instance_id_[8] = '\0';
+  }
+
+  /**
+   * @brief Publish the heartbeat when due and check the peer, call from the main loop
+   *
+   * @return Result of publish() if a heartbeat was sent, else 0
+   */
+  int update()
+  {
+    const uint32_t now = nh_->getHardware()->time();
+    const bool alive = isAlive(now);
+
+    if (formed_ != alive)
+    {
+      formed_ = alive;
+      /* answer at once, so the peer forms without waiting a period */
+      last_publish_ms_ = now - period_ms_;
+
+      if (alive && on_formed_)
+        on_formed_();
+      else if (!alive && on_broken_)
+        on_broken_();
+    }
+
+    const uint32_t period = active_ ? period_ms_ : (uint32_t)(Constants::DEAD_PUBLISH_PERIOD * 1000.0f);
+    if (((now - last_publish_ms_) < period) && (negotiation_ == nh_->getNegotiationCount()))
+      return 0;
+
+    last_publish_ms_ = now;
+    negotiation_ = nh_->getNegotiationCount();
+    status_msg_.header.stamp = nh_->now();
+    status_msg_.active = active_;
+    status_msg_.heartbeat_timeout = timeout_ms_ * 0.001f;
+    status_msg_.heartbeat_period = period_ms_ * 0.001f;
+    return publisher_.publish(status_msg_);
+  }
+
+  /* True while the peer sent a heartbeat within the timeout, may be called from an interrupt */
+  bool isAlive(const uint32_t now_ms) const
+  {
+    return peer_ && ((now_ms - last_receive_ms_) <= timeout_ms_);
+  }
+
+  /* State of the bond as of the last update() */
+  bool isBroken() const
+  {
+    return !formed_;
+  }
+
+  /* Announce to the peer that this side goes down, heartbeats are then sent faster */
+  void breakBond()
+  {
+    active_ = false;
+    peer_ = false;
+  }
+
+  /* Take part in the bond again after breakBond() */
+  void start()
+  {
+    active_ = true;
+  }
+
+  const char *getInstanceId() const
+  {
+    return instance_id_;
+  }
+
+  /* Receive a heartbeat, called by the node handle */
+  virtual void callback(unsigned char *data, size_t size)
+  {
+    if (peer_msg_.deserialize(data, size) < 0)
+      return;
+    if ((strcmp(peer_msg_.id, status_msg_.id) != 0) || (strcmp(peer_msg_.instance_id, instance_id_) == 0))
+      return;
+
+    if (!active_ || !peer_msg_.active)
+    {
+      peer_ = false;
+      return;
+    }
+
+    last_receive_ms_ = nh_->getHardware()->time();
+    peer_ = true;
+  }
+
+  virtual const char * getMsgType()
+  {
+    return peer_msg_.getType();
+  }
+
+  virtual const char * getMsgMD5()
+  {
+    return peer_msg_.getMD5();
+  }
+
+  virtual int getEndpointType()
+  {
+    return rosserial_msgs::TopicInfo::ID_SUBSCRIBER;
+  }
+
+private:
+  NodeHandleT *nh_;
+
+  Status status_msg_;
+  Status peer_msg_;
+  ros::StaticPublisher<Status, NodeHandleT> publisher_;
+
+  CallbackT on_broken_;
+  CallbackT on_formed_;
+
+  uint32_t period_ms_;
+  uint32_t timeout_ms_;
+  uint32_t last_publish_ms_;
+  uint32_t negotiation_;
+  volatile uint32_t last_receive_ms_;
+  volatile bool peer_;
+  bool formed_;
+  bool active_;
+
+  char instance_id_[9];
+};
+
+}
+
+#endif /* ROS_BOND_H_ */
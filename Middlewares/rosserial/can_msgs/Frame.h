@@ -42,37 +42,13 @@ namespace can_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      *(outbuffer + offset + 0) = (this->id >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->id >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->id >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->id >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->id);
-      union {
-        bool real;
-        uint8_t base;
-      } u_is_rtr;
-      u_is_rtr.real = this->is_rtr;
-      *(outbuffer + offset + 0) = (u_is_rtr.base >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->is_rtr);
-      union {
-        bool real;
-        uint8_t base;
-      } u_is_extended;
-      u_is_extended.real = this->is_extended;
-      *(outbuffer + offset + 0) = (u_is_extended.base >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->is_extended);
-      union {
-        bool real;
-        uint8_t base;
-      } u_is_error;
-      u_is_error.real = this->is_error;
-      *(outbuffer + offset + 0) = (u_is_error.base >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->is_error);
-      *(outbuffer + offset + 0) = (this->dlc >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->dlc);
+      offset += encode(outbuffer + offset, this->id);
+      offset += encode(outbuffer + offset, this->is_rtr);
+      offset += encode(outbuffer + offset, this->is_extended);
+      offset += encode(outbuffer + offset, this->is_error);
+      offset += encode(outbuffer + offset, this->dlc);
       for( uint32_t i = 0; i < 8; i++){
-      *(outbuffer + offset + 0) = (this->data[i] >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->data[i]);
+      offset += encode(outbuffer + offset, this->data[i]);
       }
       return offset;
     }
@@ -81,44 +57,31 @@ namespace can_msgs
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      this->id =  ((uint32_t) (*(inbuffer + offset)));
-      this->id |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->id |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->id |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->id);
-      union {
-        bool real;
-        uint8_t base;
-      } u_is_rtr;
-      u_is_rtr.base = 0;
-      u_is_rtr.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      this->is_rtr = u_is_rtr.real;
-      offset += sizeof(this->is_rtr);
-      union {
-        bool real;
-        uint8_t base;
-      } u_is_extended;
-      u_is_extended.base = 0;
-      u_is_extended.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      this->is_extended = u_is_extended.real;
-      offset += sizeof(this->is_extended);
-      union {
-        bool real;
-        uint8_t base;
-      } u_is_error;
-      u_is_error.base = 0;
-      u_is_error.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      this->is_error = u_is_error.real;
-      offset += sizeof(this->is_error);
-      this->dlc =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->dlc);
+      offset += decode(inbuffer + offset, this->id);
+      offset += decode(inbuffer + offset, this->is_rtr);
+      offset += decode(inbuffer + offset, this->is_extended);
+      offset += decode(inbuffer + offset, this->is_error);
+      offset += decode(inbuffer + offset, this->dlc);
       for( uint32_t i = 0; i < 8; i++){
-      this->data[i] =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->data[i]);
+      offset += decode(inbuffer + offset, this->data[i]);
       }
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return Frame::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 16);
+      return offset;
+    }
+
     const char * getType(){ return "can_msgs/Frame"; };
     const char * getMD5(){ return "64ae5cebf967dc6aae4e78f5683a5b25"; };
 
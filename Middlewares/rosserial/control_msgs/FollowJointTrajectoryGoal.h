@@ -18,10 +18,12 @@ namespace control_msgs
       typedef trajectory_msgs::JointTrajectory _trajectory_type;
       _trajectory_type trajectory;
       uint32_t path_tolerance_length;
+      uint32_t path_tolerance_capacity;
       typedef control_msgs::JointTolerance _path_tolerance_type;
       _path_tolerance_type st_path_tolerance;
       _path_tolerance_type * path_tolerance;
       uint32_t goal_tolerance_length;
+      uint32_t goal_tolerance_capacity;
       typedef control_msgs::JointTolerance _goal_tolerance_type;
       _goal_tolerance_type st_goal_tolerance;
       _goal_tolerance_type * goal_tolerance;
@@ -30,8 +32,8 @@ namespace control_msgs
 
     FollowJointTrajectoryGoal():
       trajectory(),
-      path_tolerance_length(0), path_tolerance(NULL),
-      goal_tolerance_length(0), goal_tolerance(NULL),
+      path_tolerance_length(0), path_tolerance_capacity(0), path_tolerance(NULL),
+      goal_tolerance_length(0), goal_tolerance_capacity(0), goal_tolerance(NULL),
       goal_time_tolerance()
     {
     }
@@ -40,32 +42,16 @@ namespace control_msgs
     {
       int offset = 0;
       offset += this->trajectory.serialize(outbuffer + offset);
-      *(outbuffer + offset + 0) = (this->path_tolerance_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->path_tolerance_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->path_tolerance_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->path_tolerance_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->path_tolerance_length);
+      offset += encode(outbuffer + offset, this->path_tolerance_length);
       for( uint32_t i = 0; i < path_tolerance_length; i++){
       offset += this->path_tolerance[i].serialize(outbuffer + offset);
       }
-      *(outbuffer + offset + 0) = (this->goal_tolerance_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->goal_tolerance_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->goal_tolerance_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->goal_tolerance_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->goal_tolerance_length);
+      offset += encode(outbuffer + offset, this->goal_tolerance_length);
       for( uint32_t i = 0; i < goal_tolerance_length; i++){
       offset += this->goal_tolerance[i].serialize(outbuffer + offset);
       }
-      *(outbuffer + offset + 0) = (this->goal_time_tolerance.sec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->goal_time_tolerance.sec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->goal_time_tolerance.sec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->goal_time_tolerance.sec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->goal_time_tolerance.sec);
-      *(outbuffer + offset + 0) = (this->goal_time_tolerance.nsec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->goal_time_tolerance.nsec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->goal_time_tolerance.nsec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->goal_time_tolerance.nsec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->goal_time_tolerance.nsec);
+      offset += encode(outbuffer + offset, this->goal_time_tolerance.sec);
+      offset += encode(outbuffer + offset, this->goal_time_tolerance.nsec);
       return offset;
     }
 
@@ -73,41 +59,35 @@ namespace control_msgs
     {
       int offset = 0;
       offset += this->trajectory.deserialize(inbuffer + offset);
-      uint32_t path_tolerance_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      path_tolerance_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      path_tolerance_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      path_tolerance_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->path_tolerance_length);
-      if(path_tolerance_lengthT > path_tolerance_length)
-        this->path_tolerance = (control_msgs::JointTolerance*)realloc(this->path_tolerance, path_tolerance_lengthT * sizeof(control_msgs::JointTolerance));
-      path_tolerance_length = path_tolerance_lengthT;
-      for( uint32_t i = 0; i < path_tolerance_length; i++){
-      offset += this->st_path_tolerance.deserialize(inbuffer + offset);
-        memcpy( &(this->path_tolerance[i]), &(this->st_path_tolerance), sizeof(control_msgs::JointTolerance));
+      offset += decodeMsgArray(inbuffer + offset, this->path_tolerance, this->path_tolerance_length, this->path_tolerance_capacity);
+      offset += decodeMsgArray(inbuffer + offset, this->goal_tolerance, this->goal_tolerance_length, this->goal_tolerance_capacity);
+      offset += decode(inbuffer + offset, this->goal_time_tolerance.sec);
+      offset += decode(inbuffer + offset, this->goal_time_tolerance.nsec);
+     return offset;
+    }
+
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return FollowJointTrajectoryGoal::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->trajectory.wireLength(inbuffer, offset, size);
+      uint32_t path_tolerance_lengthT;
+      offset = wireCount(inbuffer, offset, size, path_tolerance_lengthT, 28);
+      for( uint32_t i = 0; (i < path_tolerance_lengthT) && (offset >= 0); i++){
+        offset = this->st_path_tolerance.wireLength(inbuffer, offset, size);
       }
-      uint32_t goal_tolerance_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      goal_tolerance_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      goal_tolerance_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      goal_tolerance_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->goal_tolerance_length);
-      if(goal_tolerance_lengthT > goal_tolerance_length)
-        this->goal_tolerance = (control_msgs::JointTolerance*)realloc(this->goal_tolerance, goal_tolerance_lengthT * sizeof(control_msgs::JointTolerance));
-      goal_tolerance_length = goal_tolerance_lengthT;
-      for( uint32_t i = 0; i < goal_tolerance_length; i++){
-      offset += this->st_goal_tolerance.deserialize(inbuffer + offset);
-        memcpy( &(this->goal_tolerance[i]), &(this->st_goal_tolerance), sizeof(control_msgs::JointTolerance));
+      uint32_t goal_tolerance_lengthT;
+      offset = wireCount(inbuffer, offset, size, goal_tolerance_lengthT, 28);
+      for( uint32_t i = 0; (i < goal_tolerance_lengthT) && (offset >= 0); i++){
+        offset = this->st_goal_tolerance.wireLength(inbuffer, offset, size);
       }
-      this->goal_time_tolerance.sec =  ((uint32_t) (*(inbuffer + offset)));
-      this->goal_time_tolerance.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->goal_time_tolerance.sec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->goal_time_tolerance.sec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->goal_time_tolerance.sec);
-      this->goal_time_tolerance.nsec =  ((uint32_t) (*(inbuffer + offset)));
-      this->goal_time_tolerance.nsec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->goal_time_tolerance.nsec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->goal_time_tolerance.nsec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->goal_time_tolerance.nsec);
-     return offset;
+      offset = wireSkip(offset, size, 8);
+      return offset;
     }
 
     const char * getType(){ return "control_msgs/FollowJointTrajectoryGoal"; };
@@ -39,6 +39,20 @@ namespace control_msgs
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return GripperCommand::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 16);
+      return offset;
+    }
+
     const char * getType(){ return "control_msgs/GripperCommand"; };
     const char * getMD5(){ return "680acaff79486f017132a7f198d40f08"; };
 
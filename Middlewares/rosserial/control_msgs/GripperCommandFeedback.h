@@ -34,20 +34,8 @@ namespace control_msgs
       int offset = 0;
       offset += serializeAvrFloat64(outbuffer + offset, this->position);
       offset += serializeAvrFloat64(outbuffer + offset, this->effort);
-      union {
-        bool real;
-        uint8_t base;
-      } u_stalled;
-      u_stalled.real = this->stalled;
-      *(outbuffer + offset + 0) = (u_stalled.base >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->stalled);
-      union {
-        bool real;
-        uint8_t base;
-      } u_reached_goal;
-      u_reached_goal.real = this->reached_goal;
-      *(outbuffer + offset + 0) = (u_reached_goal.base >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->reached_goal);
+      offset += encode(outbuffer + offset, this->stalled);
+      offset += encode(outbuffer + offset, this->reached_goal);
       return offset;
     }
 
@@ -56,25 +44,25 @@ namespace control_msgs
       int offset = 0;
       offset += deserializeAvrFloat64(inbuffer + offset, &(this->position));
       offset += deserializeAvrFloat64(inbuffer + offset, &(this->effort));
-      union {
-        bool real;
-        uint8_t base;
-      } u_stalled;
-      u_stalled.base = 0;
-      u_stalled.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      this->stalled = u_stalled.real;
-      offset += sizeof(this->stalled);
-      union {
-        bool real;
-        uint8_t base;
-      } u_reached_goal;
-      u_reached_goal.base = 0;
-      u_reached_goal.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      this->reached_goal = u_reached_goal.real;
-      offset += sizeof(this->reached_goal);
+      offset += decode(inbuffer + offset, this->stalled);
+      offset += decode(inbuffer + offset, this->reached_goal);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return GripperCommandFeedback::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 18);
+      return offset;
+    }
+
     const char * getType(){ return "control_msgs/GripperCommandFeedback"; };
     const char * getMD5(){ return "e4cbff56d3562bcf113da5a5adeef91f"; };
 
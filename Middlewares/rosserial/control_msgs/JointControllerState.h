@@ -68,13 +68,7 @@ namespace control_msgs
       offset += serializeAvrFloat64(outbuffer + offset, this->i);
       offset += serializeAvrFloat64(outbuffer + offset, this->d);
       offset += serializeAvrFloat64(outbuffer + offset, this->i_clamp);
-      union {
-        bool real;
-        uint8_t base;
-      } u_antiwindup;
-      u_antiwindup.real = this->antiwindup;
-      *(outbuffer + offset + 0) = (u_antiwindup.base >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->antiwindup);
+      offset += encode(outbuffer + offset, this->antiwindup);
       return offset;
     }
 
@@ -92,17 +86,24 @@ namespace control_msgs
       offset += deserializeAvrFloat64(inbuffer + offset, &(this->i));
       offset += deserializeAvrFloat64(inbuffer + offset, &(this->d));
       offset += deserializeAvrFloat64(inbuffer + offset, &(this->i_clamp));
-      union {
-        bool real;
-        uint8_t base;
-      } u_antiwindup;
-      u_antiwindup.base = 0;
-      u_antiwindup.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      this->antiwindup = u_antiwindup.real;
-      offset += sizeof(this->antiwindup);
+      offset += decode(inbuffer + offset, this->antiwindup);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return JointControllerState::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 81);
+      return offset;
+    }
+
     const char * getType(){ return "control_msgs/JointControllerState"; };
     const char * getMD5(){ return "987ad85e4756f3aef7f1e5e7fe0595d1"; };
 
@@ -32,11 +32,7 @@ namespace control_msgs
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_name = strlen(this->name);
-      varToArr(outbuffer + offset, length_name);
-      offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
-      offset += length_name;
+      offset += encodeString(outbuffer + offset, this->name);
       offset += serializeAvrFloat64(outbuffer + offset, this->position);
       offset += serializeAvrFloat64(outbuffer + offset, this->velocity);
       offset += serializeAvrFloat64(outbuffer + offset, this->acceleration);
@@ -46,21 +42,27 @@ namespace control_msgs
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_name;
-      arrToVar(length_name, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
-      offset += length_name;
+      offset += decodeString(inbuffer + offset, this->name);
       offset += deserializeAvrFloat64(inbuffer + offset, &(this->position));
       offset += deserializeAvrFloat64(inbuffer + offset, &(this->velocity));
       offset += deserializeAvrFloat64(inbuffer + offset, &(this->acceleration));
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return JointTolerance::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 24);
+      return offset;
+    }
+
     const char * getType(){ return "control_msgs/JointTolerance"; };
     const char * getMD5(){ return "f544fe9c16cf04547e135dd6063ff5be"; };
 
@@ -40,18 +40,7 @@ namespace control_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      *(outbuffer + offset + 0) = (this->joint_names_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->joint_names_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->joint_names_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->joint_names_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->joint_names_length);
-      for( uint32_t i = 0; i < joint_names_length; i++){
-      uint32_t length_joint_namesi = strlen(this->joint_names[i]);
-      varToArr(outbuffer + offset, length_joint_namesi);
-      offset += 4;
-      memcpy(outbuffer + offset, this->joint_names[i], length_joint_namesi);
-      offset += length_joint_namesi;
-      }
+      offset += encodeStringArray(outbuffer + offset, this->joint_names, this->joint_names_length);
       offset += this->desired.serialize(outbuffer + offset);
       offset += this->actual.serialize(outbuffer + offset);
       offset += this->error.serialize(outbuffer + offset);
@@ -62,32 +51,30 @@ namespace control_msgs
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      uint32_t joint_names_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      joint_names_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      joint_names_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      joint_names_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->joint_names_length);
-      if(joint_names_lengthT > joint_names_length)
-        this->joint_names = (char**)realloc(this->joint_names, joint_names_lengthT * sizeof(char*));
-      joint_names_length = joint_names_lengthT;
-      for( uint32_t i = 0; i < joint_names_length; i++){
-      uint32_t length_st_joint_names;
-      arrToVar(length_st_joint_names, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_joint_names; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_joint_names-1]=0;
-      this->st_joint_names = (char *)(inbuffer + offset-1);
-      offset += length_st_joint_names;
-        memcpy( &(this->joint_names[i]), &(this->st_joint_names), sizeof(char*));
-      }
+      offset += decodeStringArray(inbuffer + offset, this->joint_names, this->joint_names_length);
       offset += this->desired.deserialize(inbuffer + offset);
       offset += this->actual.deserialize(inbuffer + offset);
       offset += this->error.deserialize(inbuffer + offset);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return JointTrajectoryControllerState::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = wireSkipStringArray(inbuffer, offset, size);
+      offset = this->desired.wireLength(inbuffer, offset, size);
+      offset = this->actual.wireLength(inbuffer, offset, size);
+      offset = this->error.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "control_msgs/JointTrajectoryControllerState"; };
     const char * getMD5(){ return "10817c60c2486ef6b33e97dcd87f4474"; };
 
@@ -19,16 +19,32 @@ namespace control_msgs
 
     virtual int serialize(unsigned char *outbuffer) const
     {
+      (void) outbuffer;
       int offset = 0;
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
+      (void) inbuffer;
       int offset = 0;
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return JointTrajectoryFeedback::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      (void) size;
+      return offset;
+    }
+
     const char * getType(){ return "control_msgs/JointTrajectoryFeedback"; };
     const char * getMD5(){ return "d41d8cd98f00b204e9800998ecf8427e"; };
 
@@ -62,16 +62,8 @@ namespace control_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      *(outbuffer + offset + 0) = (this->timestep.sec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->timestep.sec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->timestep.sec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->timestep.sec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->timestep.sec);
-      *(outbuffer + offset + 0) = (this->timestep.nsec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->timestep.nsec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->timestep.nsec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->timestep.nsec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->timestep.nsec);
+      offset += encode(outbuffer + offset, this->timestep.sec);
+      offset += encode(outbuffer + offset, this->timestep.nsec);
       offset += serializeAvrFloat64(outbuffer + offset, this->error);
       offset += serializeAvrFloat64(outbuffer + offset, this->error_dot);
       offset += serializeAvrFloat64(outbuffer + offset, this->p_error);
@@ -90,16 +82,8 @@ namespace control_msgs
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      this->timestep.sec =  ((uint32_t) (*(inbuffer + offset)));
-      this->timestep.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->timestep.sec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->timestep.sec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->timestep.sec);
-      this->timestep.nsec =  ((uint32_t) (*(inbuffer + offset)));
-      this->timestep.nsec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->timestep.nsec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->timestep.nsec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->timestep.nsec);
+      offset += decode(inbuffer + offset, this->timestep.sec);
+      offset += decode(inbuffer + offset, this->timestep.nsec);
       offset += deserializeAvrFloat64(inbuffer + offset, &(this->error));
       offset += deserializeAvrFloat64(inbuffer + offset, &(this->error_dot));
       offset += deserializeAvrFloat64(inbuffer + offset, &(this->p_error));
@@ -114,6 +98,20 @@ namespace control_msgs
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return PidState::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 96);
+      return offset;
+    }
+
     const char * getType(){ return "control_msgs/PidState"; };
     const char * getMD5(){ return "b138ec00e886c10e73f27e8712252ea6"; };
 
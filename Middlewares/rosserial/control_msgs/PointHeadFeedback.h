@@ -34,6 +34,20 @@ namespace control_msgs
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return PointHeadFeedback::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 8);
+      return offset;
+    }
+
     const char * getType(){ return "control_msgs/PointHeadFeedback"; };
     const char * getMD5(){ return "cce80d27fd763682da8805a73316cab4"; };
 
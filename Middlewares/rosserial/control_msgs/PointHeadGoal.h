@@ -40,21 +40,9 @@ namespace control_msgs
       int offset = 0;
       offset += this->target.serialize(outbuffer + offset);
       offset += this->pointing_axis.serialize(outbuffer + offset);
-      uint32_t length_pointing_frame = strlen(this->pointing_frame);
-      varToArr(outbuffer + offset, length_pointing_frame);
-      offset += 4;
-      memcpy(outbuffer + offset, this->pointing_frame, length_pointing_frame);
-      offset += length_pointing_frame;
-      *(outbuffer + offset + 0) = (this->min_duration.sec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->min_duration.sec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->min_duration.sec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->min_duration.sec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->min_duration.sec);
-      *(outbuffer + offset + 0) = (this->min_duration.nsec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->min_duration.nsec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->min_duration.nsec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->min_duration.nsec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->min_duration.nsec);
+      offset += encodeString(outbuffer + offset, this->pointing_frame);
+      offset += encode(outbuffer + offset, this->min_duration.sec);
+      offset += encode(outbuffer + offset, this->min_duration.nsec);
       offset += serializeAvrFloat64(outbuffer + offset, this->max_velocity);
       return offset;
     }
@@ -64,29 +52,29 @@ namespace control_msgs
       int offset = 0;
       offset += this->target.deserialize(inbuffer + offset);
       offset += this->pointing_axis.deserialize(inbuffer + offset);
-      uint32_t length_pointing_frame;
-      arrToVar(length_pointing_frame, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_pointing_frame; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_pointing_frame-1]=0;
-      this->pointing_frame = (char *)(inbuffer + offset-1);
-      offset += length_pointing_frame;
-      this->min_duration.sec =  ((uint32_t) (*(inbuffer + offset)));
-      this->min_duration.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->min_duration.sec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->min_duration.sec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->min_duration.sec);
-      this->min_duration.nsec =  ((uint32_t) (*(inbuffer + offset)));
-      this->min_duration.nsec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->min_duration.nsec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->min_duration.nsec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->min_duration.nsec);
+      offset += decodeString(inbuffer + offset, this->pointing_frame);
+      offset += decode(inbuffer + offset, this->min_duration.sec);
+      offset += decode(inbuffer + offset, this->min_duration.nsec);
       offset += deserializeAvrFloat64(inbuffer + offset, &(this->max_velocity));
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return PointHeadGoal::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->target.wireLength(inbuffer, offset, size);
+      offset = this->pointing_axis.wireLength(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 16);
+      return offset;
+    }
+
     const char * getType(){ return "control_msgs/PointHeadGoal"; };
     const char * getMD5(){ return "8b92b1cd5e06c8a94c917dc3209a4c1d"; };
 
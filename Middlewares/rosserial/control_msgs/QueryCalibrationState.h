@@ -20,16 +20,32 @@ static const char QUERYCALIBRATIONSTATE[] = "control_msgs/QueryCalibrationState"
 
     virtual int serialize(unsigned char *outbuffer) const
     {
+      (void) outbuffer;
       int offset = 0;
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
+      (void) inbuffer;
       int offset = 0;
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return QueryCalibrationStateRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      (void) size;
+      return offset;
+    }
+
     const char * getType(){ return QUERYCALIBRATIONSTATE; };
     const char * getMD5(){ return "d41d8cd98f00b204e9800998ecf8427e"; };
 
@@ -49,30 +65,31 @@ static const char QUERYCALIBRATIONSTATE[] = "control_msgs/QueryCalibrationState"
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      union {
-        bool real;
-        uint8_t base;
-      } u_is_calibrated;
-      u_is_calibrated.real = this->is_calibrated;
-      *(outbuffer + offset + 0) = (u_is_calibrated.base >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->is_calibrated);
+      offset += encode(outbuffer + offset, this->is_calibrated);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      union {
-        bool real;
-        uint8_t base;
-      } u_is_calibrated;
-      u_is_calibrated.base = 0;
-      u_is_calibrated.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      this->is_calibrated = u_is_calibrated.real;
-      offset += sizeof(this->is_calibrated);
+      offset += decode(inbuffer + offset, this->is_calibrated);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return QueryCalibrationStateResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 1);
+      return offset;
+    }
+
     const char * getType(){ return QUERYCALIBRATIONSTATE; };
     const char * getMD5(){ return "28af3beedcb84986b8e470dc5470507d"; };
 
@@ -25,35 +25,33 @@ static const char QUERYTRAJECTORYSTATE[] = "control_msgs/QueryTrajectoryState";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->time.sec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->time.sec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->time.sec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->time.sec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->time.sec);
-      *(outbuffer + offset + 0) = (this->time.nsec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->time.nsec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->time.nsec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->time.nsec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->time.nsec);
+      offset += encode(outbuffer + offset, this->time.sec);
+      offset += encode(outbuffer + offset, this->time.nsec);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      this->time.sec =  ((uint32_t) (*(inbuffer + offset)));
-      this->time.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->time.sec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->time.sec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->time.sec);
-      this->time.nsec =  ((uint32_t) (*(inbuffer + offset)));
-      this->time.nsec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->time.nsec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->time.nsec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->time.nsec);
+      offset += decode(inbuffer + offset, this->time.sec);
+      offset += decode(inbuffer + offset, this->time.nsec);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return QueryTrajectoryStateRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 8);
+      return offset;
+    }
+
     const char * getType(){ return QUERYTRAJECTORYSTATE; };
     const char * getMD5(){ return "556a4fb76023a469987922359d08a844"; };
 
@@ -90,107 +88,39 @@ static const char QUERYTRAJECTORYSTATE[] = "control_msgs/QueryTrajectoryState";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->name_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->name_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->name_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->name_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->name_length);
-      for( uint32_t i = 0; i < name_length; i++){
-      uint32_t length_namei = strlen(this->name[i]);
-      varToArr(outbuffer + offset, length_namei);
-      offset += 4;
-      memcpy(outbuffer + offset, this->name[i], length_namei);
-      offset += length_namei;
-      }
-      *(outbuffer + offset + 0) = (this->position_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->position_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->position_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->position_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->position_length);
-      for( uint32_t i = 0; i < position_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->position[i]);
-      }
-      *(outbuffer + offset + 0) = (this->velocity_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->velocity_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->velocity_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->velocity_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->velocity_length);
-      for( uint32_t i = 0; i < velocity_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->velocity[i]);
-      }
-      *(outbuffer + offset + 0) = (this->acceleration_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->acceleration_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->acceleration_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->acceleration_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->acceleration_length);
-      for( uint32_t i = 0; i < acceleration_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->acceleration[i]);
-      }
+      offset += encodeStringArray(outbuffer + offset, this->name, this->name_length);
+      offset += encodeFloat64Array(outbuffer + offset, this->position, this->position_length);
+      offset += encodeFloat64Array(outbuffer + offset, this->velocity, this->velocity_length);
+      offset += encodeFloat64Array(outbuffer + offset, this->acceleration, this->acceleration_length);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t name_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      name_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      name_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      name_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->name_length);
-      if(name_lengthT > name_length)
-        this->name = (char**)realloc(this->name, name_lengthT * sizeof(char*));
-      name_length = name_lengthT;
-      for( uint32_t i = 0; i < name_length; i++){
-      uint32_t length_st_name;
-      arrToVar(length_st_name, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_name-1]=0;
-      this->st_name = (char *)(inbuffer + offset-1);
-      offset += length_st_name;
-        memcpy( &(this->name[i]), &(this->st_name), sizeof(char*));
-      }
-      uint32_t position_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      position_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      position_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      position_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->position_length);
-      if(position_lengthT > position_length)
-        this->position = (float*)realloc(this->position, position_lengthT * sizeof(float));
-      position_length = position_lengthT;
-      for( uint32_t i = 0; i < position_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_position));
-        memcpy( &(this->position[i]), &(this->st_position), sizeof(float));
-      }
-      uint32_t velocity_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      velocity_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      velocity_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      velocity_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->velocity_length);
-      if(velocity_lengthT > velocity_length)
-        this->velocity = (float*)realloc(this->velocity, velocity_lengthT * sizeof(float));
-      velocity_length = velocity_lengthT;
-      for( uint32_t i = 0; i < velocity_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_velocity));
-        memcpy( &(this->velocity[i]), &(this->st_velocity), sizeof(float));
-      }
-      uint32_t acceleration_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      acceleration_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      acceleration_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      acceleration_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->acceleration_length);
-      if(acceleration_lengthT > acceleration_length)
-        this->acceleration = (float*)realloc(this->acceleration, acceleration_lengthT * sizeof(float));
-      acceleration_length = acceleration_lengthT;
-      for( uint32_t i = 0; i < acceleration_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_acceleration));
-        memcpy( &(this->acceleration[i]), &(this->st_acceleration), sizeof(float));
-      }
+      offset += decodeStringArray(inbuffer + offset, this->name, this->name_length);
+      offset += decodeFloat64Array(inbuffer + offset, this->position, this->position_length);
+      offset += decodeFloat64Array(inbuffer + offset, this->velocity, this->velocity_length);
+      offset += decodeFloat64Array(inbuffer + offset, this->acceleration, this->acceleration_length);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return QueryTrajectoryStateResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipStringArray(inbuffer, offset, size);
+      offset = wireSkipArray(inbuffer, offset, size, 8);
+      offset = wireSkipArray(inbuffer, offset, size, 8);
+      offset = wireSkipArray(inbuffer, offset, size, 8);
+      return offset;
+    }
+
     const char * getType(){ return QUERYTRAJECTORYSTATE; };
     const char * getMD5(){ return "1f1a6554ad060f44d013e71868403c1a"; };
 
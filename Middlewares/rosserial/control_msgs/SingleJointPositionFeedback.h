@@ -50,6 +50,20 @@ namespace control_msgs
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return SingleJointPositionFeedback::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 24);
+      return offset;
+    }
+
     const char * getType(){ return "control_msgs/SingleJointPositionFeedback"; };
     const char * getMD5(){ return "8cee65610a3d08e0a1bded82f146f1fd"; };
 
@@ -31,16 +31,8 @@ namespace control_msgs
     {
       int offset = 0;
       offset += serializeAvrFloat64(outbuffer + offset, this->position);
-      *(outbuffer + offset + 0) = (this->min_duration.sec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->min_duration.sec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->min_duration.sec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->min_duration.sec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->min_duration.sec);
-      *(outbuffer + offset + 0) = (this->min_duration.nsec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->min_duration.nsec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->min_duration.nsec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->min_duration.nsec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->min_duration.nsec);
+      offset += encode(outbuffer + offset, this->min_duration.sec);
+      offset += encode(outbuffer + offset, this->min_duration.nsec);
       offset += serializeAvrFloat64(outbuffer + offset, this->max_velocity);
       return offset;
     }
@@ -49,20 +41,26 @@ namespace control_msgs
     {
       int offset = 0;
       offset += deserializeAvrFloat64(inbuffer + offset, &(this->position));
-      this->min_duration.sec =  ((uint32_t) (*(inbuffer + offset)));
-      this->min_duration.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->min_duration.sec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->min_duration.sec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->min_duration.sec);
-      this->min_duration.nsec =  ((uint32_t) (*(inbuffer + offset)));
-      this->min_duration.nsec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->min_duration.nsec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->min_duration.nsec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->min_duration.nsec);
+      offset += decode(inbuffer + offset, this->min_duration.sec);
+      offset += decode(inbuffer + offset, this->min_duration.nsec);
       offset += deserializeAvrFloat64(inbuffer + offset, &(this->max_velocity));
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return SingleJointPositionGoal::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 24);
+      return offset;
+    }
+
     const char * getType(){ return "control_msgs/SingleJointPositionGoal"; };
     const char * getMD5(){ return "fbaaa562a23a013fd5053e5f72cbb35c"; };
 
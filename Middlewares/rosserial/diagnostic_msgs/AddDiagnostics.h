@@ -24,29 +24,30 @@ static const char ADDDIAGNOSTICS[] = "diagnostic_msgs/AddDiagnostics";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_load_namespace = strlen(this->load_namespace);
-      varToArr(outbuffer + offset, length_load_namespace);
-      offset += 4;
-      memcpy(outbuffer + offset, this->load_namespace, length_load_namespace);
-      offset += length_load_namespace;
+      offset += encodeString(outbuffer + offset, this->load_namespace);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_load_namespace;
-      arrToVar(length_load_namespace, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_load_namespace; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_load_namespace-1]=0;
-      this->load_namespace = (char *)(inbuffer + offset-1);
-      offset += length_load_namespace;
+      offset += decodeString(inbuffer + offset, this->load_namespace);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return AddDiagnosticsRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return ADDDIAGNOSTICS; };
     const char * getMD5(){ return "c26cf6e164288fbc6050d74f838bcdf0"; };
 
@@ -69,44 +70,33 @@ static const char ADDDIAGNOSTICS[] = "diagnostic_msgs/AddDiagnostics";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      union {
-        bool real;
-        uint8_t base;
-      } u_success;
-      u_success.real = this->success;
-      *(outbuffer + offset + 0) = (u_success.base >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->success);
-      uint32_t length_message = strlen(this->message);
-      varToArr(outbuffer + offset, length_message);
-      offset += 4;
-      memcpy(outbuffer + offset, this->message, length_message);
-      offset += length_message;
+      offset += encode(outbuffer + offset, this->success);
+      offset += encodeString(outbuffer + offset, this->message);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      union {
-        bool real;
-        uint8_t base;
-      } u_success;
-      u_success.base = 0;
-      u_success.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      this->success = u_success.real;
-      offset += sizeof(this->success);
-      uint32_t length_message;
-      arrToVar(length_message, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_message; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_message-1]=0;
-      this->message = (char *)(inbuffer + offset-1);
-      offset += length_message;
+      offset += decode(inbuffer + offset, this->success);
+      offset += decodeString(inbuffer + offset, this->message);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return AddDiagnosticsResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkip(offset, size, 1);
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return ADDDIAGNOSTICS; };
     const char * getMD5(){ return "937c9679a518e3a18d831e57125ea522"; };
 
@@ -17,13 +17,14 @@ namespace diagnostic_msgs
       typedef std_msgs::Header _header_type;
       _header_type header;
       uint32_t status_length;
+      uint32_t status_capacity;
       typedef diagnostic_msgs::DiagnosticStatus _status_type;
       _status_type st_status;
       _status_type * status;
 
     DiagnosticArray():
       header(),
-      status_length(0), status(NULL)
+      status_length(0), status_capacity(0), status(NULL)
     {
     }
 
@@ -31,11 +32,7 @@ namespace diagnostic_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      *(outbuffer + offset + 0) = (this->status_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->status_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->status_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->status_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->status_length);
+      offset += encode(outbuffer + offset, this->status_length);
       for( uint32_t i = 0; i < status_length; i++){
       offset += this->status[i].serialize(outbuffer + offset);
       }
@@ -46,21 +43,28 @@ namespace diagnostic_msgs
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      uint32_t status_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      status_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      status_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      status_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->status_length);
-      if(status_lengthT > status_length)
-        this->status = (diagnostic_msgs::DiagnosticStatus*)realloc(this->status, status_lengthT * sizeof(diagnostic_msgs::DiagnosticStatus));
-      status_length = status_lengthT;
-      for( uint32_t i = 0; i < status_length; i++){
-      offset += this->st_status.deserialize(inbuffer + offset);
-        memcpy( &(this->status[i]), &(this->st_status), sizeof(diagnostic_msgs::DiagnosticStatus));
-      }
+      offset += decodeMsgArray(inbuffer + offset, this->status, this->status_length, this->status_capacity);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return DiagnosticArray::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      uint32_t status_lengthT;
+      offset = wireCount(inbuffer, offset, size, status_lengthT, 17);
+      for( uint32_t i = 0; (i < status_lengthT) && (offset >= 0); i++){
+        offset = this->st_status.wireLength(inbuffer, offset, size);
+      }
+      return offset;
+    }
+
     const char * getType(){ return "diagnostic_msgs/DiagnosticArray"; };
     const char * getMD5(){ return "60810da900de1dd6ddd437c3503511da"; };
 
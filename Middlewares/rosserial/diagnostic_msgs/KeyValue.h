@@ -26,43 +26,33 @@ namespace diagnostic_msgs
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_key = strlen(this->key);
-      varToArr(outbuffer + offset, length_key);
-      offset += 4;
-      memcpy(outbuffer + offset, this->key, length_key);
-      offset += length_key;
-      uint32_t length_value = strlen(this->value);
-      varToArr(outbuffer + offset, length_value);
-      offset += 4;
-      memcpy(outbuffer + offset, this->value, length_value);
-      offset += length_value;
+      offset += encodeString(outbuffer + offset, this->key);
+      offset += encodeString(outbuffer + offset, this->value);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_key;
-      arrToVar(length_key, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_key; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_key-1]=0;
-      this->key = (char *)(inbuffer + offset-1);
-      offset += length_key;
-      uint32_t length_value;
-      arrToVar(length_value, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_value; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_value-1]=0;
-      this->value = (char *)(inbuffer + offset-1);
-      offset += length_value;
+      offset += decodeString(inbuffer + offset, this->key);
+      offset += decodeString(inbuffer + offset, this->value);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return KeyValue::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "diagnostic_msgs/KeyValue"; };
     const char * getMD5(){ return "cf57fdc6617a881a88c16e768132149c"; };
 
@@ -21,16 +21,32 @@ static const char SELFTEST[] = "diagnostic_msgs/SelfTest";
 
     virtual int serialize(unsigned char *outbuffer) const
     {
+      (void) outbuffer;
       int offset = 0;
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
+      (void) inbuffer;
       int offset = 0;
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return SelfTestRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      (void) size;
+      return offset;
+    }
+
     const char * getType(){ return SELFTEST; };
     const char * getMD5(){ return "d41d8cd98f00b204e9800998ecf8427e"; };
 
@@ -44,6 +60,7 @@ static const char SELFTEST[] = "diagnostic_msgs/SelfTest";
       typedef int8_t _passed_type;
       _passed_type passed;
       uint32_t status_length;
+      uint32_t status_capacity;
       typedef diagnostic_msgs::DiagnosticStatus _status_type;
       _status_type st_status;
       _status_type * status;
@@ -51,30 +68,16 @@ static const char SELFTEST[] = "diagnostic_msgs/SelfTest";
     SelfTestResponse():
       id(""),
       passed(0),
-      status_length(0), status(NULL)
+      status_length(0), status_capacity(0), status(NULL)
     {
     }
 
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_id = strlen(this->id);
-      varToArr(outbuffer + offset, length_id);
-      offset += 4;
-      memcpy(outbuffer + offset, this->id, length_id);
-      offset += length_id;
-      union {
-        int8_t real;
-        uint8_t base;
-      } u_passed;
-      u_passed.real = this->passed;
-      *(outbuffer + offset + 0) = (u_passed.base >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->passed);
-      *(outbuffer + offset + 0) = (this->status_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->status_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->status_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->status_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->status_length);
+      offset += encodeString(outbuffer + offset, this->id);
+      offset += encode(outbuffer + offset, this->passed);
+      offset += encode(outbuffer + offset, this->status_length);
       for( uint32_t i = 0; i < status_length; i++){
       offset += this->status[i].serialize(outbuffer + offset);
       }
@@ -84,38 +87,31 @@ static const char SELFTEST[] = "diagnostic_msgs/SelfTest";
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_id;
-      arrToVar(length_id, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_id; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_id-1]=0;
-      this->id = (char *)(inbuffer + offset-1);
-      offset += length_id;
-      union {
-        int8_t real;
-        uint8_t base;
-      } u_passed;
-      u_passed.base = 0;
-      u_passed.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      this->passed = u_passed.real;
-      offset += sizeof(this->passed);
-      uint32_t status_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      status_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      status_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      status_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->status_length);
-      if(status_lengthT > status_length)
-        this->status = (diagnostic_msgs::DiagnosticStatus*)realloc(this->status, status_lengthT * sizeof(diagnostic_msgs::DiagnosticStatus));
-      status_length = status_lengthT;
-      for( uint32_t i = 0; i < status_length; i++){
-      offset += this->st_status.deserialize(inbuffer + offset);
-        memcpy( &(this->status[i]), &(this->st_status), sizeof(diagnostic_msgs::DiagnosticStatus));
-      }
+      offset += decodeString(inbuffer + offset, this->id);
+      offset += decode(inbuffer + offset, this->passed);
+      offset += decodeMsgArray(inbuffer + offset, this->status, this->status_length, this->status_capacity);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return SelfTestResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 1);
+      uint32_t status_lengthT;
+      offset = wireCount(inbuffer, offset, size, status_lengthT, 17);
+      for( uint32_t i = 0; (i < status_lengthT) && (offset >= 0); i++){
+        offset = this->st_status.wireLength(inbuffer, offset, size);
+      }
+      return offset;
+    }
+
     const char * getType(){ return SELFTEST; };
     const char * getMD5(){ return "ac21b1bab7ab17546986536c22eb34e9"; };
 
@@ -26,44 +26,33 @@ namespace dynamic_reconfigure
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_name = strlen(this->name);
-      varToArr(outbuffer + offset, length_name);
-      offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
-      offset += length_name;
-      union {
-        bool real;
-        uint8_t base;
-      } u_value;
-      u_value.real = this->value;
-      *(outbuffer + offset + 0) = (u_value.base >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->value);
+      offset += encodeString(outbuffer + offset, this->name);
+      offset += encode(outbuffer + offset, this->value);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_name;
-      arrToVar(length_name, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
-      offset += length_name;
-      union {
-        bool real;
-        uint8_t base;
-      } u_value;
-      u_value.base = 0;
-      u_value.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      this->value = u_value.real;
-      offset += sizeof(this->value);
+      offset += decodeString(inbuffer + offset, this->name);
+      offset += decode(inbuffer + offset, this->value);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return BoolParameter::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 1);
+      return offset;
+    }
+
     const char * getType(){ return "dynamic_reconfigure/BoolParameter"; };
     const char * getMD5(){ return "23f05028c1a699fb83e22401228c3a9e"; };
 
@@ -18,75 +18,60 @@ namespace dynamic_reconfigure
   {
     public:
       uint32_t bools_length;
+      uint32_t bools_capacity;
       typedef dynamic_reconfigure::BoolParameter _bools_type;
       _bools_type st_bools;
       _bools_type * bools;
       uint32_t ints_length;
+      uint32_t ints_capacity;
       typedef dynamic_reconfigure::IntParameter _ints_type;
       _ints_type st_ints;
       _ints_type * ints;
       uint32_t strs_length;
+      uint32_t strs_capacity;
       typedef dynamic_reconfigure::StrParameter _strs_type;
       _strs_type st_strs;
       _strs_type * strs;
       uint32_t doubles_length;
+      uint32_t doubles_capacity;
       typedef dynamic_reconfigure::DoubleParameter _doubles_type;
       _doubles_type st_doubles;
       _doubles_type * doubles;
       uint32_t groups_length;
+      uint32_t groups_capacity;
       typedef dynamic_reconfigure::GroupState _groups_type;
       _groups_type st_groups;
       _groups_type * groups;
 
     Config():
-      bools_length(0), bools(NULL),
-      ints_length(0), ints(NULL),
-      strs_length(0), strs(NULL),
-      doubles_length(0), doubles(NULL),
-      groups_length(0), groups(NULL)
+      bools_length(0), bools_capacity(0), bools(NULL),
+      ints_length(0), ints_capacity(0), ints(NULL),
+      strs_length(0), strs_capacity(0), strs(NULL),
+      doubles_length(0), doubles_capacity(0), doubles(NULL),
+      groups_length(0), groups_capacity(0), groups(NULL)
     {
     }
 
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->bools_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->bools_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->bools_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->bools_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->bools_length);
+      offset += encode(outbuffer + offset, this->bools_length);
       for( uint32_t i = 0; i < bools_length; i++){
       offset += this->bools[i].serialize(outbuffer + offset);
       }
-      *(outbuffer + offset + 0) = (this->ints_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->ints_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->ints_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->ints_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->ints_length);
+      offset += encode(outbuffer + offset, this->ints_length);
       for( uint32_t i = 0; i < ints_length; i++){
       offset += this->ints[i].serialize(outbuffer + offset);
       }
-      *(outbuffer + offset + 0) = (this->strs_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->strs_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->strs_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->strs_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->strs_length);
+      offset += encode(outbuffer + offset, this->strs_length);
       for( uint32_t i = 0; i < strs_length; i++){
       offset += this->strs[i].serialize(outbuffer + offset);
       }
-      *(outbuffer + offset + 0) = (this->doubles_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->doubles_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->doubles_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->doubles_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->doubles_length);
+      offset += encode(outbuffer + offset, this->doubles_length);
       for( uint32_t i = 0; i < doubles_length; i++){
       offset += this->doubles[i].serialize(outbuffer + offset);
       }
-      *(outbuffer + offset + 0) = (this->groups_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->groups_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->groups_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->groups_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->groups_length);
+      offset += encode(outbuffer + offset, this->groups_length);
       for( uint32_t i = 0; i < groups_length; i++){
       offset += this->groups[i].serialize(outbuffer + offset);
       }
@@ -96,67 +81,49 @@ namespace dynamic_reconfigure
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t bools_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      bools_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      bools_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      bools_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->bools_length);
-      if(bools_lengthT > bools_length)
-        this->bools = (dynamic_reconfigure::BoolParameter*)realloc(this->bools, bools_lengthT * sizeof(dynamic_reconfigure::BoolParameter));
-      bools_length = bools_lengthT;
-      for( uint32_t i = 0; i < bools_length; i++){
-      offset += this->st_bools.deserialize(inbuffer + offset);
-        memcpy( &(this->bools[i]), &(this->st_bools), sizeof(dynamic_reconfigure::BoolParameter));
+      offset += decodeMsgArray(inbuffer + offset, this->bools, this->bools_length, this->bools_capacity);
+      offset += decodeMsgArray(inbuffer + offset, this->ints, this->ints_length, this->ints_capacity);
+      offset += decodeMsgArray(inbuffer + offset, this->strs, this->strs_length, this->strs_capacity);
+      offset += decodeMsgArray(inbuffer + offset, this->doubles, this->doubles_length, this->doubles_capacity);
+      offset += decodeMsgArray(inbuffer + offset, this->groups, this->groups_length, this->groups_capacity);
+     return offset;
+    }
+
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return Config::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      uint32_t bools_lengthT;
+      offset = wireCount(inbuffer, offset, size, bools_lengthT, 5);
+      for( uint32_t i = 0; (i < bools_lengthT) && (offset >= 0); i++){
+        offset = this->st_bools.wireLength(inbuffer, offset, size);
       }
-      uint32_t ints_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      ints_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      ints_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      ints_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->ints_length);
-      if(ints_lengthT > ints_length)
-        this->ints = (dynamic_reconfigure::IntParameter*)realloc(this->ints, ints_lengthT * sizeof(dynamic_reconfigure::IntParameter));
-      ints_length = ints_lengthT;
-      for( uint32_t i = 0; i < ints_length; i++){
-      offset += this->st_ints.deserialize(inbuffer + offset);
-        memcpy( &(this->ints[i]), &(this->st_ints), sizeof(dynamic_reconfigure::IntParameter));
+      uint32_t ints_lengthT;
+      offset = wireCount(inbuffer, offset, size, ints_lengthT, 8);
+      for( uint32_t i = 0; (i < ints_lengthT) && (offset >= 0); i++){
+        offset = this->st_ints.wireLength(inbuffer, offset, size);
       }
-      uint32_t strs_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      strs_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      strs_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      strs_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->strs_length);
-      if(strs_lengthT > strs_length)
-        this->strs = (dynamic_reconfigure::StrParameter*)realloc(this->strs, strs_lengthT * sizeof(dynamic_reconfigure::StrParameter));
-      strs_length = strs_lengthT;
-      for( uint32_t i = 0; i < strs_length; i++){
-      offset += this->st_strs.deserialize(inbuffer + offset);
-        memcpy( &(this->strs[i]), &(this->st_strs), sizeof(dynamic_reconfigure::StrParameter));
+      uint32_t strs_lengthT;
+      offset = wireCount(inbuffer, offset, size, strs_lengthT, 8);
+      for( uint32_t i = 0; (i < strs_lengthT) && (offset >= 0); i++){
+        offset = this->st_strs.wireLength(inbuffer, offset, size);
       }
-      uint32_t doubles_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      doubles_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      doubles_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      doubles_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->doubles_length);
-      if(doubles_lengthT > doubles_length)
-        this->doubles = (dynamic_reconfigure::DoubleParameter*)realloc(this->doubles, doubles_lengthT * sizeof(dynamic_reconfigure::DoubleParameter));
-      doubles_length = doubles_lengthT;
-      for( uint32_t i = 0; i < doubles_length; i++){
-      offset += this->st_doubles.deserialize(inbuffer + offset);
-        memcpy( &(this->doubles[i]), &(this->st_doubles), sizeof(dynamic_reconfigure::DoubleParameter));
+      uint32_t doubles_lengthT;
+      offset = wireCount(inbuffer, offset, size, doubles_lengthT, 12);
+      for( uint32_t i = 0; (i < doubles_lengthT) && (offset >= 0); i++){
+        offset = this->st_doubles.wireLength(inbuffer, offset, size);
       }
-      uint32_t groups_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      groups_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      groups_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      groups_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->groups_length);
-      if(groups_lengthT > groups_length)
-        this->groups = (dynamic_reconfigure::GroupState*)realloc(this->groups, groups_lengthT * sizeof(dynamic_reconfigure::GroupState));
-      groups_length = groups_lengthT;
-      for( uint32_t i = 0; i < groups_length; i++){
-      offset += this->st_groups.deserialize(inbuffer + offset);
-        memcpy( &(this->groups[i]), &(this->st_groups), sizeof(dynamic_reconfigure::GroupState));
+      uint32_t groups_lengthT;
+      offset = wireCount(inbuffer, offset, size, groups_lengthT, 13);
+      for( uint32_t i = 0; (i < groups_lengthT) && (offset >= 0); i++){
+        offset = this->st_groups.wireLength(inbuffer, offset, size);
       }
-     return offset;
+      return offset;
     }
 
     const char * getType(){ return "dynamic_reconfigure/Config"; };
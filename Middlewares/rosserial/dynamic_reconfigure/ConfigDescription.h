@@ -15,6 +15,7 @@ namespace dynamic_reconfigure
   {
     public:
       uint32_t groups_length;
+      uint32_t groups_capacity;
       typedef dynamic_reconfigure::Group _groups_type;
       _groups_type st_groups;
       _groups_type * groups;
@@ -26,7 +27,7 @@ namespace dynamic_reconfigure
       _dflt_type dflt;
 
     ConfigDescription():
-      groups_length(0), groups(NULL),
+      groups_length(0), groups_capacity(0), groups(NULL),
       max(),
       min(),
       dflt()
@@ -36,11 +37,7 @@ namespace dynamic_reconfigure
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->groups_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->groups_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->groups_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->groups_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->groups_length);
+      offset += encode(outbuffer + offset, this->groups_length);
       for( uint32_t i = 0; i < groups_length; i++){
       offset += this->groups[i].serialize(outbuffer + offset);
       }
@@ -53,24 +50,33 @@ namespace dynamic_reconfigure
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t groups_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      groups_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      groups_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      groups_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->groups_length);
-      if(groups_lengthT > groups_length)
-        this->groups = (dynamic_reconfigure::Group*)realloc(this->groups, groups_lengthT * sizeof(dynamic_reconfigure::Group));
-      groups_length = groups_lengthT;
-      for( uint32_t i = 0; i < groups_length; i++){
-      offset += this->st_groups.deserialize(inbuffer + offset);
-        memcpy( &(this->groups[i]), &(this->st_groups), sizeof(dynamic_reconfigure::Group));
-      }
+      offset += decodeMsgArray(inbuffer + offset, this->groups, this->groups_length, this->groups_capacity);
       offset += this->max.deserialize(inbuffer + offset);
       offset += this->min.deserialize(inbuffer + offset);
       offset += this->dflt.deserialize(inbuffer + offset);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return ConfigDescription::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      uint32_t groups_lengthT;
+      offset = wireCount(inbuffer, offset, size, groups_lengthT, 20);
+      for( uint32_t i = 0; (i < groups_lengthT) && (offset >= 0); i++){
+        offset = this->st_groups.wireLength(inbuffer, offset, size);
+      }
+      offset = this->max.wireLength(inbuffer, offset, size);
+      offset = this->min.wireLength(inbuffer, offset, size);
+      offset = this->dflt.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "dynamic_reconfigure/ConfigDescription"; };
     const char * getMD5(){ return "757ce9d44ba8ddd801bb30bc456f946f"; };
 
@@ -26,11 +26,7 @@ namespace dynamic_reconfigure
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_name = strlen(this->name);
-      varToArr(outbuffer + offset, length_name);
-      offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
-      offset += length_name;
+      offset += encodeString(outbuffer + offset, this->name);
       offset += serializeAvrFloat64(outbuffer + offset, this->value);
       return offset;
     }
@@ -38,19 +34,25 @@ namespace dynamic_reconfigure
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_name;
-      arrToVar(length_name, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
-      offset += length_name;
+      offset += decodeString(inbuffer + offset, this->name);
       offset += deserializeAvrFloat64(inbuffer + offset, &(this->value));
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return DoubleParameter::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 8);
+      return offset;
+    }
+
     const char * getType(){ return "dynamic_reconfigure/DoubleParameter"; };
     const char * getMD5(){ return "d8512f27253c0f65f928a67c329cd658"; };
 
@@ -18,6 +18,7 @@ namespace dynamic_reconfigure
       typedef const char* _type_type;
       _type_type type;
       uint32_t parameters_length;
+      uint32_t parameters_capacity;
       typedef dynamic_reconfigure::ParamDescription _parameters_type;
       _parameters_type st_parameters;
       _parameters_type * parameters;
@@ -29,7 +30,7 @@ namespace dynamic_reconfigure
     Group():
       name(""),
       type(""),
-      parameters_length(0), parameters(NULL),
+      parameters_length(0), parameters_capacity(0), parameters(NULL),
       parent(0),
       id(0)
     {
@@ -38,105 +39,48 @@ namespace dynamic_reconfigure
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_name = strlen(this->name);
-      varToArr(outbuffer + offset, length_name);
-      offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
-      offset += length_name;
-      uint32_t length_type = strlen(this->type);
-      varToArr(outbuffer + offset, length_type);
-      offset += 4;
-      memcpy(outbuffer + offset, this->type, length_type);
-      offset += length_type;
-      *(outbuffer + offset + 0) = (this->parameters_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->parameters_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->parameters_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->parameters_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->parameters_length);
+      offset += encodeString(outbuffer + offset, this->name);
+      offset += encodeString(outbuffer + offset, this->type);
+      offset += encode(outbuffer + offset, this->parameters_length);
       for( uint32_t i = 0; i < parameters_length; i++){
       offset += this->parameters[i].serialize(outbuffer + offset);
       }
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_parent;
-      u_parent.real = this->parent;
-      *(outbuffer + offset + 0) = (u_parent.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_parent.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_parent.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_parent.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->parent);
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_id;
-      u_id.real = this->id;
-      *(outbuffer + offset + 0) = (u_id.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_id.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_id.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_id.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->id);
+      offset += encode(outbuffer + offset, this->parent);
+      offset += encode(outbuffer + offset, this->id);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_name;
-      arrToVar(length_name, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
-      offset += length_name;
-      uint32_t length_type;
-      arrToVar(length_type, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_type; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_type-1]=0;
-      this->type = (char *)(inbuffer + offset-1);
-      offset += length_type;
-      uint32_t parameters_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      parameters_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      parameters_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      parameters_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->parameters_length);
-      if(parameters_lengthT > parameters_length)
-        this->parameters = (dynamic_reconfigure::ParamDescription*)realloc(this->parameters, parameters_lengthT * sizeof(dynamic_reconfigure::ParamDescription));
-      parameters_length = parameters_lengthT;
-      for( uint32_t i = 0; i < parameters_length; i++){
-      offset += this->st_parameters.deserialize(inbuffer + offset);
-        memcpy( &(this->parameters[i]), &(this->st_parameters), sizeof(dynamic_reconfigure::ParamDescription));
-      }
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_parent;
-      u_parent.base = 0;
-      u_parent.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_parent.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_parent.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_parent.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->parent = u_parent.real;
-      offset += sizeof(this->parent);
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_id;
-      u_id.base = 0;
-      u_id.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_id.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_id.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_id.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->id = u_id.real;
-      offset += sizeof(this->id);
+      offset += decodeString(inbuffer + offset, this->name);
+      offset += decodeString(inbuffer + offset, this->type);
+      offset += decodeMsgArray(inbuffer + offset, this->parameters, this->parameters_length, this->parameters_capacity);
+      offset += decode(inbuffer + offset, this->parent);
+      offset += decode(inbuffer + offset, this->id);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return Group::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      uint32_t parameters_lengthT;
+      offset = wireCount(inbuffer, offset, size, parameters_lengthT, 20);
+      for( uint32_t i = 0; (i < parameters_lengthT) && (offset >= 0); i++){
+        offset = this->st_parameters.wireLength(inbuffer, offset, size);
+      }
+      offset = wireSkip(offset, size, 8);
+      return offset;
+    }
+
     const char * getType(){ return "dynamic_reconfigure/Group"; };
     const char * getMD5(){ return "9e8cd9e9423c94823db3614dd8b1cf7a"; };
 
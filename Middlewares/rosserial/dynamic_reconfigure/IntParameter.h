@@ -26,50 +26,33 @@ namespace dynamic_reconfigure
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_name = strlen(this->name);
-      varToArr(outbuffer + offset, length_name);
-      offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
-      offset += length_name;
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_value;
-      u_value.real = this->value;
-      *(outbuffer + offset + 0) = (u_value.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_value.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_value.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_value.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->value);
+      offset += encodeString(outbuffer + offset, this->name);
+      offset += encode(outbuffer + offset, this->value);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_name;
-      arrToVar(length_name, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
-      offset += length_name;
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_value;
-      u_value.base = 0;
-      u_value.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_value.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_value.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_value.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->value = u_value.real;
-      offset += sizeof(this->value);
+      offset += decodeString(inbuffer + offset, this->name);
+      offset += decode(inbuffer + offset, this->value);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return IntParameter::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 4);
+      return offset;
+    }
+
     const char * getType(){ return "dynamic_reconfigure/IntParameter"; };
     const char * getMD5(){ return "65fedc7a0cbfb8db035e46194a350bf1"; };
 
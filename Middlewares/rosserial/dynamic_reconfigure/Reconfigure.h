@@ -36,6 +36,19 @@ static const char RECONFIGURE[] = "dynamic_reconfigure/Reconfigure";
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return ReconfigureRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->config.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return RECONFIGURE; };
     const char * getMD5(){ return "ac41a77620a4a0348b7001641796a8a1"; };
 
@@ -66,6 +79,19 @@ static const char RECONFIGURE[] = "dynamic_reconfigure/Reconfigure";
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return ReconfigureResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->config.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return RECONFIGURE; };
     const char * getMD5(){ return "ac41a77620a4a0348b7001641796a8a1"; };
 
@@ -26,43 +26,33 @@ namespace dynamic_reconfigure
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_name = strlen(this->name);
-      varToArr(outbuffer + offset, length_name);
-      offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
-      offset += length_name;
-      uint32_t length_value = strlen(this->value);
-      varToArr(outbuffer + offset, length_value);
-      offset += 4;
-      memcpy(outbuffer + offset, this->value, length_value);
-      offset += length_value;
+      offset += encodeString(outbuffer + offset, this->name);
+      offset += encodeString(outbuffer + offset, this->value);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_name;
-      arrToVar(length_name, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
-      offset += length_name;
-      uint32_t length_value;
-      arrToVar(length_value, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_value; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_value-1]=0;
-      this->value = (char *)(inbuffer + offset-1);
-      offset += length_value;
+      offset += decodeString(inbuffer + offset, this->name);
+      offset += decodeString(inbuffer + offset, this->value);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return StrParameter::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "dynamic_reconfigure/StrParameter"; };
     const char * getMD5(){ return "bc6ccc4a57f61779c8eaae61e9f422e0"; };
 
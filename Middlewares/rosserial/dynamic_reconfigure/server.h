@@ -0,0 +1,557 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file server.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief dynamic_reconfigure server with a static parameter table
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef ROS_RECONFIGURE_SERVER_H_
+#define ROS_RECONFIGURE_SERVER_H_
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdint.h>
+#include <string.h>
+
+#include "ros/node_handle.h"
+#include "ros/subscriber.h"
+#include "dynamic_reconfigure/Config.h"
+#include "dynamic_reconfigure/ConfigDescription.h"
+#include "dynamic_reconfigure/Reconfigure.h"
+/* -------------------------------------------------------------------------------*/
+
+namespace dynamic_reconfigure
+{
+
+/**
+ * @brief dynamic_reconfigure server for a static table of parameters
+ *
+ * Parameters are firmware variables of type bool, int32_t or float, which
+ * are registered once with their limits. Requests on
+ * <ns>/set_parameters are parsed from the receive buffer into staged
+ * values, ints and doubles are clamped to their limits. apply() copies all
+ * staged values to the variables at once, call it between two control
+ * cycles, e.g. at the start of the control interrupt. The hand over
+ * assumes a single core: requests never write staged values while apply()
+ * may read them.
+ *
+ * update() publishes <ns>/parameter_descriptions and
+ * <ns>/parameter_updates after every topic negotiation, as the topics are
+ * not latched, and parameter_updates after apply() changed a value. The
+ * messages are streamed, so they do not have to fit into the output
+ * buffer.
+ *
+ * Names and descriptions are not copied and have to stay valid. String
+ * parameters are not supported.
+ *
+ * @tparam NodeHandleT  Type of the node handle used for publishing
+ * @tparam MAX_PARAMS   Maximum number of parameters
+ */
+template<typename NodeHandleT, int MAX_PARAMS = 16>
+class Server : public ros::Subscriber_
+{
+public:
+  enum { TOPIC_LEN = 64 };
+
+  /* Called by apply() with the levels of all changed parameters or'ed */
+  typedef void (*ApplyCallbackT)(uint32_t);
+
+  Server(const char *ns, ApplyCallbackT apply_cb = 0) :
+    nh_(0),
+    response_pub_(makeTopic(0, ns, "/set_parameters"), &response_msg_,
+                  rosserial_msgs::TopicInfo::ID_SERVICE_SERVER + rosserial_msgs::TopicInfo::ID_PUBLISHER),
+    description_pub_(makeTopic(1, ns, "/parameter_descriptions"), &description_msg_),
+    update_pub_(makeTopic(2, ns, "/parameter_updates"), &update_msg_),
+    apply_cb_(apply_cb),
+    length_(0),
+    negotiation_(0),
+    pending_(false),
+    applied_(false),
+    respond_(false)
+  {
+    topic_ = names_[0];
+  }
+
+  void init(NodeHandleT &nh)
+  {
+    nh_ = &nh;
+    nh.advertise(response_pub_);
+    nh.subscribe(*this);
+    nh.advertise(description_pub_);
+    nh.advertise(update_pub_);
+  }
+
+  /* Register parameters, false if the table is full */
+  bool addBool(const char *name, bool *value, const char *description = "", const uint32_t level = 0)
+  {
+    Param *p = add(name, TYPE_BOOL, description, level, value);
+    if (!p)
+      return false;
+    p->dflt.b = p->staged.b = *value;
+    p->min.b = false;
+    p->max.b = true;
+    return true;
+  }
+
+  bool addInt(const char *name, int32_t *value, const int32_t min, const int32_t max,
+              const char *description = "", const uint32_t level = 0)
+  {
+    Param *p = add(name, TYPE_INT, description, level, value);
+    if (!p)
+      return false;
+    p->dflt.i = p->staged.i = *value;
+    p->min.i = min;
+    p->max.i = max;
+    return true;
+  }
+
+  bool addDouble(const char *name, float *value, const float min, const float max,
+                 const char *description = "", const uint32_t level = 0)
+  {
+    Param *p = add(name, TYPE_DOUBLE, description, level, value);
+    if (!p)
+      return false;
+    p->dflt.f = p->staged.f = *value;
+    p->min.f = min;
+    p->max.f = max;
+    return true;
+  }
+
+  /**
+   * @brief Copy the staged values of the last request to the variables
+   *
+   * @return true if a request was applied
+   */
+  bool apply()
+  {
+    if (!pending_)
+      return false;
+
+    uint32_t level = 0;
+    bool changed = false;
+    for (int i = 0; i < length_; i++)
+    {
+      Param &p = params_[i];
+      bool differs;
+      switch (p.type)
+      {
+        case TYPE_BOOL:
+          differs = (*(bool *) p.value != p.staged.b);
+          *(bool *) p.value = p.staged.b;
+          break;
+        case TYPE_INT:
+          differs = (*(int32_t *) p.value != p.staged.i);
+          *(int32_t *) p.value = p.staged.i;
+          break;
+        default:
+          differs = (*(float *) p.value != p.staged.f);
+          *(float *) p.value = p.staged.f;
+          break;
+      }
+      if (differs)
+      {
+        level |= p.level;
+        changed = true;
+      }
+    }
+
+    pending_ = false;
+    /* a parameter may have level 0, so level alone does not tell if
+     * something changed; unchanged values need no update message */
+    if (changed)
+      applied_ = true;
+    if (apply_cb_)
+      apply_cb_(level);
+    return true;
+  }
+
+  /**
+   * @brief Publish description and values when due, call from the main loop
+   *
+   * @return true if something was published
+   */
+  bool update()
+  {
+    if (!nh_ || !nh_->connected())
+      return false;
+
+    if (respond_)
+      respond_ = !send(response_pub_.id_, STAGED);
+
+    if (negotiation_ != nh_->getNegotiationCount())
+    {
+      if (!sendDescription())
+        return false;
+      negotiation_ = nh_->getNegotiationCount();
+      applied_ = true;
+    }
+
+    if (applied_ && send(update_pub_.id_, STAGED))
+    {
+      applied_ = false;
+      return true;
+    }
+    return false;
+  }
+
+  int getLength() const
+  {
+    return length_;
+  }
+
+  /* Parse a Reconfigure request, called by the node handle */
+  virtual void callback(unsigned char *data, size_t size)
+  {
+    if (request_msg_.wireLength(data, 0, size) < 0)
+      return;
+
+    /* apply() does not read the staged values until pending_ is set again */
+    pending_ = false;
+
+    int offset = 0;
+    for (int type = TYPE_BOOL; type <= TYPE_GROUP; type++)
+    {
+      uint32_t count;
+      offset += ros::Msg::decode(data + offset, count);
+      for (uint32_t i = 0; i < count; i++)
+      {
+        uint32_t length;
+        offset += ros::Msg::decode(data + offset, length);
+        Param *p = find((const char *)(data + offset), length, type);
+        offset += length;
+
+        switch (type)
+        {
+          case TYPE_BOOL:
+          {
+            uint8_t value;
+            offset += ros::Msg::decode(data + offset, value);
+            if (p)
+              p->staged.b = value != 0;
+            break;
+          }
+          case TYPE_INT:
+          {
+            int32_t value;
+            offset += ros::Msg::decode(data + offset, value);
+            if (p)
+              p->staged.i = value < p->min.i ? p->min.i : (value > p->max.i ? p->max.i : value);
+            break;
+          }
+          case TYPE_STR:
+            offset += ros::Msg::decode(data + offset, length);
+            offset += length;
+            break;
+          case TYPE_DOUBLE:
+          {
+            float value;
+            offset += ros::Msg::deserializeAvrFloat64(data + offset, &value);
+            if (p)
+              p->staged.f = value < p->min.f ? p->min.f : (value > p->max.f ? p->max.f : value);
+            break;
+          }
+          default:
+            /* group state: state, id and parent */
+            offset += 1 + 4 + 4;
+            break;
+        }
+      }
+    }
+
+    pending_ = true;
+    respond_ = !send(response_pub_.id_, STAGED);
+  }
+
+  virtual const char * getMsgType()
+  {
+    return request_msg_.getType();
+  }
+
+  virtual const char * getMsgMD5()
+  {
+    return request_msg_.getMD5();
+  }
+
+  virtual int getEndpointType()
+  {
+    return rosserial_msgs::TopicInfo::ID_SERVICE_SERVER + rosserial_msgs::TopicInfo::ID_SUBSCRIBER;
+  }
+
+private:
+  /* order of the parameter arrays in Config */
+  enum { TYPE_BOOL, TYPE_INT, TYPE_STR, TYPE_DOUBLE, TYPE_GROUP };
+
+  /* which values of the parameters are sent */
+  enum Values { STAGED, MIN, MAX, DFLT };
+
+  union Value
+  {
+    bool b;
+    int32_t i;
+    float f;
+  };
+
+  struct Param
+  {
+    const char *name;
+    const char *description;
+    uint8_t type;
+    uint32_t level;
+    void *value;
+    Value staged;
+    Value min;
+    Value max;
+    Value dflt;
+  };
+
+  /* Writes a message piece by piece, or only counts its bytes. Once the
+   * node handle refused a piece nothing more is written. */
+  class Writer
+  {
+  public:
+    Writer(NodeHandleT *nh, const bool write) : nh_(nh), write_(write), failed_(false), length_(0) {}
+
+    void bytes(const void *data, const int length)
+    {
+      if (write_ && !failed_)
+        failed_ = !nh_->writeFrame((uint8_t *) data, length);
+      length_ += length;
+    }
+
+    template<typename T>
+    void value(const T value)
+    {
+      unsigned char buffer[sizeof(T)];
+      bytes(buffer, ros::Msg::encode(buffer, value));
+    }
+
+    void float64(const float value)
+    {
+      unsigned char buffer[8];
+      bytes(buffer, ros::Msg::serializeAvrFloat64(buffer, value));
+    }
+
+    void string(const char *str)
+    {
+      const uint32_t length = strlen(str);
+      value(length);
+      bytes(str, length);
+    }
+
+    int length() const
+    {
+      return length_;
+    }
+
+    bool failed() const
+    {
+      return failed_;
+    }
+
+  private:
+    NodeHandleT *nh_;
+    bool write_;
+    bool failed_;
+    int length_;
+  };
+
+  const char *makeTopic(const int idx, const char *ns, const char *suffix)
+  {
+    const size_t length = strlen(suffix);
+    size_t ns_length = strlen(ns);
+    if (ns_length > TOPIC_LEN - 1 - length)
+      ns_length = TOPIC_LEN - 1 - length;
+    memcpy(names_[idx], ns, ns_length);
+    memcpy(names_[idx] + ns_length, suffix, length + 1);
+    return names_[idx];
+  }
+
+  Param *add(const char *name, const uint8_t type, const char *description, const uint32_t level, void *value)
+  {
+    if (length_ >= MAX_PARAMS)
+      return 0;
+
+    Param &p = params_[length_++];
+    p.name = name;
+    p.description = description;
+    p.type = type;
+    p.level = level;
+    p.value = value;
+    return &p;
+  }
+
+  Param *find(const char *name, const uint32_t length, const int type)
+  {
+    for (int i = 0; i < length_; i++)
+    {
+      Param &p = params_[i];
+      if ((p.type == type) && (strlen(p.name) == length) && (memcmp(p.name, name, length) == 0))
+        return &p;
+    }
+    return 0;
+  }
+
+  static const Value &select(const Param &p, const Values values)
+  {
+    switch (values)
+    {
+      case MIN:
+        return p.min;
+      case MAX:
+        return p.max;
+      case DFLT:
+        return p.dflt;
+      default:
+        return p.staged;
+    }
+  }
+
+  /* dynamic_reconfigure/Config with all parameters in one group */
+  void writeConfig(Writer &w, const Values values) const
+  {
+    for (int type = TYPE_BOOL; type <= TYPE_DOUBLE; type++)
+    {
+      uint32_t count = 0;
+      for (int i = 0; i < length_; i++)
+        count += params_[i].type == type;
+      w.value(count);
+
+      for (int i = 0; i < length_; i++)
+      {
+        const Param &p = params_[i];
+        if (p.type != type)
+          continue;
+        w.string(p.name);
+        if (type == TYPE_BOOL)
+          w.value((uint8_t) select(p, values).b);
+        else if (type == TYPE_INT)
+          w.value(select(p, values).i);
+        else
+          w.float64(select(p, values).f);
+      }
+    }
+
+    w.value((uint32_t) 1);
+    w.string("Default");
+    w.value((uint8_t) 1);
+    w.value((int32_t) 0);
+    w.value((int32_t) 0);
+  }
+
+  /* dynamic_reconfigure/ConfigDescription */
+  void writeDescription(Writer &w) const
+  {
+    static const char *const types[] = {"bool", "int", "str", "double"};
+
+    w.value((uint32_t) 1);
+    w.string("Default");
+    w.string("");
+    w.value((uint32_t) length_);
+    for (int i = 0; i < length_; i++)
+    {
+      const Param &p = params_[i];
+      w.string(p.name);
+      w.string(types[p.type]);
+      w.value(p.level);
+      w.string(p.description);
+      w.string("");
+    }
+    w.value((int32_t) 0);
+    w.value((int32_t) 0);
+
+    writeConfig(w, MAX);
+    writeConfig(w, MIN);
+    writeConfig(w, DFLT);
+  }
+
+  /* Stream a message, first counting and then writing its bytes */
+  template<typename WriteT>
+  bool stream(const int id, WriteT write, const Values values)
+  {
+    Writer count(nh_, false);
+    (this->*write)(count, values);
+    if (!nh_->beginFrame(id, count.length()))
+      return false;
+
+    /* a frame with a piece missing is aborted, the host discards it */
+    Writer out(nh_, true);
+    (this->*write)(out, values);
+    if (!out.failed() && nh_->endFrame())
+      return true;
+    nh_->abortFrame();
+    return false;
+  }
+
+  bool send(const int id, const Values values)
+  {
+    return stream(id, &Server::writeConfig, values);
+  }
+
+  void writeDescriptionValues(Writer &w, const Values) const
+  {
+    writeDescription(w);
+  }
+
+  bool sendDescription()
+  {
+    return stream(description_pub_.id_, &Server::writeDescriptionValues, STAGED);
+  }
+
+  NodeHandleT *nh_;
+  char names_[3][TOPIC_LEN];
+  ReconfigureRequest request_msg_;
+  ReconfigureResponse response_msg_;
+  ConfigDescription description_msg_;
+  Config update_msg_;
+  ros::Publisher response_pub_;
+  ros::Publisher description_pub_;
+  ros::Publisher update_pub_;
+  ApplyCallbackT apply_cb_;
+
+  Param params_[MAX_PARAMS];
+  int length_;
+  uint32_t negotiation_;
+  volatile bool pending_;
+  volatile bool applied_;
+  bool respond_;
+};
+
+}
+
+#endif /* ROS_RECONFIGURE_SERVER_H_ */
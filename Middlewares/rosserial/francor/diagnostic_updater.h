@@ -0,0 +1,495 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file diagnostic_updater.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Diagnostics publisher with fixed storage
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef ROS_DIAGNOSTIC_UPDATER_H_
+#define ROS_DIAGNOSTIC_UPDATER_H_
+
+/* Includes ----------------------------------------------------------------------*/
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "ros/node_handle.h"
+#include "diagnostic_msgs/DiagnosticArray.h"
+/* -------------------------------------------------------------------------------*/
+
+namespace francor
+{
+
+/**
+ * @brief Publisher of diagnostic_msgs/DiagnosticArray with fixed storage
+ *
+ * Statuses and their key value pairs are registered once at start up. Values
+ * are stored as numbers and formatted only when their status is published.
+ * A status is published by update() as soon as its level or message
+ * changes, at most once per minimum period, and all statuses are published
+ * once per heartbeat period. Value changes alone wait for the heartbeat.
+ * Statuses in a message the node handle did not take, e.g. while a streamed
+ * frame holds its output, are published again after the minimum period.
+ *
+ * Names, keys, messages and string values are not copied, they have to stay
+ * valid. A message is compared by pointer, call trigger() after changing a
+ * message in place.
+ *
+ * @tparam NodeHandleT  Type of the node handle used for publishing
+ * @tparam MAX_STATUS   Maximum number of statuses
+ * @tparam MAX_VALUES   Maximum number of key value pairs per status
+ * @tparam VALUE_LEN    Size of a formatted value including termination
+ */
+template<typename NodeHandleT, int MAX_STATUS = 4, int MAX_VALUES = 6, int VALUE_LEN = 16>
+class DiagnosticUpdater
+{
+public:
+  DiagnosticUpdater(const char *hardware_id, const uint32_t period_ms = 1000, const uint32_t min_period_ms = 100) :
+    nh_(0),
+    publisher_("/diagnostics", &msg_),
+    hardware_id_(hardware_id),
+    period_ms_(period_ms),
+    min_period_ms_(min_period_ms),
+    last_full_ms_(0),
+    last_change_ms_(0),
+    negotiation_(0),
+    dropped_(0),
+    failed_(0),
+    status_length_(0)
+  {
+    msg_.status = send_;
+  }
+
+  void init(NodeHandleT &nh)
+  {
+    nh_ = &nh;
+    nh.advertise(publisher_);
+    /* publish everything with the first update after connecting */
+    negotiation_ = nh.getNegotiationCount();
+  }
+
+  /**
+   * @brief Register a status, its level is STALE until it is set
+   *
+   * @return Index of the status, -1 if there is no space
+   */
+  int addStatus(const char *name)
+  {
+    if (status_length_ >= MAX_STATUS)
+      return -1;
+
+    Status &s = status_[status_length_];
+    s.name = name;
+    s.message = "";
+    s.level = diagnostic_msgs::DiagnosticStatus::STALE;
+    s.values_length = 0;
+    s.changed = true;
+    return status_length_++;
+  }
+
+  /**
+   * @brief Register a key value pair of a status
+   *
+   * @return Index of the value within the status, -1 if there is no space
+   */
+  int addValue(const int status, const char *key)
+  {
+    if ((status < 0) || (status >= status_length_) || (status_[status].values_length >= MAX_VALUES))
+      return -1;
+
+    Status &s = status_[status];
+    Value &v = s.values[s.values_length];
+    v.key = key;
+    v.type = VALUE_STRING;
+    v.string = "";
+    return s.values_length++;
+  }
+
+  /* Set level and message, publishes the status with the next update() if
+   * either changed */
+  void setStatus(const int status, const int8_t level, const char *message)
+  {
+    if ((status < 0) || (status >= status_length_))
+      return;
+
+    Status &s = status_[status];
+    if ((s.level != level) || (s.message != message))
+      s.changed = true;
+    s.level = level;
+    s.message = message;
+  }
+
+  /* Publish the status with the next update() */
+  void trigger(const int status)
+  {
+    if ((status >= 0) && (status < status_length_))
+      status_[status].changed = true;
+  }
+
+  void setValue(const int status, const int value, const int32_t number)
+  {
+    Value *v = getValue(status, value);
+    if (v)
+    {
+      v->type = VALUE_INT;
+      v->number.i = number;
+    }
+  }
+
+  void setValue(const int status, const int value, const float number)
+  {
+    Value *v = getValue(status, value);
+    if (v)
+    {
+      v->type = VALUE_FLOAT;
+      v->number.f = number;
+    }
+  }
+
+  void setValue(const int status, const int value, const bool flag)
+  {
+    Value *v = getValue(status, value);
+    if (v)
+    {
+      v->type = VALUE_BOOL;
+      v->number.i = flag;
+    }
+  }
+
+  void setValue(const int status, const int value, const char *string)
+  {
+    Value *v = getValue(status, value);
+    if (v)
+    {
+      v->type = VALUE_STRING;
+      v->string = string;
+    }
+  }
+
+  /**
+   * @brief Publish changed statuses, or all of them once per period
+   *
+   * @return Number of statuses published
+   */
+  int update()
+  {
+    if (!nh_ || !nh_->connected())
+      return 0;
+
+    const unsigned long now = nh_->getHardware()->time();
+    const bool full = ((now - last_full_ms_) >= period_ms_) || (negotiation_ != nh_->getNegotiationCount());
+
+    if (!full && ((now - last_change_ms_) < min_period_ms_))
+      return 0;
+
+    int length = 0;
+    for (int i = 0; i < status_length_; i++)
+    {
+      if (full || status_[i].changed)
+        send_index_[length++] = i;
+    }
+
+    if (length == 0)
+      return 0;
+
+    const int published = publishBatches(send_index_, length);
+
+    if (full)
+    {
+      last_full_ms_ = now;
+      negotiation_ = nh_->getNegotiationCount();
+    }
+    last_change_ms_ = now;
+    return published;
+  }
+
+  int getStatusCount() const
+  {
+    return status_length_;
+  }
+
+  /* Statuses not published because they alone exceed the output buffer */
+  uint32_t getDropped() const
+  {
+    return dropped_;
+  }
+
+  /* Statuses whose publish failed, they are published again */
+  uint32_t getFailed() const
+  {
+    return failed_;
+  }
+
+  /* Write number with up to decimals decimal places, returns the length */
+  static int formatFloat(char *out, float number, const int decimals = 3)
+  {
+    char *p = out;
+
+    if (isnan(number))
+    {
+      strcpy(out, "nan");
+      return 3;
+    }
+    if (number < 0.0f)
+    {
+      *p++ = '-';
+      number = -number;
+    }
+    if (isinf(number))
+    {
+      strcpy(p, "inf");
+      return (p - out) + 3;
+    }
+
+    /* too large for the integer part, written as mantissa and exponent */
+    int exponent = 0;
+    if (number >= 1e9f)
+    {
+      while (number >= 10.0f)
+      {
+        number /= 10.0f;
+        exponent++;
+      }
+    }
+
+    uint32_t scale = 1;
+    for (int i = 0; i < decimals; i++)
+      scale *= 10;
+
+    uint32_t integer = (uint32_t) number;
+    uint32_t fraction = (uint32_t)((number - (float) integer) * (float) scale + 0.5f);
+    if (fraction >= scale)
+    {
+      integer++;
+      fraction -= scale;
+    }
+
+    p += formatUnsigned(p, integer);
+    if (decimals > 0)
+    {
+      *p++ = '.';
+      for (uint32_t div = scale / 10; div > 0; div /= 10)
+        *p++ = '0' + (fraction / div) % 10;
+    }
+    if (exponent > 0)
+    {
+      *p++ = 'e';
+      p += formatUnsigned(p, exponent);
+    }
+    *p = '\0';
+    return p - out;
+  }
+
+  /* Write number in decimal, returns the length */
+  static int formatInt(char *out, const int32_t number)
+  {
+    if (number < 0)
+    {
+      out[0] = '-';
+      return 1 + formatUnsigned(out + 1, 0u - (uint32_t) number);
+    }
+    return formatUnsigned(out, (uint32_t) number);
+  }
+
+private:
+  enum { VALUE_STRING, VALUE_INT, VALUE_FLOAT, VALUE_BOOL };
+
+  struct Value
+  {
+    const char *key;
+    const char *string;
+    union
+    {
+      int32_t i;
+      float f;
+    } number;
+    uint8_t type;
+    char text[VALUE_LEN];
+  };
+
+  struct Status
+  {
+    const char *name;
+    const char *message;
+    int8_t level;
+    bool changed;
+    int values_length;
+    Value values[MAX_VALUES];
+    diagnostic_msgs::KeyValue key_values[MAX_VALUES];
+  };
+
+  Value *getValue(const int status, const int value)
+  {
+    if ((status < 0) || (status >= status_length_) || (value < 0) || (value >= status_[status].values_length))
+      return 0;
+    return &status_[status].values[value];
+  }
+
+  static int formatUnsigned(char *out, uint32_t number)
+  {
+    char digits[10];
+    int length = 0;
+    do
+    {
+      digits[length++] = '0' + (number % 10);
+      number /= 10;
+    }
+    while (number > 0);
+
+    for (int i = 0; i < length; i++)
+      out[i] = digits[length - 1 - i];
+    out[length] = '\0';
+    return length;
+  }
+
+  /* Format the values of a status and fill the message status from it */
+  void prepare(Status &s, diagnostic_msgs::DiagnosticStatus &out)
+  {
+    for (int i = 0; i < s.values_length; i++)
+    {
+      Value &v = s.values[i];
+      const char *text = v.string;
+      if (v.type != VALUE_STRING)
+      {
+        char buffer[24];
+        if (v.type == VALUE_INT)
+          formatInt(buffer, v.number.i);
+        else if (v.type == VALUE_FLOAT)
+          formatFloat(buffer, v.number.f);
+        else
+          strcpy(buffer, v.number.i ? "True" : "False");
+        strncpy(v.text, buffer, VALUE_LEN - 1);
+        v.text[VALUE_LEN - 1] = '\0';
+        text = v.text;
+      }
+      s.key_values[i].key = v.key;
+      s.key_values[i].value = text;
+    }
+
+    out.level = s.level;
+    out.name = s.name;
+    out.message = s.message;
+    out.hardware_id = hardware_id_;
+    out.values_length = s.values_length;
+    out.values = s.key_values;
+  }
+
+  static int wireSize(const diagnostic_msgs::DiagnosticStatus &s)
+  {
+    int size = 1 + 4 + strlen(s.name) + 4 + strlen(s.message) + 4 + strlen(s.hardware_id) + 4;
+    for (uint32_t i = 0; i < s.values_length; i++)
+      size += 4 + strlen(s.values[i].key) + 4 + strlen(s.values[i].value);
+    return size;
+  }
+
+  /* Publish the given statuses in as few messages as fit the output buffer,
+   * returns the number of statuses published. index is reordered. */
+  int publishBatches(int *index, const int length)
+  {
+    /* frame header, message header, length of the status array and checksum */
+    const int budget = NodeHandleT::OUTPUT_BUFFER_SIZE - 7 - 16 - 4 - 1;
+    int count = 0;
+    int start = 0;
+
+    /* the node handle serializes before it checks the size, so a status
+     * which does not fit on its own must not be published at all. The
+     * others move to the front of index, in the order of send_. */
+    for (int i = 0; i < length; i++)
+    {
+      Status &s = status_[index[i]];
+      prepare(s, send_[count]);
+      if (wireSize(send_[count]) > budget)
+      {
+        dropped_++;
+        s.changed = false;
+      }
+      else
+      {
+        index[count++] = index[i];
+      }
+    }
+
+    int published = 0;
+    while (start < count)
+    {
+      int end = start;
+      int size = 0;
+      while ((end < count) && ((size + wireSize(send_[end])) <= budget))
+        size += wireSize(send_[end++]);
+
+      msg_.header.stamp = nh_->now();
+      msg_.status = &send_[start];
+      msg_.status_length = end - start;
+      const bool sent = publisher_.publish(msg_) > 0;
+
+      /* a status which did not go out is sent again with a later update */
+      for (int i = start; i < end; i++)
+        status_[index[i]].changed = !sent;
+      if (sent)
+        published += end - start;
+      else
+        failed_ += end - start;
+      start = end;
+    }
+    msg_.status = send_;
+    return published;
+  }
+
+  NodeHandleT *nh_;
+  diagnostic_msgs::DiagnosticArray msg_;
+  ros::StaticPublisher<diagnostic_msgs::DiagnosticArray, NodeHandleT> publisher_;
+  const char *hardware_id_;
+  uint32_t period_ms_;
+  uint32_t min_period_ms_;
+  unsigned long last_full_ms_;
+  unsigned long last_change_ms_;
+  uint32_t negotiation_;
+  uint32_t dropped_;
+  uint32_t failed_;
+
+  int status_length_;
+  Status status_[MAX_STATUS];
+  diagnostic_msgs::DiagnosticStatus send_[MAX_STATUS];
+  int send_index_[MAX_STATUS];
+};
+
+}
+
+#endif /* ROS_DIAGNOSTIC_UPDATER_H_ */
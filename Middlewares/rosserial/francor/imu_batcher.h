@@ -0,0 +1,250 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file imu_batcher.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Publisher sending IMU samples in batches
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef ROS_IMU_BATCHER_H_
+#define ROS_IMU_BATCHER_H_
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdint.h>
+#include <string.h>
+
+#include "ros/node_handle.h"
+#include "francor_msgs/ImuBatch.h"
+#include "sensor_msgs/Imu.h"
+/* -------------------------------------------------------------------------------*/
+
+namespace francor
+{
+
+/**
+ * @brief Publisher collecting IMU samples into francor_msgs/ImuBatch
+ *
+ * Every sample keeps its own time stamp as an offset to the stamp of the
+ * first sample of the batch. A batch is published when it is full, when
+ * the next sample would not fit the 32 bit nanosecond offset, or when the
+ * time jumps back. Covariances are shared by all samples of a batch.
+ *
+ * A sensor_msgs/Imu takes 312 bytes plus frame id and 8 bytes of framing.
+ * In a batch a sample takes 28 bytes, or 44 with orientation, plus its share
+ * of 148 bytes plus frame id for header, covariances and framing.
+ *
+ * On the host Tools/francor_msgs holds the message and the node
+ * imu_batch_expander.py, which republishes every batch as Imu messages.
+ * expand() does the same on the device, e.g. for a node receiving batches.
+ *
+ * @tparam NodeHandleT  Type of the node handle used for publishing
+ * @tparam BATCH_SIZE   Number of samples per batch
+ */
+template<typename NodeHandleT, int BATCH_SIZE = 10>
+class ImuBatcher
+{
+public:
+  ImuBatcher(const char *topic, const char *frame_id, const bool with_orientation = false) :
+    publisher_(topic, &msg_),
+    with_orientation_(with_orientation),
+    length_(0)
+  {
+    msg_.header.frame_id = frame_id;
+    msg_.time_offset = time_offset_;
+    msg_.orientation = orientation_;
+    msg_.angular_velocity = angular_velocity_;
+    msg_.linear_acceleration = linear_acceleration_;
+  }
+
+  void init(NodeHandleT &nh)
+  {
+    nh.advertise(publisher_);
+  }
+
+  /* Covariances sent with every batch, row major as in sensor_msgs/Imu */
+  void setCovariances(const float orientation[9], const float angular_velocity[9], const float linear_acceleration[9])
+  {
+    memcpy(msg_.orientation_covariance, orientation, sizeof(msg_.orientation_covariance));
+    memcpy(msg_.angular_velocity_covariance, angular_velocity, sizeof(msg_.angular_velocity_covariance));
+    memcpy(msg_.linear_acceleration_covariance, linear_acceleration, sizeof(msg_.linear_acceleration_covariance));
+  }
+
+  /**
+   * @brief Add a sample, publishing the batch if it is full
+   *
+   * @param orientation x, y, z, w, only used if the batcher was created
+   *                    with orientation
+   * @return Result of publish() if a batch was published, else 0
+   */
+  int addSample(const ros::Time &stamp, const float angular_velocity[3], const float linear_acceleration[3],
+                const float orientation[4] = 0)
+  {
+    int ret = 0;
+
+    if (length_ > 0)
+    {
+      const int64_t offset = ((int64_t) stamp.sec - (int64_t) msg_.header.stamp.sec) * 1000000000LL +
+                             ((int64_t) stamp.nsec - (int64_t) msg_.header.stamp.nsec);
+      if ((offset < 0) || (offset > 0xffffffffLL))
+        ret = flush();
+    }
+
+    if (length_ == 0)
+      msg_.header.stamp = stamp;
+
+    time_offset_[length_] = (uint32_t)(((int64_t) stamp.sec - (int64_t) msg_.header.stamp.sec) * 1000000000LL +
+                                       ((int64_t) stamp.nsec - (int64_t) msg_.header.stamp.nsec));
+    memcpy(&angular_velocity_[3 * length_], angular_velocity, 3 * sizeof(float));
+    memcpy(&linear_acceleration_[3 * length_], linear_acceleration, 3 * sizeof(float));
+    if (with_orientation_)
+    {
+      if (orientation)
+      {
+        memcpy(&orientation_[4 * length_], orientation, 4 * sizeof(float));
+      }
+      else
+      {
+        memset(&orientation_[4 * length_], 0, 3 * sizeof(float));
+        orientation_[4 * length_ + 3] = 1.0f;
+      }
+    }
+    length_++;
+
+    if (length_ == BATCH_SIZE)
+      ret = flush();
+
+    return ret;
+  }
+
+  /* Publish the samples collected so far, returns the result of publish() */
+  int flush()
+  {
+    if (length_ == 0)
+      return 0;
+
+    msg_.time_offset_length = length_;
+    msg_.orientation_length = with_orientation_ ? 4 * length_ : 0;
+    msg_.angular_velocity_length = 3 * length_;
+    msg_.linear_acceleration_length = 3 * length_;
+    length_ = 0;
+
+    return publisher_.publish(msg_);
+  }
+
+  /* Number of samples waiting for the next batch */
+  int getLength() const
+  {
+    return length_;
+  }
+
+  /* Number of samples in a received batch */
+  static uint32_t size(const francor_msgs::ImuBatch &batch)
+  {
+    return batch.time_offset_length;
+  }
+
+  /**
+   * @brief Sample idx of a received batch as sensor_msgs/Imu
+   *
+   * Batches without orientation give an orientation covariance with -1 as
+   * first element, which marks the orientation as unknown in ROS.
+   *
+   * @return false if the batch does not hold sample idx
+   */
+  static bool expand(const francor_msgs::ImuBatch &batch, const uint32_t idx, sensor_msgs::Imu &imu)
+  {
+    if ((idx >= batch.time_offset_length) ||
+        (batch.angular_velocity_length < 3 * batch.time_offset_length) ||
+        (batch.linear_acceleration_length < 3 * batch.time_offset_length))
+      return false;
+
+    const uint32_t offset = batch.time_offset[idx];
+    imu.header.seq = batch.header.seq;
+    imu.header.frame_id = batch.header.frame_id;
+    imu.header.stamp = ros::Time(batch.header.stamp.sec + offset / 1000000000UL,
+                                 batch.header.stamp.nsec + offset % 1000000000UL);
+
+    imu.angular_velocity.x = batch.angular_velocity[3 * idx];
+    imu.angular_velocity.y = batch.angular_velocity[3 * idx + 1];
+    imu.angular_velocity.z = batch.angular_velocity[3 * idx + 2];
+    imu.linear_acceleration.x = batch.linear_acceleration[3 * idx];
+    imu.linear_acceleration.y = batch.linear_acceleration[3 * idx + 1];
+    imu.linear_acceleration.z = batch.linear_acceleration[3 * idx + 2];
+
+    for (int i = 0; i < 9; i++)
+    {
+      imu.orientation_covariance[i] = batch.orientation_covariance[i];
+      imu.angular_velocity_covariance[i] = batch.angular_velocity_covariance[i];
+      imu.linear_acceleration_covariance[i] = batch.linear_acceleration_covariance[i];
+    }
+
+    if (batch.orientation_length >= 4 * batch.time_offset_length)
+    {
+      imu.orientation.x = batch.orientation[4 * idx];
+      imu.orientation.y = batch.orientation[4 * idx + 1];
+      imu.orientation.z = batch.orientation[4 * idx + 2];
+      imu.orientation.w = batch.orientation[4 * idx + 3];
+    }
+    else
+    {
+      imu.orientation.x = 0.0f;
+      imu.orientation.y = 0.0f;
+      imu.orientation.z = 0.0f;
+      imu.orientation.w = 1.0f;
+      imu.orientation_covariance[0] = -1.0f;
+    }
+
+    return true;
+  }
+
+private:
+  francor_msgs::ImuBatch msg_;
+  ros::StaticPublisher<francor_msgs::ImuBatch, NodeHandleT> publisher_;
+  bool with_orientation_;
+  int length_;
+
+  uint32_t time_offset_[BATCH_SIZE];
+  float orientation_[4 * BATCH_SIZE];
+  float angular_velocity_[3 * BATCH_SIZE];
+  float linear_acceleration_[3 * BATCH_SIZE];
+};
+
+}
+
+#endif /* ROS_IMU_BATCHER_H_ */
@@ -0,0 +1,269 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file laser_scan_streamer.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Publisher streaming laser scans sector by sector
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef ROS_LASER_SCAN_STREAMER_H_
+#define ROS_LASER_SCAN_STREAMER_H_
+
+/* Includes ----------------------------------------------------------------------*/
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "ros/node_handle.h"
+#include "sensor_msgs/LaserScan.h"
+/* -------------------------------------------------------------------------------*/
+
+namespace francor
+{
+
+/**
+ * @brief Publisher sending a sensor_msgs/LaserScan while it is measured
+ *
+ * The scan is written as one streamed frame of the node handle. The number
+ * of points per revolution is fixed by setGeometry(), so the length fields
+ * are known when the revolution starts and header, geometry and the ranges
+ * length are sent by begin(). Each sector given to addSector() is encoded
+ * through a buffer of CHUNK points and goes out right away. The frame is
+ * closed with the last point, so there is no full revolution in RAM and no
+ * burst at the end of it.
+ *
+ * Intensities would follow all ranges on the wire and are sent empty.
+ * While a scan is open the node handle holds one other frame and drops the
+ * rest, so spin it between revolutions. The scan is aborted when the
+ * hardware cannot take a chunk, or the host negotiates the topics again.
+ * The host discards an aborted scan and its remaining sectors are ignored.
+ * The frame is limited to 0x7fff bytes, about 8000 points.
+ *
+ * @tparam NodeHandleT  Type of the node handle used for publishing
+ * @tparam CHUNK        Number of points encoded at once
+ */
+template<typename NodeHandleT, int CHUNK = 16>
+class LaserScanStreamer
+{
+public:
+  LaserScanStreamer(const char *topic, const char *frame_id) :
+    publisher_(topic, &scan_),
+    nh_(0),
+    seq_(0),
+    remaining_(0),
+    open_(false)
+  {
+    scan_.header.frame_id = frame_id;
+  }
+
+  void init(NodeHandleT &nh)
+  {
+    nh_ = &nh;
+    nh.advertise(publisher_);
+  }
+
+  /**
+   * @brief Set the geometry of all following scans
+   *
+   * @param points Number of points per revolution
+   */
+  void setGeometry(const float angle_min, const float angle_increment, const uint32_t points,
+                   const float scan_time, const float range_min, const float range_max)
+  {
+    scan_.angle_min = angle_min;
+    scan_.angle_max = angle_min + angle_increment * (float)(points > 0 ? points - 1 : 0);
+    scan_.angle_increment = angle_increment;
+    scan_.time_increment = points > 0 ? scan_time / (float) points : 0.0f;
+    scan_.scan_time = scan_time;
+    scan_.range_min = range_min;
+    scan_.range_max = range_max;
+    scan_.ranges_length = points;
+  }
+
+  /* Serialized size of a scan without framing */
+  int getLength() const
+  {
+    return 16 + strlen(scan_.header.frame_id) + 28 + 4 + 4 * scan_.ranges_length + 4;
+  }
+
+  /**
+   * @brief Start a scan, an unfinished one is completed first
+   *
+   * @param stamp Time of the first point
+   * @return false if the scan cannot be sent, its sectors are ignored then
+   */
+  bool begin(const ros::Time &stamp)
+  {
+    finish();
+
+    if (!nh_ || !nh_->beginFrame(publisher_.id_, getLength()))
+      return false;
+
+    unsigned char buffer[32];
+    int offset = 0;
+    offset += ros::Msg::encode(buffer + offset, seq_++);
+    offset += ros::Msg::encode(buffer + offset, stamp.sec);
+    offset += ros::Msg::encode(buffer + offset, stamp.nsec);
+    offset += ros::Msg::encode(buffer + offset, (uint32_t) strlen(scan_.header.frame_id));
+    open_ = true;
+    if (!write(buffer, offset) || !write((uint8_t *) scan_.header.frame_id, strlen(scan_.header.frame_id)))
+      return false;
+
+    offset = 0;
+    offset += ros::Msg::encode(buffer + offset, scan_.angle_min);
+    offset += ros::Msg::encode(buffer + offset, scan_.angle_max);
+    offset += ros::Msg::encode(buffer + offset, scan_.angle_increment);
+    offset += ros::Msg::encode(buffer + offset, scan_.time_increment);
+    offset += ros::Msg::encode(buffer + offset, scan_.scan_time);
+    offset += ros::Msg::encode(buffer + offset, scan_.range_min);
+    offset += ros::Msg::encode(buffer + offset, scan_.range_max);
+    offset += ros::Msg::encode(buffer + offset, scan_.ranges_length);
+    if (!write(buffer, offset))
+      return false;
+
+    remaining_ = scan_.ranges_length;
+    return closeIfDone();
+  }
+
+  /**
+   * @brief Send the next sector of the open scan
+   *
+   * @return Number of points sent, points beyond the revolution are dropped.
+   *         0 if the scan was aborted.
+   */
+  uint32_t addSector(const float *ranges, const uint32_t count)
+  {
+    if (!isOpen())
+      return 0;
+
+    const uint32_t sent = count < remaining_ ? count : remaining_;
+    for (uint32_t i = 0; i < sent; i += CHUNK)
+    {
+      const uint32_t n = (sent - i) < (uint32_t) CHUNK ? (sent - i) : (uint32_t) CHUNK;
+      for (uint32_t j = 0; j < n; j++)
+        ros::Msg::encode(chunk_ + 4 * j, ranges[i + j]);
+      if (!write(chunk_, 4 * n))
+        return 0;
+    }
+    remaining_ -= sent;
+
+    return closeIfDone() ? sent : 0;
+  }
+
+  /**
+   * @brief Complete the open scan, missing points are sent as NaN
+   *
+   * @return false if no scan was open or it was aborted
+   */
+  bool finish()
+  {
+    if (!isOpen())
+      return false;
+
+    const float nan = NAN;
+    for (int j = 0; j < CHUNK; j++)
+      ros::Msg::encode(chunk_ + 4 * j, nan);
+    while (remaining_ > 0)
+    {
+      const uint32_t n = remaining_ < (uint32_t) CHUNK ? remaining_ : (uint32_t) CHUNK;
+      if (!write(chunk_, 4 * n))
+        return false;
+      remaining_ -= n;
+    }
+    return closeIfDone();
+  }
+
+  bool isOpen()
+  {
+    /* the node handle closed the frame when the host renegotiated */
+    if (open_ && (nh_->getFrameRemaining() < 0))
+    {
+      open_ = false;
+      remaining_ = 0;
+    }
+    return open_;
+  }
+
+  /* Points still missing in the open scan */
+  uint32_t getRemaining() const
+  {
+    return remaining_;
+  }
+
+private:
+  /* Write to the open frame, abort the scan if the node handle cannot take it */
+  bool write(uint8_t *data, const int length)
+  {
+    if (nh_->writeFrame(data, length))
+      return true;
+
+    nh_->abortFrame();
+    open_ = false;
+    remaining_ = 0;
+    return false;
+  }
+
+  /* Send the intensities and close the frame after the last point */
+  bool closeIfDone()
+  {
+    if (!open_ || remaining_ > 0)
+      return true;
+
+    unsigned char buffer[4];
+    if (!write(buffer, ros::Msg::encode(buffer, (uint32_t) 0)))
+      return false;
+    open_ = false;
+    if (nh_->endFrame())
+      return true;
+    nh_->abortFrame();
+    return false;
+  }
+
+  sensor_msgs::LaserScan scan_;
+  ros::Publisher publisher_;
+  NodeHandleT *nh_;
+  uint32_t seq_;
+  uint32_t remaining_;
+  bool open_;
+  unsigned char chunk_[4 * CHUNK];
+};
+
+}
+
+#endif /* ROS_LASER_SCAN_STREAMER_H_ */
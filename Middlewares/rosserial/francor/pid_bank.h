@@ -0,0 +1,390 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file pid_bank.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Banks of float and Q15 PID controllers
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef ROS_PID_BANK_H_
+#define ROS_PID_BANK_H_
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdint.h>
+#include <string.h>
+/* -------------------------------------------------------------------------------*/
+
+namespace francor
+{
+
+/**
+ * @brief Dual 16 bit lane operations of the Cortex-M4 DSP extension
+ *
+ * Two Q15 values are packed into one word, lane 0 in the lower half. On
+ * targets without the DSP extension, e.g. host builds, the same results
+ * are computed in C.
+ */
+namespace dsp
+{
+
+static inline int32_t lo(const uint32_t x)
+{
+  return (int16_t)(x & 0xffffu);
+}
+
+static inline int32_t hi(const uint32_t x)
+{
+  return (int16_t)(x >> 16);
+}
+
+static inline int32_t ssat16(const int32_t x)
+{
+#if defined(__ARM_FEATURE_DSP)
+  int32_t r;
+  __asm__ ("ssat %0, #16, %1" : "=r"(r) : "r"(x));
+  return r;
+#else
+  return x > 32767 ? 32767 : (x < -32768 ? -32768 : x);
+#endif
+}
+
+static inline uint32_t pack(const int32_t low, const int32_t high)
+{
+  return ((uint32_t) low & 0xffffu) | ((uint32_t) high << 16);
+}
+
+/* Saturating add of both lanes */
+static inline uint32_t qadd16(const uint32_t a, const uint32_t b)
+{
+#if defined(__ARM_FEATURE_DSP)
+  uint32_t r;
+  __asm__ ("qadd16 %0, %1, %2" : "=r"(r) : "r"(a), "r"(b));
+  return r;
+#else
+  return pack(ssat16(lo(a) + lo(b)), ssat16(hi(a) + hi(b)));
+#endif
+}
+
+/* Saturating subtract of both lanes */
+static inline uint32_t qsub16(const uint32_t a, const uint32_t b)
+{
+#if defined(__ARM_FEATURE_DSP)
+  uint32_t r;
+  __asm__ ("qsub16 %0, %1, %2" : "=r"(r) : "r"(a), "r"(b));
+  return r;
+#else
+  return pack(ssat16(lo(a) - lo(b)), ssat16(hi(a) - hi(b)));
+#endif
+}
+
+/* acc + lo(a) * lo(b) + hi(a) * hi(b) */
+static inline int32_t smlad(const uint32_t a, const uint32_t b, const int32_t acc)
+{
+#if defined(__ARM_FEATURE_DSP)
+  int32_t r;
+  __asm__ ("smlad %0, %1, %2, %3" : "=r"(r) : "r"(a), "r"(b), "r"(acc));
+  return r;
+#else
+  return (int32_t)((uint32_t) acc + (uint32_t)(lo(a) * lo(b)) + (uint32_t)(hi(a) * hi(b)));
+#endif
+}
+
+/* lo(a) * lo(b) */
+static inline int32_t smulbb(const uint32_t a, const uint32_t b)
+{
+#if defined(__ARM_FEATURE_DSP)
+  int32_t r;
+  __asm__ ("smulbb %0, %1, %2" : "=r"(r) : "r"(a), "r"(b));
+  return r;
+#else
+  return lo(a) * lo(b);
+#endif
+}
+
+/* hi(a) * hi(b) */
+static inline int32_t smultt(const uint32_t a, const uint32_t b)
+{
+#if defined(__ARM_FEATURE_DSP)
+  int32_t r;
+  __asm__ ("smultt %0, %1, %2" : "=r"(r) : "r"(a), "r"(b));
+  return r;
+#else
+  return hi(a) * hi(b);
+#endif
+}
+
+}
+
+/**
+ * @brief State of one channel of a PID bank, as used for telemetry
+ */
+struct PidSample
+{
+  float error;    //!< Setpoint - measurement
+  float delta;    //!< Change of the error in the last cycle
+  float p_term;
+  float i_term;
+  float d_term;
+  float i_max;
+  float i_min;
+  float output;
+};
+
+/**
+ * @brief Bank of float PID controllers
+ *
+ * The state is stored as one array per quantity, so update() runs one
+ * tight loop over all channels. The integral holds the integral term, it
+ * is limited to +-i_max. The output is limited to +-out_max.
+ *
+ * @tparam CHANNELS Number of controllers
+ */
+template<int CHANNELS>
+class PidBank
+{
+public:
+  enum { SIZE = CHANNELS };
+
+  PidBank()
+  {
+    for (int c = 0; c < CHANNELS; c++)
+    {
+      setGains(c, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+      reset(c);
+    }
+  }
+
+  void setGains(const int channel, const float kp, const float ki, const float kd, const float i_max,
+                const float out_max)
+  {
+    kp_[channel] = kp;
+    ki_[channel] = ki;
+    kd_[channel] = kd;
+    i_max_[channel] = i_max;
+    out_max_[channel] = out_max;
+  }
+
+  void reset(const int channel)
+  {
+    error_[channel] = 0.0f;
+    delta_[channel] = 0.0f;
+    integral_[channel] = 0.0f;
+    output_[channel] = 0.0f;
+  }
+
+  /* One control cycle of all channels, dt is the cycle time in s */
+  void update(const float *setpoint, const float *measured, float *output, const float dt)
+  {
+    const float inv_dt = 1.0f / dt;
+
+    for (int c = 0; c < CHANNELS; c++)
+    {
+      const float e = setpoint[c] - measured[c];
+      const float de = e - error_[c];
+
+      float i = integral_[c] + ki_[c] * dt * e;
+      i = i > i_max_[c] ? i_max_[c] : (i < -i_max_[c] ? -i_max_[c] : i);
+
+      float u = kp_[c] * e + i + kd_[c] * de * inv_dt;
+      u = u > out_max_[c] ? out_max_[c] : (u < -out_max_[c] ? -out_max_[c] : u);
+
+      error_[c] = e;
+      delta_[c] = de;
+      integral_[c] = i;
+      output_[c] = u;
+      output[c] = u;
+    }
+  }
+
+  void getSample(const int channel, PidSample &sample, const float dt) const
+  {
+    sample.error = error_[channel];
+    sample.delta = delta_[channel];
+    sample.p_term = kp_[channel] * error_[channel];
+    sample.i_term = integral_[channel];
+    sample.d_term = kd_[channel] * delta_[channel] / dt;
+    sample.i_max = i_max_[channel];
+    sample.i_min = -i_max_[channel];
+    sample.output = output_[channel];
+  }
+
+private:
+  float kp_[CHANNELS];
+  float ki_[CHANNELS];
+  float kd_[CHANNELS];
+  float i_max_[CHANNELS];
+  float out_max_[CHANNELS];
+
+  float error_[CHANNELS];
+  float delta_[CHANNELS];
+  float integral_[CHANNELS];
+  float output_[CHANNELS];
+};
+
+/**
+ * @brief Bank of Q15 fixed point PID controllers
+ *
+ * Setpoints, measurements and outputs are Q15 values in [-1, 1). Two
+ * channels are processed at once with the dual 16 bit instructions of the
+ * Cortex-M4: error, error change and integral are computed for both lanes
+ * in one instruction each, and P and D term of a channel are one dual
+ * multiply accumulate. Gains are Q12, so they are limited to [-8, 8) per
+ * cycle. The integral saturates at +-1.
+ *
+ * @tparam CHANNELS Number of controllers, must be even
+ */
+template<int CHANNELS>
+class PidBankQ15
+{
+  static_assert((CHANNELS % 2) == 0, "PidBankQ15 processes channels in pairs");
+
+public:
+  enum { SIZE = CHANNELS, GAIN_SHIFT = 12 };
+
+  PidBankQ15()
+  {
+    memset(gains_pd_, 0, sizeof(gains_pd_));
+    memset(gains_i_, 0, sizeof(gains_i_));
+    memset(error_, 0, sizeof(error_));
+    memset(delta_, 0, sizeof(delta_));
+    memset(integral_, 0, sizeof(integral_));
+    memset(output_, 0, sizeof(output_));
+  }
+
+  /* Gains of a controller with cycle time dt, converted to Q12 per cycle */
+  void setGains(const int channel, const float kp, const float ki, const float kd, const float dt)
+  {
+    const int32_t p = toQ12(kp);
+    const int32_t i = toQ12(ki * dt);
+    const int32_t d = toQ12(kd / dt);
+    const int pair = channel / 2;
+
+    gains_pd_[channel] = dsp::pack(p, d);
+    if (channel & 1)
+      gains_i_[pair] = dsp::pack(dsp::lo(gains_i_[pair]), i);
+    else
+      gains_i_[pair] = dsp::pack(i, dsp::hi(gains_i_[pair]));
+  }
+
+  void reset(const int channel)
+  {
+    const int pair = channel / 2;
+    const int shift = (channel & 1) ? 16 : 0;
+    error_[pair] &= ~(0xffffu << shift);
+    delta_[pair] &= ~(0xffffu << shift);
+    integral_[pair] &= ~(0xffffu << shift);
+    output_[channel] = 0;
+  }
+
+  /* One control cycle of all channels, the arrays need no alignment */
+  void update(const int16_t *setpoint, const int16_t *measured, int16_t *output)
+  {
+    for (int p = 0; p < CHANNELS / 2; p++)
+    {
+      /* a pair of lanes is one word, memcpy is a single LDR/STR on the M4 */
+      uint32_t sp, ms, out;
+      memcpy(&sp, setpoint + 2 * p, sizeof(sp));
+      memcpy(&ms, measured + 2 * p, sizeof(ms));
+
+      const uint32_t e = dsp::qsub16(sp, ms);
+      const uint32_t de = dsp::qsub16(e, error_[p]);
+
+      /* rounded, a plain shift would let the integral drift negative */
+      const int32_t i0 = dsp::ssat16((dsp::smulbb(gains_i_[p], e) + (1 << (GAIN_SHIFT - 1))) >> GAIN_SHIFT);
+      const int32_t i1 = dsp::ssat16((dsp::smultt(gains_i_[p], e) + (1 << (GAIN_SHIFT - 1))) >> GAIN_SHIFT);
+      const uint32_t integral = dsp::qadd16(integral_[p], dsp::pack(i0, i1));
+
+      /* (error, error change) of each lane against its (kp, kd) */
+      const uint32_t x0 = (e & 0xffffu) | (de << 16);
+      const uint32_t x1 = (de & 0xffff0000u) | (e >> 16);
+      const int32_t u0 = dsp::ssat16((dsp::smlad(x0, gains_pd_[2 * p], 0) >> GAIN_SHIFT) + dsp::lo(integral));
+      const int32_t u1 = dsp::ssat16((dsp::smlad(x1, gains_pd_[2 * p + 1], 0) >> GAIN_SHIFT) + dsp::hi(integral));
+
+      error_[p] = e;
+      delta_[p] = de;
+      integral_[p] = integral;
+      out = dsp::pack(u0, u1);
+      memcpy(output + 2 * p, &out, sizeof(out));
+      output_[2 * p] = u0;
+      output_[2 * p + 1] = u1;
+    }
+  }
+
+  void getSample(const int channel, PidSample &sample, const float) const
+  {
+    const int pair = channel / 2;
+    const bool high = channel & 1;
+    const int32_t e = high ? dsp::hi(error_[pair]) : dsp::lo(error_[pair]);
+    const int32_t de = high ? dsp::hi(delta_[pair]) : dsp::lo(delta_[pair]);
+    const int32_t i = high ? dsp::hi(integral_[pair]) : dsp::lo(integral_[pair]);
+    const float scale = 1.0f / 32768.0f;
+
+    sample.error = e * scale;
+    sample.delta = de * scale;
+    sample.p_term = ((dsp::lo(gains_pd_[channel]) * e) >> GAIN_SHIFT) * scale;
+    sample.i_term = i * scale;
+    sample.d_term = ((dsp::hi(gains_pd_[channel]) * de) >> GAIN_SHIFT) * scale;
+    sample.i_max = 1.0f;
+    sample.i_min = -1.0f;
+    sample.output = output_[channel] * scale;
+  }
+
+  static int16_t toQ15(const float value)
+  {
+    return (int16_t) dsp::ssat16((int32_t)(value * 32768.0f + (value < 0.0f ? -0.5f : 0.5f)));
+  }
+
+private:
+  static int32_t toQ12(const float value)
+  {
+    return dsp::ssat16((int32_t)(value * (1 << GAIN_SHIFT) + (value < 0.0f ? -0.5f : 0.5f)));
+  }
+
+  uint32_t gains_pd_[CHANNELS];
+  uint32_t gains_i_[CHANNELS / 2];
+
+  uint32_t error_[CHANNELS / 2];
+  uint32_t delta_[CHANNELS / 2];
+  uint32_t integral_[CHANNELS / 2];
+  int16_t output_[CHANNELS];
+};
+
+}
+
+#endif /* ROS_PID_BANK_H_ */
@@ -0,0 +1,240 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file pid_telemetry.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Decimated PidState telemetry of a PID bank
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef ROS_PID_TELEMETRY_H_
+#define ROS_PID_TELEMETRY_H_
+
+/* Includes ----------------------------------------------------------------------*/
+#include <atomic>
+#include <math.h>
+#include <stdint.h>
+
+#include "ros/node_handle.h"
+#include "control_msgs/PidState.h"
+#include "francor/pid_bank.h"
+/* -------------------------------------------------------------------------------*/
+
+namespace francor
+{
+
+/**
+ * @brief control_msgs/PidState publisher for a PID bank
+ *
+ * sample() is called from the control interrupt after the bank update. On
+ * every DECIMATION-th cycle it copies the state of the next channel, round
+ * robin, into a ring buffer. update() is called from the main loop and
+ * publishes the stored states, one message per channel with the channel
+ * name as frame_id.
+ *
+ * A state is only published when error or output changed by more than the
+ * deadband since the last published state of the channel, or when the
+ * channel was skipped keepalive times in a row. If the ring is full,
+ * samples are dropped and counted.
+ *
+ * The banks integrate ki * error, so i_error holds the integral term as
+ * well.
+ *
+ * @tparam NodeHandleT  Type of the node handle used for publishing
+ * @tparam CHANNELS     Number of channels of the bank
+ * @tparam RING         Number of buffered states, a power of two
+ */
+template<typename NodeHandleT, int CHANNELS, int RING = 16>
+class PidTelemetry
+{
+  static_assert((RING & (RING - 1)) == 0, "RING has to be a power of two");
+
+public:
+  /**
+   * @param topic       Topic of the PidState messages
+   * @param names       Name of each channel, not copied
+   * @param dt          Cycle time of the bank in s
+   * @param decimation  Control cycles per stored state
+   * @param deadband    Minimum change of error or output to publish
+   * @param keepalive   Maximum number of skipped states per channel
+   */
+  PidTelemetry(const char *topic, const char *const *names, const float dt, const uint32_t decimation = 100,
+               const float deadband = 0.01f, const uint32_t keepalive = 10) :
+    publisher_(topic, &msg_),
+    names_(names),
+    dt_(dt),
+    decimation_(decimation ? decimation : 1),
+    deadband_(deadband),
+    keepalive_(keepalive),
+    cycle_(0),
+    channel_(0),
+    head_(0),
+    tail_(0),
+    dropped_(0)
+  {
+    msg_.timestep.fromSec(dt);
+    for (int c = 0; c < CHANNELS; c++)
+    {
+      skipped_[c] = keepalive;
+      memset(&last_[c], 0, sizeof(PidSample));
+    }
+  }
+
+  void init(NodeHandleT &nh)
+  {
+    nh.advertise(publisher_);
+  }
+
+  /* Store the state of the next channel on every DECIMATION-th call, call from the control interrupt */
+  template<typename BankT>
+  void sample(const BankT &bank, const ros::Time &now)
+  {
+    if (++cycle_ < decimation_)
+      return;
+    cycle_ = 0;
+
+    const int channel = channel_;
+    channel_ = (channel + 1 < CHANNELS) ? channel + 1 : 0;
+
+    const uint32_t head = head_;
+    if (head - tail_ >= (uint32_t) RING)
+    {
+      dropped_++;
+      return;
+    }
+
+    Entry &entry = ring_[head & (RING - 1)];
+    entry.channel = channel;
+    entry.stamp = now;
+    bank.getSample(channel, entry.sample, dt_);
+    /* the entry is written before update() can see it, volatile only
+     * orders head_ against other volatile accesses */
+    std::atomic_signal_fence(std::memory_order_release);
+    head_ = head + 1;
+  }
+
+  /**
+   * @brief Publish stored states, call from the main loop
+   *
+   * @param max_msgs  Maximum number of messages published by this call
+   * @return Number of published messages
+   */
+  int update(const int max_msgs = 4)
+  {
+    int count = 0;
+
+    while ((count < max_msgs) && (tail_ != head_))
+    {
+      std::atomic_signal_fence(std::memory_order_acquire);
+      const Entry &entry = ring_[tail_ & (RING - 1)];
+      const int c = entry.channel;
+      const PidSample &s = entry.sample;
+
+      if ((skipped_[c] >= keepalive_) || (fabsf(s.error - last_[c].error) > deadband_) ||
+          (fabsf(s.output - last_[c].output) > deadband_))
+      {
+        msg_.header.stamp = entry.stamp;
+        msg_.header.frame_id = names_[c];
+        msg_.error = s.error;
+        msg_.error_dot = s.delta / dt_;
+        msg_.p_error = s.error;
+        msg_.i_error = s.i_term;
+        msg_.d_error = s.delta / dt_;
+        msg_.p_term = s.p_term;
+        msg_.i_term = s.i_term;
+        msg_.d_term = s.d_term;
+        msg_.i_max = s.i_max;
+        msg_.i_min = s.i_min;
+        msg_.output = s.output;
+        publisher_.publish(msg_);
+
+        last_[c] = s;
+        skipped_[c] = 0;
+        count++;
+      }
+      else
+      {
+        skipped_[c]++;
+      }
+      /* the entry is read before sample() may overwrite it */
+      std::atomic_signal_fence(std::memory_order_release);
+      tail_ = tail_ + 1;
+    }
+    return count;
+  }
+
+  /* Number of states lost because the ring was full */
+  uint32_t getDropped() const
+  {
+    return dropped_;
+  }
+
+private:
+  struct Entry
+  {
+    int channel;
+    ros::Time stamp;
+    PidSample sample;
+  };
+
+  control_msgs::PidState msg_;
+  ros::StaticPublisher<control_msgs::PidState, NodeHandleT> publisher_;
+
+  const char *const *names_;
+  const float dt_;
+  const uint32_t decimation_;
+  const float deadband_;
+  const uint32_t keepalive_;
+
+  /* written by sample() only */
+  uint32_t cycle_;
+  int channel_;
+  volatile uint32_t head_;
+
+  /* written by update() only */
+  volatile uint32_t tail_;
+  PidSample last_[CHANNELS];
+  uint32_t skipped_[CHANNELS];
+
+  volatile uint32_t dropped_;
+  Entry ring_[RING];
+};
+
+}
+
+#endif /* ROS_PID_TELEMETRY_H_ */
@@ -0,0 +1,169 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file profile_diagnostics.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Cycle profile of the node handle as diagnostics
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef ROS_PROFILE_DIAGNOSTICS_H_
+#define ROS_PROFILE_DIAGNOSTICS_H_
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdint.h>
+
+#include "ros/profiler.h"
+#include "diagnostic_msgs/DiagnosticStatus.h"
+/* -------------------------------------------------------------------------------*/
+
+namespace francor
+{
+
+/**
+ * @brief Report the histograms of a ros::CycleProfiler as diagnostics
+ *
+ * Adds the statuses "rosserial cycles mean" and "rosserial cycles max"
+ * with one value per stage to a DiagnosticUpdater, and optionally one
+ * status per topic with count, mean, 90th percentile and max. The updater
+ * needs PROFILE_STAGES values per status. Values are copied by update(),
+ * call it before the update() of the updater. Values are in cycles.
+ *
+ * @tparam UpdaterT   Type of the DiagnosticUpdater
+ * @tparam ProfilerT  Type of the profiler of the node handle
+ */
+template<typename UpdaterT, typename ProfilerT>
+class ProfileDiagnostics
+{
+public:
+  enum { MAX_TOPICS = 4 };
+
+  ProfileDiagnostics(UpdaterT &updater, const ProfilerT &profiler) :
+    updater_(updater),
+    profiler_(profiler),
+    mean_(-1),
+    max_(-1),
+    topics_length_(0)
+  {
+  }
+
+  /* Register the stage statuses, returns false if the updater is full */
+  bool init()
+  {
+    mean_ = addStatus("rosserial cycles mean");
+    max_ = addStatus("rosserial cycles max");
+    if ((mean_ < 0) || (max_ < 0))
+      return false;
+
+    for (int stage = 0; stage < ros::PROFILE_STAGES; stage++)
+    {
+      if ((updater_.addValue(mean_, ProfilerT::getStageName(stage)) < 0) ||
+          (updater_.addValue(max_, ProfilerT::getStageName(stage)) < 0))
+        return false;
+    }
+    return true;
+  }
+
+  /* Register a status for topic id named name, returns false if there is no space */
+  bool addTopic(const int id, const char *name)
+  {
+    if ((topics_length_ >= MAX_TOPICS) || !profiler_.getTopic(id))
+      return false;
+
+    const int status = addStatus(name);
+    if ((status < 0) || (updater_.addValue(status, "count") < 0) || (updater_.addValue(status, "mean") < 0) ||
+        (updater_.addValue(status, "p90") < 0) || (updater_.addValue(status, "max") < 0))
+      return false;
+
+    topics_[topics_length_].id = id;
+    topics_[topics_length_].status = status;
+    topics_length_++;
+    return true;
+  }
+
+  /* Copy the current histograms into the updater */
+  void update()
+  {
+    for (int stage = 0; stage < ros::PROFILE_STAGES; stage++)
+    {
+      const typename ProfilerT::Histogram &h = profiler_.getStage(stage);
+      updater_.setValue(mean_, stage, clamp(h.mean()));
+      updater_.setValue(max_, stage, clamp(h.max));
+    }
+
+    for (int i = 0; i < topics_length_; i++)
+    {
+      const typename ProfilerT::Histogram &h = *profiler_.getTopic(topics_[i].id);
+      updater_.setValue(topics_[i].status, 0, clamp(h.count));
+      updater_.setValue(topics_[i].status, 1, clamp(h.mean()));
+      updater_.setValue(topics_[i].status, 2, clamp(h.percentile(90)));
+      updater_.setValue(topics_[i].status, 3, clamp(h.max));
+    }
+  }
+
+private:
+  struct Topic
+  {
+    int id;
+    int status;
+  };
+
+  int addStatus(const char *name)
+  {
+    const int status = updater_.addStatus(name);
+    updater_.setStatus(status, diagnostic_msgs::DiagnosticStatus::OK, "");
+    return status;
+  }
+
+  static int32_t clamp(const uint32_t value)
+  {
+    return value > 0x7fffffffu ? 0x7fffffff : (int32_t) value;
+  }
+
+  UpdaterT &updater_;
+  const ProfilerT &profiler_;
+
+  int mean_;
+  int max_;
+  Topic topics_[MAX_TOPICS];
+  int topics_length_;
+};
+
+}
+
+#endif /* ROS_PROFILE_DIAGNOSTICS_H_ */
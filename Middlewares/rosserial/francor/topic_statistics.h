@@ -0,0 +1,194 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file topic_statistics.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Per topic link statistics as rosgraph_msgs/TopicStatistics
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef ROS_TOPIC_STATISTICS_H_
+#define ROS_TOPIC_STATISTICS_H_
+
+/* Includes ----------------------------------------------------------------------*/
+#include <math.h>
+#include <stdint.h>
+
+#include "ros/node_handle.h"
+#include "rosgraph_msgs/TopicStatistics.h"
+/* -------------------------------------------------------------------------------*/
+
+namespace francor
+{
+
+/**
+ * @brief Publisher of the link statistics the node handle keeps per topic
+ *
+ * At the end of every window one rosgraph_msgs/TopicStatistics per
+ * registered topic is due and a new window starts. update() publishes at
+ * most max_msgs of them per call, round robin over the topics, so the
+ * burst fits the output path. The counters of a topic are taken and reset
+ * when its message is published, a topic which waited for later calls also
+ * counts the frames of those cycles. The statistics topic itself is not
+ * reported, its counters would only show the statistics burst.
+ * delivered_msgs, traffic and the period are taken from the frames
+ * sent or received on the topic, traffic includes the framing. For
+ * publishers dropped_msgs counts frames which were not sent, e.g. before
+ * the host connected or because they did not fit into the output buffer.
+ * For subscribers it counts frames with a wrong checksum or which were not
+ * received completely. Frames too large for the input buffer are dropped
+ * before their topic is known and are not counted. Stamp ages are not
+ * measured, messages are not parsed for their stamps.
+ *
+ * @tparam NodeHandleT  Type of the node handle used for publishing
+ */
+template<typename NodeHandleT>
+class TopicStatistics
+{
+public:
+  /**
+   * @param node_name  Name of this node, used as node_pub or node_sub
+   * @param window_ms  Length of a window
+   */
+  TopicStatistics(const char *node_name, const uint32_t window_ms = 1000, const char *topic = "/statistics") :
+    nh_(0),
+    publisher_(topic, &msg_),
+    node_name_(node_name),
+    window_ms_(window_ms),
+    window_start_ms_(0),
+    next_id_(0)
+  {
+  }
+
+  void init(NodeHandleT &nh)
+  {
+    nh_ = &nh;
+    nh.advertise(publisher_);
+    window_start_ = nh.now();
+    window_start_ms_ = nh.getHardware()->time();
+  }
+
+  /**
+   * @brief Publish the statistics due since the end of a window, call from
+   *        the main loop
+   *
+   * @param max_msgs  Maximum number of messages published by this call
+   * @return Number of published messages
+   */
+  int update(const int max_msgs = 2)
+  {
+    if (next_id_ == 0)
+    {
+      if ((nh_->getHardware()->time() - window_start_ms_) < window_ms_)
+        return 0;
+
+      window_stop_ = nh_->now();
+      window_start_ms_ = nh_->getHardware()->time();
+      next_id_ = 100;
+    }
+
+    int sent = 0;
+    int count = 0;
+
+    msg_.window_start = window_start_;
+    msg_.window_stop = window_stop_;
+
+    /* empty slots are skipped even without budget left, so the window is
+     * done with the call publishing its last message */
+    for (; next_id_ < 100 + NodeHandleT::TOPIC_SLOTS; next_id_++)
+    {
+      const int id = next_id_;
+      const char *name = nh_->getTopicName(id);
+      if (!name || (id == publisher_.id_))
+        continue;
+      if (sent >= max_msgs)
+        break;
+
+      const ros::TopicCounters c = *nh_->getCounters(id);
+      nh_->getCounters(id)->reset();
+      const bool pub = nh_->isPublisherId(id);
+
+      msg_.topic = name;
+      msg_.node_pub = pub ? node_name_ : "";
+      msg_.node_sub = pub ? "" : node_name_;
+      msg_.delivered_msgs = c.msgs;
+      msg_.dropped_msgs = c.drops + c.checksum_errors;
+      msg_.traffic = c.bytes;
+
+      float mean = 0.0f;
+      float stddev = 0.0f;
+      if (c.periods > 0)
+      {
+        mean = (float) c.period_sum_ms / c.periods;
+        const float variance = (float) c.period_sq_sum / c.periods - mean * mean;
+        stddev = variance > 0.0f ? sqrtf(variance) : 0.0f;
+      }
+      msg_.period_mean.fromSec(mean * 0.001f);
+      msg_.period_stddev.fromSec(stddev * 0.001f);
+      msg_.period_max = ros::Duration(c.period_max_ms / 1000, (c.period_max_ms % 1000) * 1000000UL);
+
+      sent++;
+      if (publisher_.publish(msg_) > 0)
+        count++;
+    }
+
+    if (next_id_ >= 100 + NodeHandleT::TOPIC_SLOTS)
+    {
+      next_id_ = 0;
+      window_start_ = window_stop_;
+    }
+    return count;
+  }
+
+private:
+  NodeHandleT *nh_;
+
+  rosgraph_msgs::TopicStatistics msg_;
+  ros::StaticPublisher<rosgraph_msgs::TopicStatistics, NodeHandleT> publisher_;
+
+  const char *node_name_;
+  const uint32_t window_ms_;
+  uint32_t window_start_ms_;
+  ros::Time window_start_;
+  ros::Time window_stop_;
+  int next_id_;     /* next topic of the window being published, 0 if none */
+};
+
+}
+
+#endif /* ROS_TOPIC_STATISTICS_H_ */
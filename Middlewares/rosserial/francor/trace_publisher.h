@@ -0,0 +1,135 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file trace_publisher.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Debug topic for the node handle event trace
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef ROS_TRACE_PUBLISHER_H_
+#define ROS_TRACE_PUBLISHER_H_
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdint.h>
+
+#include "ros/node_handle.h"
+#include "ros/trace.h"
+#include "std_msgs/UInt8MultiArray.h"
+/* -------------------------------------------------------------------------------*/
+
+namespace francor
+{
+
+/**
+ * @brief Drain a ros::TraceRing over a debug topic
+ *
+ * Every update() publishes the recorded entries as std_msgs/UInt8MultiArray,
+ * 8 bytes per entry as laid out in ros::TraceEntry, little endian. The
+ * number of entries lost so far is sent as layout.data_offset. Tracing is
+ * paused while the trace itself is published, so draining does not fill the
+ * ring again. bench/trace_to_chrome.py turns the entries into a timeline.
+ *
+ * @tparam NodeHandleT  Type of the node handle used for publishing
+ * @tparam TracerT      Type of the tracer of the node handle
+ * @tparam MAX_ENTRIES  Maximum number of entries per message
+ */
+template<typename NodeHandleT, typename TracerT, int MAX_ENTRIES = 32>
+class TracePublisher
+{
+public:
+  enum { ENTRY_SIZE = 8 };
+
+  TracePublisher(const char *topic, TracerT &tracer) :
+    publisher_(topic, &msg_),
+    tracer_(tracer)
+  {
+    msg_.data = data_;
+  }
+
+  void init(NodeHandleT &nh)
+  {
+    nh.advertise(publisher_);
+  }
+
+  /**
+   * @brief Publish recorded entries, call from the main loop
+   *
+   * @return Number of entries sent
+   */
+  int update()
+  {
+    ros::TraceEntry e;
+    int count = 0;
+
+    while ((count < MAX_ENTRIES) && tracer_.read(&e, 1))
+    {
+      uint8_t *out = data_ + count * ENTRY_SIZE;
+      out[0] = e.stamp & 0xff;
+      out[1] = (e.stamp >> 8) & 0xff;
+      out[2] = (e.stamp >> 16) & 0xff;
+      out[3] = (e.stamp >> 24) & 0xff;
+      out[4] = e.arg & 0xff;
+      out[5] = e.arg >> 8;
+      out[6] = e.event;
+      out[7] = e.value;
+      count++;
+    }
+    if (count == 0)
+      return 0;
+
+    msg_.data_length = count * ENTRY_SIZE;
+    msg_.layout.data_offset = tracer_.getLost();
+
+    tracer_.setEnabled(false);
+    publisher_.publish(msg_);
+    tracer_.setEnabled(true);
+    return count;
+  }
+
+private:
+  std_msgs::UInt8MultiArray msg_;
+  ros::StaticPublisher<std_msgs::UInt8MultiArray, NodeHandleT> publisher_;
+
+  TracerT &tracer_;
+  uint8_t data_[MAX_ENTRIES * ENTRY_SIZE];
+};
+
+}
+
+#endif /* ROS_TRACE_PUBLISHER_H_ */
@@ -0,0 +1,547 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file trajectory_executor.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Executor of joint trajectories on the device
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef ROS_TRAJECTORY_EXECUTOR_H_
+#define ROS_TRAJECTORY_EXECUTOR_H_
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdint.h>
+#include <string.h>
+
+#include "ros/node_handle.h"
+#include "ros/subscriber.h"
+#include "trajectory_msgs/JointTrajectory.h"
+#include "control_msgs/JointTrajectoryControllerState.h"
+/* -------------------------------------------------------------------------------*/
+
+namespace francor
+{
+
+/**
+ * @brief Executes trajectory_msgs/JointTrajectory on the device
+ *
+ * A trajectory is received as a whole and sampled by sample() in the
+ * control interrupt. The interpolation follows the joint trajectory
+ * controller of ROS: linear if the points only hold positions, cubic with
+ * velocities and quintic with velocities and accelerations. The first
+ * segment starts at the current setpoint. A header stamp of zero starts
+ * the trajectory with the next sample, an empty trajectory stops at the
+ * current setpoint.
+ *
+ * The message is parsed straight from the receive buffer into one of two
+ * fixed trajectory buffers, nothing is allocated. The spline coefficients
+ * are computed there as well, except for the first segment: it depends on
+ * the setpoint when the trajectory starts, which is only known in the
+ * control interrupt. So sample() computes one polynomial per joint when a
+ * trajectory starts and otherwise only evaluates a polynomial. A
+ * trajectory is taken over by the next sample() after it was received. The
+ * hand over assumes a single core: the receiving side never writes the
+ * buffer sample() may switch to.
+ *
+ * Every FEEDBACK_DECIMATION-th sample is stored and published as
+ * control_msgs/JointTrajectoryControllerState by update().
+ *
+ * @tparam NodeHandleT  Type of the node handle used for publishing
+ * @tparam MAX_JOINTS   Maximum number of joints
+ * @tparam MAX_POINTS   Maximum number of points per trajectory
+ */
+template<typename NodeHandleT, int MAX_JOINTS = 6, int MAX_POINTS = 8>
+class TrajectoryExecutor : public ros::Subscriber_
+{
+public:
+  TrajectoryExecutor(const char *topic, const char *state_topic, const char * const *joint_names, const int joints,
+                     const uint32_t feedback_decimation = 10) :
+    nh_(0),
+    state_publisher_(state_topic, &state_msg_),
+    joints_(joints < MAX_JOINTS ? joints : MAX_JOINTS),
+    joint_names_(joint_names),
+    decimation_(feedback_decimation > 0 ? feedback_decimation : 1),
+    decimation_count_(0),
+    buffers_(),
+    active_(0),
+    pending_(false),
+    stop_(false),
+    running_(false),
+    started_(false),
+    segment_(0),
+    feedback_ready_(false)
+  {
+    topic_ = topic;
+    memset(state_, 0, sizeof(state_));
+
+    state_msg_.joint_names = (char **) joint_names_;
+    state_msg_.joint_names_length = joints_;
+    state_msg_.desired.positions = feedback_desired_[0];
+    state_msg_.desired.velocities = feedback_desired_[1];
+    state_msg_.actual.positions = feedback_actual_;
+    state_msg_.error.positions = feedback_error_;
+  }
+
+  void init(NodeHandleT &nh)
+  {
+    nh_ = &nh;
+    nh.subscribe(*this);
+    nh.advertise(state_publisher_);
+  }
+
+  /* Set the current setpoint, e.g. from the measured positions at start up.
+   * Must not be called while sample() may run. */
+  void setState(const float *positions)
+  {
+    for (int j = 0; j < joints_; j++)
+    {
+      state_[j][0] = positions[j];
+      state_[j][1] = 0.0f;
+      state_[j][2] = 0.0f;
+    }
+  }
+
+  /* Stop at the current setpoint with the next sample */
+  void cancel()
+  {
+    stop_ = true;
+  }
+
+  /* A trajectory is executed or waits for its start time */
+  bool isRunning() const
+  {
+    return running_ || pending_;
+  }
+
+  /**
+   * @brief Sample the trajectory, called by the control interrupt
+   *
+   * @param now       Current time, on the clock of the trajectory stamps
+   * @param position  Setpoint of each joint
+   * @param velocity  Velocity setpoint of each joint, may be 0
+   * @param actual    Measured position of each joint for the feedback,
+   *                  may be 0
+   * @return true while a trajectory is executed
+   */
+  bool sample(const ros::Time &now, float *position, float *velocity = 0, const float *actual = 0)
+  {
+    if (stop_)
+    {
+      stop_ = false;
+      pending_ = false;
+      running_ = false;
+      hold();
+    }
+
+    if (pending_)
+    {
+      active_ = 1 - active_;
+      pending_ = false;
+      Trajectory &t = buffers_[active_];
+      start_ = ((t.stamp.sec == 0) && (t.stamp.nsec == 0)) ? now : t.stamp;
+      segment_ = 0;
+      running_ = t.length > 0;
+      started_ = false;
+      if (!running_)
+        hold();
+    }
+
+    if (running_)
+    {
+      const Trajectory &t = buffers_[active_];
+      const float time = (float)((int32_t)(now.sec - start_.sec)) + 1e-9f * (float)((int32_t) now.nsec - (int32_t) start_.nsec);
+
+      if (time >= 0.0f)
+      {
+        /* the first segment starts at the setpoint when the trajectory starts */
+        if (!started_)
+        {
+          firstSegment(buffers_[active_]);
+          started_ = true;
+        }
+
+        while ((segment_ < t.length - 1) && (time >= t.segments[segment_ + 1].start))
+          segment_++;
+
+        const Segment &s = t.segments[segment_];
+        float tau = time - s.start;
+        if (tau > s.duration)
+          tau = s.duration;
+
+        for (int j = 0; j < joints_; j++)
+        {
+          const float *c = s.coef[j];
+          state_[j][0] = c[0] + tau * (c[1] + tau * (c[2] + tau * (c[3] + tau * (c[4] + tau * c[5]))));
+          state_[j][1] = c[1] + tau * (2.0f * c[2] + tau * (3.0f * c[3] + tau * (4.0f * c[4] + tau * 5.0f * c[5])));
+          state_[j][2] = 2.0f * c[2] + tau * (6.0f * c[3] + tau * (12.0f * c[4] + tau * 20.0f * c[5]));
+        }
+
+        if ((segment_ == t.length - 1) && (time >= s.start + s.duration))
+        {
+          running_ = false;
+          hold();
+        }
+      }
+    }
+
+    for (int j = 0; j < joints_; j++)
+    {
+      position[j] = state_[j][0];
+      if (velocity)
+        velocity[j] = state_[j][1];
+    }
+
+    if ((++decimation_count_ >= decimation_) && !feedback_ready_)
+    {
+      decimation_count_ = 0;
+      feedback_stamp_ = now;
+      for (int j = 0; j < joints_; j++)
+      {
+        feedback_desired_[0][j] = state_[j][0];
+        feedback_desired_[1][j] = state_[j][1];
+        feedback_actual_[j] = actual ? actual[j] : state_[j][0];
+        feedback_error_[j] = feedback_actual_[j] - state_[j][0];
+      }
+      feedback_ready_ = true;
+    }
+
+    return running_;
+  }
+
+  /**
+   * @brief Publish the latest stored sample, call from the main loop
+   *
+   * @return Result of publish() if there was a sample, else 0
+   */
+  int update()
+  {
+    if (!feedback_ready_)
+      return 0;
+
+    state_msg_.header.stamp = feedback_stamp_;
+    state_msg_.desired.positions_length = joints_;
+    state_msg_.desired.velocities_length = joints_;
+    state_msg_.actual.positions_length = joints_;
+    state_msg_.error.positions_length = joints_;
+    const int ret = state_publisher_.publish(state_msg_);
+    feedback_ready_ = false;
+    return ret;
+  }
+
+  /* Receive a trajectory, called by the node handle */
+  virtual void callback(unsigned char *data, size_t size)
+  {
+    if (trajectory_msg_.wireLength(data, 0, size) < 0)
+      return;
+
+    int offset = 0;
+    uint32_t length;
+    ros::Time stamp;
+
+    /* header */
+    offset += 4;
+    offset += ros::Msg::decode(data + offset, stamp.sec);
+    offset += ros::Msg::decode(data + offset, stamp.nsec);
+    offset += ros::Msg::decode(data + offset, length);
+    offset += length;
+
+    /* joint order of the message, every joint exactly once */
+    int map[MAX_JOINTS];
+    bool seen[MAX_JOINTS] = {};
+    uint32_t names;
+    offset += ros::Msg::decode(data + offset, names);
+    if (names != (uint32_t) joints_)
+    {
+      reject("Trajectory rejected: joints do not match");
+      return;
+    }
+    for (uint32_t i = 0; i < names; i++)
+    {
+      offset += ros::Msg::decode(data + offset, length);
+      map[i] = findJoint((const char *)(data + offset), length);
+      offset += length;
+      if (map[i] < 0)
+      {
+        reject("Trajectory rejected: unknown joint");
+        return;
+      }
+      if (seen[map[i]])
+      {
+        reject("Trajectory rejected: duplicate joint");
+        return;
+      }
+      seen[map[i]] = true;
+    }
+
+    uint32_t points;
+    offset += ros::Msg::decode(data + offset, points);
+    if (points > (uint32_t) MAX_POINTS)
+    {
+      reject("Trajectory rejected: too many points");
+      return;
+    }
+
+    int order = 5;
+
+    for (uint32_t i = 0; i < points; i++)
+    {
+      Point &p = points_[i];
+      uint32_t values[4];
+      for (int k = 0; k < 4; k++)
+      {
+        offset += ros::Msg::decode(data + offset, values[k]);
+        if ((values[k] != 0) && (values[k] != (uint32_t) joints_))
+        {
+          reject("Trajectory rejected: points do not match joints");
+          return;
+        }
+        for (uint32_t j = 0; j < values[k]; j++)
+        {
+          if (k < 3)
+            ros::Msg::deserializeAvrFloat64(data + offset, &p.value[map[j]][k]);
+          offset += 8;
+        }
+      }
+
+      int32_t sec, nsec;
+      offset += ros::Msg::decode(data + offset, sec);
+      offset += ros::Msg::decode(data + offset, nsec);
+      p.time = (float) sec + 1e-9f * (float) nsec;
+
+      if ((values[0] == 0) || (p.time < ((i > 0) ? points_[i - 1].time : 0.0f)))
+      {
+        reject("Trajectory rejected: invalid point");
+        return;
+      }
+
+      /* lowest order all points support */
+      if (values[1] == 0)
+        order = 1;
+      else if ((values[2] == 0) && (order > 3))
+        order = 3;
+    }
+
+    for (uint32_t i = 0; i < points; i++)
+    {
+      for (int j = 0; j < joints_; j++)
+      {
+        if (order < 5)
+          points_[i].value[j][2] = 0.0f;
+        if (order < 3)
+          points_[i].value[j][1] = 0.0f;
+      }
+    }
+
+    /* sample() does not switch buffers until pending_ is set again */
+    pending_ = false;
+    Trajectory &t = buffers_[1 - active_];
+    t.stamp = stamp;
+    t.order = order;
+
+    /* segment 0 ends at the first point and is set up when it starts */
+    if (points > 0)
+    {
+      memcpy(t.first, points_[0].value, sizeof(t.first));
+      t.segments[0].start = 0.0f;
+      t.segments[0].duration = points_[0].time;
+    }
+    for (uint32_t i = 1; i < points; i++)
+    {
+      Segment &s = t.segments[i];
+      s.start = points_[i - 1].time;
+      s.duration = points_[i].time - points_[i - 1].time;
+      for (int j = 0; j < joints_; j++)
+        coefficients(t.order, points_[i - 1].value[j], points_[i].value[j], s.duration, s.coef[j]);
+    }
+    t.length = points;
+
+    pending_ = true;
+  }
+
+  virtual const char * getMsgType()
+  {
+    return trajectory_msg_.getType();
+  }
+
+  virtual const char * getMsgMD5()
+  {
+    return trajectory_msg_.getMD5();
+  }
+
+  virtual int getEndpointType()
+  {
+    return rosserial_msgs::TopicInfo::ID_SUBSCRIBER;
+  }
+
+  /**
+   * @brief Polynomial from state a to state b over duration
+   *
+   * @param order 1, 3 or 5
+   * @param a     Position, velocity and acceleration at the start
+   * @param b     Position, velocity and acceleration at the end
+   * @param c     Coefficients, lowest order first
+   */
+  static void coefficients(const int order, const float a[3], const float b[3], const float duration, float c[6])
+  {
+    memset(c, 0, 6 * sizeof(float));
+
+    if (duration <= 0.0f)
+    {
+      c[0] = b[0];
+      return;
+    }
+
+    const float t = duration;
+    const float t2 = t * t;
+    const float t3 = t2 * t;
+    const float dp = b[0] - a[0];
+
+    c[0] = a[0];
+    if (order == 1)
+    {
+      c[1] = dp / t;
+    }
+    else if (order == 3)
+    {
+      c[1] = a[1];
+      c[2] = (3.0f * dp - (2.0f * a[1] + b[1]) * t) / t2;
+      c[3] = (-2.0f * dp + (a[1] + b[1]) * t) / t3;
+    }
+    else
+    {
+      c[1] = a[1];
+      c[2] = 0.5f * a[2];
+      c[3] = (20.0f * dp - (8.0f * b[1] + 12.0f * a[1]) * t - (3.0f * a[2] - b[2]) * t2) / (2.0f * t3);
+      c[4] = (-30.0f * dp + (14.0f * b[1] + 16.0f * a[1]) * t + (3.0f * a[2] - 2.0f * b[2]) * t2) / (2.0f * t3 * t);
+      c[5] = (12.0f * dp - 6.0f * (b[1] + a[1]) * t - (a[2] - b[2]) * t2) / (2.0f * t3 * t2);
+    }
+  }
+
+private:
+  struct Point
+  {
+    float time;
+    float value[MAX_JOINTS][3];
+  };
+
+  struct Segment
+  {
+    float start;
+    float duration;
+    float coef[MAX_JOINTS][6];
+  };
+
+  struct Trajectory
+  {
+    ros::Time stamp;
+    int length;
+    int order;
+    float first[MAX_JOINTS][3];
+    Segment segments[MAX_POINTS];
+  };
+
+  int findJoint(const char *name, const uint32_t length) const
+  {
+    for (int j = 0; j < joints_; j++)
+    {
+      if ((strlen(joint_names_[j]) == length) && (memcmp(joint_names_[j], name, length) == 0))
+        return j;
+    }
+    return -1;
+  }
+
+  void reject(const char *reason)
+  {
+    if (nh_)
+      nh_->logwarn(reason);
+  }
+
+  void firstSegment(Trajectory &t)
+  {
+    Segment &s = t.segments[0];
+    for (int j = 0; j < joints_; j++)
+    {
+      float a[3] = {state_[j][0], t.order > 1 ? state_[j][1] : 0.0f, t.order > 3 ? state_[j][2] : 0.0f};
+      coefficients(t.order, a, t.first[j], s.duration, s.coef[j]);
+    }
+  }
+
+  void hold()
+  {
+    for (int j = 0; j < joints_; j++)
+    {
+      state_[j][1] = 0.0f;
+      state_[j][2] = 0.0f;
+    }
+  }
+
+  NodeHandleT *nh_;
+  trajectory_msgs::JointTrajectory trajectory_msg_;
+  control_msgs::JointTrajectoryControllerState state_msg_;
+  ros::StaticPublisher<control_msgs::JointTrajectoryControllerState, NodeHandleT> state_publisher_;
+
+  int joints_;
+  const char * const *joint_names_;
+  uint32_t decimation_;
+  uint32_t decimation_count_;
+
+  /* trajectory in execution and the one received next */
+  Trajectory buffers_[2];
+  Point points_[MAX_POINTS];
+  volatile int active_;
+  volatile bool pending_;
+  volatile bool stop_;
+  volatile bool running_;
+  bool started_;
+  int segment_;
+  ros::Time start_;
+
+  /* position, velocity and acceleration setpoint of each joint */
+  float state_[MAX_JOINTS][3];
+
+  volatile bool feedback_ready_;
+  ros::Time feedback_stamp_;
+  float feedback_desired_[2][MAX_JOINTS];
+  float feedback_actual_[MAX_JOINTS];
+  float feedback_error_[MAX_JOINTS];
+};
+
+}
+
+#endif /* ROS_TRAJECTORY_EXECUTOR_H_ */
@@ -0,0 +1,128 @@
+#ifndef _ROS_francor_msgs_ImuBatch_h
+#define _ROS_francor_msgs_ImuBatch_h
+
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include "ros/msg.h"
+#include "std_msgs/Header.h"
+
+/*
+ * francor_msgs/ImuBatch.msg
+ *
+ * # Batch of IMU samples sharing frame id and covariances
+ * std_msgs/Header header
+ * float32[9] orientation_covariance
+ * float32[9] angular_velocity_covariance
+ * float32[9] linear_acceleration_covariance
+ * uint32[] time_offset            # ns after header.stamp, one per sample
+ * float32[] orientation           # x, y, z, w per sample, empty without orientation
+ * float32[] angular_velocity      # x, y, z per sample
+ * float32[] linear_acceleration   # x, y, z per sample
+ */
+
+namespace francor_msgs
+{
+
+  class ImuBatch : public ros::Msg
+  {
+    public:
+      typedef std_msgs::Header _header_type;
+      _header_type header;
+      float orientation_covariance[9];
+      float angular_velocity_covariance[9];
+      float linear_acceleration_covariance[9];
+      uint32_t time_offset_length;
+      typedef uint32_t _time_offset_type;
+      _time_offset_type st_time_offset;
+      _time_offset_type * time_offset;
+      uint32_t orientation_length;
+      typedef float _orientation_type;
+      _orientation_type st_orientation;
+      _orientation_type * orientation;
+      uint32_t angular_velocity_length;
+      typedef float _angular_velocity_type;
+      _angular_velocity_type st_angular_velocity;
+      _angular_velocity_type * angular_velocity;
+      uint32_t linear_acceleration_length;
+      typedef float _linear_acceleration_type;
+      _linear_acceleration_type st_linear_acceleration;
+      _linear_acceleration_type * linear_acceleration;
+
+    ImuBatch():
+      header(),
+      orientation_covariance(),
+      angular_velocity_covariance(),
+      linear_acceleration_covariance(),
+      time_offset_length(0), time_offset(NULL),
+      orientation_length(0), orientation(NULL),
+      angular_velocity_length(0), angular_velocity(NULL),
+      linear_acceleration_length(0), linear_acceleration(NULL)
+    {
+    }
+
+    virtual int serialize(unsigned char *outbuffer) const
+    {
+      int offset = 0;
+      offset += this->header.serialize(outbuffer + offset);
+      for( uint32_t i = 0; i < 9; i++){
+      offset += encode(outbuffer + offset, this->orientation_covariance[i]);
+      }
+      for( uint32_t i = 0; i < 9; i++){
+      offset += encode(outbuffer + offset, this->angular_velocity_covariance[i]);
+      }
+      for( uint32_t i = 0; i < 9; i++){
+      offset += encode(outbuffer + offset, this->linear_acceleration_covariance[i]);
+      }
+      offset += encodeArray(outbuffer + offset, this->time_offset, this->time_offset_length);
+      offset += encodeArray(outbuffer + offset, this->orientation, this->orientation_length);
+      offset += encodeArray(outbuffer + offset, this->angular_velocity, this->angular_velocity_length);
+      offset += encodeArray(outbuffer + offset, this->linear_acceleration, this->linear_acceleration_length);
+      return offset;
+    }
+
+    virtual int deserialize(unsigned char *inbuffer)
+    {
+      int offset = 0;
+      offset += this->header.deserialize(inbuffer + offset);
+      for( uint32_t i = 0; i < 9; i++){
+      offset += decode(inbuffer + offset, this->orientation_covariance[i]);
+      }
+      for( uint32_t i = 0; i < 9; i++){
+      offset += decode(inbuffer + offset, this->angular_velocity_covariance[i]);
+      }
+      for( uint32_t i = 0; i < 9; i++){
+      offset += decode(inbuffer + offset, this->linear_acceleration_covariance[i]);
+      }
+      offset += decodeArray(inbuffer + offset, this->time_offset, this->time_offset_length);
+      offset += decodeArray(inbuffer + offset, this->orientation, this->orientation_length);
+      offset += decodeArray(inbuffer + offset, this->angular_velocity, this->angular_velocity_length);
+      offset += decodeArray(inbuffer + offset, this->linear_acceleration, this->linear_acceleration_length);
+     return offset;
+    }
+
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return ImuBatch::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 108);
+      offset = wireSkipArray(inbuffer, offset, size, 4);
+      offset = wireSkipArray(inbuffer, offset, size, 4);
+      offset = wireSkipArray(inbuffer, offset, size, 4);
+      offset = wireSkipArray(inbuffer, offset, size, 4);
+      return offset;
+    }
+
+    const char * getType(){ return "francor_msgs/ImuBatch"; };
+    const char * getMD5(){ return "e09b021f1c89109cd28743dcb94f8bc3"; };
+
+  };
+
+}
+#endif
@@ -40,6 +40,20 @@ namespace geometry_msgs
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return Accel::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->linear.wireLength(inbuffer, offset, size);
+      offset = this->angular.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "geometry_msgs/Accel"; };
     const char * getMD5(){ return "9f195f881246fdfa2798d1d3eebca84a"; };
 
@@ -43,6 +43,20 @@ namespace geometry_msgs
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return AccelWithCovariance::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->accel.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 288);
+      return offset;
+    }
+
     const char * getType(){ return "geometry_msgs/AccelWithCovariance"; };
     const char * getMD5(){ return "ad5a718d699c6be72a02b8d6a139f334"; };
 
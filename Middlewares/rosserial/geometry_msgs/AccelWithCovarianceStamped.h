@@ -41,6 +41,20 @@ namespace geometry_msgs
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return AccelWithCovarianceStamped::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = this->accel.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "geometry_msgs/AccelWithCovarianceStamped"; };
     const char * getMD5(){ return "96adb295225031ec8d57fb4251b0a886"; };
 
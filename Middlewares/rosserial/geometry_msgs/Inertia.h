@@ -70,6 +70,21 @@ namespace geometry_msgs
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return Inertia::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkip(offset, size, 8);
+      offset = this->com.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 48);
+      return offset;
+    }
+
     const char * getType(){ return "geometry_msgs/Inertia"; };
     const char * getMD5(){ return "1d26e4bb6c83ff141c5cf0d883c2b0fe"; };
 
@@ -44,6 +44,20 @@ namespace geometry_msgs
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return Point::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 24);
+      return offset;
+    }
+
     const char * getType(){ return "geometry_msgs/Point"; };
     const char * getMD5(){ return "4a842b65f413084dc2b10fb484ea7f17"; };
 
@@ -29,78 +29,35 @@ namespace geometry_msgs
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      union {
-        float real;
-        uint32_t base;
-      } u_x;
-      u_x.real = this->x;
-      *(outbuffer + offset + 0) = (u_x.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_x.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_x.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_x.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->x);
-      union {
-        float real;
-        uint32_t base;
-      } u_y;
-      u_y.real = this->y;
-      *(outbuffer + offset + 0) = (u_y.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_y.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_y.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_y.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->y);
-      union {
-        float real;
-        uint32_t base;
-      } u_z;
-      u_z.real = this->z;
-      *(outbuffer + offset + 0) = (u_z.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_z.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_z.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_z.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->z);
+      offset += encode(outbuffer + offset, this->x);
+      offset += encode(outbuffer + offset, this->y);
+      offset += encode(outbuffer + offset, this->z);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      union {
-        float real;
-        uint32_t base;
-      } u_x;
-      u_x.base = 0;
-      u_x.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_x.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_x.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_x.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->x = u_x.real;
-      offset += sizeof(this->x);
-      union {
-        float real;
-        uint32_t base;
-      } u_y;
-      u_y.base = 0;
-      u_y.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_y.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_y.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_y.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->y = u_y.real;
-      offset += sizeof(this->y);
-      union {
-        float real;
-        uint32_t base;
-      } u_z;
-      u_z.base = 0;
-      u_z.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_z.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_z.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_z.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->z = u_z.real;
-      offset += sizeof(this->z);
+      offset += decode(inbuffer + offset, this->x);
+      offset += decode(inbuffer + offset, this->y);
+      offset += decode(inbuffer + offset, this->z);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return Point32::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 12);
+      return offset;
+    }
+
     const char * getType(){ return "geometry_msgs/Point32"; };
     const char * getMD5(){ return "cc153912f1453b708d221682bc23d9ac"; };
 
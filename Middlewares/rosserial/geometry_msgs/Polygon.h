@@ -14,23 +14,20 @@ namespace geometry_msgs
   {
     public:
       uint32_t points_length;
+      uint32_t points_capacity;
       typedef geometry_msgs::Point32 _points_type;
       _points_type st_points;
       _points_type * points;
 
     Polygon():
-      points_length(0), points(NULL)
+      points_length(0), points_capacity(0), points(NULL)
     {
     }
 
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->points_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->points_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->points_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->points_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->points_length);
+      offset += encode(outbuffer + offset, this->points_length);
       for( uint32_t i = 0; i < points_length; i++){
       offset += this->points[i].serialize(outbuffer + offset);
       }
@@ -40,21 +37,27 @@ namespace geometry_msgs
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t points_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      points_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      points_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      points_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->points_length);
-      if(points_lengthT > points_length)
-        this->points = (geometry_msgs::Point32*)realloc(this->points, points_lengthT * sizeof(geometry_msgs::Point32));
-      points_length = points_lengthT;
-      for( uint32_t i = 0; i < points_length; i++){
-      offset += this->st_points.deserialize(inbuffer + offset);
-        memcpy( &(this->points[i]), &(this->st_points), sizeof(geometry_msgs::Point32));
-      }
+      offset += decodeMsgArray(inbuffer + offset, this->points, this->points_length, this->points_capacity);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return Polygon::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      uint32_t points_lengthT;
+      offset = wireCount(inbuffer, offset, size, points_lengthT, 12);
+      for( uint32_t i = 0; (i < points_lengthT) && (offset >= 0); i++){
+        offset = this->st_points.wireLength(inbuffer, offset, size);
+      }
+      return offset;
+    }
+
     const char * getType(){ return "geometry_msgs/Polygon"; };
     const char * getMD5(){ return "cd60a26494a087f577976f0329fa120e"; };
 
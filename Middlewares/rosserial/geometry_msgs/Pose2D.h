@@ -44,6 +44,20 @@ namespace geometry_msgs
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return Pose2D::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 24);
+      return offset;
+    }
+
     const char * getType(){ return "geometry_msgs/Pose2D"; };
     const char * getMD5(){ return "938fa65709584ad8e77d238529be13b8"; };
 
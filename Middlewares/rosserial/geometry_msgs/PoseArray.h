@@ -17,13 +17,14 @@ namespace geometry_msgs
       typedef std_msgs::Header _header_type;
       _header_type header;
       uint32_t poses_length;
+      uint32_t poses_capacity;
       typedef geometry_msgs::Pose _poses_type;
       _poses_type st_poses;
       _poses_type * poses;
 
     PoseArray():
       header(),
-      poses_length(0), poses(NULL)
+      poses_length(0), poses_capacity(0), poses(NULL)
     {
     }
 
@@ -31,11 +32,7 @@ namespace geometry_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      *(outbuffer + offset + 0) = (this->poses_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->poses_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->poses_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->poses_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->poses_length);
+      offset += encode(outbuffer + offset, this->poses_length);
       for( uint32_t i = 0; i < poses_length; i++){
       offset += this->poses[i].serialize(outbuffer + offset);
       }
@@ -46,21 +43,28 @@ namespace geometry_msgs
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      uint32_t poses_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      poses_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      poses_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      poses_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->poses_length);
-      if(poses_lengthT > poses_length)
-        this->poses = (geometry_msgs::Pose*)realloc(this->poses, poses_lengthT * sizeof(geometry_msgs::Pose));
-      poses_length = poses_lengthT;
-      for( uint32_t i = 0; i < poses_length; i++){
-      offset += this->st_poses.deserialize(inbuffer + offset);
-        memcpy( &(this->poses[i]), &(this->st_poses), sizeof(geometry_msgs::Pose));
-      }
+      offset += decodeMsgArray(inbuffer + offset, this->poses, this->poses_length, this->poses_capacity);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return PoseArray::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      uint32_t poses_lengthT;
+      offset = wireCount(inbuffer, offset, size, poses_lengthT, 56);
+      for( uint32_t i = 0; (i < poses_lengthT) && (offset >= 0); i++){
+        offset = this->st_poses.wireLength(inbuffer, offset, size);
+      }
+      return offset;
+    }
+
     const char * getType(){ return "geometry_msgs/PoseArray"; };
     const char * getMD5(){ return "916c28c5764443f268b296bb671b9d97"; };
 
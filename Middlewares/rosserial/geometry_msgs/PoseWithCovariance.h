@@ -43,6 +43,20 @@ namespace geometry_msgs
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return PoseWithCovariance::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->pose.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 288);
+      return offset;
+    }
+
     const char * getType(){ return "geometry_msgs/PoseWithCovariance"; };
     const char * getMD5(){ return "c23e848cf1b7533a8d7c259073a97e6f"; };
 
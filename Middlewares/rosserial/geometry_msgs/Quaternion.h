@@ -49,6 +49,20 @@ namespace geometry_msgs
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return Quaternion::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 32);
+      return offset;
+    }
+
     const char * getType(){ return "geometry_msgs/Quaternion"; };
     const char * getMD5(){ return "a779879fadf0160734f906b8c19c7004"; };
 
@@ -32,11 +32,7 @@ namespace geometry_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      uint32_t length_child_frame_id = strlen(this->child_frame_id);
-      varToArr(outbuffer + offset, length_child_frame_id);
-      offset += 4;
-      memcpy(outbuffer + offset, this->child_frame_id, length_child_frame_id);
-      offset += length_child_frame_id;
+      offset += encodeString(outbuffer + offset, this->child_frame_id);
       offset += this->transform.serialize(outbuffer + offset);
       return offset;
     }
@@ -45,19 +41,26 @@ namespace geometry_msgs
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      uint32_t length_child_frame_id;
-      arrToVar(length_child_frame_id, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_child_frame_id; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_child_frame_id-1]=0;
-      this->child_frame_id = (char *)(inbuffer + offset-1);
-      offset += length_child_frame_id;
+      offset += decodeString(inbuffer + offset, this->child_frame_id);
       offset += this->transform.deserialize(inbuffer + offset);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return TransformStamped::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = this->transform.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "geometry_msgs/TransformStamped"; };
     const char * getMD5(){ return "b5764a33bfeb3588febc2682852579b0"; };
 
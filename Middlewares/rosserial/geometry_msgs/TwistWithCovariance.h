@@ -43,6 +43,20 @@ namespace geometry_msgs
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return TwistWithCovariance::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->twist.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 288);
+      return offset;
+    }
+
     const char * getType(){ return "geometry_msgs/TwistWithCovariance"; };
     const char * getMD5(){ return "1fe8a28e6890a4cc3ae4c3ca5c7d82e6"; };
 
@@ -51,6 +51,20 @@ static const char GETMAPROI[] = "map_msgs/GetMapROI";
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return GetMapROIRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 32);
+      return offset;
+    }
+
     const char * getType(){ return GETMAPROI; };
     const char * getMD5(){ return "43c2ff8f45af555c0eaf070c401e9a47"; };
 
@@ -81,6 +95,19 @@ static const char GETMAPROI[] = "map_msgs/GetMapROI";
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return GetMapROIResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->sub_map.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return GETMAPROI; };
     const char * getMD5(){ return "4d1986519c00d81967d2891a606b234c"; };
 
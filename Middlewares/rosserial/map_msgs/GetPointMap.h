@@ -21,16 +21,32 @@ static const char GETPOINTMAP[] = "map_msgs/GetPointMap";
 
     virtual int serialize(unsigned char *outbuffer) const
     {
+      (void) outbuffer;
       int offset = 0;
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
+      (void) inbuffer;
       int offset = 0;
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return GetPointMapRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      (void) size;
+      return offset;
+    }
+
     const char * getType(){ return GETPOINTMAP; };
     const char * getMD5(){ return "d41d8cd98f00b204e9800998ecf8427e"; };
 
@@ -61,6 +77,19 @@ static const char GETPOINTMAP[] = "map_msgs/GetPointMap";
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return GetPointMapResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->map.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return GETPOINTMAP; };
     const char * getMD5(){ return "b84fbb39505086eb6a62d933c75cb7b4"; };
 
@@ -66,6 +66,20 @@ static const char GETPOINTMAPROI[] = "map_msgs/GetPointMapROI";
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return GetPointMapROIRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 56);
+      return offset;
+    }
+
     const char * getType(){ return GETPOINTMAPROI; };
     const char * getMD5(){ return "895f7e437a9a6dd225316872b187a303"; };
 
@@ -96,6 +110,19 @@ static const char GETPOINTMAPROI[] = "map_msgs/GetPointMapROI";
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return GetPointMapROIResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->sub_map.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return GETPOINTMAPROI; };
     const char * getMD5(){ return "313769f8b0e724525c6463336cbccd63"; };
 
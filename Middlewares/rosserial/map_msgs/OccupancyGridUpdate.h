@@ -42,50 +42,11 @@ namespace map_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_x;
-      u_x.real = this->x;
-      *(outbuffer + offset + 0) = (u_x.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_x.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_x.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_x.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->x);
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_y;
-      u_y.real = this->y;
-      *(outbuffer + offset + 0) = (u_y.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_y.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_y.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_y.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->y);
-      *(outbuffer + offset + 0) = (this->width >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->width >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->width >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->width >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->width);
-      *(outbuffer + offset + 0) = (this->height >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->height >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->height >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->height >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->height);
-      *(outbuffer + offset + 0) = (this->data_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->data_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->data_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->data_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->data_length);
-      for( uint32_t i = 0; i < data_length; i++){
-      union {
-        int8_t real;
-        uint8_t base;
-      } u_datai;
-      u_datai.real = this->data[i];
-      *(outbuffer + offset + 0) = (u_datai.base >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->data[i]);
-      }
+      offset += encode(outbuffer + offset, this->x);
+      offset += encode(outbuffer + offset, this->y);
+      offset += encode(outbuffer + offset, this->width);
+      offset += encode(outbuffer + offset, this->height);
+      offset += encodeArray(outbuffer + offset, this->data, this->data_length);
       return offset;
     }
 
@@ -93,60 +54,29 @@ namespace map_msgs
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_x;
-      u_x.base = 0;
-      u_x.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_x.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_x.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_x.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->x = u_x.real;
-      offset += sizeof(this->x);
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_y;
-      u_y.base = 0;
-      u_y.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_y.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_y.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_y.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->y = u_y.real;
-      offset += sizeof(this->y);
-      this->width =  ((uint32_t) (*(inbuffer + offset)));
-      this->width |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->width |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->width |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->width);
-      this->height =  ((uint32_t) (*(inbuffer + offset)));
-      this->height |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->height |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->height |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->height);
-      uint32_t data_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      data_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      data_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      data_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->data_length);
-      if(data_lengthT > data_length)
-        this->data = (int8_t*)realloc(this->data, data_lengthT * sizeof(int8_t));
-      data_length = data_lengthT;
-      for( uint32_t i = 0; i < data_length; i++){
-      union {
-        int8_t real;
-        uint8_t base;
-      } u_st_data;
-      u_st_data.base = 0;
-      u_st_data.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      this->st_data = u_st_data.real;
-      offset += sizeof(this->st_data);
-        memcpy( &(this->data[i]), &(this->st_data), sizeof(int8_t));
-      }
+      offset += decode(inbuffer + offset, this->x);
+      offset += decode(inbuffer + offset, this->y);
+      offset += decode(inbuffer + offset, this->width);
+      offset += decode(inbuffer + offset, this->height);
+      offset += decodeArray(inbuffer + offset, this->data, this->data_length);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return OccupancyGridUpdate::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 16);
+      offset = wireSkipArray(inbuffer, offset, size, 1);
+      return offset;
+    }
+
     const char * getType(){ return "map_msgs/OccupancyGridUpdate"; };
     const char * getMD5(){ return "b295be292b335c34718bd939deebe1c9"; };
 
@@ -34,11 +34,7 @@ namespace map_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      *(outbuffer + offset + 0) = (this->type >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->type >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->type >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->type >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->type);
+      offset += encode(outbuffer + offset, this->type);
       offset += this->points.serialize(outbuffer + offset);
       return offset;
     }
@@ -47,15 +43,26 @@ namespace map_msgs
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      this->type =  ((uint32_t) (*(inbuffer + offset)));
-      this->type |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->type |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->type |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->type);
+      offset += decode(inbuffer + offset, this->type);
       offset += this->points.deserialize(inbuffer + offset);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return PointCloud2Update::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 4);
+      offset = this->points.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "map_msgs/PointCloud2Update"; };
     const char * getMD5(){ return "6c58e4f249ae9cd2b24fb1ee0f99195e"; };
 
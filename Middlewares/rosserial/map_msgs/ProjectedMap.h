@@ -45,6 +45,20 @@ namespace map_msgs
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return ProjectedMap::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->map.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 16);
+      return offset;
+    }
+
     const char * getType(){ return "map_msgs/ProjectedMap"; };
     const char * getMD5(){ return "7bbe8f96e45089681dc1ea7d023cbfca"; };
 
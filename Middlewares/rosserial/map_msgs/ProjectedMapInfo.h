@@ -41,11 +41,7 @@ namespace map_msgs
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_frame_id = strlen(this->frame_id);
-      varToArr(outbuffer + offset, length_frame_id);
-      offset += 4;
-      memcpy(outbuffer + offset, this->frame_id, length_frame_id);
-      offset += length_frame_id;
+      offset += encodeString(outbuffer + offset, this->frame_id);
       offset += serializeAvrFloat64(outbuffer + offset, this->x);
       offset += serializeAvrFloat64(outbuffer + offset, this->y);
       offset += serializeAvrFloat64(outbuffer + offset, this->width);
@@ -58,15 +54,7 @@ namespace map_msgs
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_frame_id;
-      arrToVar(length_frame_id, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_frame_id; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_frame_id-1]=0;
-      this->frame_id = (char *)(inbuffer + offset-1);
-      offset += length_frame_id;
+      offset += decodeString(inbuffer + offset, this->frame_id);
       offset += deserializeAvrFloat64(inbuffer + offset, &(this->x));
       offset += deserializeAvrFloat64(inbuffer + offset, &(this->y));
       offset += deserializeAvrFloat64(inbuffer + offset, &(this->width));
@@ -76,6 +64,20 @@ namespace map_msgs
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return ProjectedMapInfo::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 48);
+      return offset;
+    }
+
     const char * getType(){ return "map_msgs/ProjectedMapInfo"; };
     const char * getMD5(){ return "2dc10595ae94de23f22f8a6d2a0eef7a"; };
 
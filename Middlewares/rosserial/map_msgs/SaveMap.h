@@ -36,6 +36,19 @@ static const char SAVEMAP[] = "map_msgs/SaveMap";
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return SaveMapRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->filename.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return SAVEMAP; };
     const char * getMD5(){ return "716e25f9d9dc76ceba197f93cbf05dc7"; };
 
@@ -51,16 +64,32 @@ static const char SAVEMAP[] = "map_msgs/SaveMap";
 
     virtual int serialize(unsigned char *outbuffer) const
     {
+      (void) outbuffer;
       int offset = 0;
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
+      (void) inbuffer;
       int offset = 0;
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return SaveMapResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      (void) size;
+      return offset;
+    }
+
     const char * getType(){ return SAVEMAP; };
     const char * getMD5(){ return "d41d8cd98f00b204e9800998ecf8427e"; };
 
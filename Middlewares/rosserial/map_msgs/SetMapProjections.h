@@ -21,16 +21,32 @@ static const char SETMAPPROJECTIONS[] = "map_msgs/SetMapProjections";
 
     virtual int serialize(unsigned char *outbuffer) const
     {
+      (void) outbuffer;
       int offset = 0;
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
+      (void) inbuffer;
       int offset = 0;
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return SetMapProjectionsRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      (void) size;
+      return offset;
+    }
+
     const char * getType(){ return SETMAPPROJECTIONS; };
     const char * getMD5(){ return "d41d8cd98f00b204e9800998ecf8427e"; };
 
@@ -40,23 +56,20 @@ static const char SETMAPPROJECTIONS[] = "map_msgs/SetMapProjections";
   {
     public:
       uint32_t projected_maps_info_length;
+      uint32_t projected_maps_info_capacity;
       typedef map_msgs::ProjectedMapInfo _projected_maps_info_type;
       _projected_maps_info_type st_projected_maps_info;
       _projected_maps_info_type * projected_maps_info;
 
     SetMapProjectionsResponse():
-      projected_maps_info_length(0), projected_maps_info(NULL)
+      projected_maps_info_length(0), projected_maps_info_capacity(0), projected_maps_info(NULL)
     {
     }
 
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->projected_maps_info_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->projected_maps_info_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->projected_maps_info_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->projected_maps_info_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->projected_maps_info_length);
+      offset += encode(outbuffer + offset, this->projected_maps_info_length);
       for( uint32_t i = 0; i < projected_maps_info_length; i++){
       offset += this->projected_maps_info[i].serialize(outbuffer + offset);
       }
@@ -66,21 +79,27 @@ static const char SETMAPPROJECTIONS[] = "map_msgs/SetMapProjections";
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t projected_maps_info_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      projected_maps_info_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      projected_maps_info_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      projected_maps_info_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->projected_maps_info_length);
-      if(projected_maps_info_lengthT > projected_maps_info_length)
-        this->projected_maps_info = (map_msgs::ProjectedMapInfo*)realloc(this->projected_maps_info, projected_maps_info_lengthT * sizeof(map_msgs::ProjectedMapInfo));
-      projected_maps_info_length = projected_maps_info_lengthT;
-      for( uint32_t i = 0; i < projected_maps_info_length; i++){
-      offset += this->st_projected_maps_info.deserialize(inbuffer + offset);
-        memcpy( &(this->projected_maps_info[i]), &(this->st_projected_maps_info), sizeof(map_msgs::ProjectedMapInfo));
-      }
+      offset += decodeMsgArray(inbuffer + offset, this->projected_maps_info, this->projected_maps_info_length, this->projected_maps_info_capacity);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return SetMapProjectionsResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      uint32_t projected_maps_info_lengthT;
+      offset = wireCount(inbuffer, offset, size, projected_maps_info_lengthT, 52);
+      for( uint32_t i = 0; (i < projected_maps_info_lengthT) && (offset >= 0); i++){
+        offset = this->st_projected_maps_info.wireLength(inbuffer, offset, size);
+      }
+      return offset;
+    }
+
     const char * getType(){ return SETMAPPROJECTIONS; };
     const char * getMD5(){ return "d7980a33202421c8cd74565e57a4d229"; };
 
@@ -35,6 +35,19 @@ namespace nav_msgs
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return GetMapResult::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->map.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "nav_msgs/GetMapResult"; };
     const char * getMD5(){ return "6cdd0a18e0aff5b0a3ca2326a89b54ff"; };
 
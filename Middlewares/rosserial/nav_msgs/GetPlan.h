@@ -34,16 +34,7 @@ static const char GETPLAN[] = "nav_msgs/GetPlan";
       int offset = 0;
       offset += this->start.serialize(outbuffer + offset);
       offset += this->goal.serialize(outbuffer + offset);
-      union {
-        float real;
-        uint32_t base;
-      } u_tolerance;
-      u_tolerance.real = this->tolerance;
-      *(outbuffer + offset + 0) = (u_tolerance.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_tolerance.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_tolerance.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_tolerance.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->tolerance);
+      offset += encode(outbuffer + offset, this->tolerance);
       return offset;
     }
 
@@ -52,20 +43,25 @@ static const char GETPLAN[] = "nav_msgs/GetPlan";
       int offset = 0;
       offset += this->start.deserialize(inbuffer + offset);
       offset += this->goal.deserialize(inbuffer + offset);
-      union {
-        float real;
-        uint32_t base;
-      } u_tolerance;
-      u_tolerance.base = 0;
-      u_tolerance.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_tolerance.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_tolerance.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_tolerance.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->tolerance = u_tolerance.real;
-      offset += sizeof(this->tolerance);
+      offset += decode(inbuffer + offset, this->tolerance);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return GetPlanRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->start.wireLength(inbuffer, offset, size);
+      offset = this->goal.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 4);
+      return offset;
+    }
+
     const char * getType(){ return GETPLAN; };
     const char * getMD5(){ return "e25a43e0752bcca599a8c2eef8282df8"; };
 
@@ -96,6 +92,19 @@ static const char GETPLAN[] = "nav_msgs/GetPlan";
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return GetPlanResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->plan.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return GETPLAN; };
     const char * getMD5(){ return "0002bc113c0259d71f6cf8cbc9430e18"; };
 
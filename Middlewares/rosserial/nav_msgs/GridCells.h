@@ -21,6 +21,7 @@ namespace nav_msgs
       typedef float _cell_height_type;
       _cell_height_type cell_height;
       uint32_t cells_length;
+      uint32_t cells_capacity;
       typedef geometry_msgs::Point _cells_type;
       _cells_type st_cells;
       _cells_type * cells;
@@ -29,7 +30,7 @@ namespace nav_msgs
       header(),
       cell_width(0),
       cell_height(0),
-      cells_length(0), cells(NULL)
+      cells_length(0), cells_capacity(0), cells(NULL)
     {
     }
 
@@ -37,31 +38,9 @@ namespace nav_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      union {
-        float real;
-        uint32_t base;
-      } u_cell_width;
-      u_cell_width.real = this->cell_width;
-      *(outbuffer + offset + 0) = (u_cell_width.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_cell_width.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_cell_width.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_cell_width.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->cell_width);
-      union {
-        float real;
-        uint32_t base;
-      } u_cell_height;
-      u_cell_height.real = this->cell_height;
-      *(outbuffer + offset + 0) = (u_cell_height.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_cell_height.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_cell_height.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_cell_height.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->cell_height);
-      *(outbuffer + offset + 0) = (this->cells_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->cells_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->cells_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->cells_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->cells_length);
+      offset += encode(outbuffer + offset, this->cell_width);
+      offset += encode(outbuffer + offset, this->cell_height);
+      offset += encode(outbuffer + offset, this->cells_length);
       for( uint32_t i = 0; i < cells_length; i++){
       offset += this->cells[i].serialize(outbuffer + offset);
       }
@@ -72,43 +51,31 @@ namespace nav_msgs
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      union {
-        float real;
-        uint32_t base;
-      } u_cell_width;
-      u_cell_width.base = 0;
-      u_cell_width.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_cell_width.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_cell_width.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_cell_width.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->cell_width = u_cell_width.real;
-      offset += sizeof(this->cell_width);
-      union {
-        float real;
-        uint32_t base;
-      } u_cell_height;
-      u_cell_height.base = 0;
-      u_cell_height.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_cell_height.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_cell_height.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_cell_height.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->cell_height = u_cell_height.real;
-      offset += sizeof(this->cell_height);
-      uint32_t cells_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      cells_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      cells_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      cells_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->cells_length);
-      if(cells_lengthT > cells_length)
-        this->cells = (geometry_msgs::Point*)realloc(this->cells, cells_lengthT * sizeof(geometry_msgs::Point));
-      cells_length = cells_lengthT;
-      for( uint32_t i = 0; i < cells_length; i++){
-      offset += this->st_cells.deserialize(inbuffer + offset);
-        memcpy( &(this->cells[i]), &(this->st_cells), sizeof(geometry_msgs::Point));
-      }
+      offset += decode(inbuffer + offset, this->cell_width);
+      offset += decode(inbuffer + offset, this->cell_height);
+      offset += decodeMsgArray(inbuffer + offset, this->cells, this->cells_length, this->cells_capacity);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return GridCells::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 8);
+      uint32_t cells_lengthT;
+      offset = wireCount(inbuffer, offset, size, cells_lengthT, 24);
+      for( uint32_t i = 0; (i < cells_lengthT) && (offset >= 0); i++){
+        offset = this->st_cells.wireLength(inbuffer, offset, size);
+      }
+      return offset;
+    }
+
     const char * getType(){ return "nav_msgs/GridCells"; };
     const char * getMD5(){ return "b9e4f5df6d28e272ebde00a3994830f5"; };
 
@@ -37,36 +37,11 @@ namespace nav_msgs
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->map_load_time.sec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->map_load_time.sec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->map_load_time.sec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->map_load_time.sec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->map_load_time.sec);
-      *(outbuffer + offset + 0) = (this->map_load_time.nsec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->map_load_time.nsec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->map_load_time.nsec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->map_load_time.nsec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->map_load_time.nsec);
-      union {
-        float real;
-        uint32_t base;
-      } u_resolution;
-      u_resolution.real = this->resolution;
-      *(outbuffer + offset + 0) = (u_resolution.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_resolution.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_resolution.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_resolution.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->resolution);
-      *(outbuffer + offset + 0) = (this->width >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->width >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->width >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->width >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->width);
-      *(outbuffer + offset + 0) = (this->height >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->height >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->height >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->height >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->height);
+      offset += encode(outbuffer + offset, this->map_load_time.sec);
+      offset += encode(outbuffer + offset, this->map_load_time.nsec);
+      offset += encode(outbuffer + offset, this->resolution);
+      offset += encode(outbuffer + offset, this->width);
+      offset += encode(outbuffer + offset, this->height);
       offset += this->origin.serialize(outbuffer + offset);
       return offset;
     }
@@ -74,41 +49,29 @@ namespace nav_msgs
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      this->map_load_time.sec =  ((uint32_t) (*(inbuffer + offset)));
-      this->map_load_time.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->map_load_time.sec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->map_load_time.sec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->map_load_time.sec);
-      this->map_load_time.nsec =  ((uint32_t) (*(inbuffer + offset)));
-      this->map_load_time.nsec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->map_load_time.nsec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->map_load_time.nsec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->map_load_time.nsec);
-      union {
-        float real;
-        uint32_t base;
-      } u_resolution;
-      u_resolution.base = 0;
-      u_resolution.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_resolution.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_resolution.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_resolution.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->resolution = u_resolution.real;
-      offset += sizeof(this->resolution);
-      this->width =  ((uint32_t) (*(inbuffer + offset)));
-      this->width |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->width |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->width |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->width);
-      this->height =  ((uint32_t) (*(inbuffer + offset)));
-      this->height |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->height |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->height |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->height);
+      offset += decode(inbuffer + offset, this->map_load_time.sec);
+      offset += decode(inbuffer + offset, this->map_load_time.nsec);
+      offset += decode(inbuffer + offset, this->resolution);
+      offset += decode(inbuffer + offset, this->width);
+      offset += decode(inbuffer + offset, this->height);
       offset += this->origin.deserialize(inbuffer + offset);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return MapMetaData::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkip(offset, size, 20);
+      offset = this->origin.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "nav_msgs/MapMetaData"; };
     const char * getMD5(){ return "10cfc8a2818024d3248802c00c95f11b"; };
 
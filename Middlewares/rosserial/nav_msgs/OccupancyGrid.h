@@ -35,20 +35,7 @@ namespace nav_msgs
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
       offset += this->info.serialize(outbuffer + offset);
-      *(outbuffer + offset + 0) = (this->data_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->data_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->data_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->data_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->data_length);
-      for( uint32_t i = 0; i < data_length; i++){
-      union {
-        int8_t real;
-        uint8_t base;
-      } u_datai;
-      u_datai.real = this->data[i];
-      *(outbuffer + offset + 0) = (u_datai.base >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->data[i]);
-      }
+      offset += encodeArray(outbuffer + offset, this->data, this->data_length);
       return offset;
     }
 
@@ -57,28 +44,25 @@ namespace nav_msgs
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
       offset += this->info.deserialize(inbuffer + offset);
-      uint32_t data_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      data_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      data_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      data_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->data_length);
-      if(data_lengthT > data_length)
-        this->data = (int8_t*)realloc(this->data, data_lengthT * sizeof(int8_t));
-      data_length = data_lengthT;
-      for( uint32_t i = 0; i < data_length; i++){
-      union {
-        int8_t real;
-        uint8_t base;
-      } u_st_data;
-      u_st_data.base = 0;
-      u_st_data.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      this->st_data = u_st_data.real;
-      offset += sizeof(this->st_data);
-        memcpy( &(this->data[i]), &(this->st_data), sizeof(int8_t));
-      }
+      offset += decodeArray(inbuffer + offset, this->data, this->data_length);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return OccupancyGrid::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = this->info.wireLength(inbuffer, offset, size);
+      offset = wireSkipArray(inbuffer, offset, size, 1);
+      return offset;
+    }
+
     const char * getType(){ return "nav_msgs/OccupancyGrid"; };
     const char * getMD5(){ return "3381f2d731d4076ec5c71b0759edbe4e"; };
 
@@ -36,11 +36,7 @@ namespace nav_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      uint32_t length_child_frame_id = strlen(this->child_frame_id);
-      varToArr(outbuffer + offset, length_child_frame_id);
-      offset += 4;
-      memcpy(outbuffer + offset, this->child_frame_id, length_child_frame_id);
-      offset += length_child_frame_id;
+      offset += encodeString(outbuffer + offset, this->child_frame_id);
       offset += this->pose.serialize(outbuffer + offset);
       offset += this->twist.serialize(outbuffer + offset);
       return offset;
@@ -50,20 +46,28 @@ namespace nav_msgs
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      uint32_t length_child_frame_id;
-      arrToVar(length_child_frame_id, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_child_frame_id; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_child_frame_id-1]=0;
-      this->child_frame_id = (char *)(inbuffer + offset-1);
-      offset += length_child_frame_id;
+      offset += decodeString(inbuffer + offset, this->child_frame_id);
       offset += this->pose.deserialize(inbuffer + offset);
       offset += this->twist.deserialize(inbuffer + offset);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return Odometry::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = this->pose.wireLength(inbuffer, offset, size);
+      offset = this->twist.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "nav_msgs/Odometry"; };
     const char * getMD5(){ return "cd5e73d190d741a2f92e81eda573aca7"; };
 
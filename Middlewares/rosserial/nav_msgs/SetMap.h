@@ -42,6 +42,20 @@ static const char SETMAP[] = "nav_msgs/SetMap";
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return SetMapRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->map.wireLength(inbuffer, offset, size);
+      offset = this->initial_pose.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return SETMAP; };
     const char * getMD5(){ return "91149a20d7be299b87c340df8cc94fd4"; };
 
@@ -61,30 +75,31 @@ static const char SETMAP[] = "nav_msgs/SetMap";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      union {
-        bool real;
-        uint8_t base;
-      } u_success;
-      u_success.real = this->success;
-      *(outbuffer + offset + 0) = (u_success.base >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->success);
+      offset += encode(outbuffer + offset, this->success);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      union {
-        bool real;
-        uint8_t base;
-      } u_success;
-      u_success.base = 0;
-      u_success.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      this->success = u_success.real;
-      offset += sizeof(this->success);
+      offset += decode(inbuffer + offset, this->success);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return SetMapResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 1);
+      return offset;
+    }
+
     const char * getType(){ return SETMAP; };
     const char * getMD5(){ return "358e233cde0c8a8bcfea4ce193f8fc15"; };
 
@@ -20,16 +20,32 @@ static const char NODELETLIST[] = "nodelet/NodeletList";
 
     virtual int serialize(unsigned char *outbuffer) const
     {
+      (void) outbuffer;
       int offset = 0;
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
+      (void) inbuffer;
       int offset = 0;
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return NodeletListRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      (void) size;
+      return offset;
+    }
+
     const char * getType(){ return NODELETLIST; };
     const char * getMD5(){ return "d41d8cd98f00b204e9800998ecf8427e"; };
 
@@ -51,47 +67,30 @@ static const char NODELETLIST[] = "nodelet/NodeletList";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->nodelets_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->nodelets_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->nodelets_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->nodelets_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->nodelets_length);
-      for( uint32_t i = 0; i < nodelets_length; i++){
-      uint32_t length_nodeletsi = strlen(this->nodelets[i]);
-      varToArr(outbuffer + offset, length_nodeletsi);
-      offset += 4;
-      memcpy(outbuffer + offset, this->nodelets[i], length_nodeletsi);
-      offset += length_nodeletsi;
-      }
+      offset += encodeStringArray(outbuffer + offset, this->nodelets, this->nodelets_length);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t nodelets_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      nodelets_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      nodelets_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      nodelets_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->nodelets_length);
-      if(nodelets_lengthT > nodelets_length)
-        this->nodelets = (char**)realloc(this->nodelets, nodelets_lengthT * sizeof(char*));
-      nodelets_length = nodelets_lengthT;
-      for( uint32_t i = 0; i < nodelets_length; i++){
-      uint32_t length_st_nodelets;
-      arrToVar(length_st_nodelets, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_nodelets; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_nodelets-1]=0;
-      this->st_nodelets = (char *)(inbuffer + offset-1);
-      offset += length_st_nodelets;
-        memcpy( &(this->nodelets[i]), &(this->st_nodelets), sizeof(char*));
-      }
+      offset += decodeStringArray(inbuffer + offset, this->nodelets, this->nodelets_length);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return NodeletListResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipStringArray(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return NODELETLIST; };
     const char * getMD5(){ return "99c7b10e794f5600b8030e697e946ca7"; };
 
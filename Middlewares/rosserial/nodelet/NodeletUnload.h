@@ -24,29 +24,30 @@ static const char NODELETUNLOAD[] = "nodelet/NodeletUnload";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_name = strlen(this->name);
-      varToArr(outbuffer + offset, length_name);
-      offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
-      offset += length_name;
+      offset += encodeString(outbuffer + offset, this->name);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_name;
-      arrToVar(length_name, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
-      offset += length_name;
+      offset += decodeString(inbuffer + offset, this->name);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return NodeletUnloadRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return NODELETUNLOAD; };
     const char * getMD5(){ return "c1f3d28f1b044c871e6eff2e9fc3c667"; };
 
@@ -66,30 +67,31 @@ static const char NODELETUNLOAD[] = "nodelet/NodeletUnload";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      union {
-        bool real;
-        uint8_t base;
-      } u_success;
-      u_success.real = this->success;
-      *(outbuffer + offset + 0) = (u_success.base >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->success);
+      offset += encode(outbuffer + offset, this->success);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      union {
-        bool real;
-        uint8_t base;
-      } u_success;
-      u_success.base = 0;
-      u_success.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      this->success = u_success.real;
-      offset += sizeof(this->success);
+      offset += decode(inbuffer + offset, this->success);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return NodeletUnloadResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 1);
+      return offset;
+    }
+
     const char * getType(){ return NODELETUNLOAD; };
     const char * getMD5(){ return "358e233cde0c8a8bcfea4ce193f8fc15"; };
 
@@ -38,13 +38,22 @@
 #include "ros/node_handle.h"
 
 #if defined(STM32F3) or defined(STM32F4)
-  #include "STMHardware.h"
+  #include "STMHardwareLL.h"
 #endif
 
 namespace ros
 {
 #if defined(STM32F3) or defined(STM32F4)
-  typedef NodeHandle_<STMHardware> NodeHandle; // default 25, 25, 512, 512
+  // USART2 over DMA1 stream 5 (rx) and 6 (tx), channel 4. Firmware written
+  // for the former STMHardware default has to:
+  //  1. init USART2 with HAL_UART_Init() and enable the DMA1 clock before
+  //     nh.initNode(), the HAL UART driver must not start transfers on it
+  //  2. call nh.getHardware()->usartIrq() from USART2_IRQHandler() and
+  //     nh.getHardware()->txDmaIrq() from DMA1_Stream6_IRQHandler() instead
+  //     of the HAL handlers, and enable both in the NVIC
+  // Without the tx stream interrupt only the first write() is sent. The rx
+  // stream needs no interrupt, read() polls its counter.
+  typedef NodeHandle_<STMHardwareLL> NodeHandle; // default 25, 25, 512, 512, no profiling
 #endif
 }
 
@@ -37,11 +37,70 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
 
 namespace ros
 {
 
-/* Base Message Type */
+/* Unsigned integer with the same size as a field, used by the codecs. The
+ * byte accesses are written out so the compiler can merge them into single
+ * loads and stores even when optimizing for size. */
+template<size_t Size> struct WireBase_;
+template<> struct WireBase_<1>
+{
+  typedef uint8_t type;
+  static type load(const unsigned char *in) { return in[0]; }
+  static void store(unsigned char *out, const type v) { out[0] = v; }
+};
+template<> struct WireBase_<2>
+{
+  typedef uint16_t type;
+  static type load(const unsigned char *in)
+  {
+    return (type)(((type) in[0]) | (((type) in[1]) << 8));
+  }
+  static void store(unsigned char *out, const type v)
+  {
+    out[0] = (v >> 0) & 0xFF;
+    out[1] = (v >> 8) & 0xFF;
+  }
+};
+template<> struct WireBase_<4>
+{
+  typedef uint32_t type;
+  static type load(const unsigned char *in)
+  {
+    return ((type) in[0]) | (((type) in[1]) << 8) | (((type) in[2]) << 16) | (((type) in[3]) << 24);
+  }
+  static void store(unsigned char *out, const type v)
+  {
+    out[0] = (v >> 0) & 0xFF;
+    out[1] = (v >> 8) & 0xFF;
+    out[2] = (v >> 16) & 0xFF;
+    out[3] = (v >> 24) & 0xFF;
+  }
+};
+template<> struct WireBase_<8>
+{
+  typedef uint64_t type;
+  static type load(const unsigned char *in)
+  {
+    return ((type) WireBase_<4>::load(in)) | (((type) WireBase_<4>::load(in + 4)) << 32);
+  }
+  static void store(unsigned char *out, const type v)
+  {
+    WireBase_<4>::store(out, (uint32_t) v);
+    WireBase_<4>::store(out + 4, (uint32_t)(v >> 32));
+  }
+};
+
+/* Base Message Type
+ *
+ * The generated messages add a non-virtual deserialize(data, size), which
+ * checks the length with wireLength() before decoding anything. It is not
+ * part of this interface: code holding a Msg* only reaches the unchecked
+ * deserialize(data), the length check needs the message type. */
 class Msg
 {
 public:
@@ -124,6 +183,224 @@ public:
     return 8;
   }
 
+  /*
+   * Field codecs shared by all generated messages. Every field is stored
+   * little endian; each function returns the number of bytes used so the
+   * generated code only has to advance its offset. Keeping one copy of the
+   * byte shuffling here instead of one per field keeps the messages small.
+   */
+
+  // Encode an integer, float or bool field
+  template<typename T>
+  static int encode(unsigned char *outbuffer, const T value)
+  {
+    typename WireBase_<sizeof(T)>::type base;
+    memcpy(&base, &value, sizeof(T));
+    WireBase_<sizeof(T)>::store(outbuffer, base);
+    return sizeof(T);
+  }
+
+  // Decode an integer or float field
+  template<typename T>
+  static int decode(const unsigned char *inbuffer, T &value)
+  {
+    typename WireBase_<sizeof(T)>::type base = WireBase_<sizeof(T)>::load(inbuffer);
+    memcpy(&value, &base, sizeof(T));
+    return sizeof(T);
+  }
+
+  // Decode a bool field, any non-zero byte is true
+  static int decode(const unsigned char *inbuffer, bool &value)
+  {
+    value = (inbuffer[0] != 0);
+    return 1;
+  }
+
+  // Encode a string as length followed by the characters
+  static int encodeString(unsigned char *outbuffer, const char *str)
+  {
+    uint32_t length = strlen(str);
+    encode(outbuffer, length);
+    memcpy(outbuffer + 4, str, length);
+    return 4 + length;
+  }
+
+  // Decode a string in place: the characters are moved down over the last
+  // length byte to make room for the terminating zero, str points into inbuffer
+  template<typename StrT>
+  static int decodeString(unsigned char *inbuffer, StrT &str)
+  {
+    uint32_t length;
+    decode(inbuffer, length);
+    memmove(inbuffer + 3, inbuffer + 4, length);
+    inbuffer[3 + length] = 0;
+    str = (char *)(inbuffer + 3);
+    return 4 + length;
+  }
+
+  // Encode a variable length array of integer or float32 fields
+  template<typename T>
+  static int encodeArray(unsigned char *outbuffer, const T *data, const uint32_t length)
+  {
+    int offset = encode(outbuffer, length);
+    for (uint32_t i = 0; i < length; i++)
+      offset += encode(outbuffer + offset, data[i]);
+    return offset;
+  }
+
+  // Decode a variable length array of integer or float32 fields, growing
+  // the storage if the received array is longer than the current one
+  template<typename T>
+  static int decodeArray(const unsigned char *inbuffer, T *&data, uint32_t &length)
+  {
+    uint32_t lengthT;
+    int offset = decode(inbuffer, lengthT);
+    if (lengthT > length)
+      data = (T*)realloc(data, lengthT * sizeof(T));
+    length = lengthT;
+    for (uint32_t i = 0; i < length; i++)
+      offset += decode(inbuffer + offset, data[i]);
+    return offset;
+  }
+
+  // Decode a variable length array of nested messages. capacity counts the
+  // constructed elements: elements behind a shorter array keep their nested
+  // storage for the next longer one, and only elements beyond capacity are
+  // constructed when the array grows. The storage is grown with new[]
+  // since the messages have a vtable and must not be moved by realloc.
+  // A capacity of 0 means the decoder does not own data: an array the user
+  // points to is left alone and replaced by the decoder's own. Only storage
+  // the decoder allocated, capacity != 0, is freed when it grows again.
+  template<typename T>
+  static int decodeMsgArray(unsigned char *inbuffer, T *&data, uint32_t &length, uint32_t &capacity)
+  {
+    uint32_t lengthT;
+    int offset = decode(inbuffer, lengthT);
+    if (lengthT > capacity)
+    {
+      T *grown = new T[lengthT];
+      for (uint32_t i = 0; i < capacity; i++)
+        grown[i] = data[i];
+      if (capacity != 0)
+        delete[] data;
+      data = grown;
+      capacity = lengthT;
+    }
+    length = lengthT;
+    for (uint32_t i = 0; i < length; i++)
+      offset += data[i].T::deserialize(inbuffer + offset);
+    return offset;
+  }
+
+  // Encode a variable length array of float64 fields
+  static int encodeFloat64Array(unsigned char *outbuffer, const float *data, const uint32_t length)
+  {
+    int offset = encode(outbuffer, length);
+    for (uint32_t i = 0; i < length; i++)
+      offset += serializeAvrFloat64(outbuffer + offset, data[i]);
+    return offset;
+  }
+
+  // Decode a variable length array of float64 fields
+  static int decodeFloat64Array(const unsigned char *inbuffer, float *&data, uint32_t &length)
+  {
+    uint32_t lengthT;
+    int offset = decode(inbuffer, lengthT);
+    if (lengthT > length)
+      data = (float*)realloc(data, lengthT * sizeof(float));
+    length = lengthT;
+    for (uint32_t i = 0; i < length; i++)
+      offset += deserializeAvrFloat64(inbuffer + offset, &data[i]);
+    return offset;
+  }
+
+  // Encode a variable length array of strings
+  static int encodeStringArray(unsigned char *outbuffer, char * const *data, const uint32_t length)
+  {
+    int offset = encode(outbuffer, length);
+    for (uint32_t i = 0; i < length; i++)
+      offset += encodeString(outbuffer + offset, data[i]);
+    return offset;
+  }
+
+  // Decode a variable length array of strings in place
+  static int decodeStringArray(unsigned char *inbuffer, char **&data, uint32_t &length)
+  {
+    uint32_t lengthT;
+    int offset = decode(inbuffer, lengthT);
+    if (lengthT > length)
+      data = (char**)realloc(data, lengthT * sizeof(char*));
+    length = lengthT;
+    for (uint32_t i = 0; i < length; i++)
+      offset += decodeString(inbuffer + offset, data[i]);
+    return offset;
+  }
+
+  /*
+   * Length checks used by the generated wireLength(). They walk a serialized
+   * message without touching it: each takes the offset reached so far and
+   * returns the offset behind its field, or -1 once anything would end past
+   * size. A failure passes through all following calls, so the generated
+   * code only looks at the result at the very end. Fixed size fields are
+   * merged into one wireSkip() by the generator.
+   */
+
+  // Skip a fixed number of bytes
+  static int wireSkip(const int offset, const size_t size, const size_t bytes)
+  {
+    if ((offset < 0) || (bytes > size - (size_t) offset))
+      return -1;
+    return offset + (int) bytes;
+  }
+
+  // Read the element count of a variable length array. element is the
+  // least number of bytes an element takes on the wire, counts for which
+  // the remaining bytes cannot hold are rejected before anything is
+  // allocated for them. Elements of 0 bytes, e.g. std_msgs/Empty, give no
+  // bound, so element 0 skips the check.
+  static int wireCount(const unsigned char *inbuffer, int offset, const size_t size, uint32_t &count,
+                       const size_t element)
+  {
+    count = 0;
+    offset = wireSkip(offset, size, 4);
+    if (offset < 0)
+      return -1;
+    uint32_t countT;
+    decode(inbuffer + offset - 4, countT);
+    if ((element > 0) && (countT > (size - (size_t) offset) / element))
+      return -1;
+    count = countT;
+    return offset;
+  }
+
+  // Skip a string
+  static int wireSkipString(const unsigned char *inbuffer, int offset, const size_t size)
+  {
+    uint32_t length;
+    offset = wireCount(inbuffer, offset, size, length, 1);
+    return wireSkip(offset, size, length);
+  }
+
+  // Skip a variable length array of elements with a fixed size
+  static int wireSkipArray(const unsigned char *inbuffer, int offset, const size_t size, const size_t element)
+  {
+    uint32_t count;
+    offset = wireCount(inbuffer, offset, size, count, element);
+    if (offset < 0)
+      return -1;
+    return offset + (int) (count * element);
+  }
+
+  // Skip a variable length array of strings
+  static int wireSkipStringArray(const unsigned char *inbuffer, int offset, const size_t size)
+  {
+    uint32_t count;
+    offset = wireCount(inbuffer, offset, size, count, 4);
+    for (uint32_t i = 0; (i < count) && (offset >= 0); i++)
+      offset = wireSkipString(inbuffer, offset, size);
+    return offset;
+  }
+
   // Copy data from variable into a byte array
   template<typename A, typename V>
   static void varToArr(A arr, const V var)
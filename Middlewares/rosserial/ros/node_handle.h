@@ -35,6 +35,7 @@
 #ifndef ROS_NODE_HANDLE_H_
 #define ROS_NODE_HANDLE_H_
 
+#include <limits.h>
 #include <stdint.h>
 
 #include "std_msgs/Time.h"
@@ -43,6 +44,8 @@
 #include "rosserial_msgs/RequestParam.h"
 
 #include "ros/msg.h"
+#include "ros/profiler.h"
+#include "ros/trace.h"
 
 namespace ros
 {
@@ -95,17 +98,114 @@ const uint8_t SERIAL_MSG_TIMEOUT  = 20;   // 20 milliseconds to recieve all of m
 
 using rosserial_msgs::TopicInfo;
 
+/* Link statistics of one topic, updated by NodeHandle_ for every frame */
+struct TopicCounters
+{
+  uint64_t period_sq_sum;    // sum of the squared periods in ms^2
+  uint32_t msgs;             // frames sent or received
+  uint32_t bytes;            // including the 8 bytes of framing
+  uint32_t drops;            // frames not sent, or received incomplete
+  uint32_t checksum_errors;  // received frames with a wrong checksum
+  uint32_t periods;          // number of periods in period_sum_ms
+  uint32_t period_sum_ms;
+  uint32_t period_max_ms;
+  uint32_t last_ms;          // time of the last frame, if msgs or periods
+  bool seen;
+
+  /* Start a new window, the period to the next frame is still counted */
+  void reset()
+  {
+    msgs = 0;
+    bytes = 0;
+    drops = 0;
+    checksum_errors = 0;
+    periods = 0;
+    period_sum_ms = 0;
+    period_max_ms = 0;
+    period_sq_sum = 0;
+  }
+
+  void add(uint32_t now_ms, uint32_t size)
+  {
+    if (seen)
+    {
+      const uint32_t period = now_ms - last_ms;
+      periods++;
+      period_sum_ms += period;
+      period_sq_sum += (uint64_t)period * period;
+      if (period > period_max_ms)
+        period_max_ms = period;
+    }
+    seen = true;
+    last_ms = now_ms;
+    msgs++;
+    bytes += size;
+  }
+};
+
+/* TX_CAPACITY of a hardware, the most bytes one write() can queue without
+ * dropping them, 0 if the hardware does not declare it */
+template<typename T>
+struct VoidType
+{
+  typedef void type;
+};
+
+template<class Hardware, class Enable = void>
+struct HardwareTxCapacity
+{
+  enum { value = 0 };
+};
+
+template<class Hardware>
+struct HardwareTxCapacity<Hardware, typename VoidType<decltype(Hardware::TX_CAPACITY)>::type>
+{
+  enum { value = Hardware::TX_CAPACITY };
+};
+
+/* Bytes a write() of the hardware takes right now, from its txSpace(). A
+ * hardware without txSpace() is taken to accept every write. */
+template<class Hardware, class Enable = void>
+struct HardwareTxSpace
+{
+  static int get(Hardware &)
+  {
+    return INT_MAX;
+  }
+};
+
+template<class Hardware>
+struct HardwareTxSpace<Hardware, typename VoidType<decltype(&Hardware::txSpace)>::type>
+{
+  static int get(Hardware &hardware)
+  {
+    return hardware.txSpace();
+  }
+};
+
 /* Node Handle */
 template<class Hardware,
          int MAX_SUBSCRIBERS = 25,
          int MAX_PUBLISHERS = 25,
          int INPUT_SIZE = 512,
-         int OUTPUT_SIZE = 512>
+         int OUTPUT_SIZE = 512,
+         class Profiler = NullProfiler,
+         class Tracer = NullTracer>
 class NodeHandle_ : public NodeHandleBase_
 {
+  /* a frame which does not fit the tx ring of the hardware is never sent */
+  static_assert((HardwareTxCapacity<Hardware>::value == 0) || (HardwareTxCapacity<Hardware>::value >= OUTPUT_SIZE),
+                "TX_CAPACITY of the hardware must hold a frame of OUTPUT_SIZE");
+
 protected:
   Hardware hardware_;
 
+  /* cycle counts of spinOnce and publish, see ros/profiler.h */
+  Profiler profiler_;
+
+  /* protocol events, see ros/trace.h */
+  Tracer tracer_;
+
   /* time used for syncing */
   uint32_t rt_time;
 
@@ -121,11 +221,21 @@ protected:
   Publisher * publishers[MAX_PUBLISHERS];
   Subscriber_ * subscribers[MAX_SUBSCRIBERS];
 
+  /* link statistics, indexed by topic id - 100 */
+  TopicCounters counters_[MAX_SUBSCRIBERS + MAX_PUBLISHERS];
+
   /*
    * Setup Functions
    */
 public:
-  NodeHandle_() : configured_(false)
+  /* buffer sizes, for components which have to split their output */
+  enum { INPUT_BUFFER_SIZE = INPUT_SIZE, OUTPUT_BUFFER_SIZE = OUTPUT_SIZE };
+
+  /* topic ids are 100 up to 100 + TOPIC_SLOTS - 1, subscribers first */
+  enum { TOPIC_SLOTS = MAX_SUBSCRIBERS + MAX_PUBLISHERS };
+
+  NodeHandle_() : configured_(false), negotiation_count_(0), stream_remaining_(-1), stream_chk_(0),
+    stream_id_(0), stream_aborted_(false), held_size_(0), held_id_(0), sync_deferred_(false)
   {
 
     for (unsigned int i = 0; i < MAX_PUBLISHERS; i++)
@@ -140,6 +250,13 @@ public:
     for (unsigned int i = 0; i < OUTPUT_SIZE; i++)
       message_out[i] = 0;
 
+    for (unsigned int i = 0; i < TOPIC_SLOTS; i++)
+    {
+      counters_[i].reset();
+      counters_[i].seen = false;
+      counters_[i].last_ms = 0;
+    }
+
     req_param_resp.ints_length = 0;
     req_param_resp.ints = NULL;
     req_param_resp.floats_length = 0;
@@ -155,6 +272,16 @@ public:
     return &hardware_;
   }
 
+  Profiler* getProfiler()
+  {
+    return &profiler_;
+  }
+
+  Tracer* getTracer()
+  {
+    return &tracer_;
+  }
+
   /* Start serial, initialize buffers */
   void initNode()
   {
@@ -188,6 +315,39 @@ public:
      spin_timeout_ = timeout;
   }
 
+  /* Number of topic negotiations so far. Changes whenever the host has set
+   * up its side of the topics again, e.g. after it was restarted. */
+  uint32_t getNegotiationCount() const
+  {
+    return negotiation_count_;
+  }
+
+  /* Link statistics of topic id, 0 if id is not a topic id */
+  TopicCounters * getCounters(int id)
+  {
+    const int i = id - 100;
+    if ((i < 0) || (i >= TOPIC_SLOTS))
+      return 0;
+    return &counters_[i];
+  }
+
+  /* Name of the topic registered with id, 0 if there is none */
+  const char * getTopicName(int id)
+  {
+    const int i = id - 100;
+    if ((i >= 0) && (i < MAX_SUBSCRIBERS))
+      return subscribers[i] ? subscribers[i]->topic_ : 0;
+    if ((i >= MAX_SUBSCRIBERS) && (i < TOPIC_SLOTS))
+      return publishers[i - MAX_SUBSCRIBERS] ? publishers[i - MAX_SUBSCRIBERS]->topic_ : 0;
+    return 0;
+  }
+
+  /* True if id belongs to a publisher of this node */
+  bool isPublisherId(int id) const
+  {
+    return (id >= 100 + MAX_SUBSCRIBERS) && (id < 100 + TOPIC_SLOTS);
+  }
+
 protected:
   //State machine variables for spinOnce
   int mode_;
@@ -197,6 +357,20 @@ protected:
   int checksum_;
 
   bool configured_;
+  uint32_t negotiation_count_;
+
+  /* open streamed frame: payload bytes still expected, -1 if none */
+  int stream_remaining_;
+  int stream_chk_;
+  int stream_id_;
+
+  /* the open frame was aborted, its padding waits for space in the hardware */
+  bool stream_aborted_;
+
+  /* frame held in message_out until the streamed frame is closed */
+  int held_size_;
+  int held_id_;
+  bool sync_deferred_;
 
   /* used for syncing the time */
   uint32_t last_sync_time;
@@ -211,10 +385,29 @@ public:
 
   virtual int spinOnce()
   {
+    const uint32_t start = profiler_.start();
+    uint32_t dispatch = 0;
+
+    const int ret = spin(dispatch);
+
+    profiler_.add(PROFILE_PARSE, profiler_.record(PROFILE_SPIN, start) - dispatch);
+    return ret;
+  }
+
+protected:
+  /* spinOnce, dispatch returns the cycles spent in subscriber callbacks */
+  int spin(uint32_t & dispatch)
+  {
+    /* pad an aborted frame as far as the hardware drained meanwhile */
+    if (stream_aborted_)
+      flushAbort();
+
     /* restart if timed out */
     uint32_t c_time = hardware_.time();
     if ((c_time - last_sync_receive_time) > (SYNC_SECONDS * 2200))
     {
+      if (configured_)
+        tracer_.event(TRACE_DISCONNECT, TRACE_DISCONNECT_SYNC);
       configured_ = false;
     }
 
@@ -223,7 +416,12 @@ public:
     {
       if (c_time > last_msg_timeout_time)
       {
+        /* the topic of an incomplete frame is known once its id is read */
+        if ((mode_ >= MODE_MESSAGE) && getCounters(topic_))
+          getCounters(topic_)->drops++;
+        tracer_.event(TRACE_RESYNC, TRACE_RESYNC_TIMEOUT, mode_ >= MODE_MESSAGE ? topic_ : 0);
         mode_ = MODE_FIRST_FF;
+        tracer_.event(TRACE_MODE, MODE_FIRST_FF);
       }
     }
 
@@ -246,6 +444,7 @@ public:
       int data = hardware_.read();
       if (data < 0)
         break;
+      const int mode = mode_;
       checksum_ += data;
       if (mode_ == MODE_MESSAGE)          /* message data being recieved */
       {
@@ -258,12 +457,14 @@ public:
       {
         if (data == 0xff)
         {
+          tracer_.event(TRACE_FRAME_BEGIN);
           mode_++;
           last_msg_timeout_time = c_time + SERIAL_MSG_TIMEOUT;
         }
         else if (hardware_.time() - c_time > (SYNC_SECONDS * 1000))
         {
           /* We have been stuck in spinOnce too long, return error */
+          tracer_.event(TRACE_DISCONNECT, TRACE_DISCONNECT_STUCK);
           configured_ = false;
           return SPIN_TIMEOUT;
         }
@@ -276,6 +477,7 @@ public:
         }
         else
         {
+          tracer_.event(TRACE_RESYNC, TRACE_RESYNC_PROTOCOL);
           mode_ = MODE_FIRST_FF;
           if (configured_ == false)
             requestSyncTime();  /* send a msg back showing our protocol version */
@@ -295,10 +497,18 @@ public:
       }
       else if (mode_ == MODE_SIZE_CHECKSUM)
       {
-        if ((checksum_ % 256) == 255)
+        if (((checksum_ % 256) == 255) && (bytes_ <= INPUT_SIZE))
+        {
           mode_++;
+        }
         else
-          mode_ = MODE_FIRST_FF;          /* Abandon the frame if the msg len is wrong */
+        {
+          if ((checksum_ % 256) != 255)
+            tracer_.event(TRACE_CHECKSUM_ERROR, 0);
+          else
+            tracer_.event(TRACE_RESYNC, TRACE_RESYNC_LENGTH);
+          mode_ = MODE_FIRST_FF;          /* Abandon the frame if the msg len is wrong or does not fit */
+        }
       }
       else if (mode_ == MODE_TOPIC_L)     /* bottom half of topic id */
       {
@@ -316,8 +526,19 @@ public:
       else if (mode_ == MODE_MSG_CHECKSUM)    /* do checksum */
       {
         mode_ = MODE_FIRST_FF;
-        if ((checksum_ % 256) == 255)
+        tracer_.event(TRACE_MODE, MODE_FIRST_FF);
+        TopicCounters * counters = getCounters(topic_);
+        if ((checksum_ % 256) != 255)
+        {
+          tracer_.event(TRACE_CHECKSUM_ERROR, 1, topic_);
+          if (counters)
+            counters->checksum_errors++;
+        }
+        else
         {
+          tracer_.event(TRACE_FRAME_END, 0, topic_);
+          if (counters)
+            counters->add(c_time, index_ + 8);
           if (topic_ == TopicInfo::ID_PUBLISHER)
           {
             requestSyncTime();
@@ -328,24 +549,38 @@ public:
           }
           else if (topic_ == TopicInfo::ID_TIME)
           {
-            syncTime(message_in);
+            syncTime(message_in, index_);
           }
           else if (topic_ == TopicInfo::ID_PARAMETER_REQUEST)
           {
-            req_param_resp.deserialize(message_in);
-            param_recieved = true;
+            if (req_param_resp.deserialize(message_in, index_) >= 0)
+              param_recieved = true;
           }
           else if (topic_ == TopicInfo::ID_TX_STOP)
           {
+            tracer_.event(TRACE_DISCONNECT, TRACE_DISCONNECT_HOST);
             configured_ = false;
           }
           else
           {
-            if (subscribers[topic_ - 100])
-              subscribers[topic_ - 100]->callback(message_in);
+            const int sub = topic_ - 100;
+            if ((sub >= 0) && (sub < MAX_SUBSCRIBERS) && subscribers[sub])
+            {
+              const uint32_t start = profiler_.start();
+              tracer_.event(TRACE_CALLBACK_BEGIN, 0, topic_);
+              subscribers[sub]->callback(message_in, index_);
+              tracer_.event(TRACE_CALLBACK_END, 0, topic_);
+              const uint32_t cycles = profiler_.record(PROFILE_DISPATCH, start);
+              profiler_.addTopic(topic_, cycles);
+              dispatch += cycles;
+            }
           }
         }
       }
+
+      /* the end of a frame is traced before its callback */
+      if ((mode_ != mode) && (mode != MODE_MSG_CHECKSUM))
+        tracer_.event(TRACE_MODE, mode_);
     }
 
     /* occasionally sync time */
@@ -358,7 +593,7 @@ public:
     return SPIN_OK;
   }
 
-
+public:
   /* Are we connected to the PC? */
   virtual bool connected()
   {
@@ -371,17 +606,25 @@ public:
 
   void requestSyncTime()
   {
+    /* rt_time has to be taken when the request is on the wire */
+    if (stream_remaining_ >= 0)
+    {
+      sync_deferred_ = true;
+      return;
+    }
+
     std_msgs::Time t;
-    publish(TopicInfo::ID_TIME, &t);
+    publishStatic(TopicInfo::ID_TIME, t);
     rt_time = hardware_.time();
   }
 
-  void syncTime(uint8_t * data)
+  void syncTime(uint8_t * data, size_t size)
   {
     std_msgs::Time t;
     uint32_t offset = hardware_.time() - rt_time;
 
-    t.deserialize(data);
+    if (t.deserialize(data, size) < 0)
+      return;
     t.data.sec += offset / 1000;
     t.data.nsec += (offset % 1000) * 1000000UL;
 
@@ -480,7 +723,12 @@ public:
   void negotiateTopics()
   {
     rosserial_msgs::TopicInfo ti;
+    bool complete = true;
     int i;
+
+    /* the host waits for the topic infos, they cannot wait behind a stream */
+    abortFrame();
+
     for (i = 0; i < MAX_PUBLISHERS; i++)
     {
       if (publishers[i] != 0) // non-empty slot
@@ -490,7 +738,8 @@ public:
         ti.message_type = (char *) publishers[i]->msg_->getType();
         ti.md5sum = (char *) publishers[i]->msg_->getMD5();
         ti.buffer_size = OUTPUT_SIZE;
-        publish(publishers[i]->getEndpointType(), &ti);
+        if (publishStatic(publishers[i]->getEndpointType(), ti) <= 0)
+          complete = false;
       }
     }
     for (i = 0; i < MAX_SUBSCRIBERS; i++)
@@ -502,20 +751,215 @@ public:
         ti.message_type = (char *) subscribers[i]->getMsgType();
         ti.md5sum = (char *) subscribers[i]->getMsgMD5();
         ti.buffer_size = INPUT_SIZE;
-        publish(subscribers[i]->getEndpointType(), &ti);
+        if (publishStatic(subscribers[i]->getEndpointType(), ti) <= 0)
+          complete = false;
       }
     }
+
+    /* the host does not know all topics, it asks again after its timeout */
+    if (!complete)
+      return;
+
     configured_ = true;
+    negotiation_count_++;
+    tracer_.event(TRACE_CONNECT);
   }
 
   virtual int publish(int id, const Msg * msg)
   {
     if (id >= 100 && !configured_)
-      return 0;
+      return dropFrame(id, 0);
+
+    /* message_out still holds a frame for the end of the stream */
+    if (held_size_ > 0)
+      return dropFrame(id, -1);
 
     /* serialize message */
+    const uint32_t start = profiler_.start();
+    tracer_.event(TRACE_PUBLISH_BEGIN, 0, id);
     int l = msg->serialize(message_out + 7);
+    profiler_.record(PROFILE_SERIALIZE, start);
+
+    l = sendFrame(id, l);
+    tracer_.event(TRACE_PUBLISH_END, l > 0, l > 0 ? l : 0);
+    profiler_.addTopic(id, profiler_.elapsed(start));
+    return l;
+  }
+
+  /* Publish with the message type known at compile time: serialize is bound
+   * statically, so it is inlined instead of going through the vtable. */
+  template<typename MsgT>
+  int publishStatic(int id, const MsgT & msg)
+  {
+    if (id >= 100 && !configured_)
+      return dropFrame(id, 0);
+
+    if (held_size_ > 0)
+      return dropFrame(id, -1);
+
+    const uint32_t start = profiler_.start();
+    tracer_.event(TRACE_PUBLISH_BEGIN, 0, id);
+    int l = msg.MsgT::serialize(message_out + 7);
+    profiler_.record(PROFILE_SERIALIZE, start);
+
+    l = sendFrame(id, l);
+    tracer_.event(TRACE_PUBLISH_END, l > 0, l > 0 ? l : 0);
+    profiler_.addTopic(id, profiler_.elapsed(start));
+    return l;
+  }
+
+  /*
+   * Streamed frames: the payload is handed to the hardware in pieces
+   * instead of being serialized into message_out. The payload length has to
+   * be known when the frame is started. One other frame is held in
+   * message_out and sent right after the streamed frame, further ones are
+   * dropped. A time sync request waits for the end of the stream, a topic
+   * negotiation aborts the stream.
+   *
+   * A piece is only written if the hardware takes all of it (txSpace()),
+   * otherwise the call fails and the frame stays as it was. The caller may
+   * try again later or give up with abortFrame(), so the host never gets a
+   * frame with bytes missing.
+   */
+
+  /* Start a frame of length payload bytes on topic id */
+  bool beginFrame(int id, int length)
+  {
+    if ((id >= 100 && !configured_) || (stream_remaining_ >= 0) || (length < 0) || (length > 0x7fff))
+      return dropFrame(id, false);
+
+    uint8_t header[7];
+    header[0] = 0xff;
+    header[1] = PROTOCOL_VER;
+    header[2] = (uint8_t)((uint16_t)length & 255);
+    header[3] = (uint8_t)((uint16_t)length >> 8);
+    header[4] = 255 - ((header[2] + header[3]) % 256);
+    header[5] = (uint8_t)((int16_t)id & 255);
+    header[6] = (uint8_t)((int16_t)id >> 8);
+
+    if (!writeHardware(header, 7))
+      return dropFrame(id, false);
+
+    tracer_.event(TRACE_PUBLISH_BEGIN, 0, id);
+    stream_remaining_ = length;
+    stream_chk_ = header[5] + header[6];
+    stream_id_ = id;
+    if (getCounters(id))
+      getCounters(id)->add(hardware_.time(), length + 8);
+    return true;
+  }
+
+  /* Append payload bytes to the open frame, false if they are more than the
+   * frame expects or the hardware cannot take them now */
+  bool writeFrame(uint8_t * data, int length)
+  {
+    if (stream_aborted_ || (length < 0) || (length > stream_remaining_))
+      return false;
+
+    if (!writeHardware(data, length))
+      return false;
+
+    for (int i = 0; i < length; i++)
+      stream_chk_ += data[i];
+    stream_remaining_ -= length;
+    return true;
+  }
+
+  /* Close the open frame once all of its payload has been written, false
+   * if payload is missing or the hardware cannot take the checksum now */
+  bool endFrame()
+  {
+    if (stream_aborted_ || (stream_remaining_ != 0))
+      return false;
+
+    return closeFrame(255 - (stream_chk_ % 256));
+  }
+
+  /* Give up the open frame. Its missing payload is sent as zeros and the
+   * frame gets a wrong checksum, so the host discards it. What does not fit
+   * the hardware now follows in spinOnce(), until then no frame is opened. */
+  bool abortFrame()
+  {
+    if ((stream_remaining_ < 0) || stream_aborted_)
+      return false;
+
+    stream_aborted_ = true;
+    dropFrame(stream_id_, 0);
+    flushAbort();
+    return true;
+  }
 
+  /* Payload bytes the open frame still expects, -1 if no frame is open or
+   * it was aborted */
+  int getFrameRemaining() const
+  {
+    return stream_aborted_ ? -1 : stream_remaining_;
+  }
+
+protected:
+  /* Write all length bytes, or nothing if the hardware cannot take them now */
+  bool writeHardware(uint8_t * data, int length)
+  {
+    if (HardwareTxSpace<Hardware>::get(hardware_) < length)
+      return false;
+    hardware_.write(data, length);
+    return true;
+  }
+
+  /* Send the checksum of the open frame, then what waited for its end */
+  bool closeFrame(uint8_t chk)
+  {
+    if (!writeHardware(&chk, 1))
+      return false;
+
+    tracer_.event(TRACE_PUBLISH_END, !stream_aborted_);
+    stream_remaining_ = -1;
+    stream_aborted_ = false;
+
+    if (held_size_ > 0)
+    {
+      if (writeHardware(message_out, held_size_))
+      {
+        if (getCounters(held_id_))
+          getCounters(held_id_)->add(hardware_.time(), held_size_);
+      }
+      else
+      {
+        dropFrame(held_id_, 0);
+      }
+      held_size_ = 0;
+    }
+    if (sync_deferred_)
+    {
+      sync_deferred_ = false;
+      requestSyncTime();
+    }
+    return true;
+  }
+
+  /* Pad the aborted frame with zeros as far as the hardware takes them and
+   * close it once complete. Zeros leave the sum unchanged, so one more than
+   * the right checksum never verifies. */
+  bool flushAbort()
+  {
+    uint8_t zeros[16] = {0};
+    while (stream_remaining_ > 0)
+    {
+      int n = stream_remaining_ < 16 ? stream_remaining_ : 16;
+      const int space = HardwareTxSpace<Hardware>::get(hardware_);
+      if (space < n)
+        n = space;
+      if (n <= 0)
+        return false;
+      hardware_.write(zeros, n);
+      stream_remaining_ -= n;
+    }
+    return closeFrame(256 - (stream_chk_ % 256));
+  }
+
+  /* Add header and checksum around the l bytes serialized at message_out + 7 */
+  int sendFrame(int id, int l)
+  {
     /* setup the header */
     message_out[0] = 0xff;
     message_out[1] = PROTOCOL_VER;
@@ -526,24 +970,50 @@ public:
     message_out[6] = (uint8_t)((int16_t)id >> 8);
 
     /* calculate checksum */
+    const uint32_t start = profiler_.start();
     int chk = 0;
     for (int i = 5; i < l + 7; i++)
       chk += message_out[i];
     l += 7;
     message_out[l++] = 255 - (chk % 256);
+    profiler_.record(PROFILE_CHECKSUM, start);
+
+    /* a streamed frame is on the wire, hold this one until it is closed */
+    if ((l <= OUTPUT_SIZE) && (stream_remaining_ >= 0))
+    {
+      held_size_ = l;
+      held_id_ = id;
+      return l;
+    }
 
     if (l <= OUTPUT_SIZE)
     {
-      hardware_.write(message_out, l);
+      const uint32_t write_start = profiler_.start();
+      const bool written = writeHardware(message_out, l);
+      profiler_.record(PROFILE_WRITE, write_start);
+      if (!written)
+        return dropFrame(id, -1);
+      if (getCounters(id))
+        getCounters(id)->add(hardware_.time(), l);
       return l;
     }
     else
     {
       logerror("Message from device dropped: message larger than buffer.");
-      return -1;
+      return dropFrame(id, -1);
     }
   }
 
+  /* Count a frame of topic id which was not sent, returns ret */
+  template<typename T>
+  T dropFrame(int id, T ret)
+  {
+    if (getCounters(id))
+      getCounters(id)->drops++;
+    return ret;
+  }
+
+public:
   /********************************************************************
    * Logging
    */
@@ -554,7 +1024,7 @@ private:
     rosserial_msgs::Log l;
     l.level = byte;
     l.msg = (char*)msg;
-    publish(rosserial_msgs::TopicInfo::ID_LOG, &l);
+    publishStatic(rosserial_msgs::TopicInfo::ID_LOG, l);
   }
 
 public:
@@ -592,7 +1062,7 @@ private:
     param_recieved = false;
     rosserial_msgs::RequestParamRequest req;
     req.name  = (char*)name;
-    publish(TopicInfo::ID_PARAMETER_REQUEST, &req);
+    publishStatic(TopicInfo::ID_PARAMETER_REQUEST, req);
     uint32_t end_time = hardware_.time() + time_out;
     while (!param_recieved)
     {
@@ -0,0 +1,227 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file profiler.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Cycle counter profiling hooks of the node handle
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef ROS_PROFILER_H_
+#define ROS_PROFILER_H_
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdint.h>
+/* -------------------------------------------------------------------------------*/
+
+namespace ros
+{
+
+/* Stages of NodeHandle_ which are measured by a profiler */
+enum ProfileStage
+{
+  PROFILE_SPIN,       // one spinOnce() call
+  PROFILE_PARSE,      // spinOnce() without dispatch: framing, checksums, time sync
+  PROFILE_DISPATCH,   // deserialize and callback of a subscriber
+  PROFILE_SERIALIZE,  // serialize of a published message
+  PROFILE_CHECKSUM,   // checksum of an outgoing frame
+  PROFILE_WRITE,      // hand over of an outgoing frame to the hardware
+  PROFILE_STAGES
+};
+
+/**
+ * @brief Default profiler of NodeHandle_, all hooks compile to nothing
+ */
+struct NullProfiler
+{
+  uint32_t start() const { return 0; }
+  uint32_t elapsed(uint32_t) const { return 0; }
+  uint32_t record(int, uint32_t) { return 0; }
+  void add(int, uint32_t) {}
+  void addTopic(int, uint32_t) {}
+};
+
+/**
+ * @brief Histogram of durations in cycles
+ *
+ * Bin i counts durations of 2^i up to 2^(i+1) - 1 cycles, bin 0 also
+ * counts zero. The last bin takes everything above.
+ */
+template<int BINS>
+struct CycleHistogram
+{
+  uint64_t sum;
+  uint32_t count;
+  uint32_t max;
+  uint32_t bins[BINS];
+
+  void reset()
+  {
+    sum = 0;
+    count = 0;
+    max = 0;
+    for (int i = 0; i < BINS; i++)
+      bins[i] = 0;
+  }
+
+  void add(uint32_t cycles)
+  {
+    int bin = 0;
+    for (uint32_t c = cycles >> 1; c && (bin < BINS - 1); c >>= 1)
+      bin++;
+
+    sum += cycles;
+    count++;
+    if (cycles > max)
+      max = cycles;
+    bins[bin]++;
+  }
+
+  uint32_t mean() const
+  {
+    return count ? (uint32_t)(sum / count) : 0;
+  }
+
+  /* Upper bound of the bin holding the pct percentile, capped by max */
+  uint32_t percentile(uint32_t pct) const
+  {
+    const uint64_t rank = ((uint64_t) count * pct + 99) / 100;
+    uint64_t seen = 0;
+    for (int i = 0; i < BINS - 1; i++)
+    {
+      seen += bins[i];
+      if (seen >= rank)
+      {
+        const uint32_t bound = (2u << i) - 1;
+        return bound < max ? bound : max;
+      }
+    }
+    return max;
+  }
+};
+
+/**
+ * @brief Profiler of NodeHandle_ based on a cycle counter
+ *
+ * Keeps one histogram per stage and one per topic. For a subscriber the
+ * topic histogram holds dispatch, for a publisher serialize, checksum and
+ * write of one message. The hooks are not reentrant, publishing from an
+ * interrupt while spinOnce() runs mixes up the measurements.
+ *
+ * @tparam ClockT       Type with a static uint32_t cycles(), e.g. STMHardware
+ * @tparam TOPIC_SLOTS  Number of topic slots of the node handle
+ * @tparam BINS         Number of histogram bins
+ */
+template<typename ClockT, int TOPIC_SLOTS, int BINS = 20>
+class CycleProfiler
+{
+public:
+  typedef CycleHistogram<BINS> Histogram;
+
+  CycleProfiler()
+  {
+    reset();
+  }
+
+  void reset()
+  {
+    for (int i = 0; i < PROFILE_STAGES; i++)
+      stages_[i].reset();
+    for (int i = 0; i < TOPIC_SLOTS; i++)
+      topics_[i].reset();
+  }
+
+  uint32_t start() const
+  {
+    return ClockT::cycles();
+  }
+
+  uint32_t elapsed(uint32_t start) const
+  {
+    return ClockT::cycles() - start;
+  }
+
+  /* Add the cycles since start to stage, returns them */
+  uint32_t record(int stage, uint32_t start)
+  {
+    const uint32_t cycles = elapsed(start);
+    stages_[stage].add(cycles);
+    return cycles;
+  }
+
+  void add(int stage, uint32_t cycles)
+  {
+    stages_[stage].add(cycles);
+  }
+
+  void addTopic(int id, uint32_t cycles)
+  {
+    const int i = id - 100;
+    if ((i >= 0) && (i < TOPIC_SLOTS))
+      topics_[i].add(cycles);
+  }
+
+  const Histogram & getStage(int stage) const
+  {
+    return stages_[stage];
+  }
+
+  /* Histogram of topic id, 0 if id is not a topic id */
+  const Histogram * getTopic(int id) const
+  {
+    const int i = id - 100;
+    return ((i >= 0) && (i < TOPIC_SLOTS)) ? &topics_[i] : 0;
+  }
+
+  static const char * getStageName(int stage)
+  {
+    static const char * const names[PROFILE_STAGES] =
+    {
+      "spin", "parse", "dispatch", "serialize", "checksum", "write"
+    };
+    return ((stage >= 0) && (stage < PROFILE_STAGES)) ? names[stage] : "";
+  }
+
+private:
+  Histogram stages_[PROFILE_STAGES];
+  Histogram topics_[TOPIC_SLOTS];
+};
+
+}
+
+#endif /* ROS_PROFILER_H_ */
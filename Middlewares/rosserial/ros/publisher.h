@@ -69,6 +69,22 @@ private:
   int endpoint_;
 };
 
+/* Publisher bound to a concrete message and node handle type, so publish()
+ * serializes without virtual dispatch. NodeHandleT must be the type of the
+ * node handle this publisher is advertised on. */
+template<typename MsgT, typename NodeHandleT>
+class StaticPublisher : public Publisher
+{
+public:
+  StaticPublisher(const char * topic_name, MsgT * msg, int endpoint = rosserial_msgs::TopicInfo::ID_PUBLISHER) :
+    Publisher(topic_name, msg, endpoint) {};
+
+  int publish(const MsgT & msg)
+  {
+    return static_cast<NodeHandleT*>(nh_)->publishStatic(id_, msg);
+  };
+};
+
 }
 
 #endif
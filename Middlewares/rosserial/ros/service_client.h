@@ -52,22 +52,28 @@ public:
   {
     this->topic_ = topic_name;
     this->waiting = true;
+    this->received = false;
   }
 
-  virtual void call(const MReq & request, MRes & response)
+  /* Returns true once response holds the reply. False if the link is or
+   * goes down, or the reply does not hold a complete response. */
+  virtual bool call(const MReq & request, MRes & response)
   {
-    if (!pub.nh_->connected()) return;
+    if (!pub.nh_->connected()) return false;
     ret = &response;
     waiting = true;
+    received = false;
     pub.publish(&request);
     while (waiting && pub.nh_->connected())
       if (pub.nh_->spinOnce() < 0) break;
+    return received;
   }
 
   // these refer to the subscriber
-  virtual void callback(unsigned char *data)
+  virtual void callback(unsigned char *data, size_t size)
   {
-    ret->deserialize(data);
+    /* a broken reply ends the call as well, the host sends no second one */
+    received = (ret->MRes::deserialize(data, size) >= 0);
     waiting = false;
   }
   virtual const char * getMsgType()
@@ -87,6 +93,7 @@ public:
   MRes resp;
   MRes * ret;
   bool waiting;
+  bool received;
   Publisher pub;
 };
 
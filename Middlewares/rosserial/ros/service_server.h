@@ -58,9 +58,10 @@ public:
   }
 
   // these refer to the subscriber
-  virtual void callback(unsigned char *data)
+  virtual void callback(unsigned char *data, size_t size)
   {
-    req.deserialize(data);
+    if (req.MReq::deserialize(data, size) < 0)
+      return;
     (obj_->*cb_)(req, resp);
     pub.publish(&resp);
   }
@@ -99,9 +100,10 @@ public:
   }
 
   // these refer to the subscriber
-  virtual void callback(unsigned char *data)
+  virtual void callback(unsigned char *data, size_t size)
   {
-    req.deserialize(data);
+    if (req.MReq::deserialize(data, size) < 0)
+      return;
     cb_(req, resp);
     pub.publish(&resp);
   }
@@ -44,7 +44,22 @@ namespace ros
 class Subscriber_
 {
 public:
-  virtual void callback(unsigned char *data) = 0;
+  /* data holds size bytes of the received frame, frames which do not hold a
+   * complete message are dropped without invoking the user callback */
+  virtual void callback(unsigned char *data, size_t size)
+  {
+    (void) size;
+    callback(data);
+  }
+
+  /* Callback without the frame size, as subscribers written for older
+   * versions implement it. Only reached through the default sized callback
+   * above, such subscribers deserialize without a length check. */
+  virtual void callback(unsigned char *data)
+  {
+    (void) data;
+  }
+
   virtual int getEndpointType() = 0;
 
   // id_ is set by NodeHandle when we advertise
@@ -71,9 +86,10 @@ public:
     topic_ = topic_name;
   };
 
-  virtual void callback(unsigned char* data)
+  virtual void callback(unsigned char* data, size_t size)
   {
-    msg.deserialize(data);
+    if (msg.MsgT::deserialize(data, size) < 0)
+      return;
     (obj_->*cb_)(msg);
   }
 
@@ -111,9 +127,10 @@ public:
     topic_ = topic_name;
   };
 
-  virtual void callback(unsigned char* data)
+  virtual void callback(unsigned char* data, size_t size)
   {
-    msg.deserialize(data);
+    if (msg.MsgT::deserialize(data, size) < 0)
+      return;
     this->cb_(msg);
   }
 
@@ -135,6 +152,44 @@ private:
   int endpoint_;
 };
 
+/* Subscriber with the callback fixed at compile time. Nothing is stored for
+ * the callback, deserialize and the callback are inlined into callback(). */
+template<typename MsgT, void (*Callback)(const MsgT&)>
+class StaticSubscriber final : public Subscriber_
+{
+public:
+  MsgT msg;
+
+  StaticSubscriber(const char * topic_name, int endpoint = rosserial_msgs::TopicInfo::ID_SUBSCRIBER) :
+    endpoint_(endpoint)
+  {
+    topic_ = topic_name;
+  };
+
+  virtual void callback(unsigned char* data, size_t size)
+  {
+    if (msg.MsgT::deserialize(data, size) < 0)
+      return;
+    Callback(msg);
+  }
+
+  virtual const char * getMsgType()
+  {
+    return this->msg.getType();
+  }
+  virtual const char * getMsgMD5()
+  {
+    return this->msg.getMD5();
+  }
+  virtual int getEndpointType()
+  {
+    return endpoint_;
+  }
+
+private:
+  int endpoint_;
+};
+
 }
 
 #endif
@@ -0,0 +1,193 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file trace.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Binary event trace of the node handle
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef ROS_TRACE_H_
+#define ROS_TRACE_H_
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdint.h>
+/* -------------------------------------------------------------------------------*/
+
+namespace ros
+{
+
+/* Events recorded by NodeHandle_ */
+enum TraceEvent
+{
+  TRACE_MODE = 1,         // receive state machine changed, value: new mode
+  TRACE_FRAME_BEGIN,      // first sync byte of a frame
+  TRACE_FRAME_END,        // valid frame received, arg: topic id
+  TRACE_CHECKSUM_ERROR,   // value: 0 length checksum, 1 message checksum, arg: topic id
+  TRACE_RESYNC,           // frame abandoned, value: TraceResync, arg: topic id if known
+  TRACE_PUBLISH_BEGIN,    // arg: topic id
+  TRACE_PUBLISH_END,      // value: 1 if the frame was written, arg: its length, 0 if streamed
+  TRACE_CALLBACK_BEGIN,   // arg: topic id
+  TRACE_CALLBACK_END,     // arg: topic id
+  TRACE_CONNECT,          // topics negotiated
+  TRACE_DISCONNECT        // value: TraceDisconnect
+};
+
+enum TraceResync
+{
+  TRACE_RESYNC_TIMEOUT,   // frame not complete within SERIAL_MSG_TIMEOUT
+  TRACE_RESYNC_PROTOCOL,  // wrong protocol version
+  TRACE_RESYNC_LENGTH     // length larger than the input buffer
+};
+
+enum TraceDisconnect
+{
+  TRACE_DISCONNECT_SYNC,  // no time sync for too long
+  TRACE_DISCONNECT_STUCK, // spinOnce() waited too long for a sync byte
+  TRACE_DISCONNECT_HOST   // host sent ID_TX_STOP
+};
+
+/* One entry of the trace, 8 bytes, little endian on the wire */
+struct TraceEntry
+{
+  uint32_t stamp;   // clock of the tracer, e.g. core cycles
+  uint16_t arg;
+  uint8_t event;
+  uint8_t value;
+};
+
+/**
+ * @brief Default tracer of NodeHandle_, all hooks compile to nothing
+ */
+struct NullTracer
+{
+  void event(uint8_t, uint8_t = 0, uint16_t = 0) {}
+};
+
+/**
+ * @brief Ring of the last SIZE trace events
+ *
+ * Recording an event is a read of the clock and a few stores, older
+ * entries are overwritten. read() takes the entries in order from a
+ * single reader, entries which were overwritten before they were read
+ * are counted as lost. Recording from an interrupt while read() runs may
+ * hand out an entry which is being overwritten.
+ *
+ * @tparam ClockT Type with a static uint32_t cycles(), e.g. STMHardware
+ * @tparam SIZE   Number of entries, a power of two
+ */
+template<typename ClockT, int SIZE = 256>
+class TraceRing
+{
+  static_assert((SIZE & (SIZE - 1)) == 0, "SIZE has to be a power of two");
+
+public:
+  TraceRing() : head_(0), tail_(0), lost_(0), enabled_(true)
+  {
+  }
+
+  void event(uint8_t event, uint8_t value = 0, uint16_t arg = 0)
+  {
+    if (!enabled_)
+      return;
+
+    TraceEntry &e = entries_[head_ & (SIZE - 1)];
+    e.stamp = ClockT::cycles();
+    e.arg = arg;
+    e.event = event;
+    e.value = value;
+    head_++;
+  }
+
+  /* Stop recording, e.g. while the trace itself is published */
+  void setEnabled(bool enabled)
+  {
+    enabled_ = enabled;
+  }
+
+  /* Number of entries which were not read yet */
+  int available()
+  {
+    skipLost();
+    return head_ - tail_;
+  }
+
+  /* Copy up to max entries in recording order, returns their number */
+  int read(TraceEntry *out, int max)
+  {
+    skipLost();
+
+    int count = 0;
+    while ((count < max) && (tail_ != head_))
+      out[count++] = entries_[tail_++ & (SIZE - 1)];
+    return count;
+  }
+
+  /* Number of entries overwritten before they were read */
+  uint32_t getLost() const
+  {
+    return lost_;
+  }
+
+  void clear()
+  {
+    tail_ = head_;
+    lost_ = 0;
+  }
+
+private:
+  void skipLost()
+  {
+    const uint32_t head = head_;
+    if (head - tail_ > (uint32_t) SIZE)
+    {
+      lost_ += head - tail_ - SIZE;
+      tail_ = head - SIZE;
+    }
+  }
+
+  TraceEntry entries_[SIZE];
+  volatile uint32_t head_;
+  uint32_t tail_;
+  uint32_t lost_;
+  bool enabled_;
+};
+
+}
+
+#endif /* ROS_TRACE_H_ */
@@ -21,16 +21,32 @@ static const char GETLOGGERS[] = "roscpp/GetLoggers";
 
     virtual int serialize(unsigned char *outbuffer) const
     {
+      (void) outbuffer;
       int offset = 0;
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
+      (void) inbuffer;
       int offset = 0;
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return GetLoggersRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      (void) size;
+      return offset;
+    }
+
     const char * getType(){ return GETLOGGERS; };
     const char * getMD5(){ return "d41d8cd98f00b204e9800998ecf8427e"; };
 
@@ -40,23 +56,20 @@ static const char GETLOGGERS[] = "roscpp/GetLoggers";
   {
     public:
       uint32_t loggers_length;
+      uint32_t loggers_capacity;
       typedef roscpp::Logger _loggers_type;
       _loggers_type st_loggers;
       _loggers_type * loggers;
 
     GetLoggersResponse():
-      loggers_length(0), loggers(NULL)
+      loggers_length(0), loggers_capacity(0), loggers(NULL)
     {
     }
 
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->loggers_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->loggers_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->loggers_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->loggers_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->loggers_length);
+      offset += encode(outbuffer + offset, this->loggers_length);
       for( uint32_t i = 0; i < loggers_length; i++){
       offset += this->loggers[i].serialize(outbuffer + offset);
       }
@@ -66,21 +79,27 @@ static const char GETLOGGERS[] = "roscpp/GetLoggers";
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t loggers_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      loggers_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      loggers_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      loggers_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->loggers_length);
-      if(loggers_lengthT > loggers_length)
-        this->loggers = (roscpp::Logger*)realloc(this->loggers, loggers_lengthT * sizeof(roscpp::Logger));
-      loggers_length = loggers_lengthT;
-      for( uint32_t i = 0; i < loggers_length; i++){
-      offset += this->st_loggers.deserialize(inbuffer + offset);
-        memcpy( &(this->loggers[i]), &(this->st_loggers), sizeof(roscpp::Logger));
-      }
+      offset += decodeMsgArray(inbuffer + offset, this->loggers, this->loggers_length, this->loggers_capacity);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return GetLoggersResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      uint32_t loggers_lengthT;
+      offset = wireCount(inbuffer, offset, size, loggers_lengthT, 8);
+      for( uint32_t i = 0; (i < loggers_lengthT) && (offset >= 0); i++){
+        offset = this->st_loggers.wireLength(inbuffer, offset, size);
+      }
+      return offset;
+    }
+
     const char * getType(){ return GETLOGGERS; };
     const char * getMD5(){ return "32e97e85527d4678a8f9279894bb64b0"; };
 
@@ -27,43 +27,33 @@ static const char SETLOGGERLEVEL[] = "roscpp/SetLoggerLevel";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_logger = strlen(this->logger);
-      varToArr(outbuffer + offset, length_logger);
-      offset += 4;
-      memcpy(outbuffer + offset, this->logger, length_logger);
-      offset += length_logger;
-      uint32_t length_level = strlen(this->level);
-      varToArr(outbuffer + offset, length_level);
-      offset += 4;
-      memcpy(outbuffer + offset, this->level, length_level);
-      offset += length_level;
+      offset += encodeString(outbuffer + offset, this->logger);
+      offset += encodeString(outbuffer + offset, this->level);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_logger;
-      arrToVar(length_logger, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_logger; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_logger-1]=0;
-      this->logger = (char *)(inbuffer + offset-1);
-      offset += length_logger;
-      uint32_t length_level;
-      arrToVar(length_level, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_level; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_level-1]=0;
-      this->level = (char *)(inbuffer + offset-1);
-      offset += length_level;
+      offset += decodeString(inbuffer + offset, this->logger);
+      offset += decodeString(inbuffer + offset, this->level);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return SetLoggerLevelRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return SETLOGGERLEVEL; };
     const char * getMD5(){ return "51da076440d78ca1684d36c868df61ea"; };
 
@@ -79,16 +69,32 @@ static const char SETLOGGERLEVEL[] = "roscpp/SetLoggerLevel";
 
     virtual int serialize(unsigned char *outbuffer) const
     {
+      (void) outbuffer;
       int offset = 0;
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
+      (void) inbuffer;
       int offset = 0;
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return SetLoggerLevelResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      (void) size;
+      return offset;
+    }
+
     const char * getType(){ return SETLOGGERLEVEL; };
     const char * getMD5(){ return "d41d8cd98f00b204e9800998ecf8427e"; };
 
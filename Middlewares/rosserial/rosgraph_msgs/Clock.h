@@ -24,35 +24,33 @@ namespace rosgraph_msgs
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->clock.sec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->clock.sec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->clock.sec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->clock.sec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->clock.sec);
-      *(outbuffer + offset + 0) = (this->clock.nsec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->clock.nsec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->clock.nsec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->clock.nsec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->clock.nsec);
+      offset += encode(outbuffer + offset, this->clock.sec);
+      offset += encode(outbuffer + offset, this->clock.nsec);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      this->clock.sec =  ((uint32_t) (*(inbuffer + offset)));
-      this->clock.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->clock.sec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->clock.sec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->clock.sec);
-      this->clock.nsec =  ((uint32_t) (*(inbuffer + offset)));
-      this->clock.nsec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->clock.nsec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->clock.nsec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->clock.nsec);
+      offset += decode(inbuffer + offset, this->clock.sec);
+      offset += decode(inbuffer + offset, this->clock.nsec);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return Clock::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 8);
+      return offset;
+    }
+
     const char * getType(){ return "rosgraph_msgs/Clock"; };
     const char * getMD5(){ return "a9c97c1d230cfc112e270351a944ee47"; };
 
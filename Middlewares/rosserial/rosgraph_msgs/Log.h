@@ -53,50 +53,13 @@ namespace rosgraph_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      union {
-        int8_t real;
-        uint8_t base;
-      } u_level;
-      u_level.real = this->level;
-      *(outbuffer + offset + 0) = (u_level.base >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->level);
-      uint32_t length_name = strlen(this->name);
-      varToArr(outbuffer + offset, length_name);
-      offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
-      offset += length_name;
-      uint32_t length_msg = strlen(this->msg);
-      varToArr(outbuffer + offset, length_msg);
-      offset += 4;
-      memcpy(outbuffer + offset, this->msg, length_msg);
-      offset += length_msg;
-      uint32_t length_file = strlen(this->file);
-      varToArr(outbuffer + offset, length_file);
-      offset += 4;
-      memcpy(outbuffer + offset, this->file, length_file);
-      offset += length_file;
-      uint32_t length_function = strlen(this->function);
-      varToArr(outbuffer + offset, length_function);
-      offset += 4;
-      memcpy(outbuffer + offset, this->function, length_function);
-      offset += length_function;
-      *(outbuffer + offset + 0) = (this->line >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->line >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->line >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->line >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->line);
-      *(outbuffer + offset + 0) = (this->topics_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->topics_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->topics_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->topics_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->topics_length);
-      for( uint32_t i = 0; i < topics_length; i++){
-      uint32_t length_topicsi = strlen(this->topics[i]);
-      varToArr(outbuffer + offset, length_topicsi);
-      offset += 4;
-      memcpy(outbuffer + offset, this->topics[i], length_topicsi);
-      offset += length_topicsi;
-      }
+      offset += encode(outbuffer + offset, this->level);
+      offset += encodeString(outbuffer + offset, this->name);
+      offset += encodeString(outbuffer + offset, this->msg);
+      offset += encodeString(outbuffer + offset, this->file);
+      offset += encodeString(outbuffer + offset, this->function);
+      offset += encode(outbuffer + offset, this->line);
+      offset += encodeStringArray(outbuffer + offset, this->topics, this->topics_length);
       return offset;
     }
 
@@ -104,78 +67,36 @@ namespace rosgraph_msgs
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      union {
-        int8_t real;
-        uint8_t base;
-      } u_level;
-      u_level.base = 0;
-      u_level.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      this->level = u_level.real;
-      offset += sizeof(this->level);
-      uint32_t length_name;
-      arrToVar(length_name, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
-      offset += length_name;
-      uint32_t length_msg;
-      arrToVar(length_msg, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_msg; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_msg-1]=0;
-      this->msg = (char *)(inbuffer + offset-1);
-      offset += length_msg;
-      uint32_t length_file;
-      arrToVar(length_file, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_file; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_file-1]=0;
-      this->file = (char *)(inbuffer + offset-1);
-      offset += length_file;
-      uint32_t length_function;
-      arrToVar(length_function, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_function; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_function-1]=0;
-      this->function = (char *)(inbuffer + offset-1);
-      offset += length_function;
-      this->line =  ((uint32_t) (*(inbuffer + offset)));
-      this->line |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->line |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->line |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->line);
-      uint32_t topics_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      topics_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      topics_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      topics_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->topics_length);
-      if(topics_lengthT > topics_length)
-        this->topics = (char**)realloc(this->topics, topics_lengthT * sizeof(char*));
-      topics_length = topics_lengthT;
-      for( uint32_t i = 0; i < topics_length; i++){
-      uint32_t length_st_topics;
-      arrToVar(length_st_topics, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_topics; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_topics-1]=0;
-      this->st_topics = (char *)(inbuffer + offset-1);
-      offset += length_st_topics;
-        memcpy( &(this->topics[i]), &(this->st_topics), sizeof(char*));
-      }
+      offset += decode(inbuffer + offset, this->level);
+      offset += decodeString(inbuffer + offset, this->name);
+      offset += decodeString(inbuffer + offset, this->msg);
+      offset += decodeString(inbuffer + offset, this->file);
+      offset += decodeString(inbuffer + offset, this->function);
+      offset += decode(inbuffer + offset, this->line);
+      offset += decodeStringArray(inbuffer + offset, this->topics, this->topics_length);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return Log::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 1);
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 4);
+      offset = wireSkipStringArray(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "rosgraph_msgs/Log"; };
     const char * getMD5(){ return "acffd30cd6b6de30f120938c17c593fb"; };
 
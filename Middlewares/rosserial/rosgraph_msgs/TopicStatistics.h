@@ -64,280 +64,75 @@ namespace rosgraph_msgs
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_topic = strlen(this->topic);
-      varToArr(outbuffer + offset, length_topic);
-      offset += 4;
-      memcpy(outbuffer + offset, this->topic, length_topic);
-      offset += length_topic;
-      uint32_t length_node_pub = strlen(this->node_pub);
-      varToArr(outbuffer + offset, length_node_pub);
-      offset += 4;
-      memcpy(outbuffer + offset, this->node_pub, length_node_pub);
-      offset += length_node_pub;
-      uint32_t length_node_sub = strlen(this->node_sub);
-      varToArr(outbuffer + offset, length_node_sub);
-      offset += 4;
-      memcpy(outbuffer + offset, this->node_sub, length_node_sub);
-      offset += length_node_sub;
-      *(outbuffer + offset + 0) = (this->window_start.sec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->window_start.sec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->window_start.sec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->window_start.sec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->window_start.sec);
-      *(outbuffer + offset + 0) = (this->window_start.nsec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->window_start.nsec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->window_start.nsec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->window_start.nsec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->window_start.nsec);
-      *(outbuffer + offset + 0) = (this->window_stop.sec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->window_stop.sec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->window_stop.sec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->window_stop.sec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->window_stop.sec);
-      *(outbuffer + offset + 0) = (this->window_stop.nsec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->window_stop.nsec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->window_stop.nsec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->window_stop.nsec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->window_stop.nsec);
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_delivered_msgs;
-      u_delivered_msgs.real = this->delivered_msgs;
-      *(outbuffer + offset + 0) = (u_delivered_msgs.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_delivered_msgs.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_delivered_msgs.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_delivered_msgs.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->delivered_msgs);
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_dropped_msgs;
-      u_dropped_msgs.real = this->dropped_msgs;
-      *(outbuffer + offset + 0) = (u_dropped_msgs.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_dropped_msgs.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_dropped_msgs.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_dropped_msgs.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->dropped_msgs);
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_traffic;
-      u_traffic.real = this->traffic;
-      *(outbuffer + offset + 0) = (u_traffic.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_traffic.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_traffic.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_traffic.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->traffic);
-      *(outbuffer + offset + 0) = (this->period_mean.sec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->period_mean.sec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->period_mean.sec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->period_mean.sec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->period_mean.sec);
-      *(outbuffer + offset + 0) = (this->period_mean.nsec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->period_mean.nsec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->period_mean.nsec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->period_mean.nsec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->period_mean.nsec);
-      *(outbuffer + offset + 0) = (this->period_stddev.sec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->period_stddev.sec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->period_stddev.sec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->period_stddev.sec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->period_stddev.sec);
-      *(outbuffer + offset + 0) = (this->period_stddev.nsec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->period_stddev.nsec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->period_stddev.nsec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->period_stddev.nsec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->period_stddev.nsec);
-      *(outbuffer + offset + 0) = (this->period_max.sec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->period_max.sec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->period_max.sec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->period_max.sec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->period_max.sec);
-      *(outbuffer + offset + 0) = (this->period_max.nsec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->period_max.nsec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->period_max.nsec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->period_max.nsec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->period_max.nsec);
-      *(outbuffer + offset + 0) = (this->stamp_age_mean.sec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->stamp_age_mean.sec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->stamp_age_mean.sec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->stamp_age_mean.sec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->stamp_age_mean.sec);
-      *(outbuffer + offset + 0) = (this->stamp_age_mean.nsec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->stamp_age_mean.nsec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->stamp_age_mean.nsec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->stamp_age_mean.nsec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->stamp_age_mean.nsec);
-      *(outbuffer + offset + 0) = (this->stamp_age_stddev.sec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->stamp_age_stddev.sec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->stamp_age_stddev.sec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->stamp_age_stddev.sec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->stamp_age_stddev.sec);
-      *(outbuffer + offset + 0) = (this->stamp_age_stddev.nsec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->stamp_age_stddev.nsec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->stamp_age_stddev.nsec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->stamp_age_stddev.nsec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->stamp_age_stddev.nsec);
-      *(outbuffer + offset + 0) = (this->stamp_age_max.sec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->stamp_age_max.sec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->stamp_age_max.sec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->stamp_age_max.sec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->stamp_age_max.sec);
-      *(outbuffer + offset + 0) = (this->stamp_age_max.nsec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->stamp_age_max.nsec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->stamp_age_max.nsec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->stamp_age_max.nsec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->stamp_age_max.nsec);
+      offset += encodeString(outbuffer + offset, this->topic);
+      offset += encodeString(outbuffer + offset, this->node_pub);
+      offset += encodeString(outbuffer + offset, this->node_sub);
+      offset += encode(outbuffer + offset, this->window_start.sec);
+      offset += encode(outbuffer + offset, this->window_start.nsec);
+      offset += encode(outbuffer + offset, this->window_stop.sec);
+      offset += encode(outbuffer + offset, this->window_stop.nsec);
+      offset += encode(outbuffer + offset, this->delivered_msgs);
+      offset += encode(outbuffer + offset, this->dropped_msgs);
+      offset += encode(outbuffer + offset, this->traffic);
+      offset += encode(outbuffer + offset, this->period_mean.sec);
+      offset += encode(outbuffer + offset, this->period_mean.nsec);
+      offset += encode(outbuffer + offset, this->period_stddev.sec);
+      offset += encode(outbuffer + offset, this->period_stddev.nsec);
+      offset += encode(outbuffer + offset, this->period_max.sec);
+      offset += encode(outbuffer + offset, this->period_max.nsec);
+      offset += encode(outbuffer + offset, this->stamp_age_mean.sec);
+      offset += encode(outbuffer + offset, this->stamp_age_mean.nsec);
+      offset += encode(outbuffer + offset, this->stamp_age_stddev.sec);
+      offset += encode(outbuffer + offset, this->stamp_age_stddev.nsec);
+      offset += encode(outbuffer + offset, this->stamp_age_max.sec);
+      offset += encode(outbuffer + offset, this->stamp_age_max.nsec);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_topic;
-      arrToVar(length_topic, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_topic; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_topic-1]=0;
-      this->topic = (char *)(inbuffer + offset-1);
-      offset += length_topic;
-      uint32_t length_node_pub;
-      arrToVar(length_node_pub, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_node_pub; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_node_pub-1]=0;
-      this->node_pub = (char *)(inbuffer + offset-1);
-      offset += length_node_pub;
-      uint32_t length_node_sub;
-      arrToVar(length_node_sub, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_node_sub; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_node_sub-1]=0;
-      this->node_sub = (char *)(inbuffer + offset-1);
-      offset += length_node_sub;
-      this->window_start.sec =  ((uint32_t) (*(inbuffer + offset)));
-      this->window_start.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->window_start.sec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->window_start.sec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->window_start.sec);
-      this->window_start.nsec =  ((uint32_t) (*(inbuffer + offset)));
-      this->window_start.nsec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->window_start.nsec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->window_start.nsec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->window_start.nsec);
-      this->window_stop.sec =  ((uint32_t) (*(inbuffer + offset)));
-      this->window_stop.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->window_stop.sec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->window_stop.sec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->window_stop.sec);
-      this->window_stop.nsec =  ((uint32_t) (*(inbuffer + offset)));
-      this->window_stop.nsec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->window_stop.nsec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->window_stop.nsec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->window_stop.nsec);
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_delivered_msgs;
-      u_delivered_msgs.base = 0;
-      u_delivered_msgs.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_delivered_msgs.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_delivered_msgs.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_delivered_msgs.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->delivered_msgs = u_delivered_msgs.real;
-      offset += sizeof(this->delivered_msgs);
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_dropped_msgs;
-      u_dropped_msgs.base = 0;
-      u_dropped_msgs.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_dropped_msgs.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_dropped_msgs.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_dropped_msgs.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->dropped_msgs = u_dropped_msgs.real;
-      offset += sizeof(this->dropped_msgs);
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_traffic;
-      u_traffic.base = 0;
-      u_traffic.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_traffic.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_traffic.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_traffic.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->traffic = u_traffic.real;
-      offset += sizeof(this->traffic);
-      this->period_mean.sec =  ((uint32_t) (*(inbuffer + offset)));
-      this->period_mean.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->period_mean.sec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->period_mean.sec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->period_mean.sec);
-      this->period_mean.nsec =  ((uint32_t) (*(inbuffer + offset)));
-      this->period_mean.nsec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->period_mean.nsec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->period_mean.nsec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->period_mean.nsec);
-      this->period_stddev.sec =  ((uint32_t) (*(inbuffer + offset)));
-      this->period_stddev.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->period_stddev.sec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->period_stddev.sec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->period_stddev.sec);
-      this->period_stddev.nsec =  ((uint32_t) (*(inbuffer + offset)));
-      this->period_stddev.nsec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->period_stddev.nsec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->period_stddev.nsec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->period_stddev.nsec);
-      this->period_max.sec =  ((uint32_t) (*(inbuffer + offset)));
-      this->period_max.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->period_max.sec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->period_max.sec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->period_max.sec);
-      this->period_max.nsec =  ((uint32_t) (*(inbuffer + offset)));
-      this->period_max.nsec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->period_max.nsec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->period_max.nsec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->period_max.nsec);
-      this->stamp_age_mean.sec =  ((uint32_t) (*(inbuffer + offset)));
-      this->stamp_age_mean.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->stamp_age_mean.sec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->stamp_age_mean.sec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->stamp_age_mean.sec);
-      this->stamp_age_mean.nsec =  ((uint32_t) (*(inbuffer + offset)));
-      this->stamp_age_mean.nsec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->stamp_age_mean.nsec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->stamp_age_mean.nsec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->stamp_age_mean.nsec);
-      this->stamp_age_stddev.sec =  ((uint32_t) (*(inbuffer + offset)));
-      this->stamp_age_stddev.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->stamp_age_stddev.sec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->stamp_age_stddev.sec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->stamp_age_stddev.sec);
-      this->stamp_age_stddev.nsec =  ((uint32_t) (*(inbuffer + offset)));
-      this->stamp_age_stddev.nsec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->stamp_age_stddev.nsec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->stamp_age_stddev.nsec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->stamp_age_stddev.nsec);
-      this->stamp_age_max.sec =  ((uint32_t) (*(inbuffer + offset)));
-      this->stamp_age_max.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->stamp_age_max.sec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->stamp_age_max.sec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->stamp_age_max.sec);
-      this->stamp_age_max.nsec =  ((uint32_t) (*(inbuffer + offset)));
-      this->stamp_age_max.nsec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->stamp_age_max.nsec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->stamp_age_max.nsec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->stamp_age_max.nsec);
+      offset += decodeString(inbuffer + offset, this->topic);
+      offset += decodeString(inbuffer + offset, this->node_pub);
+      offset += decodeString(inbuffer + offset, this->node_sub);
+      offset += decode(inbuffer + offset, this->window_start.sec);
+      offset += decode(inbuffer + offset, this->window_start.nsec);
+      offset += decode(inbuffer + offset, this->window_stop.sec);
+      offset += decode(inbuffer + offset, this->window_stop.nsec);
+      offset += decode(inbuffer + offset, this->delivered_msgs);
+      offset += decode(inbuffer + offset, this->dropped_msgs);
+      offset += decode(inbuffer + offset, this->traffic);
+      offset += decode(inbuffer + offset, this->period_mean.sec);
+      offset += decode(inbuffer + offset, this->period_mean.nsec);
+      offset += decode(inbuffer + offset, this->period_stddev.sec);
+      offset += decode(inbuffer + offset, this->period_stddev.nsec);
+      offset += decode(inbuffer + offset, this->period_max.sec);
+      offset += decode(inbuffer + offset, this->period_max.nsec);
+      offset += decode(inbuffer + offset, this->stamp_age_mean.sec);
+      offset += decode(inbuffer + offset, this->stamp_age_mean.nsec);
+      offset += decode(inbuffer + offset, this->stamp_age_stddev.sec);
+      offset += decode(inbuffer + offset, this->stamp_age_stddev.nsec);
+      offset += decode(inbuffer + offset, this->stamp_age_max.sec);
+      offset += decode(inbuffer + offset, this->stamp_age_max.nsec);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return TopicStatistics::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 76);
+      return offset;
+    }
+
     const char * getType(){ return "rosgraph_msgs/TopicStatistics"; };
     const char * getMD5(){ return "10152ed868c5097a5e2e4a89d7daa710"; };
 
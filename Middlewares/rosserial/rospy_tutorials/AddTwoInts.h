@@ -27,73 +27,33 @@ static const char ADDTWOINTS[] = "rospy_tutorials/AddTwoInts";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      union {
-        int64_t real;
-        uint64_t base;
-      } u_a;
-      u_a.real = this->a;
-      *(outbuffer + offset + 0) = (u_a.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_a.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_a.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_a.base >> (8 * 3)) & 0xFF;
-      *(outbuffer + offset + 4) = (u_a.base >> (8 * 4)) & 0xFF;
-      *(outbuffer + offset + 5) = (u_a.base >> (8 * 5)) & 0xFF;
-      *(outbuffer + offset + 6) = (u_a.base >> (8 * 6)) & 0xFF;
-      *(outbuffer + offset + 7) = (u_a.base >> (8 * 7)) & 0xFF;
-      offset += sizeof(this->a);
-      union {
-        int64_t real;
-        uint64_t base;
-      } u_b;
-      u_b.real = this->b;
-      *(outbuffer + offset + 0) = (u_b.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_b.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_b.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_b.base >> (8 * 3)) & 0xFF;
-      *(outbuffer + offset + 4) = (u_b.base >> (8 * 4)) & 0xFF;
-      *(outbuffer + offset + 5) = (u_b.base >> (8 * 5)) & 0xFF;
-      *(outbuffer + offset + 6) = (u_b.base >> (8 * 6)) & 0xFF;
-      *(outbuffer + offset + 7) = (u_b.base >> (8 * 7)) & 0xFF;
-      offset += sizeof(this->b);
+      offset += encode(outbuffer + offset, this->a);
+      offset += encode(outbuffer + offset, this->b);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      union {
-        int64_t real;
-        uint64_t base;
-      } u_a;
-      u_a.base = 0;
-      u_a.base |= ((uint64_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_a.base |= ((uint64_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_a.base |= ((uint64_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_a.base |= ((uint64_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      u_a.base |= ((uint64_t) (*(inbuffer + offset + 4))) << (8 * 4);
-      u_a.base |= ((uint64_t) (*(inbuffer + offset + 5))) << (8 * 5);
-      u_a.base |= ((uint64_t) (*(inbuffer + offset + 6))) << (8 * 6);
-      u_a.base |= ((uint64_t) (*(inbuffer + offset + 7))) << (8 * 7);
-      this->a = u_a.real;
-      offset += sizeof(this->a);
-      union {
-        int64_t real;
-        uint64_t base;
-      } u_b;
-      u_b.base = 0;
-      u_b.base |= ((uint64_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_b.base |= ((uint64_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_b.base |= ((uint64_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_b.base |= ((uint64_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      u_b.base |= ((uint64_t) (*(inbuffer + offset + 4))) << (8 * 4);
-      u_b.base |= ((uint64_t) (*(inbuffer + offset + 5))) << (8 * 5);
-      u_b.base |= ((uint64_t) (*(inbuffer + offset + 6))) << (8 * 6);
-      u_b.base |= ((uint64_t) (*(inbuffer + offset + 7))) << (8 * 7);
-      this->b = u_b.real;
-      offset += sizeof(this->b);
+      offset += decode(inbuffer + offset, this->a);
+      offset += decode(inbuffer + offset, this->b);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return AddTwoIntsRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 16);
+      return offset;
+    }
+
     const char * getType(){ return ADDTWOINTS; };
     const char * getMD5(){ return "36d09b846be0b371c5f190354dd3153e"; };
 
@@ -113,44 +73,31 @@ static const char ADDTWOINTS[] = "rospy_tutorials/AddTwoInts";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      union {
-        int64_t real;
-        uint64_t base;
-      } u_sum;
-      u_sum.real = this->sum;
-      *(outbuffer + offset + 0) = (u_sum.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_sum.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_sum.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_sum.base >> (8 * 3)) & 0xFF;
-      *(outbuffer + offset + 4) = (u_sum.base >> (8 * 4)) & 0xFF;
-      *(outbuffer + offset + 5) = (u_sum.base >> (8 * 5)) & 0xFF;
-      *(outbuffer + offset + 6) = (u_sum.base >> (8 * 6)) & 0xFF;
-      *(outbuffer + offset + 7) = (u_sum.base >> (8 * 7)) & 0xFF;
-      offset += sizeof(this->sum);
+      offset += encode(outbuffer + offset, this->sum);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      union {
-        int64_t real;
-        uint64_t base;
-      } u_sum;
-      u_sum.base = 0;
-      u_sum.base |= ((uint64_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_sum.base |= ((uint64_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_sum.base |= ((uint64_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_sum.base |= ((uint64_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      u_sum.base |= ((uint64_t) (*(inbuffer + offset + 4))) << (8 * 4);
-      u_sum.base |= ((uint64_t) (*(inbuffer + offset + 5))) << (8 * 5);
-      u_sum.base |= ((uint64_t) (*(inbuffer + offset + 6))) << (8 * 6);
-      u_sum.base |= ((uint64_t) (*(inbuffer + offset + 7))) << (8 * 7);
-      this->sum = u_sum.real;
-      offset += sizeof(this->sum);
+      offset += decode(inbuffer + offset, this->sum);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return AddTwoIntsResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 8);
+      return offset;
+    }
+
     const char * getType(){ return ADDTWOINTS; };
     const char * getMD5(){ return "b88405221c77b1878a3cbbfff53428d7"; };
 
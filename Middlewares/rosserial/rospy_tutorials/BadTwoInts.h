@@ -27,65 +27,33 @@ static const char BADTWOINTS[] = "rospy_tutorials/BadTwoInts";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      union {
-        int64_t real;
-        uint64_t base;
-      } u_a;
-      u_a.real = this->a;
-      *(outbuffer + offset + 0) = (u_a.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_a.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_a.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_a.base >> (8 * 3)) & 0xFF;
-      *(outbuffer + offset + 4) = (u_a.base >> (8 * 4)) & 0xFF;
-      *(outbuffer + offset + 5) = (u_a.base >> (8 * 5)) & 0xFF;
-      *(outbuffer + offset + 6) = (u_a.base >> (8 * 6)) & 0xFF;
-      *(outbuffer + offset + 7) = (u_a.base >> (8 * 7)) & 0xFF;
-      offset += sizeof(this->a);
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_b;
-      u_b.real = this->b;
-      *(outbuffer + offset + 0) = (u_b.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_b.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_b.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_b.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->b);
+      offset += encode(outbuffer + offset, this->a);
+      offset += encode(outbuffer + offset, this->b);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      union {
-        int64_t real;
-        uint64_t base;
-      } u_a;
-      u_a.base = 0;
-      u_a.base |= ((uint64_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_a.base |= ((uint64_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_a.base |= ((uint64_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_a.base |= ((uint64_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      u_a.base |= ((uint64_t) (*(inbuffer + offset + 4))) << (8 * 4);
-      u_a.base |= ((uint64_t) (*(inbuffer + offset + 5))) << (8 * 5);
-      u_a.base |= ((uint64_t) (*(inbuffer + offset + 6))) << (8 * 6);
-      u_a.base |= ((uint64_t) (*(inbuffer + offset + 7))) << (8 * 7);
-      this->a = u_a.real;
-      offset += sizeof(this->a);
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_b;
-      u_b.base = 0;
-      u_b.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_b.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_b.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_b.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->b = u_b.real;
-      offset += sizeof(this->b);
+      offset += decode(inbuffer + offset, this->a);
+      offset += decode(inbuffer + offset, this->b);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return BadTwoIntsRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 12);
+      return offset;
+    }
+
     const char * getType(){ return BADTWOINTS; };
     const char * getMD5(){ return "29bb5c7dea8bf822f53e94b0ee5a3a56"; };
 
@@ -105,36 +73,31 @@ static const char BADTWOINTS[] = "rospy_tutorials/BadTwoInts";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_sum;
-      u_sum.real = this->sum;
-      *(outbuffer + offset + 0) = (u_sum.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_sum.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_sum.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_sum.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->sum);
+      offset += encode(outbuffer + offset, this->sum);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_sum;
-      u_sum.base = 0;
-      u_sum.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_sum.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_sum.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_sum.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->sum = u_sum.real;
-      offset += sizeof(this->sum);
+      offset += decode(inbuffer + offset, this->sum);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return BadTwoIntsResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 4);
+      return offset;
+    }
+
     const char * getType(){ return BADTWOINTS; };
     const char * getMD5(){ return "0ba699c25c9418c0366f3595c0c8e8ec"; };
 
@@ -28,11 +28,7 @@ namespace rospy_tutorials
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      uint32_t length_data = strlen(this->data);
-      varToArr(outbuffer + offset, length_data);
-      offset += 4;
-      memcpy(outbuffer + offset, this->data, length_data);
-      offset += length_data;
+      offset += encodeString(outbuffer + offset, this->data);
       return offset;
     }
 
@@ -40,18 +36,24 @@ namespace rospy_tutorials
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      uint32_t length_data;
-      arrToVar(length_data, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_data; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_data-1]=0;
-      this->data = (char *)(inbuffer + offset-1);
-      offset += length_data;
+      offset += decodeString(inbuffer + offset, this->data);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return HeaderString::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "rospy_tutorials/HeaderString"; };
     const char * getMD5(){ return "c99a9440709e4d4a9716d55b8270d5e7"; };
 
@@ -38,51 +38,41 @@ namespace rosserial_arduino
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->adc0 >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->adc0 >> (8 * 1)) & 0xFF;
-      offset += sizeof(this->adc0);
-      *(outbuffer + offset + 0) = (this->adc1 >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->adc1 >> (8 * 1)) & 0xFF;
-      offset += sizeof(this->adc1);
-      *(outbuffer + offset + 0) = (this->adc2 >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->adc2 >> (8 * 1)) & 0xFF;
-      offset += sizeof(this->adc2);
-      *(outbuffer + offset + 0) = (this->adc3 >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->adc3 >> (8 * 1)) & 0xFF;
-      offset += sizeof(this->adc3);
-      *(outbuffer + offset + 0) = (this->adc4 >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->adc4 >> (8 * 1)) & 0xFF;
-      offset += sizeof(this->adc4);
-      *(outbuffer + offset + 0) = (this->adc5 >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->adc5 >> (8 * 1)) & 0xFF;
-      offset += sizeof(this->adc5);
+      offset += encode(outbuffer + offset, this->adc0);
+      offset += encode(outbuffer + offset, this->adc1);
+      offset += encode(outbuffer + offset, this->adc2);
+      offset += encode(outbuffer + offset, this->adc3);
+      offset += encode(outbuffer + offset, this->adc4);
+      offset += encode(outbuffer + offset, this->adc5);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      this->adc0 =  ((uint16_t) (*(inbuffer + offset)));
-      this->adc0 |= ((uint16_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      offset += sizeof(this->adc0);
-      this->adc1 =  ((uint16_t) (*(inbuffer + offset)));
-      this->adc1 |= ((uint16_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      offset += sizeof(this->adc1);
-      this->adc2 =  ((uint16_t) (*(inbuffer + offset)));
-      this->adc2 |= ((uint16_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      offset += sizeof(this->adc2);
-      this->adc3 =  ((uint16_t) (*(inbuffer + offset)));
-      this->adc3 |= ((uint16_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      offset += sizeof(this->adc3);
-      this->adc4 =  ((uint16_t) (*(inbuffer + offset)));
-      this->adc4 |= ((uint16_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      offset += sizeof(this->adc4);
-      this->adc5 =  ((uint16_t) (*(inbuffer + offset)));
-      this->adc5 |= ((uint16_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      offset += sizeof(this->adc5);
+      offset += decode(inbuffer + offset, this->adc0);
+      offset += decode(inbuffer + offset, this->adc1);
+      offset += decode(inbuffer + offset, this->adc2);
+      offset += decode(inbuffer + offset, this->adc3);
+      offset += decode(inbuffer + offset, this->adc4);
+      offset += decode(inbuffer + offset, this->adc5);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return Adc::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 12);
+      return offset;
+    }
+
     const char * getType(){ return "rosserial_arduino/Adc"; };
     const char * getMD5(){ return "6d7853a614e2e821319068311f2af25b"; };
 
@@ -24,29 +24,30 @@ static const char TEST[] = "rosserial_arduino/Test";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_input = strlen(this->input);
-      varToArr(outbuffer + offset, length_input);
-      offset += 4;
-      memcpy(outbuffer + offset, this->input, length_input);
-      offset += length_input;
+      offset += encodeString(outbuffer + offset, this->input);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_input;
-      arrToVar(length_input, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_input; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_input-1]=0;
-      this->input = (char *)(inbuffer + offset-1);
-      offset += length_input;
+      offset += decodeString(inbuffer + offset, this->input);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return TestRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return TEST; };
     const char * getMD5(){ return "39e92f1778057359c64c7b8a7d7b19de"; };
 
@@ -66,29 +67,30 @@ static const char TEST[] = "rosserial_arduino/Test";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_output = strlen(this->output);
-      varToArr(outbuffer + offset, length_output);
-      offset += 4;
-      memcpy(outbuffer + offset, this->output, length_output);
-      offset += length_output;
+      offset += encodeString(outbuffer + offset, this->output);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_output;
-      arrToVar(length_output, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_output; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_output-1]=0;
-      this->output = (char *)(inbuffer + offset-1);
-      offset += length_output;
+      offset += decodeString(inbuffer + offset, this->output);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return TestResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return TEST; };
     const char * getMD5(){ return "0825d95fdfa2c8f4bbb4e9c74bccd3fd"; };
 
@@ -31,33 +31,33 @@ namespace rosserial_msgs
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->level >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->level);
-      uint32_t length_msg = strlen(this->msg);
-      varToArr(outbuffer + offset, length_msg);
-      offset += 4;
-      memcpy(outbuffer + offset, this->msg, length_msg);
-      offset += length_msg;
+      offset += encode(outbuffer + offset, this->level);
+      offset += encodeString(outbuffer + offset, this->msg);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      this->level =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->level);
-      uint32_t length_msg;
-      arrToVar(length_msg, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_msg; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_msg-1]=0;
-      this->msg = (char *)(inbuffer + offset-1);
-      offset += length_msg;
+      offset += decode(inbuffer + offset, this->level);
+      offset += decodeString(inbuffer + offset, this->msg);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return Log::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkip(offset, size, 1);
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "rosserial_msgs/Log"; };
     const char * getMD5(){ return "11abd731c25933261cd6183bd12d6295"; };
 
@@ -24,29 +24,30 @@ static const char REQUESTMESSAGEINFO[] = "rosserial_msgs/RequestMessageInfo";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_type = strlen(this->type);
-      varToArr(outbuffer + offset, length_type);
-      offset += 4;
-      memcpy(outbuffer + offset, this->type, length_type);
-      offset += length_type;
+      offset += encodeString(outbuffer + offset, this->type);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_type;
-      arrToVar(length_type, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_type; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_type-1]=0;
-      this->type = (char *)(inbuffer + offset-1);
-      offset += length_type;
+      offset += decodeString(inbuffer + offset, this->type);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return RequestMessageInfoRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return REQUESTMESSAGEINFO; };
     const char * getMD5(){ return "dc67331de85cf97091b7d45e5c64ab75"; };
 
@@ -69,43 +70,33 @@ static const char REQUESTMESSAGEINFO[] = "rosserial_msgs/RequestMessageInfo";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_md5 = strlen(this->md5);
-      varToArr(outbuffer + offset, length_md5);
-      offset += 4;
-      memcpy(outbuffer + offset, this->md5, length_md5);
-      offset += length_md5;
-      uint32_t length_definition = strlen(this->definition);
-      varToArr(outbuffer + offset, length_definition);
-      offset += 4;
-      memcpy(outbuffer + offset, this->definition, length_definition);
-      offset += length_definition;
+      offset += encodeString(outbuffer + offset, this->md5);
+      offset += encodeString(outbuffer + offset, this->definition);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_md5;
-      arrToVar(length_md5, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_md5; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_md5-1]=0;
-      this->md5 = (char *)(inbuffer + offset-1);
-      offset += length_md5;
-      uint32_t length_definition;
-      arrToVar(length_definition, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_definition; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_definition-1]=0;
-      this->definition = (char *)(inbuffer + offset-1);
-      offset += length_definition;
+      offset += decodeString(inbuffer + offset, this->md5);
+      offset += decodeString(inbuffer + offset, this->definition);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return RequestMessageInfoResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return REQUESTMESSAGEINFO; };
     const char * getMD5(){ return "fe452186a069bed40f09b8628fe5eac8"; };
 
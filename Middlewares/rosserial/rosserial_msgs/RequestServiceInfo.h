@@ -24,29 +24,30 @@ static const char REQUESTSERVICEINFO[] = "rosserial_msgs/RequestServiceInfo";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_service = strlen(this->service);
-      varToArr(outbuffer + offset, length_service);
-      offset += 4;
-      memcpy(outbuffer + offset, this->service, length_service);
-      offset += length_service;
+      offset += encodeString(outbuffer + offset, this->service);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_service;
-      arrToVar(length_service, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_service; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_service-1]=0;
-      this->service = (char *)(inbuffer + offset-1);
-      offset += length_service;
+      offset += decodeString(inbuffer + offset, this->service);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return RequestServiceInfoRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return REQUESTSERVICEINFO; };
     const char * getMD5(){ return "1cbcfa13b08f6d36710b9af8741e6112"; };
 
@@ -72,57 +73,36 @@ static const char REQUESTSERVICEINFO[] = "rosserial_msgs/RequestServiceInfo";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_service_md5 = strlen(this->service_md5);
-      varToArr(outbuffer + offset, length_service_md5);
-      offset += 4;
-      memcpy(outbuffer + offset, this->service_md5, length_service_md5);
-      offset += length_service_md5;
-      uint32_t length_request_md5 = strlen(this->request_md5);
-      varToArr(outbuffer + offset, length_request_md5);
-      offset += 4;
-      memcpy(outbuffer + offset, this->request_md5, length_request_md5);
-      offset += length_request_md5;
-      uint32_t length_response_md5 = strlen(this->response_md5);
-      varToArr(outbuffer + offset, length_response_md5);
-      offset += 4;
-      memcpy(outbuffer + offset, this->response_md5, length_response_md5);
-      offset += length_response_md5;
+      offset += encodeString(outbuffer + offset, this->service_md5);
+      offset += encodeString(outbuffer + offset, this->request_md5);
+      offset += encodeString(outbuffer + offset, this->response_md5);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_service_md5;
-      arrToVar(length_service_md5, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_service_md5; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_service_md5-1]=0;
-      this->service_md5 = (char *)(inbuffer + offset-1);
-      offset += length_service_md5;
-      uint32_t length_request_md5;
-      arrToVar(length_request_md5, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_request_md5; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_request_md5-1]=0;
-      this->request_md5 = (char *)(inbuffer + offset-1);
-      offset += length_request_md5;
-      uint32_t length_response_md5;
-      arrToVar(length_response_md5, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_response_md5; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_response_md5-1]=0;
-      this->response_md5 = (char *)(inbuffer + offset-1);
-      offset += length_response_md5;
+      offset += decodeString(inbuffer + offset, this->service_md5);
+      offset += decodeString(inbuffer + offset, this->request_md5);
+      offset += decodeString(inbuffer + offset, this->response_md5);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return RequestServiceInfoResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return REQUESTSERVICEINFO; };
     const char * getMD5(){ return "c3d6dd25b909596479fbbc6559fa6874"; };
 
@@ -87,106 +87,19 @@ namespace sensor_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      union {
-        float real;
-        uint32_t base;
-      } u_voltage;
-      u_voltage.real = this->voltage;
-      *(outbuffer + offset + 0) = (u_voltage.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_voltage.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_voltage.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_voltage.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->voltage);
-      union {
-        float real;
-        uint32_t base;
-      } u_current;
-      u_current.real = this->current;
-      *(outbuffer + offset + 0) = (u_current.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_current.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_current.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_current.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->current);
-      union {
-        float real;
-        uint32_t base;
-      } u_charge;
-      u_charge.real = this->charge;
-      *(outbuffer + offset + 0) = (u_charge.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_charge.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_charge.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_charge.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->charge);
-      union {
-        float real;
-        uint32_t base;
-      } u_capacity;
-      u_capacity.real = this->capacity;
-      *(outbuffer + offset + 0) = (u_capacity.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_capacity.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_capacity.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_capacity.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->capacity);
-      union {
-        float real;
-        uint32_t base;
-      } u_design_capacity;
-      u_design_capacity.real = this->design_capacity;
-      *(outbuffer + offset + 0) = (u_design_capacity.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_design_capacity.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_design_capacity.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_design_capacity.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->design_capacity);
-      union {
-        float real;
-        uint32_t base;
-      } u_percentage;
-      u_percentage.real = this->percentage;
-      *(outbuffer + offset + 0) = (u_percentage.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_percentage.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_percentage.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_percentage.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->percentage);
-      *(outbuffer + offset + 0) = (this->power_supply_status >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->power_supply_status);
-      *(outbuffer + offset + 0) = (this->power_supply_health >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->power_supply_health);
-      *(outbuffer + offset + 0) = (this->power_supply_technology >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->power_supply_technology);
-      union {
-        bool real;
-        uint8_t base;
-      } u_present;
-      u_present.real = this->present;
-      *(outbuffer + offset + 0) = (u_present.base >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->present);
-      *(outbuffer + offset + 0) = (this->cell_voltage_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->cell_voltage_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->cell_voltage_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->cell_voltage_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->cell_voltage_length);
-      for( uint32_t i = 0; i < cell_voltage_length; i++){
-      union {
-        float real;
-        uint32_t base;
-      } u_cell_voltagei;
-      u_cell_voltagei.real = this->cell_voltage[i];
-      *(outbuffer + offset + 0) = (u_cell_voltagei.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_cell_voltagei.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_cell_voltagei.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_cell_voltagei.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->cell_voltage[i]);
-      }
-      uint32_t length_location = strlen(this->location);
-      varToArr(outbuffer + offset, length_location);
-      offset += 4;
-      memcpy(outbuffer + offset, this->location, length_location);
-      offset += length_location;
-      uint32_t length_serial_number = strlen(this->serial_number);
-      varToArr(outbuffer + offset, length_serial_number);
-      offset += 4;
-      memcpy(outbuffer + offset, this->serial_number, length_serial_number);
-      offset += length_serial_number;
+      offset += encode(outbuffer + offset, this->voltage);
+      offset += encode(outbuffer + offset, this->current);
+      offset += encode(outbuffer + offset, this->charge);
+      offset += encode(outbuffer + offset, this->capacity);
+      offset += encode(outbuffer + offset, this->design_capacity);
+      offset += encode(outbuffer + offset, this->percentage);
+      offset += encode(outbuffer + offset, this->power_supply_status);
+      offset += encode(outbuffer + offset, this->power_supply_health);
+      offset += encode(outbuffer + offset, this->power_supply_technology);
+      offset += encode(outbuffer + offset, this->present);
+      offset += encodeArray(outbuffer + offset, this->cell_voltage, this->cell_voltage_length);
+      offset += encodeString(outbuffer + offset, this->location);
+      offset += encodeString(outbuffer + offset, this->serial_number);
       return offset;
     }
 
@@ -194,129 +107,39 @@ namespace sensor_msgs
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      union {
-        float real;
-        uint32_t base;
-      } u_voltage;
-      u_voltage.base = 0;
-      u_voltage.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_voltage.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_voltage.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_voltage.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->voltage = u_voltage.real;
-      offset += sizeof(this->voltage);
-      union {
-        float real;
-        uint32_t base;
-      } u_current;
-      u_current.base = 0;
-      u_current.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_current.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_current.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_current.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->current = u_current.real;
-      offset += sizeof(this->current);
-      union {
-        float real;
-        uint32_t base;
-      } u_charge;
-      u_charge.base = 0;
-      u_charge.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_charge.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_charge.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_charge.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->charge = u_charge.real;
-      offset += sizeof(this->charge);
-      union {
-        float real;
-        uint32_t base;
-      } u_capacity;
-      u_capacity.base = 0;
-      u_capacity.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_capacity.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_capacity.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_capacity.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->capacity = u_capacity.real;
-      offset += sizeof(this->capacity);
-      union {
-        float real;
-        uint32_t base;
-      } u_design_capacity;
-      u_design_capacity.base = 0;
-      u_design_capacity.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_design_capacity.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_design_capacity.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_design_capacity.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->design_capacity = u_design_capacity.real;
-      offset += sizeof(this->design_capacity);
-      union {
-        float real;
-        uint32_t base;
-      } u_percentage;
-      u_percentage.base = 0;
-      u_percentage.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_percentage.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_percentage.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_percentage.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->percentage = u_percentage.real;
-      offset += sizeof(this->percentage);
-      this->power_supply_status =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->power_supply_status);
-      this->power_supply_health =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->power_supply_health);
-      this->power_supply_technology =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->power_supply_technology);
-      union {
-        bool real;
-        uint8_t base;
-      } u_present;
-      u_present.base = 0;
-      u_present.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      this->present = u_present.real;
-      offset += sizeof(this->present);
-      uint32_t cell_voltage_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      cell_voltage_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      cell_voltage_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      cell_voltage_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->cell_voltage_length);
-      if(cell_voltage_lengthT > cell_voltage_length)
-        this->cell_voltage = (float*)realloc(this->cell_voltage, cell_voltage_lengthT * sizeof(float));
-      cell_voltage_length = cell_voltage_lengthT;
-      for( uint32_t i = 0; i < cell_voltage_length; i++){
-      union {
-        float real;
-        uint32_t base;
-      } u_st_cell_voltage;
-      u_st_cell_voltage.base = 0;
-      u_st_cell_voltage.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_st_cell_voltage.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_st_cell_voltage.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_st_cell_voltage.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->st_cell_voltage = u_st_cell_voltage.real;
-      offset += sizeof(this->st_cell_voltage);
-        memcpy( &(this->cell_voltage[i]), &(this->st_cell_voltage), sizeof(float));
-      }
-      uint32_t length_location;
-      arrToVar(length_location, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_location; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_location-1]=0;
-      this->location = (char *)(inbuffer + offset-1);
-      offset += length_location;
-      uint32_t length_serial_number;
-      arrToVar(length_serial_number, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_serial_number; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_serial_number-1]=0;
-      this->serial_number = (char *)(inbuffer + offset-1);
-      offset += length_serial_number;
+      offset += decode(inbuffer + offset, this->voltage);
+      offset += decode(inbuffer + offset, this->current);
+      offset += decode(inbuffer + offset, this->charge);
+      offset += decode(inbuffer + offset, this->capacity);
+      offset += decode(inbuffer + offset, this->design_capacity);
+      offset += decode(inbuffer + offset, this->percentage);
+      offset += decode(inbuffer + offset, this->power_supply_status);
+      offset += decode(inbuffer + offset, this->power_supply_health);
+      offset += decode(inbuffer + offset, this->power_supply_technology);
+      offset += decode(inbuffer + offset, this->present);
+      offset += decodeArray(inbuffer + offset, this->cell_voltage, this->cell_voltage_length);
+      offset += decodeString(inbuffer + offset, this->location);
+      offset += decodeString(inbuffer + offset, this->serial_number);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return BatteryState::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 28);
+      offset = wireSkipArray(inbuffer, offset, size, 4);
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "sensor_msgs/BatteryState"; };
     const char * getMD5(){ return "476f837fa6771f6e16e3bf4ef96f8770"; };
 
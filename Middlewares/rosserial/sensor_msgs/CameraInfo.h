@@ -55,29 +55,10 @@ namespace sensor_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      *(outbuffer + offset + 0) = (this->height >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->height >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->height >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->height >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->height);
-      *(outbuffer + offset + 0) = (this->width >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->width >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->width >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->width >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->width);
-      uint32_t length_distortion_model = strlen(this->distortion_model);
-      varToArr(outbuffer + offset, length_distortion_model);
-      offset += 4;
-      memcpy(outbuffer + offset, this->distortion_model, length_distortion_model);
-      offset += length_distortion_model;
-      *(outbuffer + offset + 0) = (this->D_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->D_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->D_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->D_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->D_length);
-      for( uint32_t i = 0; i < D_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->D[i]);
-      }
+      offset += encode(outbuffer + offset, this->height);
+      offset += encode(outbuffer + offset, this->width);
+      offset += encodeString(outbuffer + offset, this->distortion_model);
+      offset += encodeFloat64Array(outbuffer + offset, this->D, this->D_length);
       for( uint32_t i = 0; i < 9; i++){
       offset += serializeAvrFloat64(outbuffer + offset, this->K[i]);
       }
@@ -87,16 +68,8 @@ namespace sensor_msgs
       for( uint32_t i = 0; i < 12; i++){
       offset += serializeAvrFloat64(outbuffer + offset, this->P[i]);
       }
-      *(outbuffer + offset + 0) = (this->binning_x >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->binning_x >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->binning_x >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->binning_x >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->binning_x);
-      *(outbuffer + offset + 0) = (this->binning_y >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->binning_y >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->binning_y >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->binning_y >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->binning_y);
+      offset += encode(outbuffer + offset, this->binning_x);
+      offset += encode(outbuffer + offset, this->binning_y);
       offset += this->roi.serialize(outbuffer + offset);
       return offset;
     }
@@ -105,37 +78,10 @@ namespace sensor_msgs
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      this->height =  ((uint32_t) (*(inbuffer + offset)));
-      this->height |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->height |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->height |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->height);
-      this->width =  ((uint32_t) (*(inbuffer + offset)));
-      this->width |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->width |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->width |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->width);
-      uint32_t length_distortion_model;
-      arrToVar(length_distortion_model, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_distortion_model; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_distortion_model-1]=0;
-      this->distortion_model = (char *)(inbuffer + offset-1);
-      offset += length_distortion_model;
-      uint32_t D_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      D_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      D_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      D_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->D_length);
-      if(D_lengthT > D_length)
-        this->D = (float*)realloc(this->D, D_lengthT * sizeof(float));
-      D_length = D_lengthT;
-      for( uint32_t i = 0; i < D_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_D));
-        memcpy( &(this->D[i]), &(this->st_D), sizeof(float));
-      }
+      offset += decode(inbuffer + offset, this->height);
+      offset += decode(inbuffer + offset, this->width);
+      offset += decodeString(inbuffer + offset, this->distortion_model);
+      offset += decodeFloat64Array(inbuffer + offset, this->D, this->D_length);
       for( uint32_t i = 0; i < 9; i++){
       offset += deserializeAvrFloat64(inbuffer + offset, &(this->K[i]));
       }
@@ -145,20 +91,30 @@ namespace sensor_msgs
       for( uint32_t i = 0; i < 12; i++){
       offset += deserializeAvrFloat64(inbuffer + offset, &(this->P[i]));
       }
-      this->binning_x =  ((uint32_t) (*(inbuffer + offset)));
-      this->binning_x |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->binning_x |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->binning_x |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->binning_x);
-      this->binning_y =  ((uint32_t) (*(inbuffer + offset)));
-      this->binning_y |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->binning_y |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->binning_y |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->binning_y);
+      offset += decode(inbuffer + offset, this->binning_x);
+      offset += decode(inbuffer + offset, this->binning_y);
       offset += this->roi.deserialize(inbuffer + offset);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return CameraInfo::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 8);
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkipArray(inbuffer, offset, size, 8);
+      offset = wireSkip(offset, size, 248);
+      offset = this->roi.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "sensor_msgs/CameraInfo"; };
     const char * getMD5(){ return "c9a58c1b0b154e0e6da7578cb991d214"; };
 
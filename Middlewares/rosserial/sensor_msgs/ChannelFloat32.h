@@ -28,68 +28,33 @@ namespace sensor_msgs
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_name = strlen(this->name);
-      varToArr(outbuffer + offset, length_name);
-      offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
-      offset += length_name;
-      *(outbuffer + offset + 0) = (this->values_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->values_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->values_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->values_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->values_length);
-      for( uint32_t i = 0; i < values_length; i++){
-      union {
-        float real;
-        uint32_t base;
-      } u_valuesi;
-      u_valuesi.real = this->values[i];
-      *(outbuffer + offset + 0) = (u_valuesi.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_valuesi.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_valuesi.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_valuesi.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->values[i]);
-      }
+      offset += encodeString(outbuffer + offset, this->name);
+      offset += encodeArray(outbuffer + offset, this->values, this->values_length);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_name;
-      arrToVar(length_name, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
-      offset += length_name;
-      uint32_t values_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      values_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      values_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      values_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->values_length);
-      if(values_lengthT > values_length)
-        this->values = (float*)realloc(this->values, values_lengthT * sizeof(float));
-      values_length = values_lengthT;
-      for( uint32_t i = 0; i < values_length; i++){
-      union {
-        float real;
-        uint32_t base;
-      } u_st_values;
-      u_st_values.base = 0;
-      u_st_values.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_st_values.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_st_values.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_st_values.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->st_values = u_st_values.real;
-      offset += sizeof(this->st_values);
-        memcpy( &(this->values[i]), &(this->st_values), sizeof(float));
-      }
+      offset += decodeString(inbuffer + offset, this->name);
+      offset += decodeArray(inbuffer + offset, this->values, this->values_length);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return ChannelFloat32::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkipArray(inbuffer, offset, size, 4);
+      return offset;
+    }
+
     const char * getType(){ return "sensor_msgs/ChannelFloat32"; };
     const char * getMD5(){ return "3d40139cdd33dfedcb71ffeeeb42ae7f"; };
 
@@ -76,6 +76,25 @@ namespace sensor_msgs
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return Imu::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = this->orientation.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 72);
+      offset = this->angular_velocity.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 72);
+      offset = this->linear_acceleration.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 72);
+      return offset;
+    }
+
     const char * getType(){ return "sensor_msgs/Imu"; };
     const char * getMD5(){ return "6a62c6daae103f4ff57a132d6f95cec2"; };
 
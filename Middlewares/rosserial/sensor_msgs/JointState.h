@@ -45,42 +45,10 @@ namespace sensor_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      *(outbuffer + offset + 0) = (this->name_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->name_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->name_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->name_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->name_length);
-      for( uint32_t i = 0; i < name_length; i++){
-      uint32_t length_namei = strlen(this->name[i]);
-      varToArr(outbuffer + offset, length_namei);
-      offset += 4;
-      memcpy(outbuffer + offset, this->name[i], length_namei);
-      offset += length_namei;
-      }
-      *(outbuffer + offset + 0) = (this->position_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->position_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->position_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->position_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->position_length);
-      for( uint32_t i = 0; i < position_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->position[i]);
-      }
-      *(outbuffer + offset + 0) = (this->velocity_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->velocity_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->velocity_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->velocity_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->velocity_length);
-      for( uint32_t i = 0; i < velocity_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->velocity[i]);
-      }
-      *(outbuffer + offset + 0) = (this->effort_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->effort_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->effort_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->effort_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->effort_length);
-      for( uint32_t i = 0; i < effort_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->effort[i]);
-      }
+      offset += encodeStringArray(outbuffer + offset, this->name, this->name_length);
+      offset += encodeFloat64Array(outbuffer + offset, this->position, this->position_length);
+      offset += encodeFloat64Array(outbuffer + offset, this->velocity, this->velocity_length);
+      offset += encodeFloat64Array(outbuffer + offset, this->effort, this->effort_length);
       return offset;
     }
 
@@ -88,65 +56,30 @@ namespace sensor_msgs
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      uint32_t name_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      name_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      name_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      name_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->name_length);
-      if(name_lengthT > name_length)
-        this->name = (char**)realloc(this->name, name_lengthT * sizeof(char*));
-      name_length = name_lengthT;
-      for( uint32_t i = 0; i < name_length; i++){
-      uint32_t length_st_name;
-      arrToVar(length_st_name, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_name-1]=0;
-      this->st_name = (char *)(inbuffer + offset-1);
-      offset += length_st_name;
-        memcpy( &(this->name[i]), &(this->st_name), sizeof(char*));
-      }
-      uint32_t position_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      position_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      position_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      position_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->position_length);
-      if(position_lengthT > position_length)
-        this->position = (float*)realloc(this->position, position_lengthT * sizeof(float));
-      position_length = position_lengthT;
-      for( uint32_t i = 0; i < position_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_position));
-        memcpy( &(this->position[i]), &(this->st_position), sizeof(float));
-      }
-      uint32_t velocity_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      velocity_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      velocity_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      velocity_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->velocity_length);
-      if(velocity_lengthT > velocity_length)
-        this->velocity = (float*)realloc(this->velocity, velocity_lengthT * sizeof(float));
-      velocity_length = velocity_lengthT;
-      for( uint32_t i = 0; i < velocity_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_velocity));
-        memcpy( &(this->velocity[i]), &(this->st_velocity), sizeof(float));
-      }
-      uint32_t effort_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      effort_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      effort_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      effort_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->effort_length);
-      if(effort_lengthT > effort_length)
-        this->effort = (float*)realloc(this->effort, effort_lengthT * sizeof(float));
-      effort_length = effort_lengthT;
-      for( uint32_t i = 0; i < effort_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_effort));
-        memcpy( &(this->effort[i]), &(this->st_effort), sizeof(float));
-      }
+      offset += decodeStringArray(inbuffer + offset, this->name, this->name_length);
+      offset += decodeFloat64Array(inbuffer + offset, this->position, this->position_length);
+      offset += decodeFloat64Array(inbuffer + offset, this->velocity, this->velocity_length);
+      offset += decodeFloat64Array(inbuffer + offset, this->effort, this->effort_length);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return JointState::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = wireSkipStringArray(inbuffer, offset, size);
+      offset = wireSkipArray(inbuffer, offset, size, 8);
+      offset = wireSkipArray(inbuffer, offset, size, 8);
+      offset = wireSkipArray(inbuffer, offset, size, 8);
+      return offset;
+    }
+
     const char * getType(){ return "sensor_msgs/JointState"; };
     const char * getMD5(){ return "3066dcd76a6cfaef579bd0f34173e9fd"; };
 
@@ -32,44 +32,35 @@ namespace sensor_msgs
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->type >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->type);
-      *(outbuffer + offset + 0) = (this->id >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->id);
-      union {
-        float real;
-        uint32_t base;
-      } u_intensity;
-      u_intensity.real = this->intensity;
-      *(outbuffer + offset + 0) = (u_intensity.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_intensity.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_intensity.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_intensity.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->intensity);
+      offset += encode(outbuffer + offset, this->type);
+      offset += encode(outbuffer + offset, this->id);
+      offset += encode(outbuffer + offset, this->intensity);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      this->type =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->type);
-      this->id =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->id);
-      union {
-        float real;
-        uint32_t base;
-      } u_intensity;
-      u_intensity.base = 0;
-      u_intensity.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_intensity.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_intensity.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_intensity.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->intensity = u_intensity.real;
-      offset += sizeof(this->intensity);
+      offset += decode(inbuffer + offset, this->type);
+      offset += decode(inbuffer + offset, this->id);
+      offset += decode(inbuffer + offset, this->intensity);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return JoyFeedback::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 6);
+      return offset;
+    }
+
     const char * getType(){ return "sensor_msgs/JoyFeedback"; };
     const char * getMD5(){ return "f4dcd73460360d98f36e55ee7f2e46f1"; };
 
@@ -14,23 +14,20 @@ namespace sensor_msgs
   {
     public:
       uint32_t array_length;
+      uint32_t array_capacity;
       typedef sensor_msgs::JoyFeedback _array_type;
       _array_type st_array;
       _array_type * array;
 
     JoyFeedbackArray():
-      array_length(0), array(NULL)
+      array_length(0), array_capacity(0), array(NULL)
     {
     }
 
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->array_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->array_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->array_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->array_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->array_length);
+      offset += encode(outbuffer + offset, this->array_length);
       for( uint32_t i = 0; i < array_length; i++){
       offset += this->array[i].serialize(outbuffer + offset);
       }
@@ -40,21 +37,27 @@ namespace sensor_msgs
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t array_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      array_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      array_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      array_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->array_length);
-      if(array_lengthT > array_length)
-        this->array = (sensor_msgs::JoyFeedback*)realloc(this->array, array_lengthT * sizeof(sensor_msgs::JoyFeedback));
-      array_length = array_lengthT;
-      for( uint32_t i = 0; i < array_length; i++){
-      offset += this->st_array.deserialize(inbuffer + offset);
-        memcpy( &(this->array[i]), &(this->st_array), sizeof(sensor_msgs::JoyFeedback));
-      }
+      offset += decodeMsgArray(inbuffer + offset, this->array, this->array_length, this->array_capacity);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return JoyFeedbackArray::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      uint32_t array_lengthT;
+      offset = wireCount(inbuffer, offset, size, array_lengthT, 6);
+      for( uint32_t i = 0; (i < array_lengthT) && (offset >= 0); i++){
+        offset = this->st_array.wireLength(inbuffer, offset, size);
+      }
+      return offset;
+    }
+
     const char * getType(){ return "sensor_msgs/JoyFeedbackArray"; };
     const char * getMD5(){ return "cde5730a895b1fc4dee6f91b754b213d"; };
 
@@ -56,110 +56,15 @@ namespace sensor_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      union {
-        float real;
-        uint32_t base;
-      } u_angle_min;
-      u_angle_min.real = this->angle_min;
-      *(outbuffer + offset + 0) = (u_angle_min.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_angle_min.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_angle_min.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_angle_min.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->angle_min);
-      union {
-        float real;
-        uint32_t base;
-      } u_angle_max;
-      u_angle_max.real = this->angle_max;
-      *(outbuffer + offset + 0) = (u_angle_max.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_angle_max.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_angle_max.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_angle_max.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->angle_max);
-      union {
-        float real;
-        uint32_t base;
-      } u_angle_increment;
-      u_angle_increment.real = this->angle_increment;
-      *(outbuffer + offset + 0) = (u_angle_increment.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_angle_increment.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_angle_increment.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_angle_increment.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->angle_increment);
-      union {
-        float real;
-        uint32_t base;
-      } u_time_increment;
-      u_time_increment.real = this->time_increment;
-      *(outbuffer + offset + 0) = (u_time_increment.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_time_increment.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_time_increment.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_time_increment.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->time_increment);
-      union {
-        float real;
-        uint32_t base;
-      } u_scan_time;
-      u_scan_time.real = this->scan_time;
-      *(outbuffer + offset + 0) = (u_scan_time.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_scan_time.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_scan_time.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_scan_time.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->scan_time);
-      union {
-        float real;
-        uint32_t base;
-      } u_range_min;
-      u_range_min.real = this->range_min;
-      *(outbuffer + offset + 0) = (u_range_min.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_range_min.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_range_min.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_range_min.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->range_min);
-      union {
-        float real;
-        uint32_t base;
-      } u_range_max;
-      u_range_max.real = this->range_max;
-      *(outbuffer + offset + 0) = (u_range_max.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_range_max.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_range_max.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_range_max.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->range_max);
-      *(outbuffer + offset + 0) = (this->ranges_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->ranges_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->ranges_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->ranges_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->ranges_length);
-      for( uint32_t i = 0; i < ranges_length; i++){
-      union {
-        float real;
-        uint32_t base;
-      } u_rangesi;
-      u_rangesi.real = this->ranges[i];
-      *(outbuffer + offset + 0) = (u_rangesi.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_rangesi.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_rangesi.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_rangesi.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->ranges[i]);
-      }
-      *(outbuffer + offset + 0) = (this->intensities_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->intensities_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->intensities_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->intensities_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->intensities_length);
-      for( uint32_t i = 0; i < intensities_length; i++){
-      union {
-        float real;
-        uint32_t base;
-      } u_intensitiesi;
-      u_intensitiesi.real = this->intensities[i];
-      *(outbuffer + offset + 0) = (u_intensitiesi.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_intensitiesi.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_intensitiesi.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_intensitiesi.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->intensities[i]);
-      }
+      offset += encode(outbuffer + offset, this->angle_min);
+      offset += encode(outbuffer + offset, this->angle_max);
+      offset += encode(outbuffer + offset, this->angle_increment);
+      offset += encode(outbuffer + offset, this->time_increment);
+      offset += encode(outbuffer + offset, this->scan_time);
+      offset += encode(outbuffer + offset, this->range_min);
+      offset += encode(outbuffer + offset, this->range_max);
+      offset += encodeArray(outbuffer + offset, this->ranges, this->ranges_length);
+      offset += encodeArray(outbuffer + offset, this->intensities, this->intensities_length);
       return offset;
     }
 
@@ -167,130 +72,34 @@ namespace sensor_msgs
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      union {
-        float real;
-        uint32_t base;
-      } u_angle_min;
-      u_angle_min.base = 0;
-      u_angle_min.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_angle_min.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_angle_min.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_angle_min.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->angle_min = u_angle_min.real;
-      offset += sizeof(this->angle_min);
-      union {
-        float real;
-        uint32_t base;
-      } u_angle_max;
-      u_angle_max.base = 0;
-      u_angle_max.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_angle_max.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_angle_max.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_angle_max.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->angle_max = u_angle_max.real;
-      offset += sizeof(this->angle_max);
-      union {
-        float real;
-        uint32_t base;
-      } u_angle_increment;
-      u_angle_increment.base = 0;
-      u_angle_increment.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_angle_increment.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_angle_increment.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_angle_increment.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->angle_increment = u_angle_increment.real;
-      offset += sizeof(this->angle_increment);
-      union {
-        float real;
-        uint32_t base;
-      } u_time_increment;
-      u_time_increment.base = 0;
-      u_time_increment.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_time_increment.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_time_increment.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_time_increment.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->time_increment = u_time_increment.real;
-      offset += sizeof(this->time_increment);
-      union {
-        float real;
-        uint32_t base;
-      } u_scan_time;
-      u_scan_time.base = 0;
-      u_scan_time.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_scan_time.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_scan_time.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_scan_time.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->scan_time = u_scan_time.real;
-      offset += sizeof(this->scan_time);
-      union {
-        float real;
-        uint32_t base;
-      } u_range_min;
-      u_range_min.base = 0;
-      u_range_min.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_range_min.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_range_min.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_range_min.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->range_min = u_range_min.real;
-      offset += sizeof(this->range_min);
-      union {
-        float real;
-        uint32_t base;
-      } u_range_max;
-      u_range_max.base = 0;
-      u_range_max.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_range_max.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_range_max.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_range_max.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->range_max = u_range_max.real;
-      offset += sizeof(this->range_max);
-      uint32_t ranges_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      ranges_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      ranges_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      ranges_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->ranges_length);
-      if(ranges_lengthT > ranges_length)
-        this->ranges = (float*)realloc(this->ranges, ranges_lengthT * sizeof(float));
-      ranges_length = ranges_lengthT;
-      for( uint32_t i = 0; i < ranges_length; i++){
-      union {
-        float real;
-        uint32_t base;
-      } u_st_ranges;
-      u_st_ranges.base = 0;
-      u_st_ranges.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_st_ranges.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_st_ranges.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_st_ranges.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->st_ranges = u_st_ranges.real;
-      offset += sizeof(this->st_ranges);
-        memcpy( &(this->ranges[i]), &(this->st_ranges), sizeof(float));
-      }
-      uint32_t intensities_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      intensities_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      intensities_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      intensities_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->intensities_length);
-      if(intensities_lengthT > intensities_length)
-        this->intensities = (float*)realloc(this->intensities, intensities_lengthT * sizeof(float));
-      intensities_length = intensities_lengthT;
-      for( uint32_t i = 0; i < intensities_length; i++){
-      union {
-        float real;
-        uint32_t base;
-      } u_st_intensities;
-      u_st_intensities.base = 0;
-      u_st_intensities.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_st_intensities.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_st_intensities.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_st_intensities.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->st_intensities = u_st_intensities.real;
-      offset += sizeof(this->st_intensities);
-        memcpy( &(this->intensities[i]), &(this->st_intensities), sizeof(float));
-      }
+      offset += decode(inbuffer + offset, this->angle_min);
+      offset += decode(inbuffer + offset, this->angle_max);
+      offset += decode(inbuffer + offset, this->angle_increment);
+      offset += decode(inbuffer + offset, this->time_increment);
+      offset += decode(inbuffer + offset, this->scan_time);
+      offset += decode(inbuffer + offset, this->range_min);
+      offset += decode(inbuffer + offset, this->range_max);
+      offset += decodeArray(inbuffer + offset, this->ranges, this->ranges_length);
+      offset += decodeArray(inbuffer + offset, this->intensities, this->intensities_length);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return LaserScan::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 28);
+      offset = wireSkipArray(inbuffer, offset, size, 4);
+      offset = wireSkipArray(inbuffer, offset, size, 4);
+      return offset;
+    }
+
     const char * getType(){ return "sensor_msgs/LaserScan"; };
     const char * getMD5(){ return "90c7ef2dc6895d81024acba2ac42f369"; };
 
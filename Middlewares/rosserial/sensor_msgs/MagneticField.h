@@ -49,6 +49,21 @@ namespace sensor_msgs
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return MagneticField::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = this->magnetic_field.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 72);
+      return offset;
+    }
+
     const char * getType(){ return "sensor_msgs/MagneticField"; };
     const char * getMD5(){ return "2f3b0b43eed0c9501de0fa3ff89a45aa"; };
 
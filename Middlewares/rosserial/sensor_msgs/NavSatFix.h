@@ -54,8 +54,7 @@ namespace sensor_msgs
       for( uint32_t i = 0; i < 9; i++){
       offset += serializeAvrFloat64(outbuffer + offset, this->position_covariance[i]);
       }
-      *(outbuffer + offset + 0) = (this->position_covariance_type >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->position_covariance_type);
+      offset += encode(outbuffer + offset, this->position_covariance_type);
       return offset;
     }
 
@@ -70,11 +69,25 @@ namespace sensor_msgs
       for( uint32_t i = 0; i < 9; i++){
       offset += deserializeAvrFloat64(inbuffer + offset, &(this->position_covariance[i]));
       }
-      this->position_covariance_type =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->position_covariance_type);
+      offset += decode(inbuffer + offset, this->position_covariance_type);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return NavSatFix::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = this->status.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 97);
+      return offset;
+    }
+
     const char * getType(){ return "sensor_msgs/NavSatFix"; };
     const char * getMD5(){ return "2d3a8cd499b9b4a0249fb98fd05cfa48"; };
 
@@ -34,36 +34,33 @@ namespace sensor_msgs
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      union {
-        int8_t real;
-        uint8_t base;
-      } u_status;
-      u_status.real = this->status;
-      *(outbuffer + offset + 0) = (u_status.base >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->status);
-      *(outbuffer + offset + 0) = (this->service >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->service >> (8 * 1)) & 0xFF;
-      offset += sizeof(this->service);
+      offset += encode(outbuffer + offset, this->status);
+      offset += encode(outbuffer + offset, this->service);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      union {
-        int8_t real;
-        uint8_t base;
-      } u_status;
-      u_status.base = 0;
-      u_status.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      this->status = u_status.real;
-      offset += sizeof(this->status);
-      this->service =  ((uint16_t) (*(inbuffer + offset)));
-      this->service |= ((uint16_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      offset += sizeof(this->service);
+      offset += decode(inbuffer + offset, this->status);
+      offset += decode(inbuffer + offset, this->service);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return NavSatStatus::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 3);
+      return offset;
+    }
+
     const char * getType(){ return "sensor_msgs/NavSatStatus"; };
     const char * getMD5(){ return "331cdbddfa4bc96ffc3b9ad98900a54c"; };
 
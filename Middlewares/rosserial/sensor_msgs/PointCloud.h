@@ -18,18 +18,20 @@ namespace sensor_msgs
       typedef std_msgs::Header _header_type;
       _header_type header;
       uint32_t points_length;
+      uint32_t points_capacity;
       typedef geometry_msgs::Point32 _points_type;
       _points_type st_points;
       _points_type * points;
       uint32_t channels_length;
+      uint32_t channels_capacity;
       typedef sensor_msgs::ChannelFloat32 _channels_type;
       _channels_type st_channels;
       _channels_type * channels;
 
     PointCloud():
       header(),
-      points_length(0), points(NULL),
-      channels_length(0), channels(NULL)
+      points_length(0), points_capacity(0), points(NULL),
+      channels_length(0), channels_capacity(0), channels(NULL)
     {
     }
 
@@ -37,19 +39,11 @@ namespace sensor_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      *(outbuffer + offset + 0) = (this->points_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->points_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->points_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->points_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->points_length);
+      offset += encode(outbuffer + offset, this->points_length);
       for( uint32_t i = 0; i < points_length; i++){
       offset += this->points[i].serialize(outbuffer + offset);
       }
-      *(outbuffer + offset + 0) = (this->channels_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->channels_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->channels_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->channels_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->channels_length);
+      offset += encode(outbuffer + offset, this->channels_length);
       for( uint32_t i = 0; i < channels_length; i++){
       offset += this->channels[i].serialize(outbuffer + offset);
       }
@@ -60,31 +54,32 @@ namespace sensor_msgs
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      uint32_t points_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      points_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      points_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      points_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->points_length);
-      if(points_lengthT > points_length)
-        this->points = (geometry_msgs::Point32*)realloc(this->points, points_lengthT * sizeof(geometry_msgs::Point32));
-      points_length = points_lengthT;
-      for( uint32_t i = 0; i < points_length; i++){
-      offset += this->st_points.deserialize(inbuffer + offset);
-        memcpy( &(this->points[i]), &(this->st_points), sizeof(geometry_msgs::Point32));
+      offset += decodeMsgArray(inbuffer + offset, this->points, this->points_length, this->points_capacity);
+      offset += decodeMsgArray(inbuffer + offset, this->channels, this->channels_length, this->channels_capacity);
+     return offset;
+    }
+
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return PointCloud::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      uint32_t points_lengthT;
+      offset = wireCount(inbuffer, offset, size, points_lengthT, 12);
+      for( uint32_t i = 0; (i < points_lengthT) && (offset >= 0); i++){
+        offset = this->st_points.wireLength(inbuffer, offset, size);
       }
-      uint32_t channels_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      channels_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      channels_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      channels_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->channels_length);
-      if(channels_lengthT > channels_length)
-        this->channels = (sensor_msgs::ChannelFloat32*)realloc(this->channels, channels_lengthT * sizeof(sensor_msgs::ChannelFloat32));
-      channels_length = channels_lengthT;
-      for( uint32_t i = 0; i < channels_length; i++){
-      offset += this->st_channels.deserialize(inbuffer + offset);
-        memcpy( &(this->channels[i]), &(this->st_channels), sizeof(sensor_msgs::ChannelFloat32));
+      uint32_t channels_lengthT;
+      offset = wireCount(inbuffer, offset, size, channels_lengthT, 8);
+      for( uint32_t i = 0; (i < channels_lengthT) && (offset >= 0); i++){
+        offset = this->st_channels.wireLength(inbuffer, offset, size);
       }
-     return offset;
+      return offset;
     }
 
     const char * getType(){ return "sensor_msgs/PointCloud"; };
@@ -40,53 +40,37 @@ namespace sensor_msgs
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_name = strlen(this->name);
-      varToArr(outbuffer + offset, length_name);
-      offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
-      offset += length_name;
-      *(outbuffer + offset + 0) = (this->offset >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->offset >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->offset >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->offset >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->offset);
-      *(outbuffer + offset + 0) = (this->datatype >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->datatype);
-      *(outbuffer + offset + 0) = (this->count >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->count >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->count >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->count >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->count);
+      offset += encodeString(outbuffer + offset, this->name);
+      offset += encode(outbuffer + offset, this->offset);
+      offset += encode(outbuffer + offset, this->datatype);
+      offset += encode(outbuffer + offset, this->count);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_name;
-      arrToVar(length_name, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
-      offset += length_name;
-      this->offset =  ((uint32_t) (*(inbuffer + offset)));
-      this->offset |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->offset |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->offset |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->offset);
-      this->datatype =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->datatype);
-      this->count =  ((uint32_t) (*(inbuffer + offset)));
-      this->count |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->count |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->count |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->count);
+      offset += decodeString(inbuffer + offset, this->name);
+      offset += decode(inbuffer + offset, this->offset);
+      offset += decode(inbuffer + offset, this->datatype);
+      offset += decode(inbuffer + offset, this->count);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return PointField::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 9);
+      return offset;
+    }
+
     const char * getType(){ return "sensor_msgs/PointField"; };
     const char * getMD5(){ return "268eacb2962780ceac86cbd17e328150"; };
 
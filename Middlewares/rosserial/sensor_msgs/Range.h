@@ -42,48 +42,11 @@ namespace sensor_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      *(outbuffer + offset + 0) = (this->radiation_type >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->radiation_type);
-      union {
-        float real;
-        uint32_t base;
-      } u_field_of_view;
-      u_field_of_view.real = this->field_of_view;
-      *(outbuffer + offset + 0) = (u_field_of_view.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_field_of_view.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_field_of_view.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_field_of_view.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->field_of_view);
-      union {
-        float real;
-        uint32_t base;
-      } u_min_range;
-      u_min_range.real = this->min_range;
-      *(outbuffer + offset + 0) = (u_min_range.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_min_range.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_min_range.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_min_range.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->min_range);
-      union {
-        float real;
-        uint32_t base;
-      } u_max_range;
-      u_max_range.real = this->max_range;
-      *(outbuffer + offset + 0) = (u_max_range.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_max_range.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_max_range.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_max_range.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->max_range);
-      union {
-        float real;
-        uint32_t base;
-      } u_range;
-      u_range.real = this->range;
-      *(outbuffer + offset + 0) = (u_range.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_range.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_range.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_range.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->range);
+      offset += encode(outbuffer + offset, this->radiation_type);
+      offset += encode(outbuffer + offset, this->field_of_view);
+      offset += encode(outbuffer + offset, this->min_range);
+      offset += encode(outbuffer + offset, this->max_range);
+      offset += encode(outbuffer + offset, this->range);
       return offset;
     }
 
@@ -91,55 +54,28 @@ namespace sensor_msgs
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      this->radiation_type =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->radiation_type);
-      union {
-        float real;
-        uint32_t base;
-      } u_field_of_view;
-      u_field_of_view.base = 0;
-      u_field_of_view.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_field_of_view.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_field_of_view.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_field_of_view.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->field_of_view = u_field_of_view.real;
-      offset += sizeof(this->field_of_view);
-      union {
-        float real;
-        uint32_t base;
-      } u_min_range;
-      u_min_range.base = 0;
-      u_min_range.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_min_range.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_min_range.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_min_range.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->min_range = u_min_range.real;
-      offset += sizeof(this->min_range);
-      union {
-        float real;
-        uint32_t base;
-      } u_max_range;
-      u_max_range.base = 0;
-      u_max_range.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_max_range.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_max_range.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_max_range.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->max_range = u_max_range.real;
-      offset += sizeof(this->max_range);
-      union {
-        float real;
-        uint32_t base;
-      } u_range;
-      u_range.base = 0;
-      u_range.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_range.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_range.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_range.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->range = u_range.real;
-      offset += sizeof(this->range);
+      offset += decode(inbuffer + offset, this->radiation_type);
+      offset += decode(inbuffer + offset, this->field_of_view);
+      offset += decode(inbuffer + offset, this->min_range);
+      offset += decode(inbuffer + offset, this->max_range);
+      offset += decode(inbuffer + offset, this->range);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return Range::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 17);
+      return offset;
+    }
+
     const char * getType(){ return "sensor_msgs/Range"; };
     const char * getMD5(){ return "c005c34273dc426c67a020a87bc24148"; };
 
@@ -35,70 +35,39 @@ namespace sensor_msgs
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->x_offset >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->x_offset >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->x_offset >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->x_offset >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->x_offset);
-      *(outbuffer + offset + 0) = (this->y_offset >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->y_offset >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->y_offset >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->y_offset >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->y_offset);
-      *(outbuffer + offset + 0) = (this->height >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->height >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->height >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->height >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->height);
-      *(outbuffer + offset + 0) = (this->width >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->width >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->width >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->width >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->width);
-      union {
-        bool real;
-        uint8_t base;
-      } u_do_rectify;
-      u_do_rectify.real = this->do_rectify;
-      *(outbuffer + offset + 0) = (u_do_rectify.base >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->do_rectify);
+      offset += encode(outbuffer + offset, this->x_offset);
+      offset += encode(outbuffer + offset, this->y_offset);
+      offset += encode(outbuffer + offset, this->height);
+      offset += encode(outbuffer + offset, this->width);
+      offset += encode(outbuffer + offset, this->do_rectify);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      this->x_offset =  ((uint32_t) (*(inbuffer + offset)));
-      this->x_offset |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->x_offset |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->x_offset |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->x_offset);
-      this->y_offset =  ((uint32_t) (*(inbuffer + offset)));
-      this->y_offset |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->y_offset |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->y_offset |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->y_offset);
-      this->height =  ((uint32_t) (*(inbuffer + offset)));
-      this->height |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->height |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->height |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->height);
-      this->width =  ((uint32_t) (*(inbuffer + offset)));
-      this->width |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->width |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->width |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->width);
-      union {
-        bool real;
-        uint8_t base;
-      } u_do_rectify;
-      u_do_rectify.base = 0;
-      u_do_rectify.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      this->do_rectify = u_do_rectify.real;
-      offset += sizeof(this->do_rectify);
+      offset += decode(inbuffer + offset, this->x_offset);
+      offset += decode(inbuffer + offset, this->y_offset);
+      offset += decode(inbuffer + offset, this->height);
+      offset += decode(inbuffer + offset, this->width);
+      offset += decode(inbuffer + offset, this->do_rectify);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return RegionOfInterest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 17);
+      return offset;
+    }
+
     const char * getType(){ return "sensor_msgs/RegionOfInterest"; };
     const char * getMD5(){ return "bdb633039d588fcccb441a4d43ccfe09"; };
 
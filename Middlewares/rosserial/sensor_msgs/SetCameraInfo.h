@@ -36,6 +36,19 @@ static const char SETCAMERAINFO[] = "sensor_msgs/SetCameraInfo";
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return SetCameraInfoRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->camera_info.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return SETCAMERAINFO; };
     const char * getMD5(){ return "ee34be01fdeee563d0d99cd594d5581d"; };
 
@@ -58,44 +71,33 @@ static const char SETCAMERAINFO[] = "sensor_msgs/SetCameraInfo";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      union {
-        bool real;
-        uint8_t base;
-      } u_success;
-      u_success.real = this->success;
-      *(outbuffer + offset + 0) = (u_success.base >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->success);
-      uint32_t length_status_message = strlen(this->status_message);
-      varToArr(outbuffer + offset, length_status_message);
-      offset += 4;
-      memcpy(outbuffer + offset, this->status_message, length_status_message);
-      offset += length_status_message;
+      offset += encode(outbuffer + offset, this->success);
+      offset += encodeString(outbuffer + offset, this->status_message);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      union {
-        bool real;
-        uint8_t base;
-      } u_success;
-      u_success.base = 0;
-      u_success.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      this->success = u_success.real;
-      offset += sizeof(this->success);
-      uint32_t length_status_message;
-      arrToVar(length_status_message, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_status_message; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_status_message-1]=0;
-      this->status_message = (char *)(inbuffer + offset-1);
-      offset += length_status_message;
+      offset += decode(inbuffer + offset, this->success);
+      offset += decodeString(inbuffer + offset, this->status_message);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return SetCameraInfoResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkip(offset, size, 1);
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return SETCAMERAINFO; };
     const char * getMD5(){ return "2ec6f3eff0161f4257b808b12bc830c2"; };
 
@@ -32,21 +32,9 @@ namespace sensor_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      *(outbuffer + offset + 0) = (this->time_ref.sec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->time_ref.sec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->time_ref.sec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->time_ref.sec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->time_ref.sec);
-      *(outbuffer + offset + 0) = (this->time_ref.nsec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->time_ref.nsec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->time_ref.nsec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->time_ref.nsec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->time_ref.nsec);
-      uint32_t length_source = strlen(this->source);
-      varToArr(outbuffer + offset, length_source);
-      offset += 4;
-      memcpy(outbuffer + offset, this->source, length_source);
-      offset += length_source;
+      offset += encode(outbuffer + offset, this->time_ref.sec);
+      offset += encode(outbuffer + offset, this->time_ref.nsec);
+      offset += encodeString(outbuffer + offset, this->source);
       return offset;
     }
 
@@ -54,28 +42,27 @@ namespace sensor_msgs
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      this->time_ref.sec =  ((uint32_t) (*(inbuffer + offset)));
-      this->time_ref.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->time_ref.sec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->time_ref.sec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->time_ref.sec);
-      this->time_ref.nsec =  ((uint32_t) (*(inbuffer + offset)));
-      this->time_ref.nsec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->time_ref.nsec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->time_ref.nsec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->time_ref.nsec);
-      uint32_t length_source;
-      arrToVar(length_source, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_source; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_source-1]=0;
-      this->source = (char *)(inbuffer + offset-1);
-      offset += length_source;
+      offset += decode(inbuffer + offset, this->time_ref.sec);
+      offset += decode(inbuffer + offset, this->time_ref.nsec);
+      offset += decodeString(inbuffer + offset, this->source);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return TimeReference::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 8);
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "sensor_msgs/TimeReference"; };
     const char * getMD5(){ return "fded64a0265108ba86c3d38fb11c0c16"; };
 
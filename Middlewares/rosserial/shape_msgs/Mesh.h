@@ -15,36 +15,30 @@ namespace shape_msgs
   {
     public:
       uint32_t triangles_length;
+      uint32_t triangles_capacity;
       typedef shape_msgs::MeshTriangle _triangles_type;
       _triangles_type st_triangles;
       _triangles_type * triangles;
       uint32_t vertices_length;
+      uint32_t vertices_capacity;
       typedef geometry_msgs::Point _vertices_type;
       _vertices_type st_vertices;
       _vertices_type * vertices;
 
     Mesh():
-      triangles_length(0), triangles(NULL),
-      vertices_length(0), vertices(NULL)
+      triangles_length(0), triangles_capacity(0), triangles(NULL),
+      vertices_length(0), vertices_capacity(0), vertices(NULL)
     {
     }
 
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->triangles_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->triangles_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->triangles_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->triangles_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->triangles_length);
+      offset += encode(outbuffer + offset, this->triangles_length);
       for( uint32_t i = 0; i < triangles_length; i++){
       offset += this->triangles[i].serialize(outbuffer + offset);
       }
-      *(outbuffer + offset + 0) = (this->vertices_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->vertices_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->vertices_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->vertices_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->vertices_length);
+      offset += encode(outbuffer + offset, this->vertices_length);
       for( uint32_t i = 0; i < vertices_length; i++){
       offset += this->vertices[i].serialize(outbuffer + offset);
       }
@@ -54,31 +48,31 @@ namespace shape_msgs
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t triangles_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      triangles_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      triangles_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      triangles_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->triangles_length);
-      if(triangles_lengthT > triangles_length)
-        this->triangles = (shape_msgs::MeshTriangle*)realloc(this->triangles, triangles_lengthT * sizeof(shape_msgs::MeshTriangle));
-      triangles_length = triangles_lengthT;
-      for( uint32_t i = 0; i < triangles_length; i++){
-      offset += this->st_triangles.deserialize(inbuffer + offset);
-        memcpy( &(this->triangles[i]), &(this->st_triangles), sizeof(shape_msgs::MeshTriangle));
+      offset += decodeMsgArray(inbuffer + offset, this->triangles, this->triangles_length, this->triangles_capacity);
+      offset += decodeMsgArray(inbuffer + offset, this->vertices, this->vertices_length, this->vertices_capacity);
+     return offset;
+    }
+
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return Mesh::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      uint32_t triangles_lengthT;
+      offset = wireCount(inbuffer, offset, size, triangles_lengthT, 12);
+      for( uint32_t i = 0; (i < triangles_lengthT) && (offset >= 0); i++){
+        offset = this->st_triangles.wireLength(inbuffer, offset, size);
       }
-      uint32_t vertices_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      vertices_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      vertices_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      vertices_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->vertices_length);
-      if(vertices_lengthT > vertices_length)
-        this->vertices = (geometry_msgs::Point*)realloc(this->vertices, vertices_lengthT * sizeof(geometry_msgs::Point));
-      vertices_length = vertices_lengthT;
-      for( uint32_t i = 0; i < vertices_length; i++){
-      offset += this->st_vertices.deserialize(inbuffer + offset);
-        memcpy( &(this->vertices[i]), &(this->st_vertices), sizeof(geometry_msgs::Point));
+      uint32_t vertices_lengthT;
+      offset = wireCount(inbuffer, offset, size, vertices_lengthT, 24);
+      for( uint32_t i = 0; (i < vertices_lengthT) && (offset >= 0); i++){
+        offset = this->st_vertices.wireLength(inbuffer, offset, size);
       }
-     return offset;
+      return offset;
     }
 
     const char * getType(){ return "shape_msgs/Mesh"; };
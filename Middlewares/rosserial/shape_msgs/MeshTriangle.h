@@ -23,11 +23,7 @@ namespace shape_msgs
     {
       int offset = 0;
       for( uint32_t i = 0; i < 3; i++){
-      *(outbuffer + offset + 0) = (this->vertex_indices[i] >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->vertex_indices[i] >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->vertex_indices[i] >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->vertex_indices[i] >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->vertex_indices[i]);
+      offset += encode(outbuffer + offset, this->vertex_indices[i]);
       }
       return offset;
     }
@@ -36,15 +32,25 @@ namespace shape_msgs
     {
       int offset = 0;
       for( uint32_t i = 0; i < 3; i++){
-      this->vertex_indices[i] =  ((uint32_t) (*(inbuffer + offset)));
-      this->vertex_indices[i] |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->vertex_indices[i] |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->vertex_indices[i] |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->vertex_indices[i]);
+      offset += decode(inbuffer + offset, this->vertex_indices[i]);
       }
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return MeshTriangle::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 12);
+      return offset;
+    }
+
     const char * getType(){ return "shape_msgs/MeshTriangle"; };
     const char * getMD5(){ return "23688b2e6d2de3d32fe8af104a903253"; };
 
@@ -37,6 +37,20 @@ namespace shape_msgs
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return Plane::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 32);
+      return offset;
+    }
+
     const char * getType(){ return "shape_msgs/Plane"; };
     const char * getMD5(){ return "2c1b92ed8f31492f8e73f6a4a44ca796"; };
 
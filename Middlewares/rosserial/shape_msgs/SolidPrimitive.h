@@ -40,39 +40,33 @@ namespace shape_msgs
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->type >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->type);
-      *(outbuffer + offset + 0) = (this->dimensions_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->dimensions_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->dimensions_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->dimensions_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->dimensions_length);
-      for( uint32_t i = 0; i < dimensions_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->dimensions[i]);
-      }
+      offset += encode(outbuffer + offset, this->type);
+      offset += encodeFloat64Array(outbuffer + offset, this->dimensions, this->dimensions_length);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      this->type =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->type);
-      uint32_t dimensions_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      dimensions_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      dimensions_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      dimensions_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->dimensions_length);
-      if(dimensions_lengthT > dimensions_length)
-        this->dimensions = (float*)realloc(this->dimensions, dimensions_lengthT * sizeof(float));
-      dimensions_length = dimensions_lengthT;
-      for( uint32_t i = 0; i < dimensions_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_dimensions));
-        memcpy( &(this->dimensions[i]), &(this->st_dimensions), sizeof(float));
-      }
+      offset += decode(inbuffer + offset, this->type);
+      offset += decodeFloat64Array(inbuffer + offset, this->dimensions, this->dimensions_length);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return SolidPrimitive::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkip(offset, size, 1);
+      offset = wireSkipArray(inbuffer, offset, size, 8);
+      return offset;
+    }
+
     const char * getType(){ return "shape_msgs/SolidPrimitive"; };
     const char * getMD5(){ return "d8f8cbc74c5ff283fca29569ccefb45d"; };
 
@@ -32,99 +32,37 @@ namespace std_msgs
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      union {
-        float real;
-        uint32_t base;
-      } u_r;
-      u_r.real = this->r;
-      *(outbuffer + offset + 0) = (u_r.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_r.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_r.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_r.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->r);
-      union {
-        float real;
-        uint32_t base;
-      } u_g;
-      u_g.real = this->g;
-      *(outbuffer + offset + 0) = (u_g.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_g.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_g.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_g.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->g);
-      union {
-        float real;
-        uint32_t base;
-      } u_b;
-      u_b.real = this->b;
-      *(outbuffer + offset + 0) = (u_b.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_b.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_b.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_b.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->b);
-      union {
-        float real;
-        uint32_t base;
-      } u_a;
-      u_a.real = this->a;
-      *(outbuffer + offset + 0) = (u_a.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_a.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_a.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_a.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->a);
+      offset += encode(outbuffer + offset, this->r);
+      offset += encode(outbuffer + offset, this->g);
+      offset += encode(outbuffer + offset, this->b);
+      offset += encode(outbuffer + offset, this->a);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      union {
-        float real;
-        uint32_t base;
-      } u_r;
-      u_r.base = 0;
-      u_r.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_r.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_r.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_r.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->r = u_r.real;
-      offset += sizeof(this->r);
-      union {
-        float real;
-        uint32_t base;
-      } u_g;
-      u_g.base = 0;
-      u_g.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_g.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_g.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_g.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->g = u_g.real;
-      offset += sizeof(this->g);
-      union {
-        float real;
-        uint32_t base;
-      } u_b;
-      u_b.base = 0;
-      u_b.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_b.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_b.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_b.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->b = u_b.real;
-      offset += sizeof(this->b);
-      union {
-        float real;
-        uint32_t base;
-      } u_a;
-      u_a.base = 0;
-      u_a.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_a.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_a.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_a.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->a = u_a.real;
-      offset += sizeof(this->a);
+      offset += decode(inbuffer + offset, this->r);
+      offset += decode(inbuffer + offset, this->g);
+      offset += decode(inbuffer + offset, this->b);
+      offset += decode(inbuffer + offset, this->a);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return ColorRGBA::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 16);
+      return offset;
+    }
+
     const char * getType(){ return "std_msgs/ColorRGBA"; };
     const char * getMD5(){ return "a29a96539573343b1310c73607334b00"; };
 
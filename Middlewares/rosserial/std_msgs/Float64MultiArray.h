@@ -30,14 +30,7 @@ namespace std_msgs
     {
       int offset = 0;
       offset += this->layout.serialize(outbuffer + offset);
-      *(outbuffer + offset + 0) = (this->data_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->data_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->data_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->data_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->data_length);
-      for( uint32_t i = 0; i < data_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->data[i]);
-      }
+      offset += encodeFloat64Array(outbuffer + offset, this->data, this->data_length);
       return offset;
     }
 
@@ -45,21 +38,24 @@ namespace std_msgs
     {
       int offset = 0;
       offset += this->layout.deserialize(inbuffer + offset);
-      uint32_t data_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      data_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      data_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      data_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->data_length);
-      if(data_lengthT > data_length)
-        this->data = (float*)realloc(this->data, data_lengthT * sizeof(float));
-      data_length = data_lengthT;
-      for( uint32_t i = 0; i < data_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_data));
-        memcpy( &(this->data[i]), &(this->st_data), sizeof(float));
-      }
+      offset += decodeFloat64Array(inbuffer + offset, this->data, this->data_length);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return Float64MultiArray::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->layout.wireLength(inbuffer, offset, size);
+      offset = wireSkipArray(inbuffer, offset, size, 8);
+      return offset;
+    }
+
     const char * getType(){ return "std_msgs/Float64MultiArray"; };
     const char * getMD5(){ return "4b7d974086d4060e7db4613a7e6c3ba4"; };
 
@@ -23,32 +23,31 @@ namespace std_msgs
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      union {
-        int16_t real;
-        uint16_t base;
-      } u_data;
-      u_data.real = this->data;
-      *(outbuffer + offset + 0) = (u_data.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_data.base >> (8 * 1)) & 0xFF;
-      offset += sizeof(this->data);
+      offset += encode(outbuffer + offset, this->data);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      union {
-        int16_t real;
-        uint16_t base;
-      } u_data;
-      u_data.base = 0;
-      u_data.base |= ((uint16_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_data.base |= ((uint16_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->data = u_data.real;
-      offset += sizeof(this->data);
+      offset += decode(inbuffer + offset, this->data);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return Int16::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 2);
+      return offset;
+    }
+
     const char * getType(){ return "std_msgs/Int16"; };
     const char * getMD5(){ return "8524586e34fbd7cb1c08c5f5f1ca0e57"; };
 
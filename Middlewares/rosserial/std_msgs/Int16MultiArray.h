@@ -30,21 +30,7 @@ namespace std_msgs
     {
       int offset = 0;
       offset += this->layout.serialize(outbuffer + offset);
-      *(outbuffer + offset + 0) = (this->data_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->data_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->data_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->data_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->data_length);
-      for( uint32_t i = 0; i < data_length; i++){
-      union {
-        int16_t real;
-        uint16_t base;
-      } u_datai;
-      u_datai.real = this->data[i];
-      *(outbuffer + offset + 0) = (u_datai.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_datai.base >> (8 * 1)) & 0xFF;
-      offset += sizeof(this->data[i]);
-      }
+      offset += encodeArray(outbuffer + offset, this->data, this->data_length);
       return offset;
     }
 
@@ -52,29 +38,24 @@ namespace std_msgs
     {
       int offset = 0;
       offset += this->layout.deserialize(inbuffer + offset);
-      uint32_t data_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      data_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      data_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      data_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->data_length);
-      if(data_lengthT > data_length)
-        this->data = (int16_t*)realloc(this->data, data_lengthT * sizeof(int16_t));
-      data_length = data_lengthT;
-      for( uint32_t i = 0; i < data_length; i++){
-      union {
-        int16_t real;
-        uint16_t base;
-      } u_st_data;
-      u_st_data.base = 0;
-      u_st_data.base |= ((uint16_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_st_data.base |= ((uint16_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->st_data = u_st_data.real;
-      offset += sizeof(this->st_data);
-        memcpy( &(this->data[i]), &(this->st_data), sizeof(int16_t));
-      }
+      offset += decodeArray(inbuffer + offset, this->data, this->data_length);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return Int16MultiArray::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->layout.wireLength(inbuffer, offset, size);
+      offset = wireSkipArray(inbuffer, offset, size, 2);
+      return offset;
+    }
+
     const char * getType(){ return "std_msgs/Int16MultiArray"; };
     const char * getMD5(){ return "d9338d7f523fcb692fae9d0a0e9f067c"; };
 
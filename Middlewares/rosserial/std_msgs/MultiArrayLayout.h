@@ -14,6 +14,7 @@ namespace std_msgs
   {
     public:
       uint32_t dim_length;
+      uint32_t dim_capacity;
       typedef std_msgs::MultiArrayDimension _dim_type;
       _dim_type st_dim;
       _dim_type * dim;
@@ -21,7 +22,7 @@ namespace std_msgs
       _data_offset_type data_offset;
 
     MultiArrayLayout():
-      dim_length(0), dim(NULL),
+      dim_length(0), dim_capacity(0), dim(NULL),
       data_offset(0)
     {
     }
@@ -29,45 +30,40 @@ namespace std_msgs
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->dim_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->dim_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->dim_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->dim_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->dim_length);
+      offset += encode(outbuffer + offset, this->dim_length);
       for( uint32_t i = 0; i < dim_length; i++){
       offset += this->dim[i].serialize(outbuffer + offset);
       }
-      *(outbuffer + offset + 0) = (this->data_offset >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->data_offset >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->data_offset >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->data_offset >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->data_offset);
+      offset += encode(outbuffer + offset, this->data_offset);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t dim_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      dim_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      dim_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      dim_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->dim_length);
-      if(dim_lengthT > dim_length)
-        this->dim = (std_msgs::MultiArrayDimension*)realloc(this->dim, dim_lengthT * sizeof(std_msgs::MultiArrayDimension));
-      dim_length = dim_lengthT;
-      for( uint32_t i = 0; i < dim_length; i++){
-      offset += this->st_dim.deserialize(inbuffer + offset);
-        memcpy( &(this->dim[i]), &(this->st_dim), sizeof(std_msgs::MultiArrayDimension));
-      }
-      this->data_offset =  ((uint32_t) (*(inbuffer + offset)));
-      this->data_offset |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->data_offset |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->data_offset |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->data_offset);
+      offset += decodeMsgArray(inbuffer + offset, this->dim, this->dim_length, this->dim_capacity);
+      offset += decode(inbuffer + offset, this->data_offset);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return MultiArrayLayout::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      uint32_t dim_lengthT;
+      offset = wireCount(inbuffer, offset, size, dim_lengthT, 12);
+      for( uint32_t i = 0; (i < dim_lengthT) && (offset >= 0); i++){
+        offset = this->st_dim.wireLength(inbuffer, offset, size);
+      }
+      offset = wireSkip(offset, size, 4);
+      return offset;
+    }
+
     const char * getType(){ return "std_msgs/MultiArrayLayout"; };
     const char * getMD5(){ return "0fed2a11c13e11c5571b4e2a995a91a3"; };
 
@@ -23,29 +23,30 @@ namespace std_msgs
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_data = strlen(this->data);
-      varToArr(outbuffer + offset, length_data);
-      offset += 4;
-      memcpy(outbuffer + offset, this->data, length_data);
-      offset += length_data;
+      offset += encodeString(outbuffer + offset, this->data);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_data;
-      arrToVar(length_data, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_data; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_data-1]=0;
-      this->data = (char *)(inbuffer + offset-1);
-      offset += length_data;
+      offset += decodeString(inbuffer + offset, this->data);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return String::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "std_msgs/String"; };
     const char * getMD5(){ return "992ce8a1687cec8c8bd883ec73ca41d1"; };
 
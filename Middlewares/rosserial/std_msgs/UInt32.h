@@ -23,25 +23,31 @@ namespace std_msgs
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->data >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->data >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->data >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->data >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->data);
+      offset += encode(outbuffer + offset, this->data);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      this->data =  ((uint32_t) (*(inbuffer + offset)));
-      this->data |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->data |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->data |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->data);
+      offset += decode(inbuffer + offset, this->data);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return UInt32::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 4);
+      return offset;
+    }
+
     const char * getType(){ return "std_msgs/UInt32"; };
     const char * getMD5(){ return "304a39449588c7f8ce2df6e8001c5fce"; };
 
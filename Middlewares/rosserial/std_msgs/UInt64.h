@@ -23,33 +23,31 @@ namespace std_msgs
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->data >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->data >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->data >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->data >> (8 * 3)) & 0xFF;
-      *(outbuffer + offset + 4) = (this->data >> (8 * 4)) & 0xFF;
-      *(outbuffer + offset + 5) = (this->data >> (8 * 5)) & 0xFF;
-      *(outbuffer + offset + 6) = (this->data >> (8 * 6)) & 0xFF;
-      *(outbuffer + offset + 7) = (this->data >> (8 * 7)) & 0xFF;
-      offset += sizeof(this->data);
+      offset += encode(outbuffer + offset, this->data);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      this->data =  ((uint64_t) (*(inbuffer + offset)));
-      this->data |= ((uint64_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->data |= ((uint64_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->data |= ((uint64_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->data |= ((uint64_t) (*(inbuffer + offset + 4))) << (8 * 4);
-      this->data |= ((uint64_t) (*(inbuffer + offset + 5))) << (8 * 5);
-      this->data |= ((uint64_t) (*(inbuffer + offset + 6))) << (8 * 6);
-      this->data |= ((uint64_t) (*(inbuffer + offset + 7))) << (8 * 7);
-      offset += sizeof(this->data);
+      offset += decode(inbuffer + offset, this->data);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return UInt64::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 8);
+      return offset;
+    }
+
     const char * getType(){ return "std_msgs/UInt64"; };
     const char * getMD5(){ return "1b2a79973e8bf53d7b53acb71299cb57"; };
 
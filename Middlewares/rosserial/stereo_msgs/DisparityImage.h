@@ -49,57 +49,12 @@ namespace stereo_msgs
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
       offset += this->image.serialize(outbuffer + offset);
-      union {
-        float real;
-        uint32_t base;
-      } u_f;
-      u_f.real = this->f;
-      *(outbuffer + offset + 0) = (u_f.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_f.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_f.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_f.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->f);
-      union {
-        float real;
-        uint32_t base;
-      } u_T;
-      u_T.real = this->T;
-      *(outbuffer + offset + 0) = (u_T.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_T.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_T.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_T.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->T);
+      offset += encode(outbuffer + offset, this->f);
+      offset += encode(outbuffer + offset, this->T);
       offset += this->valid_window.serialize(outbuffer + offset);
-      union {
-        float real;
-        uint32_t base;
-      } u_min_disparity;
-      u_min_disparity.real = this->min_disparity;
-      *(outbuffer + offset + 0) = (u_min_disparity.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_min_disparity.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_min_disparity.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_min_disparity.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->min_disparity);
-      union {
-        float real;
-        uint32_t base;
-      } u_max_disparity;
-      u_max_disparity.real = this->max_disparity;
-      *(outbuffer + offset + 0) = (u_max_disparity.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_max_disparity.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_max_disparity.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_max_disparity.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->max_disparity);
-      union {
-        float real;
-        uint32_t base;
-      } u_delta_d;
-      u_delta_d.real = this->delta_d;
-      *(outbuffer + offset + 0) = (u_delta_d.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_delta_d.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_delta_d.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_delta_d.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->delta_d);
+      offset += encode(outbuffer + offset, this->min_disparity);
+      offset += encode(outbuffer + offset, this->max_disparity);
+      offset += encode(outbuffer + offset, this->delta_d);
       return offset;
     }
 
@@ -108,65 +63,32 @@ namespace stereo_msgs
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
       offset += this->image.deserialize(inbuffer + offset);
-      union {
-        float real;
-        uint32_t base;
-      } u_f;
-      u_f.base = 0;
-      u_f.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_f.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_f.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_f.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->f = u_f.real;
-      offset += sizeof(this->f);
-      union {
-        float real;
-        uint32_t base;
-      } u_T;
-      u_T.base = 0;
-      u_T.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_T.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_T.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_T.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->T = u_T.real;
-      offset += sizeof(this->T);
+      offset += decode(inbuffer + offset, this->f);
+      offset += decode(inbuffer + offset, this->T);
       offset += this->valid_window.deserialize(inbuffer + offset);
-      union {
-        float real;
-        uint32_t base;
-      } u_min_disparity;
-      u_min_disparity.base = 0;
-      u_min_disparity.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_min_disparity.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_min_disparity.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_min_disparity.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->min_disparity = u_min_disparity.real;
-      offset += sizeof(this->min_disparity);
-      union {
-        float real;
-        uint32_t base;
-      } u_max_disparity;
-      u_max_disparity.base = 0;
-      u_max_disparity.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_max_disparity.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_max_disparity.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_max_disparity.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->max_disparity = u_max_disparity.real;
-      offset += sizeof(this->max_disparity);
-      union {
-        float real;
-        uint32_t base;
-      } u_delta_d;
-      u_delta_d.base = 0;
-      u_delta_d.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_delta_d.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_delta_d.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_delta_d.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->delta_d = u_delta_d.real;
-      offset += sizeof(this->delta_d);
+      offset += decode(inbuffer + offset, this->min_disparity);
+      offset += decode(inbuffer + offset, this->max_disparity);
+      offset += decode(inbuffer + offset, this->delta_d);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return DisparityImage::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = this->image.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 8);
+      offset = this->valid_window.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 12);
+      return offset;
+    }
+
     const char * getType(){ return "stereo_msgs/DisparityImage"; };
     const char * getMD5(){ return "04a177815f75271039fa21f16acad8c9"; };
 
@@ -20,16 +20,32 @@ static const char FRAMEGRAPH[] = "tf/FrameGraph";
 
     virtual int serialize(unsigned char *outbuffer) const
     {
+      (void) outbuffer;
       int offset = 0;
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
+      (void) inbuffer;
       int offset = 0;
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return FrameGraphRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      (void) size;
+      return offset;
+    }
+
     const char * getType(){ return FRAMEGRAPH; };
     const char * getMD5(){ return "d41d8cd98f00b204e9800998ecf8427e"; };
 
@@ -49,29 +65,30 @@ static const char FRAMEGRAPH[] = "tf/FrameGraph";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_dot_graph = strlen(this->dot_graph);
-      varToArr(outbuffer + offset, length_dot_graph);
-      offset += 4;
-      memcpy(outbuffer + offset, this->dot_graph, length_dot_graph);
-      offset += length_dot_graph;
+      offset += encodeString(outbuffer + offset, this->dot_graph);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_dot_graph;
-      arrToVar(length_dot_graph, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_dot_graph; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_dot_graph-1]=0;
-      this->dot_graph = (char *)(inbuffer + offset-1);
-      offset += length_dot_graph;
+      offset += decodeString(inbuffer + offset, this->dot_graph);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return FrameGraphResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return FRAMEGRAPH; };
     const char * getMD5(){ return "c4af9ac907e58e906eb0b6e3c58478c0"; };
 
@@ -0,0 +1,290 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file batched_transform_broadcaster.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Transform broadcaster publishing all transforms of a cycle at once
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef ROS_BATCHED_TRANSFORM_BROADCASTER_H_
+#define ROS_BATCHED_TRANSFORM_BROADCASTER_H_
+
+/* Includes ----------------------------------------------------------------------*/
+#include <string.h>
+
+#include "ros/node_handle.h"
+#include "tf/tfMessage.h"
+#include "tf2_msgs/TFMessage.h"
+/* -------------------------------------------------------------------------------*/
+
+namespace tf
+{
+
+/**
+ * @brief Transform broadcaster which sends all transforms of a control cycle
+ *        in one /tf message
+ *
+ * sendTransform() only queues the transform, flush() publishes everything
+ * queued since the last flush. Each child frame is published at most once
+ * per minimum period; a newer transform for a queued child frame replaces
+ * the queued one. Static transforms are published on /tf_static as
+ * tf2_msgs/TFMessage, the type tf2 listeners expect there. The link has no
+ * latching, so the static set is sent again with the first flush after
+ * every topic negotiation with the host.
+ *
+ * Transforms are copied, but their frame id strings are not: they have to
+ * stay valid until the transform is published. The child frame ids used
+ * for the rate limit are kept as copies.
+ *
+ * @tparam NodeHandleT    Type of the node handle used for publishing
+ * @tparam MAX_TRANSFORMS Maximum number of child frames
+ * @tparam MAX_STATIC     Maximum number of static transforms
+ * @tparam MAX_FRAME_ID   Maximum length of a child frame id
+ */
+template<typename NodeHandleT, int MAX_TRANSFORMS = 16, int MAX_STATIC = 4, int MAX_FRAME_ID = 31>
+class BatchedTransformBroadcaster
+{
+public:
+  BatchedTransformBroadcaster(const uint32_t min_period_ms = 0) :
+    nh_(0),
+    publisher_("/tf", &msg_),
+    static_publisher_("/tf_static", &static_msg_),
+    min_period_ms_(min_period_ms),
+    frames_length_(0),
+    queued_length_(0),
+    static_length_(0),
+    static_pending_(false),
+    static_negotiation_(0)
+  {
+  }
+
+  void init(NodeHandleT &nh)
+  {
+    nh_ = &nh;
+    nh.advertise(publisher_);
+    nh.advertise(static_publisher_);
+    static_negotiation_ = nh.getNegotiationCount();
+  }
+
+  /* Minimum time between two transforms of the same child frame */
+  void setMinPeriod(const uint32_t min_period_ms)
+  {
+    min_period_ms_ = min_period_ms;
+  }
+
+  /**
+   * @brief Queue a transform for the next flush()
+   *
+   * @return false if the transform was dropped, because its child frame was
+   *         published less than the minimum period ago, there is no space
+   *         for another child frame or its id is longer than MAX_FRAME_ID
+   */
+  bool sendTransform(const geometry_msgs::TransformStamped &transform)
+  {
+    const int frame = findFrame(transform.child_frame_id);
+    if (frame < 0)
+      return false;
+
+    Frame &f = frames_[frame];
+    if (f.queued < 0)
+    {
+      const unsigned long now = nh_->getHardware()->time();
+      if (f.published && ((now - f.last_ms) < min_period_ms_))
+        return false;
+      f.queued = queued_length_++;
+      queued_frames_[f.queued] = frame;
+    }
+
+    queued_[f.queued] = transform;
+    return true;
+  }
+
+  /**
+   * @brief Add a transform that does not change, it is published after
+   *        every negotiation
+   *
+   * @return false if there is no space for another static transform
+   */
+  bool sendStaticTransform(const geometry_msgs::TransformStamped &transform)
+  {
+    if (static_length_ >= MAX_STATIC)
+      return false;
+
+    static_[static_length_++] = transform;
+    static_pending_ = true;
+    return true;
+  }
+
+  /**
+   * @brief Publish all queued transforms, split into as many /tf messages as
+   *        needed to fit the output buffer of the node handle
+   *
+   * @return Number of transforms published
+   */
+  int flush()
+  {
+    const unsigned long now = nh_->getHardware()->time();
+
+    if (static_pending_ || (nh_->getNegotiationCount() != static_negotiation_))
+    {
+      if (nh_->connected() &&
+          (publishBatches(static_publisher_, static_msg_, static_, static_length_) == static_length_))
+      {
+        static_pending_ = false;
+        static_negotiation_ = nh_->getNegotiationCount();
+      }
+    }
+
+    const int published = publishBatches(publisher_, msg_, queued_, queued_length_);
+
+    for (int i = 0; i < queued_length_; i++)
+    {
+      Frame &f = frames_[queued_frames_[i]];
+      f.queued = -1;
+      if (i < published)
+      {
+        f.published = true;
+        f.last_ms = now;
+      }
+    }
+    queued_length_ = 0;
+
+    return published;
+  }
+
+  /* Number of transforms waiting for flush() */
+  int getQueued() const
+  {
+    return queued_length_;
+  }
+
+private:
+  struct Frame
+  {
+    char child_frame_id[MAX_FRAME_ID + 1];
+    unsigned long last_ms;
+    bool published;
+    int queued;
+  };
+
+  /* Serialized size of a transform: header (seq, stamp, frame_id),
+   * child_frame_id and the seven float64 values of the transform */
+  static int wireSize(const geometry_msgs::TransformStamped &transform)
+  {
+    return 4 + 8 + 4 + (int) strlen(transform.header.frame_id) +
+           4 + (int) strlen(transform.child_frame_id) + 7 * 8;
+  }
+
+  int findFrame(const char *child_frame_id)
+  {
+    for (int i = 0; i < frames_length_; i++)
+    {
+      if (strcmp(frames_[i].child_frame_id, child_frame_id) == 0)
+        return i;
+    }
+
+    const size_t length = strlen(child_frame_id);
+    if ((frames_length_ >= MAX_TRANSFORMS) || (length > MAX_FRAME_ID))
+      return -1;
+
+    Frame &f = frames_[frames_length_];
+    memcpy(f.child_frame_id, child_frame_id, length + 1);
+    f.last_ms = 0;
+    f.published = false;
+    f.queued = -1;
+    return frames_length_++;
+  }
+
+  /* Publish transforms in as few messages as possible, returns the number
+   * of transforms published before the first failure */
+  template<typename MsgT>
+  int publishBatches(ros::StaticPublisher<MsgT, NodeHandleT> &publisher, MsgT &msg,
+                     geometry_msgs::TransformStamped *transforms, const int length)
+  {
+    /* frame header, length of the transform array and checksum */
+    const int budget = NodeHandleT::OUTPUT_BUFFER_SIZE - 7 - 4 - 1;
+
+    int start = 0;
+    while (start < length)
+    {
+      int end = start;
+      int size = 0;
+      while ((end < length) && ((size + wireSize(transforms[end])) <= budget))
+        size += wireSize(transforms[end++]);
+
+      /* a single transform larger than the buffer can never be sent */
+      if (end == start)
+        return start;
+
+      msg.transforms = transforms + start;
+      msg.transforms_length = end - start;
+      if (publisher.publish(msg) <= 0)
+        return start;
+
+      start = end;
+    }
+
+    return length;
+  }
+
+  NodeHandleT *nh_;
+
+  tf::tfMessage msg_;
+  tf2_msgs::TFMessage static_msg_;
+  ros::StaticPublisher<tf::tfMessage, NodeHandleT> publisher_;
+  ros::StaticPublisher<tf2_msgs::TFMessage, NodeHandleT> static_publisher_;
+
+  uint32_t min_period_ms_;
+
+  Frame frames_[MAX_TRANSFORMS];
+  int frames_length_;
+
+  geometry_msgs::TransformStamped queued_[MAX_TRANSFORMS];
+  int queued_frames_[MAX_TRANSFORMS];
+  int queued_length_;
+
+  geometry_msgs::TransformStamped static_[MAX_STATIC];
+  int static_length_;
+  bool static_pending_;
+  uint32_t static_negotiation_;
+};
+
+}
+
+#endif /* ROS_BATCHED_TRANSFORM_BROADCASTER_H_ */
@@ -36,21 +36,17 @@
 #define ROS_TF_H_
 
 #include "geometry_msgs/TransformStamped.h"
+#include "tf/tf_math.h"
 
 namespace tf
 {
 
+/* the quaternion holds floats, so it is computed in single precision */
 static inline geometry_msgs::Quaternion createQuaternionFromYaw(double yaw)
 {
-  geometry_msgs::Quaternion q;
-  q.x = 0;
-  q.y = 0;
-  q.z = sin(yaw * 0.5);
-  q.w = cos(yaw * 0.5);
-  return q;
+  return quaternionFromYaw((float) yaw);
 }
 
 }
 
 #endif
-
@@ -14,23 +14,20 @@ namespace tf
   {
     public:
       uint32_t transforms_length;
+      uint32_t transforms_capacity;
       typedef geometry_msgs::TransformStamped _transforms_type;
       _transforms_type st_transforms;
       _transforms_type * transforms;
 
     tfMessage():
-      transforms_length(0), transforms(NULL)
+      transforms_length(0), transforms_capacity(0), transforms(NULL)
     {
     }
 
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->transforms_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->transforms_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->transforms_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->transforms_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->transforms_length);
+      offset += encode(outbuffer + offset, this->transforms_length);
       for( uint32_t i = 0; i < transforms_length; i++){
       offset += this->transforms[i].serialize(outbuffer + offset);
       }
@@ -40,21 +37,27 @@ namespace tf
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t transforms_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      transforms_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      transforms_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      transforms_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->transforms_length);
-      if(transforms_lengthT > transforms_length)
-        this->transforms = (geometry_msgs::TransformStamped*)realloc(this->transforms, transforms_lengthT * sizeof(geometry_msgs::TransformStamped));
-      transforms_length = transforms_lengthT;
-      for( uint32_t i = 0; i < transforms_length; i++){
-      offset += this->st_transforms.deserialize(inbuffer + offset);
-        memcpy( &(this->transforms[i]), &(this->st_transforms), sizeof(geometry_msgs::TransformStamped));
-      }
+      offset += decodeMsgArray(inbuffer + offset, this->transforms, this->transforms_length, this->transforms_capacity);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return tfMessage::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      uint32_t transforms_lengthT;
+      offset = wireCount(inbuffer, offset, size, transforms_lengthT, 76);
+      for( uint32_t i = 0; (i < transforms_lengthT) && (offset >= 0); i++){
+        offset = this->st_transforms.wireLength(inbuffer, offset, size);
+      }
+      return offset;
+    }
+
     const char * getType(){ return "tf/tfMessage"; };
     const char * getMD5(){ return "94810edda583a504dfda3829e70d7eec"; };
 
@@ -0,0 +1,373 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file tf_math.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Single precision quaternion and rotation math for tf
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef ROS_TF_MATH_H_
+#define ROS_TF_MATH_H_
+
+/* Includes ----------------------------------------------------------------------*/
+#include <math.h>
+
+#include "geometry_msgs/Quaternion.h"
+#include "geometry_msgs/Transform.h"
+#include "geometry_msgs/Vector3.h"
+/* -------------------------------------------------------------------------------*/
+
+/*
+ * Single precision rotation math for tf. The message types hold floats, so
+ * nothing is gained from double precision, which the Cortex-M4F has to
+ * emulate in software. sin, cos and atan2 are evaluated with short
+ * polynomials (from the Cephes single precision library) which stay within
+ * a few float ulps for angles of a few turns.
+ */
+
+namespace tf
+{
+
+/* Math Constants ----------------------------------------------------------------*/
+const float TF_PI       = 3.14159265358979f;
+const float TF_PI_2     = 1.57079632679490f;
+const float TF_PI_4     = 0.78539816339745f;
+/* -------------------------------------------------------------------------------*/
+
+/**
+ * @brief Sine and cosine of angle
+ *
+ * The angle is reduced to [-pi/4, pi/4] in three steps so the reduction
+ * itself does not lose precision for angles up to a few hundred radians.
+ */
+static inline void fastSinCos(const float angle, float &s, float &c)
+{
+  const int k = (int)(angle * 0.636619772f + ((angle >= 0.0f) ? 0.5f : -0.5f));
+  const float fk = (float) k;
+  const float r = ((angle - fk * 1.5703125f) - fk * 4.837512969970703125e-4f) - fk * 7.54978995489188216e-8f;
+  const float z = r * r;
+
+  const float sr = r + r * z * ((-1.9515295891e-4f * z + 8.3321608736e-3f) * z - 1.6666654611e-1f);
+  const float cr = 1.0f - 0.5f * z + z * z * ((2.443315711809948e-5f * z - 1.388731625493765e-3f) * z + 4.166664568298827e-2f);
+
+  /* quadrant: odd ones swap sin and cos, signs follow from bit 1 */
+  const bool swap = (k & 1) != 0;
+  const float s0 = swap ? cr : sr;
+  const float c0 = swap ? sr : cr;
+  s = (k & 2) ? -s0 : s0;
+  c = ((k + 1) & 2) ? -c0 : c0;
+}
+
+static inline float fastSin(const float angle)
+{
+  float s, c;
+  fastSinCos(angle, s, c);
+  return s;
+}
+
+static inline float fastCos(const float angle)
+{
+  float s, c;
+  fastSinCos(angle, s, c);
+  return c;
+}
+
+/* Arc tangent, reduced to [-tan(pi/8), tan(pi/8)] before the polynomial */
+static inline float fastAtan(float x)
+{
+  const float sign = (x < 0.0f) ? -1.0f : 1.0f;
+  float y = 0.0f;
+
+  x *= sign;
+  if (x > 2.414213562373095f)
+  {
+    y = TF_PI_2;
+    x = -1.0f / x;
+  }
+  else if (x > 0.414213562373095f)
+  {
+    y = TF_PI_4;
+    x = (x - 1.0f) / (x + 1.0f);
+  }
+
+  const float z = x * x;
+  y += (((8.05374449538e-2f * z - 1.38776856032e-1f) * z + 1.99777106478e-1f) * z - 3.33329491539e-1f) * z * x + x;
+  return sign * y;
+}
+
+static inline float fastAtan2(const float y, const float x)
+{
+  if (x > 0.0f)
+    return fastAtan(y / x);
+  if (x < 0.0f)
+    return fastAtan(y / x) + ((y < 0.0f) ? -TF_PI : TF_PI);
+  if (y > 0.0f)
+    return TF_PI_2;
+  if (y < 0.0f)
+    return -TF_PI_2;
+  return 0.0f;
+}
+
+/*
+ * Quaternions
+ */
+
+static inline geometry_msgs::Quaternion quaternionFromYaw(const float yaw)
+{
+  geometry_msgs::Quaternion q;
+  fastSinCos(0.5f * yaw, q.z, q.w);
+  return q;
+}
+
+/* Quaternion of fixed axis rotations about x (roll), y (pitch) and z (yaw),
+ * the same convention as tf::Quaternion::setRPY() */
+static inline geometry_msgs::Quaternion quaternionFromRPY(const float roll, const float pitch, const float yaw)
+{
+  float sr, cr, sp, cp, sy, cy;
+  fastSinCos(0.5f * roll, sr, cr);
+  fastSinCos(0.5f * pitch, sp, cp);
+  fastSinCos(0.5f * yaw, sy, cy);
+
+  geometry_msgs::Quaternion q;
+  q.x = sr * cp * cy - cr * sp * sy;
+  q.y = cr * sp * cy + sr * cp * sy;
+  q.z = cr * cp * sy - sr * sp * cy;
+  q.w = cr * cp * cy + sr * sp * sy;
+  return q;
+}
+
+static inline void getRPY(const geometry_msgs::Quaternion &q, float &roll, float &pitch, float &yaw)
+{
+  roll = fastAtan2(2.0f * (q.w * q.x + q.y * q.z), 1.0f - 2.0f * (q.x * q.x + q.y * q.y));
+
+  float sp = 2.0f * (q.w * q.y - q.z * q.x);
+  if (sp > 1.0f)
+    sp = 1.0f;
+  else if (sp < -1.0f)
+    sp = -1.0f;
+  pitch = fastAtan2(sp, sqrtf(1.0f - sp * sp));
+
+  yaw = fastAtan2(2.0f * (q.w * q.z + q.x * q.y), 1.0f - 2.0f * (q.y * q.y + q.z * q.z));
+}
+
+static inline float getYaw(const geometry_msgs::Quaternion &q)
+{
+  return fastAtan2(2.0f * (q.w * q.z + q.x * q.y), 1.0f - 2.0f * (q.y * q.y + q.z * q.z));
+}
+
+static inline geometry_msgs::Quaternion multiply(const geometry_msgs::Quaternion &a, const geometry_msgs::Quaternion &b)
+{
+  geometry_msgs::Quaternion q;
+  q.x = a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y;
+  q.y = a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x;
+  q.z = a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w;
+  q.w = a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z;
+  return q;
+}
+
+/* Inverse of a unit quaternion */
+static inline geometry_msgs::Quaternion inverse(const geometry_msgs::Quaternion &q)
+{
+  geometry_msgs::Quaternion r;
+  r.x = -q.x;
+  r.y = -q.y;
+  r.z = -q.z;
+  r.w = q.w;
+  return r;
+}
+
+static inline geometry_msgs::Quaternion normalize(const geometry_msgs::Quaternion &q)
+{
+  const float inv = 1.0f / sqrtf(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+  geometry_msgs::Quaternion r;
+  r.x = q.x * inv;
+  r.y = q.y * inv;
+  r.z = q.z * inv;
+  r.w = q.w * inv;
+  return r;
+}
+
+/* Rotate a vector by a unit quaternion */
+static inline geometry_msgs::Vector3 rotate(const geometry_msgs::Quaternion &q, const geometry_msgs::Vector3 &v)
+{
+  /* t = 2 * (q.xyz x v), v' = v + w * t + q.xyz x t */
+  const float tx = 2.0f * (q.y * v.z - q.z * v.y);
+  const float ty = 2.0f * (q.z * v.x - q.x * v.z);
+  const float tz = 2.0f * (q.x * v.y - q.y * v.x);
+
+  geometry_msgs::Vector3 r;
+  r.x = v.x + q.w * tx + (q.y * tz - q.z * ty);
+  r.y = v.y + q.w * ty + (q.z * tx - q.x * tz);
+  r.z = v.z + q.w * tz + (q.x * ty - q.y * tx);
+  return r;
+}
+
+/* Spherical linear interpolation along the shorter arc, ratio 0 gives a
+ * and 1 gives b */
+static inline geometry_msgs::Quaternion slerp(const geometry_msgs::Quaternion &a, const geometry_msgs::Quaternion &b,
+                                              const float ratio)
+{
+  float dot = a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+  float sign = 1.0f;
+  if (dot < 0.0f)
+  {
+    dot = -dot;
+    sign = -1.0f;
+  }
+
+  float wa = 1.0f - ratio;
+  float wb = ratio;
+  if (dot < 0.9995f)
+  {
+    /* nearly parallel quaternions are interpolated linearly instead */
+    const float theta = fastAtan2(sqrtf(1.0f - dot * dot), dot);
+    const float inv_sin = 1.0f / fastSin(theta);
+    wa = fastSin(wa * theta) * inv_sin;
+    wb = fastSin(wb * theta) * inv_sin;
+  }
+  wb *= sign;
+
+  geometry_msgs::Quaternion q;
+  q.x = wa * a.x + wb * b.x;
+  q.y = wa * a.y + wb * b.y;
+  q.z = wa * a.z + wb * b.z;
+  q.w = wa * a.w + wb * b.w;
+  return normalize(q);
+}
+
+/*
+ * Rotation matrices, row major
+ */
+
+static inline void toMatrix(const geometry_msgs::Quaternion &q, float m[9])
+{
+  const float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+  const float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+  const float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+  m[0] = 1.0f - 2.0f * (yy + zz);
+  m[1] = 2.0f * (xy - wz);
+  m[2] = 2.0f * (xz + wy);
+  m[3] = 2.0f * (xy + wz);
+  m[4] = 1.0f - 2.0f * (xx + zz);
+  m[5] = 2.0f * (yz - wx);
+  m[6] = 2.0f * (xz - wy);
+  m[7] = 2.0f * (yz + wx);
+  m[8] = 1.0f - 2.0f * (xx + yy);
+}
+
+/* Quaternion of a rotation matrix, computed from the largest of w, x, y and
+ * z to stay accurate for all rotations */
+static inline geometry_msgs::Quaternion fromMatrix(const float m[9])
+{
+  geometry_msgs::Quaternion q;
+  const float trace = m[0] + m[4] + m[8];
+
+  if (trace > 0.0f)
+  {
+    const float s = 0.5f / sqrtf(trace + 1.0f);
+    q.w = 0.25f / s;
+    q.x = (m[7] - m[5]) * s;
+    q.y = (m[2] - m[6]) * s;
+    q.z = (m[3] - m[1]) * s;
+  }
+  else if ((m[0] > m[4]) && (m[0] > m[8]))
+  {
+    const float s = 2.0f * sqrtf(1.0f + m[0] - m[4] - m[8]);
+    q.w = (m[7] - m[5]) / s;
+    q.x = 0.25f * s;
+    q.y = (m[1] + m[3]) / s;
+    q.z = (m[2] + m[6]) / s;
+  }
+  else if (m[4] > m[8])
+  {
+    const float s = 2.0f * sqrtf(1.0f + m[4] - m[0] - m[8]);
+    q.w = (m[2] - m[6]) / s;
+    q.x = (m[1] + m[3]) / s;
+    q.y = 0.25f * s;
+    q.z = (m[5] + m[7]) / s;
+  }
+  else
+  {
+    const float s = 2.0f * sqrtf(1.0f + m[8] - m[0] - m[4]);
+    q.w = (m[3] - m[1]) / s;
+    q.x = (m[2] + m[6]) / s;
+    q.y = (m[5] + m[7]) / s;
+    q.z = 0.25f * s;
+  }
+  return q;
+}
+
+/*
+ * Transforms
+ */
+
+/* Transform a point from the child into the parent frame of t */
+static inline geometry_msgs::Vector3 transformPoint(const geometry_msgs::Transform &t, const geometry_msgs::Vector3 &p)
+{
+  geometry_msgs::Vector3 r = rotate(t.rotation, p);
+  r.x += t.translation.x;
+  r.y += t.translation.y;
+  r.z += t.translation.z;
+  return r;
+}
+
+/* a * b: transform from the child frame of b into the parent frame of a */
+static inline geometry_msgs::Transform compose(const geometry_msgs::Transform &a, const geometry_msgs::Transform &b)
+{
+  geometry_msgs::Transform r;
+  r.translation = transformPoint(a, b.translation);
+  r.rotation = multiply(a.rotation, b.rotation);
+  return r;
+}
+
+static inline geometry_msgs::Transform inverse(const geometry_msgs::Transform &t)
+{
+  geometry_msgs::Transform r;
+  r.rotation = inverse(t.rotation);
+  r.translation = rotate(r.rotation, t.translation);
+  r.translation.x = -r.translation.x;
+  r.translation.y = -r.translation.y;
+  r.translation.z = -r.translation.z;
+  return r;
+}
+
+}
+
+#endif /* ROS_TF_MATH_H_ */
@@ -0,0 +1,322 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file transform_buffer.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Transform buffer with interpolated lookups on the MCU
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef ROS_TRANSFORM_BUFFER_H_
+#define ROS_TRANSFORM_BUFFER_H_
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdint.h>
+#include <string.h>
+
+#include "ros/node_handle.h"
+#include "ros/time.h"
+#include "geometry_msgs/Transform.h"
+#include "tf/tfMessage.h"
+#include "tf/tf_math.h"
+/* -------------------------------------------------------------------------------*/
+
+namespace tf
+{
+
+/* Transform Buffer Configuration -----------------------------------------------*/
+const int TF_BUFFER_FRAME_ID_LEN = 32;  // maximum frame id length incl. terminating zero
+/* -------------------------------------------------------------------------------*/
+
+/**
+ * @brief Fixed size store of the transforms between pairs of frames
+ *
+ * For every parent/child pair the last HISTORY transforms are kept in a
+ * ring ordered by time. lookupTransform() interpolates between the two
+ * transforms around the requested time: linearly for the translation,
+ * SLERP for the rotation. Transforms received on /tf_static are kept once
+ * and valid for all times.
+ *
+ * Lookups guess the ring position from the time span of the ring, so they
+ * take constant time for transforms published at a steady rate. Resolve the
+ * pair once with findPair() to avoid comparing frame ids at control rate.
+ *
+ * @tparam MAX_PAIRS  Maximum number of parent/child pairs
+ * @tparam HISTORY    Number of transforms kept per pair
+ */
+template<int MAX_PAIRS = 8, int HISTORY = 8>
+class TransformBuffer
+{
+public:
+  TransformBuffer() :
+    tf_sub_("/tf", &TransformBuffer::tfCallback, this),
+    tf_static_sub_("/tf_static", &TransformBuffer::tfStaticCallback, this),
+    pairs_length_(0)
+  {
+  }
+
+  /* Feed the buffer from /tf and /tf_static of the given node handle */
+  template<typename NodeHandleT>
+  bool subscribe(NodeHandleT &nh)
+  {
+    return nh.subscribe(tf_sub_) && nh.subscribe(tf_static_sub_);
+  }
+
+  /**
+   * @brief Add a transform to the ring of its frame pair
+   *
+   * @return false if the frame ids are too long or all pairs are in use
+   */
+  bool setTransform(const geometry_msgs::TransformStamped &transform, const bool is_static = false)
+  {
+    int pair = findPair(transform.header.frame_id, transform.child_frame_id);
+    if (pair < 0)
+      pair = addPair(transform.header.frame_id, transform.child_frame_id);
+    if (pair < 0)
+      return false;
+
+    Pair &p = pairs_[pair];
+    Entry entry;
+    entry.stamp = transform.header.stamp;
+    entry.t[0] = transform.transform.translation.x;
+    entry.t[1] = transform.transform.translation.y;
+    entry.t[2] = transform.transform.translation.z;
+    entry.q = transform.transform.rotation;
+
+    p.is_static = is_static;
+    if (is_static)
+    {
+      p.first = 0;
+      p.length = 1;
+      p.entries[0] = entry;
+      return true;
+    }
+
+    insert(p, entry);
+    return true;
+  }
+
+  /* Add all transforms of a tf message */
+  void setTransforms(const tf::tfMessage &msg, const bool is_static = false)
+  {
+    for (uint32_t i = 0; i < msg.transforms_length; i++)
+      setTransform(msg.transforms[i], is_static);
+  }
+
+  /* Index of a frame pair for lookupTransform(), -1 if unknown */
+  int findPair(const char *parent, const char *child) const
+  {
+    for (int i = 0; i < pairs_length_; i++)
+    {
+      if ((strcmp(pairs_[i].parent, parent) == 0) && (strcmp(pairs_[i].child, child) == 0))
+        return i;
+    }
+    return -1;
+  }
+
+  /**
+   * @brief Transform from the child into the parent frame at the given time
+   *
+   * A zero time returns the latest transform. Times outside of the ring
+   * are not extrapolated.
+   *
+   * @return false if the pair is unknown or the time is not covered
+   */
+  bool lookupTransform(const int pair, const ros::Time &time, geometry_msgs::Transform &transform) const
+  {
+    if ((pair < 0) || (pair >= pairs_length_) || (pairs_[pair].length == 0))
+      return false;
+
+    const Pair &p = pairs_[pair];
+    const Entry &newest = at(p, p.length - 1);
+
+    if (p.is_static || ((time.sec == 0) && (time.nsec == 0)))
+    {
+      toTransform(newest, newest, 0.0f, transform);
+      return true;
+    }
+
+    const Entry &oldest = at(p, 0);
+    const int64_t span = diffNs(newest.stamp, oldest.stamp);
+    const int64_t offset = diffNs(time, oldest.stamp);
+    if ((offset < 0) || (offset > span))
+      return false;
+
+    if (span == 0)
+    {
+      toTransform(newest, newest, 0.0f, transform);
+      return true;
+    }
+
+    /* Guess the position assuming equally spaced stamps, then correct */
+    int idx = (int)(((float) offset / (float) span) * (float)(p.length - 1));
+    if (idx > p.length - 2)
+      idx = p.length - 2;
+    while ((idx > 0) && (diffNs(time, at(p, idx).stamp) < 0))
+      idx--;
+    while ((idx < p.length - 2) && (diffNs(time, at(p, idx + 1).stamp) > 0))
+      idx++;
+
+    const Entry &a = at(p, idx);
+    const Entry &b = at(p, idx + 1);
+    const int64_t ab = diffNs(b.stamp, a.stamp);
+    const float ratio = (ab > 0) ? ((float) diffNs(time, a.stamp) / (float) ab) : 0.0f;
+
+    toTransform(a, b, ratio, transform);
+    return true;
+  }
+
+  bool lookupTransform(const char *parent, const char *child, const ros::Time &time,
+                       geometry_msgs::Transform &transform) const
+  {
+    return lookupTransform(findPair(parent, child), time, transform);
+  }
+
+  /* Forget all transforms, e.g. when the time jumped back */
+  void clear()
+  {
+    for (int i = 0; i < pairs_length_; i++)
+      pairs_[i].length = 0;
+  }
+
+private:
+  struct Entry
+  {
+    ros::Time stamp;
+    float t[3];         // translation x, y, z
+    geometry_msgs::Quaternion q;
+  };
+
+  struct Pair
+  {
+    char parent[TF_BUFFER_FRAME_ID_LEN];
+    char child[TF_BUFFER_FRAME_ID_LEN];
+    Entry entries[HISTORY];
+    int first;          // ring index of the oldest entry
+    int length;
+    bool is_static;
+  };
+
+  static int64_t diffNs(const ros::Time &a, const ros::Time &b)
+  {
+    return ((int64_t) a.sec - (int64_t) b.sec) * 1000000000LL + ((int64_t) a.nsec - (int64_t) b.nsec);
+  }
+
+  static const Entry &at(const Pair &p, const int idx)
+  {
+    return p.entries[(p.first + idx) % HISTORY];
+  }
+
+  static Entry &at(Pair &p, const int idx)
+  {
+    return p.entries[(p.first + idx) % HISTORY];
+  }
+
+  int addPair(const char *parent, const char *child)
+  {
+    if ((pairs_length_ >= MAX_PAIRS) ||
+        (strlen(parent) >= TF_BUFFER_FRAME_ID_LEN) || (strlen(child) >= TF_BUFFER_FRAME_ID_LEN))
+      return -1;
+
+    Pair &p = pairs_[pairs_length_];
+    strcpy(p.parent, parent);
+    strcpy(p.child, child);
+    p.first = 0;
+    p.length = 0;
+    p.is_static = false;
+    return pairs_length_++;
+  }
+
+  /* Insert keeping the ring sorted by time, dropping the oldest entry when
+   * full. Transforms normally arrive in order and are appended. */
+  static void insert(Pair &p, const Entry &entry)
+  {
+    int pos = p.length;
+    while ((pos > 0) && (diffNs(entry.stamp, at(p, pos - 1).stamp) <= 0))
+      pos--;
+
+    if ((pos < p.length) && (diffNs(entry.stamp, at(p, pos).stamp) == 0))
+    {
+      at(p, pos) = entry;
+      return;
+    }
+
+    if (p.length == HISTORY)
+    {
+      if (pos == 0)
+        return; // older than everything kept
+      p.first = (p.first + 1) % HISTORY;
+      p.length--;
+      pos--;
+    }
+
+    for (int i = p.length; i > pos; i--)
+      at(p, i) = at(p, i - 1);
+    at(p, pos) = entry;
+    p.length++;
+  }
+
+  /* Interpolate between two entries, ratio 0 gives a and 1 gives b */
+  static void toTransform(const Entry &a, const Entry &b, const float ratio, geometry_msgs::Transform &transform)
+  {
+    transform.translation.x = a.t[0] + (b.t[0] - a.t[0]) * ratio;
+    transform.translation.y = a.t[1] + (b.t[1] - a.t[1]) * ratio;
+    transform.translation.z = a.t[2] + (b.t[2] - a.t[2]) * ratio;
+    transform.rotation = tf::slerp(a.q, b.q, ratio);
+  }
+
+  void tfCallback(const tf::tfMessage &msg)
+  {
+    setTransforms(msg, false);
+  }
+
+  void tfStaticCallback(const tf::tfMessage &msg)
+  {
+    setTransforms(msg, true);
+  }
+
+  ros::Subscriber<tf::tfMessage, TransformBuffer> tf_sub_;
+  ros::Subscriber<tf::tfMessage, TransformBuffer> tf_static_sub_;
+
+  Pair pairs_[MAX_PAIRS];
+  int pairs_length_;
+};
+
+}
+
+#endif /* ROS_TRANSFORM_BUFFER_H_ */
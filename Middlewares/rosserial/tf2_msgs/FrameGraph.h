@@ -20,16 +20,32 @@ static const char FRAMEGRAPH[] = "tf2_msgs/FrameGraph";
 
     virtual int serialize(unsigned char *outbuffer) const
     {
+      (void) outbuffer;
       int offset = 0;
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
+      (void) inbuffer;
       int offset = 0;
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return FrameGraphRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      (void) size;
+      return offset;
+    }
+
     const char * getType(){ return FRAMEGRAPH; };
     const char * getMD5(){ return "d41d8cd98f00b204e9800998ecf8427e"; };
 
@@ -49,29 +65,30 @@ static const char FRAMEGRAPH[] = "tf2_msgs/FrameGraph";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_frame_yaml = strlen(this->frame_yaml);
-      varToArr(outbuffer + offset, length_frame_yaml);
-      offset += 4;
-      memcpy(outbuffer + offset, this->frame_yaml, length_frame_yaml);
-      offset += length_frame_yaml;
+      offset += encodeString(outbuffer + offset, this->frame_yaml);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_frame_yaml;
-      arrToVar(length_frame_yaml, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_frame_yaml; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_frame_yaml-1]=0;
-      this->frame_yaml = (char *)(inbuffer + offset-1);
-      offset += length_frame_yaml;
+      offset += decodeString(inbuffer + offset, this->frame_yaml);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return FrameGraphResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return FRAMEGRAPH; };
     const char * getMD5(){ return "437ea58e9463815a0d511c7326b686b0"; };
 
@@ -41,6 +41,20 @@ namespace tf2_msgs
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return LookupTransformResult::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->transform.wireLength(inbuffer, offset, size);
+      offset = this->error.wireLength(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "tf2_msgs/LookupTransformResult"; };
     const char * getMD5(){ return "3fe5db6a19ca9cfb675418c5ad875c36"; };
 
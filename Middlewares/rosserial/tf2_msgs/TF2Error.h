@@ -33,33 +33,33 @@ namespace tf2_msgs
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->error >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->error);
-      uint32_t length_error_string = strlen(this->error_string);
-      varToArr(outbuffer + offset, length_error_string);
-      offset += 4;
-      memcpy(outbuffer + offset, this->error_string, length_error_string);
-      offset += length_error_string;
+      offset += encode(outbuffer + offset, this->error);
+      offset += encodeString(outbuffer + offset, this->error_string);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      this->error =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->error);
-      uint32_t length_error_string;
-      arrToVar(length_error_string, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_error_string; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_error_string-1]=0;
-      this->error_string = (char *)(inbuffer + offset-1);
-      offset += length_error_string;
+      offset += decode(inbuffer + offset, this->error);
+      offset += decodeString(inbuffer + offset, this->error_string);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return TF2Error::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkip(offset, size, 1);
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "tf2_msgs/TF2Error"; };
     const char * getMD5(){ return "bc6848fd6fd750c92e38575618a4917d"; };
 
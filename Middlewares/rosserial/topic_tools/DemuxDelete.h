@@ -24,29 +24,30 @@ static const char DEMUXDELETE[] = "topic_tools/DemuxDelete";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_topic = strlen(this->topic);
-      varToArr(outbuffer + offset, length_topic);
-      offset += 4;
-      memcpy(outbuffer + offset, this->topic, length_topic);
-      offset += length_topic;
+      offset += encodeString(outbuffer + offset, this->topic);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_topic;
-      arrToVar(length_topic, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_topic; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_topic-1]=0;
-      this->topic = (char *)(inbuffer + offset-1);
-      offset += length_topic;
+      offset += decodeString(inbuffer + offset, this->topic);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return DemuxDeleteRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return DEMUXDELETE; };
     const char * getMD5(){ return "d8f94bae31b356b24d0427f80426d0c3"; };
 
@@ -62,16 +63,32 @@ static const char DEMUXDELETE[] = "topic_tools/DemuxDelete";
 
     virtual int serialize(unsigned char *outbuffer) const
     {
+      (void) outbuffer;
       int offset = 0;
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
+      (void) inbuffer;
       int offset = 0;
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return DemuxDeleteResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      (void) size;
+      return offset;
+    }
+
     const char * getType(){ return DEMUXDELETE; };
     const char * getMD5(){ return "d41d8cd98f00b204e9800998ecf8427e"; };
 
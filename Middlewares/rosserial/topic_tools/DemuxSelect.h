@@ -24,29 +24,30 @@ static const char DEMUXSELECT[] = "topic_tools/DemuxSelect";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_topic = strlen(this->topic);
-      varToArr(outbuffer + offset, length_topic);
-      offset += 4;
-      memcpy(outbuffer + offset, this->topic, length_topic);
-      offset += length_topic;
+      offset += encodeString(outbuffer + offset, this->topic);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_topic;
-      arrToVar(length_topic, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_topic; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_topic-1]=0;
-      this->topic = (char *)(inbuffer + offset-1);
-      offset += length_topic;
+      offset += decodeString(inbuffer + offset, this->topic);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return DemuxSelectRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return DEMUXSELECT; };
     const char * getMD5(){ return "d8f94bae31b356b24d0427f80426d0c3"; };
 
@@ -66,29 +67,30 @@ static const char DEMUXSELECT[] = "topic_tools/DemuxSelect";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_prev_topic = strlen(this->prev_topic);
-      varToArr(outbuffer + offset, length_prev_topic);
-      offset += 4;
-      memcpy(outbuffer + offset, this->prev_topic, length_prev_topic);
-      offset += length_prev_topic;
+      offset += encodeString(outbuffer + offset, this->prev_topic);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_prev_topic;
-      arrToVar(length_prev_topic, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_prev_topic; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_prev_topic-1]=0;
-      this->prev_topic = (char *)(inbuffer + offset-1);
-      offset += length_prev_topic;
+      offset += decodeString(inbuffer + offset, this->prev_topic);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return DemuxSelectResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return DEMUXSELECT; };
     const char * getMD5(){ return "3db0a473debdbafea387c9e49358c320"; };
 
@@ -20,16 +20,32 @@ static const char MUXLIST[] = "topic_tools/MuxList";
 
     virtual int serialize(unsigned char *outbuffer) const
     {
+      (void) outbuffer;
       int offset = 0;
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
+      (void) inbuffer;
       int offset = 0;
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return MuxListRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      (void) size;
+      return offset;
+    }
+
     const char * getType(){ return MUXLIST; };
     const char * getMD5(){ return "d41d8cd98f00b204e9800998ecf8427e"; };
 
@@ -51,47 +67,30 @@ static const char MUXLIST[] = "topic_tools/MuxList";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->topics_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->topics_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->topics_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->topics_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->topics_length);
-      for( uint32_t i = 0; i < topics_length; i++){
-      uint32_t length_topicsi = strlen(this->topics[i]);
-      varToArr(outbuffer + offset, length_topicsi);
-      offset += 4;
-      memcpy(outbuffer + offset, this->topics[i], length_topicsi);
-      offset += length_topicsi;
-      }
+      offset += encodeStringArray(outbuffer + offset, this->topics, this->topics_length);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t topics_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      topics_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      topics_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      topics_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->topics_length);
-      if(topics_lengthT > topics_length)
-        this->topics = (char**)realloc(this->topics, topics_lengthT * sizeof(char*));
-      topics_length = topics_lengthT;
-      for( uint32_t i = 0; i < topics_length; i++){
-      uint32_t length_st_topics;
-      arrToVar(length_st_topics, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_topics; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_topics-1]=0;
-      this->st_topics = (char *)(inbuffer + offset-1);
-      offset += length_st_topics;
-        memcpy( &(this->topics[i]), &(this->st_topics), sizeof(char*));
-      }
+      offset += decodeStringArray(inbuffer + offset, this->topics, this->topics_length);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return MuxListResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipStringArray(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return MUXLIST; };
     const char * getMD5(){ return "b0eef9a05d4e829092fc2f2c3c2aad3d"; };
 
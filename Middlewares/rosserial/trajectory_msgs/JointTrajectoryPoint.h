@@ -44,115 +44,44 @@ namespace trajectory_msgs
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->positions_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->positions_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->positions_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->positions_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->positions_length);
-      for( uint32_t i = 0; i < positions_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->positions[i]);
-      }
-      *(outbuffer + offset + 0) = (this->velocities_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->velocities_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->velocities_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->velocities_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->velocities_length);
-      for( uint32_t i = 0; i < velocities_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->velocities[i]);
-      }
-      *(outbuffer + offset + 0) = (this->accelerations_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->accelerations_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->accelerations_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->accelerations_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->accelerations_length);
-      for( uint32_t i = 0; i < accelerations_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->accelerations[i]);
-      }
-      *(outbuffer + offset + 0) = (this->effort_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->effort_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->effort_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->effort_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->effort_length);
-      for( uint32_t i = 0; i < effort_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->effort[i]);
-      }
-      *(outbuffer + offset + 0) = (this->time_from_start.sec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->time_from_start.sec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->time_from_start.sec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->time_from_start.sec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->time_from_start.sec);
-      *(outbuffer + offset + 0) = (this->time_from_start.nsec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->time_from_start.nsec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->time_from_start.nsec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->time_from_start.nsec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->time_from_start.nsec);
+      offset += encodeFloat64Array(outbuffer + offset, this->positions, this->positions_length);
+      offset += encodeFloat64Array(outbuffer + offset, this->velocities, this->velocities_length);
+      offset += encodeFloat64Array(outbuffer + offset, this->accelerations, this->accelerations_length);
+      offset += encodeFloat64Array(outbuffer + offset, this->effort, this->effort_length);
+      offset += encode(outbuffer + offset, this->time_from_start.sec);
+      offset += encode(outbuffer + offset, this->time_from_start.nsec);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t positions_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      positions_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      positions_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      positions_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->positions_length);
-      if(positions_lengthT > positions_length)
-        this->positions = (float*)realloc(this->positions, positions_lengthT * sizeof(float));
-      positions_length = positions_lengthT;
-      for( uint32_t i = 0; i < positions_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_positions));
-        memcpy( &(this->positions[i]), &(this->st_positions), sizeof(float));
-      }
-      uint32_t velocities_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      velocities_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      velocities_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      velocities_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->velocities_length);
-      if(velocities_lengthT > velocities_length)
-        this->velocities = (float*)realloc(this->velocities, velocities_lengthT * sizeof(float));
-      velocities_length = velocities_lengthT;
-      for( uint32_t i = 0; i < velocities_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_velocities));
-        memcpy( &(this->velocities[i]), &(this->st_velocities), sizeof(float));
-      }
-      uint32_t accelerations_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      accelerations_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      accelerations_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      accelerations_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->accelerations_length);
-      if(accelerations_lengthT > accelerations_length)
-        this->accelerations = (float*)realloc(this->accelerations, accelerations_lengthT * sizeof(float));
-      accelerations_length = accelerations_lengthT;
-      for( uint32_t i = 0; i < accelerations_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_accelerations));
-        memcpy( &(this->accelerations[i]), &(this->st_accelerations), sizeof(float));
-      }
-      uint32_t effort_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      effort_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      effort_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      effort_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->effort_length);
-      if(effort_lengthT > effort_length)
-        this->effort = (float*)realloc(this->effort, effort_lengthT * sizeof(float));
-      effort_length = effort_lengthT;
-      for( uint32_t i = 0; i < effort_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_effort));
-        memcpy( &(this->effort[i]), &(this->st_effort), sizeof(float));
-      }
-      this->time_from_start.sec =  ((uint32_t) (*(inbuffer + offset)));
-      this->time_from_start.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->time_from_start.sec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->time_from_start.sec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->time_from_start.sec);
-      this->time_from_start.nsec =  ((uint32_t) (*(inbuffer + offset)));
-      this->time_from_start.nsec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->time_from_start.nsec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->time_from_start.nsec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->time_from_start.nsec);
+      offset += decodeFloat64Array(inbuffer + offset, this->positions, this->positions_length);
+      offset += decodeFloat64Array(inbuffer + offset, this->velocities, this->velocities_length);
+      offset += decodeFloat64Array(inbuffer + offset, this->accelerations, this->accelerations_length);
+      offset += decodeFloat64Array(inbuffer + offset, this->effort, this->effort_length);
+      offset += decode(inbuffer + offset, this->time_from_start.sec);
+      offset += decode(inbuffer + offset, this->time_from_start.nsec);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return JointTrajectoryPoint::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipArray(inbuffer, offset, size, 8);
+      offset = wireSkipArray(inbuffer, offset, size, 8);
+      offset = wireSkipArray(inbuffer, offset, size, 8);
+      offset = wireSkipArray(inbuffer, offset, size, 8);
+      offset = wireSkip(offset, size, 8);
+      return offset;
+    }
+
     const char * getType(){ return "trajectory_msgs/JointTrajectoryPoint"; };
     const char * getMD5(){ return "f3cd1e1c4d320c79d6985c904ae5dcd3"; };
 
@@ -16,14 +16,17 @@ namespace trajectory_msgs
   {
     public:
       uint32_t transforms_length;
+      uint32_t transforms_capacity;
       typedef geometry_msgs::Transform _transforms_type;
       _transforms_type st_transforms;
       _transforms_type * transforms;
       uint32_t velocities_length;
+      uint32_t velocities_capacity;
       typedef geometry_msgs::Twist _velocities_type;
       _velocities_type st_velocities;
       _velocities_type * velocities;
       uint32_t accelerations_length;
+      uint32_t accelerations_capacity;
       typedef geometry_msgs::Twist _accelerations_type;
       _accelerations_type st_accelerations;
       _accelerations_type * accelerations;
@@ -31,9 +34,9 @@ namespace trajectory_msgs
       _time_from_start_type time_from_start;
 
     MultiDOFJointTrajectoryPoint():
-      transforms_length(0), transforms(NULL),
-      velocities_length(0), velocities(NULL),
-      accelerations_length(0), accelerations(NULL),
+      transforms_length(0), transforms_capacity(0), transforms(NULL),
+      velocities_length(0), velocities_capacity(0), velocities(NULL),
+      accelerations_length(0), accelerations_capacity(0), accelerations(NULL),
       time_from_start()
     {
     }
@@ -41,93 +44,60 @@ namespace trajectory_msgs
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->transforms_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->transforms_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->transforms_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->transforms_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->transforms_length);
+      offset += encode(outbuffer + offset, this->transforms_length);
       for( uint32_t i = 0; i < transforms_length; i++){
       offset += this->transforms[i].serialize(outbuffer + offset);
       }
-      *(outbuffer + offset + 0) = (this->velocities_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->velocities_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->velocities_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->velocities_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->velocities_length);
+      offset += encode(outbuffer + offset, this->velocities_length);
       for( uint32_t i = 0; i < velocities_length; i++){
       offset += this->velocities[i].serialize(outbuffer + offset);
       }
-      *(outbuffer + offset + 0) = (this->accelerations_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->accelerations_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->accelerations_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->accelerations_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->accelerations_length);
+      offset += encode(outbuffer + offset, this->accelerations_length);
       for( uint32_t i = 0; i < accelerations_length; i++){
       offset += this->accelerations[i].serialize(outbuffer + offset);
       }
-      *(outbuffer + offset + 0) = (this->time_from_start.sec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->time_from_start.sec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->time_from_start.sec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->time_from_start.sec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->time_from_start.sec);
-      *(outbuffer + offset + 0) = (this->time_from_start.nsec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->time_from_start.nsec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->time_from_start.nsec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->time_from_start.nsec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->time_from_start.nsec);
+      offset += encode(outbuffer + offset, this->time_from_start.sec);
+      offset += encode(outbuffer + offset, this->time_from_start.nsec);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t transforms_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      transforms_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      transforms_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      transforms_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->transforms_length);
-      if(transforms_lengthT > transforms_length)
-        this->transforms = (geometry_msgs::Transform*)realloc(this->transforms, transforms_lengthT * sizeof(geometry_msgs::Transform));
-      transforms_length = transforms_lengthT;
-      for( uint32_t i = 0; i < transforms_length; i++){
-      offset += this->st_transforms.deserialize(inbuffer + offset);
-        memcpy( &(this->transforms[i]), &(this->st_transforms), sizeof(geometry_msgs::Transform));
+      offset += decodeMsgArray(inbuffer + offset, this->transforms, this->transforms_length, this->transforms_capacity);
+      offset += decodeMsgArray(inbuffer + offset, this->velocities, this->velocities_length, this->velocities_capacity);
+      offset += decodeMsgArray(inbuffer + offset, this->accelerations, this->accelerations_length, this->accelerations_capacity);
+      offset += decode(inbuffer + offset, this->time_from_start.sec);
+      offset += decode(inbuffer + offset, this->time_from_start.nsec);
+     return offset;
+    }
+
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return MultiDOFJointTrajectoryPoint::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      uint32_t transforms_lengthT;
+      offset = wireCount(inbuffer, offset, size, transforms_lengthT, 56);
+      for( uint32_t i = 0; (i < transforms_lengthT) && (offset >= 0); i++){
+        offset = this->st_transforms.wireLength(inbuffer, offset, size);
       }
-      uint32_t velocities_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      velocities_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      velocities_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      velocities_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->velocities_length);
-      if(velocities_lengthT > velocities_length)
-        this->velocities = (geometry_msgs::Twist*)realloc(this->velocities, velocities_lengthT * sizeof(geometry_msgs::Twist));
-      velocities_length = velocities_lengthT;
-      for( uint32_t i = 0; i < velocities_length; i++){
-      offset += this->st_velocities.deserialize(inbuffer + offset);
-        memcpy( &(this->velocities[i]), &(this->st_velocities), sizeof(geometry_msgs::Twist));
+      uint32_t velocities_lengthT;
+      offset = wireCount(inbuffer, offset, size, velocities_lengthT, 48);
+      for( uint32_t i = 0; (i < velocities_lengthT) && (offset >= 0); i++){
+        offset = this->st_velocities.wireLength(inbuffer, offset, size);
       }
-      uint32_t accelerations_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      accelerations_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      accelerations_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      accelerations_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->accelerations_length);
-      if(accelerations_lengthT > accelerations_length)
-        this->accelerations = (geometry_msgs::Twist*)realloc(this->accelerations, accelerations_lengthT * sizeof(geometry_msgs::Twist));
-      accelerations_length = accelerations_lengthT;
-      for( uint32_t i = 0; i < accelerations_length; i++){
-      offset += this->st_accelerations.deserialize(inbuffer + offset);
-        memcpy( &(this->accelerations[i]), &(this->st_accelerations), sizeof(geometry_msgs::Twist));
+      uint32_t accelerations_lengthT;
+      offset = wireCount(inbuffer, offset, size, accelerations_lengthT, 48);
+      for( uint32_t i = 0; (i < accelerations_lengthT) && (offset >= 0); i++){
+        offset = this->st_accelerations.wireLength(inbuffer, offset, size);
       }
-      this->time_from_start.sec =  ((uint32_t) (*(inbuffer + offset)));
-      this->time_from_start.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->time_from_start.sec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->time_from_start.sec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->time_from_start.sec);
-      this->time_from_start.nsec =  ((uint32_t) (*(inbuffer + offset)));
-      this->time_from_start.nsec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->time_from_start.nsec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->time_from_start.nsec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->time_from_start.nsec);
-     return offset;
+      offset = wireSkip(offset, size, 8);
+      return offset;
     }
 
     const char * getType(){ return "trajectory_msgs/MultiDOFJointTrajectoryPoint"; };
@@ -26,57 +26,33 @@ namespace turtle_actionlib
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_edges;
-      u_edges.real = this->edges;
-      *(outbuffer + offset + 0) = (u_edges.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_edges.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_edges.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_edges.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->edges);
-      union {
-        float real;
-        uint32_t base;
-      } u_radius;
-      u_radius.real = this->radius;
-      *(outbuffer + offset + 0) = (u_radius.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_radius.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_radius.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_radius.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->radius);
+      offset += encode(outbuffer + offset, this->edges);
+      offset += encode(outbuffer + offset, this->radius);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_edges;
-      u_edges.base = 0;
-      u_edges.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_edges.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_edges.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_edges.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->edges = u_edges.real;
-      offset += sizeof(this->edges);
-      union {
-        float real;
-        uint32_t base;
-      } u_radius;
-      u_radius.base = 0;
-      u_radius.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_radius.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_radius.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_radius.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->radius = u_radius.real;
-      offset += sizeof(this->radius);
+      offset += decode(inbuffer + offset, this->edges);
+      offset += decode(inbuffer + offset, this->radius);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return ShapeGoal::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 8);
+      return offset;
+    }
+
     const char * getType(){ return "turtle_actionlib/ShapeGoal"; };
     const char * getMD5(){ return "3b9202ab7292cebe5a95ab2bf6b9c091"; };
 
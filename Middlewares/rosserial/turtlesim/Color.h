@@ -29,27 +29,35 @@ namespace turtlesim
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->r >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->r);
-      *(outbuffer + offset + 0) = (this->g >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->g);
-      *(outbuffer + offset + 0) = (this->b >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->b);
+      offset += encode(outbuffer + offset, this->r);
+      offset += encode(outbuffer + offset, this->g);
+      offset += encode(outbuffer + offset, this->b);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      this->r =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->r);
-      this->g =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->g);
-      this->b =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->b);
+      offset += decode(inbuffer + offset, this->r);
+      offset += decode(inbuffer + offset, this->g);
+      offset += decode(inbuffer + offset, this->b);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return Color::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 3);
+      return offset;
+    }
+
     const char * getType(){ return "turtlesim/Color"; };
     const char * getMD5(){ return "353891e354491c51aabe32df673fb446"; };
 
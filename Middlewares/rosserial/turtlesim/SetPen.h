@@ -36,35 +36,39 @@ static const char SETPEN[] = "turtlesim/SetPen";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->r >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->r);
-      *(outbuffer + offset + 0) = (this->g >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->g);
-      *(outbuffer + offset + 0) = (this->b >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->b);
-      *(outbuffer + offset + 0) = (this->width >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->width);
-      *(outbuffer + offset + 0) = (this->off >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->off);
+      offset += encode(outbuffer + offset, this->r);
+      offset += encode(outbuffer + offset, this->g);
+      offset += encode(outbuffer + offset, this->b);
+      offset += encode(outbuffer + offset, this->width);
+      offset += encode(outbuffer + offset, this->off);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      this->r =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->r);
-      this->g =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->g);
-      this->b =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->b);
-      this->width =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->width);
-      this->off =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->off);
+      offset += decode(inbuffer + offset, this->r);
+      offset += decode(inbuffer + offset, this->g);
+      offset += decode(inbuffer + offset, this->b);
+      offset += decode(inbuffer + offset, this->width);
+      offset += decode(inbuffer + offset, this->off);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return SetPenRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 5);
+      return offset;
+    }
+
     const char * getType(){ return SETPEN; };
     const char * getMD5(){ return "9f452acce566bf0c0954594f69a8e41b"; };
 
@@ -80,16 +84,32 @@ static const char SETPEN[] = "turtlesim/SetPen";
 
     virtual int serialize(unsigned char *outbuffer) const
     {
+      (void) outbuffer;
       int offset = 0;
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
+      (void) inbuffer;
       int offset = 0;
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return SetPenResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      (void) size;
+      return offset;
+    }
+
     const char * getType(){ return SETPEN; };
     const char * getMD5(){ return "d41d8cd98f00b204e9800998ecf8427e"; };
 
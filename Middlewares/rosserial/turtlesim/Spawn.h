@@ -33,92 +33,37 @@ static const char SPAWN[] = "turtlesim/Spawn";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      union {
-        float real;
-        uint32_t base;
-      } u_x;
-      u_x.real = this->x;
-      *(outbuffer + offset + 0) = (u_x.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_x.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_x.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_x.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->x);
-      union {
-        float real;
-        uint32_t base;
-      } u_y;
-      u_y.real = this->y;
-      *(outbuffer + offset + 0) = (u_y.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_y.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_y.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_y.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->y);
-      union {
-        float real;
-        uint32_t base;
-      } u_theta;
-      u_theta.real = this->theta;
-      *(outbuffer + offset + 0) = (u_theta.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_theta.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_theta.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_theta.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->theta);
-      uint32_t length_name = strlen(this->name);
-      varToArr(outbuffer + offset, length_name);
-      offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
-      offset += length_name;
+      offset += encode(outbuffer + offset, this->x);
+      offset += encode(outbuffer + offset, this->y);
+      offset += encode(outbuffer + offset, this->theta);
+      offset += encodeString(outbuffer + offset, this->name);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      union {
-        float real;
-        uint32_t base;
-      } u_x;
-      u_x.base = 0;
-      u_x.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_x.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_x.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_x.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->x = u_x.real;
-      offset += sizeof(this->x);
-      union {
-        float real;
-        uint32_t base;
-      } u_y;
-      u_y.base = 0;
-      u_y.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_y.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_y.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_y.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->y = u_y.real;
-      offset += sizeof(this->y);
-      union {
-        float real;
-        uint32_t base;
-      } u_theta;
-      u_theta.base = 0;
-      u_theta.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_theta.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_theta.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_theta.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->theta = u_theta.real;
-      offset += sizeof(this->theta);
-      uint32_t length_name;
-      arrToVar(length_name, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
-      offset += length_name;
+      offset += decode(inbuffer + offset, this->x);
+      offset += decode(inbuffer + offset, this->y);
+      offset += decode(inbuffer + offset, this->theta);
+      offset += decodeString(inbuffer + offset, this->name);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return SpawnRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkip(offset, size, 12);
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return SPAWN; };
     const char * getMD5(){ return "57f001c49ab7b11d699f8606c1f4f7ff"; };
 
@@ -138,29 +83,30 @@ static const char SPAWN[] = "turtlesim/Spawn";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_name = strlen(this->name);
-      varToArr(outbuffer + offset, length_name);
-      offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
-      offset += length_name;
+      offset += encodeString(outbuffer + offset, this->name);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_name;
-      arrToVar(length_name, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
-      offset += length_name;
+      offset += decodeString(inbuffer + offset, this->name);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return SpawnResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return SPAWN; };
     const char * getMD5(){ return "c1f3d28f1b044c871e6eff2e9fc3c667"; };
 
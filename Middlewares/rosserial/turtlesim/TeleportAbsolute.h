@@ -30,78 +30,35 @@ static const char TELEPORTABSOLUTE[] = "turtlesim/TeleportAbsolute";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      union {
-        float real;
-        uint32_t base;
-      } u_x;
-      u_x.real = this->x;
-      *(outbuffer + offset + 0) = (u_x.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_x.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_x.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_x.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->x);
-      union {
-        float real;
-        uint32_t base;
-      } u_y;
-      u_y.real = this->y;
-      *(outbuffer + offset + 0) = (u_y.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_y.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_y.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_y.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->y);
-      union {
-        float real;
-        uint32_t base;
-      } u_theta;
-      u_theta.real = this->theta;
-      *(outbuffer + offset + 0) = (u_theta.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_theta.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_theta.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_theta.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->theta);
+      offset += encode(outbuffer + offset, this->x);
+      offset += encode(outbuffer + offset, this->y);
+      offset += encode(outbuffer + offset, this->theta);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      union {
-        float real;
-        uint32_t base;
-      } u_x;
-      u_x.base = 0;
-      u_x.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_x.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_x.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_x.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->x = u_x.real;
-      offset += sizeof(this->x);
-      union {
-        float real;
-        uint32_t base;
-      } u_y;
-      u_y.base = 0;
-      u_y.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_y.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_y.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_y.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->y = u_y.real;
-      offset += sizeof(this->y);
-      union {
-        float real;
-        uint32_t base;
-      } u_theta;
-      u_theta.base = 0;
-      u_theta.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_theta.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_theta.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_theta.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->theta = u_theta.real;
-      offset += sizeof(this->theta);
+      offset += decode(inbuffer + offset, this->x);
+      offset += decode(inbuffer + offset, this->y);
+      offset += decode(inbuffer + offset, this->theta);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return TeleportAbsoluteRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 12);
+      return offset;
+    }
+
     const char * getType(){ return TELEPORTABSOLUTE; };
     const char * getMD5(){ return "a130bc60ee6513855dc62ea83fcc5b20"; };
 
@@ -117,16 +74,32 @@ static const char TELEPORTABSOLUTE[] = "turtlesim/TeleportAbsolute";
 
     virtual int serialize(unsigned char *outbuffer) const
     {
+      (void) outbuffer;
       int offset = 0;
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
+      (void) inbuffer;
       int offset = 0;
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return TeleportAbsoluteResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      (void) size;
+      return offset;
+    }
+
     const char * getType(){ return TELEPORTABSOLUTE; };
     const char * getMD5(){ return "d41d8cd98f00b204e9800998ecf8427e"; };
 
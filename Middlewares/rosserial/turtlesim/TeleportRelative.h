@@ -27,57 +27,33 @@ static const char TELEPORTRELATIVE[] = "turtlesim/TeleportRelative";
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      union {
-        float real;
-        uint32_t base;
-      } u_linear;
-      u_linear.real = this->linear;
-      *(outbuffer + offset + 0) = (u_linear.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_linear.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_linear.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_linear.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->linear);
-      union {
-        float real;
-        uint32_t base;
-      } u_angular;
-      u_angular.real = this->angular;
-      *(outbuffer + offset + 0) = (u_angular.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_angular.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_angular.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_angular.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->angular);
+      offset += encode(outbuffer + offset, this->linear);
+      offset += encode(outbuffer + offset, this->angular);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      union {
-        float real;
-        uint32_t base;
-      } u_linear;
-      u_linear.base = 0;
-      u_linear.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_linear.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_linear.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_linear.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->linear = u_linear.real;
-      offset += sizeof(this->linear);
-      union {
-        float real;
-        uint32_t base;
-      } u_angular;
-      u_angular.base = 0;
-      u_angular.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_angular.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_angular.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_angular.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->angular = u_angular.real;
-      offset += sizeof(this->angular);
+      offset += decode(inbuffer + offset, this->linear);
+      offset += decode(inbuffer + offset, this->angular);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return TeleportRelativeRequest::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      offset = wireSkip(offset, size, 8);
+      return offset;
+    }
+
     const char * getType(){ return TELEPORTRELATIVE; };
     const char * getMD5(){ return "9d5c2dcd348ac8f76ce2a4307bd63a13"; };
 
@@ -93,16 +69,32 @@ static const char TELEPORTRELATIVE[] = "turtlesim/TeleportRelative";
 
     virtual int serialize(unsigned char *outbuffer) const
     {
+      (void) outbuffer;
       int offset = 0;
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
+      (void) inbuffer;
       int offset = 0;
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return TeleportRelativeResponse::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      (void) inbuffer;
+      (void) size;
+      return offset;
+    }
+
     const char * getType(){ return TELEPORTRELATIVE; };
     const char * getMD5(){ return "d41d8cd98f00b204e9800998ecf8427e"; };
 
@@ -39,10 +39,12 @@ namespace visualization_msgs
       typedef ros::Duration _lifetime_type;
       _lifetime_type lifetime;
       uint32_t points_length;
+      uint32_t points_capacity;
       typedef geometry_msgs::Point _points_type;
       _points_type st_points;
       _points_type * points;
       uint32_t outline_colors_length;
+      uint32_t outline_colors_capacity;
       typedef std_msgs::ColorRGBA _outline_colors_type;
       _outline_colors_type st_outline_colors;
       _outline_colors_type * outline_colors;
@@ -66,8 +68,8 @@ namespace visualization_msgs
       filled(0),
       fill_color(),
       lifetime(),
-      points_length(0), points(NULL),
-      outline_colors_length(0), outline_colors(NULL)
+      points_length(0), points_capacity(0), points(NULL),
+      outline_colors_length(0), outline_colors_capacity(0), outline_colors(NULL)
     {
     }
 
@@ -75,79 +77,22 @@ namespace visualization_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      uint32_t length_ns = strlen(this->ns);
-      varToArr(outbuffer + offset, length_ns);
-      offset += 4;
-      memcpy(outbuffer + offset, this->ns, length_ns);
-      offset += length_ns;
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_id;
-      u_id.real = this->id;
-      *(outbuffer + offset + 0) = (u_id.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_id.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_id.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_id.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->id);
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_type;
-      u_type.real = this->type;
-      *(outbuffer + offset + 0) = (u_type.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_type.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_type.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_type.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->type);
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_action;
-      u_action.real = this->action;
-      *(outbuffer + offset + 0) = (u_action.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_action.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_action.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_action.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->action);
+      offset += encodeString(outbuffer + offset, this->ns);
+      offset += encode(outbuffer + offset, this->id);
+      offset += encode(outbuffer + offset, this->type);
+      offset += encode(outbuffer + offset, this->action);
       offset += this->position.serialize(outbuffer + offset);
-      union {
-        float real;
-        uint32_t base;
-      } u_scale;
-      u_scale.real = this->scale;
-      *(outbuffer + offset + 0) = (u_scale.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_scale.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_scale.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_scale.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->scale);
+      offset += encode(outbuffer + offset, this->scale);
       offset += this->outline_color.serialize(outbuffer + offset);
-      *(outbuffer + offset + 0) = (this->filled >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->filled);
+      offset += encode(outbuffer + offset, this->filled);
       offset += this->fill_color.serialize(outbuffer + offset);
-      *(outbuffer + offset + 0) = (this->lifetime.sec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->lifetime.sec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->lifetime.sec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->lifetime.sec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->lifetime.sec);
-      *(outbuffer + offset + 0) = (this->lifetime.nsec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->lifetime.nsec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->lifetime.nsec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->lifetime.nsec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->lifetime.nsec);
-      *(outbuffer + offset + 0) = (this->points_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->points_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->points_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->points_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->points_length);
+      offset += encode(outbuffer + offset, this->lifetime.sec);
+      offset += encode(outbuffer + offset, this->lifetime.nsec);
+      offset += encode(outbuffer + offset, this->points_length);
       for( uint32_t i = 0; i < points_length; i++){
       offset += this->points[i].serialize(outbuffer + offset);
       }
-      *(outbuffer + offset + 0) = (this->outline_colors_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->outline_colors_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->outline_colors_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->outline_colors_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->outline_colors_length);
+      offset += encode(outbuffer + offset, this->outline_colors_length);
       for( uint32_t i = 0; i < outline_colors_length; i++){
       offset += this->outline_colors[i].serialize(outbuffer + offset);
       }
@@ -158,99 +103,51 @@ namespace visualization_msgs
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      uint32_t length_ns;
-      arrToVar(length_ns, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_ns; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_ns-1]=0;
-      this->ns = (char *)(inbuffer + offset-1);
-      offset += length_ns;
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_id;
-      u_id.base = 0;
-      u_id.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_id.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_id.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_id.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->id = u_id.real;
-      offset += sizeof(this->id);
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_type;
-      u_type.base = 0;
-      u_type.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_type.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_type.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_type.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->type = u_type.real;
-      offset += sizeof(this->type);
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_action;
-      u_action.base = 0;
-      u_action.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_action.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_action.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_action.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->action = u_action.real;
-      offset += sizeof(this->action);
+      offset += decodeString(inbuffer + offset, this->ns);
+      offset += decode(inbuffer + offset, this->id);
+      offset += decode(inbuffer + offset, this->type);
+      offset += decode(inbuffer + offset, this->action);
       offset += this->position.deserialize(inbuffer + offset);
-      union {
-        float real;
-        uint32_t base;
-      } u_scale;
-      u_scale.base = 0;
-      u_scale.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_scale.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_scale.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_scale.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->scale = u_scale.real;
-      offset += sizeof(this->scale);
+      offset += decode(inbuffer + offset, this->scale);
       offset += this->outline_color.deserialize(inbuffer + offset);
-      this->filled =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->filled);
+      offset += decode(inbuffer + offset, this->filled);
       offset += this->fill_color.deserialize(inbuffer + offset);
-      this->lifetime.sec =  ((uint32_t) (*(inbuffer + offset)));
-      this->lifetime.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->lifetime.sec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->lifetime.sec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->lifetime.sec);
-      this->lifetime.nsec =  ((uint32_t) (*(inbuffer + offset)));
-      this->lifetime.nsec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->lifetime.nsec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->lifetime.nsec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->lifetime.nsec);
-      uint32_t points_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      points_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      points_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      points_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->points_length);
-      if(points_lengthT > points_length)
-        this->points = (geometry_msgs::Point*)realloc(this->points, points_lengthT * sizeof(geometry_msgs::Point));
-      points_length = points_lengthT;
-      for( uint32_t i = 0; i < points_length; i++){
-      offset += this->st_points.deserialize(inbuffer + offset);
-        memcpy( &(this->points[i]), &(this->st_points), sizeof(geometry_msgs::Point));
+      offset += decode(inbuffer + offset, this->lifetime.sec);
+      offset += decode(inbuffer + offset, this->lifetime.nsec);
+      offset += decodeMsgArray(inbuffer + offset, this->points, this->points_length, this->points_capacity);
+      offset += decodeMsgArray(inbuffer + offset, this->outline_colors, this->outline_colors_length, this->outline_colors_capacity);
+     return offset;
+    }
+
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return ImageMarker::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 12);
+      offset = this->position.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 4);
+      offset = this->outline_color.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 1);
+      offset = this->fill_color.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 8);
+      uint32_t points_lengthT;
+      offset = wireCount(inbuffer, offset, size, points_lengthT, 24);
+      for( uint32_t i = 0; (i < points_lengthT) && (offset >= 0); i++){
+        offset = this->st_points.wireLength(inbuffer, offset, size);
       }
-      uint32_t outline_colors_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      outline_colors_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      outline_colors_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      outline_colors_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->outline_colors_length);
-      if(outline_colors_lengthT > outline_colors_length)
-        this->outline_colors = (std_msgs::ColorRGBA*)realloc(this->outline_colors, outline_colors_lengthT * sizeof(std_msgs::ColorRGBA));
-      outline_colors_length = outline_colors_lengthT;
-      for( uint32_t i = 0; i < outline_colors_length; i++){
-      offset += this->st_outline_colors.deserialize(inbuffer + offset);
-        memcpy( &(this->outline_colors[i]), &(this->st_outline_colors), sizeof(std_msgs::ColorRGBA));
+      uint32_t outline_colors_lengthT;
+      offset = wireCount(inbuffer, offset, size, outline_colors_lengthT, 16);
+      for( uint32_t i = 0; (i < outline_colors_lengthT) && (offset >= 0); i++){
+        offset = this->st_outline_colors.wireLength(inbuffer, offset, size);
       }
-     return offset;
+      return offset;
     }
 
     const char * getType(){ return "visualization_msgs/ImageMarker"; };
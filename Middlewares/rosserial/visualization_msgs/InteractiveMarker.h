@@ -27,10 +27,12 @@ namespace visualization_msgs
       typedef float _scale_type;
       _scale_type scale;
       uint32_t menu_entries_length;
+      uint32_t menu_entries_capacity;
       typedef visualization_msgs::MenuEntry _menu_entries_type;
       _menu_entries_type st_menu_entries;
       _menu_entries_type * menu_entries;
       uint32_t controls_length;
+      uint32_t controls_capacity;
       typedef visualization_msgs::InteractiveMarkerControl _controls_type;
       _controls_type st_controls;
       _controls_type * controls;
@@ -41,8 +43,8 @@ namespace visualization_msgs
       name(""),
       description(""),
       scale(0),
-      menu_entries_length(0), menu_entries(NULL),
-      controls_length(0), controls(NULL)
+      menu_entries_length(0), menu_entries_capacity(0), menu_entries(NULL),
+      controls_length(0), controls_capacity(0), controls(NULL)
     {
     }
 
@@ -51,39 +53,14 @@ namespace visualization_msgs
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
       offset += this->pose.serialize(outbuffer + offset);
-      uint32_t length_name = strlen(this->name);
-      varToArr(outbuffer + offset, length_name);
-      offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
-      offset += length_name;
-      uint32_t length_description = strlen(this->description);
-      varToArr(outbuffer + offset, length_description);
-      offset += 4;
-      memcpy(outbuffer + offset, this->description, length_description);
-      offset += length_description;
-      union {
-        float real;
-        uint32_t base;
-      } u_scale;
-      u_scale.real = this->scale;
-      *(outbuffer + offset + 0) = (u_scale.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_scale.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_scale.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_scale.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->scale);
-      *(outbuffer + offset + 0) = (this->menu_entries_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->menu_entries_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->menu_entries_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->menu_entries_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->menu_entries_length);
+      offset += encodeString(outbuffer + offset, this->name);
+      offset += encodeString(outbuffer + offset, this->description);
+      offset += encode(outbuffer + offset, this->scale);
+      offset += encode(outbuffer + offset, this->menu_entries_length);
       for( uint32_t i = 0; i < menu_entries_length; i++){
       offset += this->menu_entries[i].serialize(outbuffer + offset);
       }
-      *(outbuffer + offset + 0) = (this->controls_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->controls_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->controls_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->controls_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->controls_length);
+      offset += encode(outbuffer + offset, this->controls_length);
       for( uint32_t i = 0; i < controls_length; i++){
       offset += this->controls[i].serialize(outbuffer + offset);
       }
@@ -95,60 +72,39 @@ namespace visualization_msgs
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
       offset += this->pose.deserialize(inbuffer + offset);
-      uint32_t length_name;
-      arrToVar(length_name, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
-      offset += length_name;
-      uint32_t length_description;
-      arrToVar(length_description, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_description; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_description-1]=0;
-      this->description = (char *)(inbuffer + offset-1);
-      offset += length_description;
-      union {
-        float real;
-        uint32_t base;
-      } u_scale;
-      u_scale.base = 0;
-      u_scale.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_scale.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_scale.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_scale.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->scale = u_scale.real;
-      offset += sizeof(this->scale);
-      uint32_t menu_entries_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      menu_entries_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      menu_entries_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      menu_entries_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->menu_entries_length);
-      if(menu_entries_lengthT > menu_entries_length)
-        this->menu_entries = (visualization_msgs::MenuEntry*)realloc(this->menu_entries, menu_entries_lengthT * sizeof(visualization_msgs::MenuEntry));
-      menu_entries_length = menu_entries_lengthT;
-      for( uint32_t i = 0; i < menu_entries_length; i++){
-      offset += this->st_menu_entries.deserialize(inbuffer + offset);
-        memcpy( &(this->menu_entries[i]), &(this->st_menu_entries), sizeof(visualization_msgs::MenuEntry));
+      offset += decodeString(inbuffer + offset, this->name);
+      offset += decodeString(inbuffer + offset, this->description);
+      offset += decode(inbuffer + offset, this->scale);
+      offset += decodeMsgArray(inbuffer + offset, this->menu_entries, this->menu_entries_length, this->menu_entries_capacity);
+      offset += decodeMsgArray(inbuffer + offset, this->controls, this->controls_length, this->controls_capacity);
+     return offset;
+    }
+
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return InteractiveMarker::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = this->pose.wireLength(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 4);
+      uint32_t menu_entries_lengthT;
+      offset = wireCount(inbuffer, offset, size, menu_entries_lengthT, 17);
+      for( uint32_t i = 0; (i < menu_entries_lengthT) && (offset >= 0); i++){
+        offset = this->st_menu_entries.wireLength(inbuffer, offset, size);
       }
-      uint32_t controls_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      controls_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      controls_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      controls_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->controls_length);
-      if(controls_lengthT > controls_length)
-        this->controls = (visualization_msgs::InteractiveMarkerControl*)realloc(this->controls, controls_lengthT * sizeof(visualization_msgs::InteractiveMarkerControl));
-      controls_length = controls_lengthT;
-      for( uint32_t i = 0; i < controls_length; i++){
-      offset += this->st_controls.deserialize(inbuffer + offset);
-        memcpy( &(this->controls[i]), &(this->st_controls), sizeof(visualization_msgs::InteractiveMarkerControl));
+      uint32_t controls_lengthT;
+      offset = wireCount(inbuffer, offset, size, controls_lengthT, 48);
+      for( uint32_t i = 0; (i < controls_lengthT) && (offset >= 0); i++){
+        offset = this->st_controls.wireLength(inbuffer, offset, size);
       }
-     return offset;
+      return offset;
     }
 
     const char * getType(){ return "visualization_msgs/InteractiveMarker"; };
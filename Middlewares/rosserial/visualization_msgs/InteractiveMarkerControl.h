@@ -25,6 +25,7 @@ namespace visualization_msgs
       typedef bool _always_visible_type;
       _always_visible_type always_visible;
       uint32_t markers_length;
+      uint32_t markers_capacity;
       typedef visualization_msgs::Marker _markers_type;
       _markers_type st_markers;
       _markers_type * markers;
@@ -52,7 +53,7 @@ namespace visualization_msgs
       orientation_mode(0),
       interaction_mode(0),
       always_visible(0),
-      markers_length(0), markers(NULL),
+      markers_length(0), markers_capacity(0), markers(NULL),
       independent_marker_orientation(0),
       description("")
     {
@@ -61,103 +62,56 @@ namespace visualization_msgs
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_name = strlen(this->name);
-      varToArr(outbuffer + offset, length_name);
-      offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
-      offset += length_name;
+      offset += encodeString(outbuffer + offset, this->name);
       offset += this->orientation.serialize(outbuffer + offset);
-      *(outbuffer + offset + 0) = (this->orientation_mode >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->orientation_mode);
-      *(outbuffer + offset + 0) = (this->interaction_mode >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->interaction_mode);
-      union {
-        bool real;
-        uint8_t base;
-      } u_always_visible;
-      u_always_visible.real = this->always_visible;
-      *(outbuffer + offset + 0) = (u_always_visible.base >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->always_visible);
-      *(outbuffer + offset + 0) = (this->markers_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->markers_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->markers_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->markers_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->markers_length);
+      offset += encode(outbuffer + offset, this->orientation_mode);
+      offset += encode(outbuffer + offset, this->interaction_mode);
+      offset += encode(outbuffer + offset, this->always_visible);
+      offset += encode(outbuffer + offset, this->markers_length);
       for( uint32_t i = 0; i < markers_length; i++){
       offset += this->markers[i].serialize(outbuffer + offset);
       }
-      union {
-        bool real;
-        uint8_t base;
-      } u_independent_marker_orientation;
-      u_independent_marker_orientation.real = this->independent_marker_orientation;
-      *(outbuffer + offset + 0) = (u_independent_marker_orientation.base >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->independent_marker_orientation);
-      uint32_t length_description = strlen(this->description);
-      varToArr(outbuffer + offset, length_description);
-      offset += 4;
-      memcpy(outbuffer + offset, this->description, length_description);
-      offset += length_description;
+      offset += encode(outbuffer + offset, this->independent_marker_orientation);
+      offset += encodeString(outbuffer + offset, this->description);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_name;
-      arrToVar(length_name, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
-      offset += length_name;
+      offset += decodeString(inbuffer + offset, this->name);
       offset += this->orientation.deserialize(inbuffer + offset);
-      this->orientation_mode =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->orientation_mode);
-      this->interaction_mode =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->interaction_mode);
-      union {
-        bool real;
-        uint8_t base;
-      } u_always_visible;
-      u_always_visible.base = 0;
-      u_always_visible.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      this->always_visible = u_always_visible.real;
-      offset += sizeof(this->always_visible);
-      uint32_t markers_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      markers_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      markers_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      markers_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->markers_length);
-      if(markers_lengthT > markers_length)
-        this->markers = (visualization_msgs::Marker*)realloc(this->markers, markers_lengthT * sizeof(visualization_msgs::Marker));
-      markers_length = markers_lengthT;
-      for( uint32_t i = 0; i < markers_length; i++){
-      offset += this->st_markers.deserialize(inbuffer + offset);
-        memcpy( &(this->markers[i]), &(this->st_markers), sizeof(visualization_msgs::Marker));
-      }
-      union {
-        bool real;
-        uint8_t base;
-      } u_independent_marker_orientation;
-      u_independent_marker_orientation.base = 0;
-      u_independent_marker_orientation.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      this->independent_marker_orientation = u_independent_marker_orientation.real;
-      offset += sizeof(this->independent_marker_orientation);
-      uint32_t length_description;
-      arrToVar(length_description, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_description; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_description-1]=0;
-      this->description = (char *)(inbuffer + offset-1);
-      offset += length_description;
+      offset += decode(inbuffer + offset, this->orientation_mode);
+      offset += decode(inbuffer + offset, this->interaction_mode);
+      offset += decode(inbuffer + offset, this->always_visible);
+      offset += decodeMsgArray(inbuffer + offset, this->markers, this->markers_length, this->markers_capacity);
+      offset += decode(inbuffer + offset, this->independent_marker_orientation);
+      offset += decodeString(inbuffer + offset, this->description);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return InteractiveMarkerControl::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = this->orientation.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 3);
+      uint32_t markers_lengthT;
+      offset = wireCount(inbuffer, offset, size, markers_lengthT, 154);
+      for( uint32_t i = 0; (i < markers_lengthT) && (offset >= 0); i++){
+        offset = this->st_markers.wireLength(inbuffer, offset, size);
+      }
+      offset = wireSkip(offset, size, 1);
+      offset = wireSkipString(inbuffer, offset, size);
+      return offset;
+    }
+
     const char * getType(){ return "visualization_msgs/InteractiveMarkerControl"; };
     const char * getMD5(){ return "b3c81e785788195d1840b86c28da1aac"; };
 
@@ -57,37 +57,14 @@ namespace visualization_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      uint32_t length_client_id = strlen(this->client_id);
-      varToArr(outbuffer + offset, length_client_id);
-      offset += 4;
-      memcpy(outbuffer + offset, this->client_id, length_client_id);
-      offset += length_client_id;
-      uint32_t length_marker_name = strlen(this->marker_name);
-      varToArr(outbuffer + offset, length_marker_name);
-      offset += 4;
-      memcpy(outbuffer + offset, this->marker_name, length_marker_name);
-      offset += length_marker_name;
-      uint32_t length_control_name = strlen(this->control_name);
-      varToArr(outbuffer + offset, length_control_name);
-      offset += 4;
-      memcpy(outbuffer + offset, this->control_name, length_control_name);
-      offset += length_control_name;
-      *(outbuffer + offset + 0) = (this->event_type >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->event_type);
+      offset += encodeString(outbuffer + offset, this->client_id);
+      offset += encodeString(outbuffer + offset, this->marker_name);
+      offset += encodeString(outbuffer + offset, this->control_name);
+      offset += encode(outbuffer + offset, this->event_type);
       offset += this->pose.serialize(outbuffer + offset);
-      *(outbuffer + offset + 0) = (this->menu_entry_id >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->menu_entry_id >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->menu_entry_id >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->menu_entry_id >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->menu_entry_id);
+      offset += encode(outbuffer + offset, this->menu_entry_id);
       offset += this->mouse_point.serialize(outbuffer + offset);
-      union {
-        bool real;
-        uint8_t base;
-      } u_mouse_point_valid;
-      u_mouse_point_valid.real = this->mouse_point_valid;
-      *(outbuffer + offset + 0) = (u_mouse_point_valid.base >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->mouse_point_valid);
+      offset += encode(outbuffer + offset, this->mouse_point_valid);
       return offset;
     }
 
@@ -95,53 +72,38 @@ namespace visualization_msgs
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      uint32_t length_client_id;
-      arrToVar(length_client_id, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_client_id; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_client_id-1]=0;
-      this->client_id = (char *)(inbuffer + offset-1);
-      offset += length_client_id;
-      uint32_t length_marker_name;
-      arrToVar(length_marker_name, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_marker_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_marker_name-1]=0;
-      this->marker_name = (char *)(inbuffer + offset-1);
-      offset += length_marker_name;
-      uint32_t length_control_name;
-      arrToVar(length_control_name, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_control_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_control_name-1]=0;
-      this->control_name = (char *)(inbuffer + offset-1);
-      offset += length_control_name;
-      this->event_type =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->event_type);
+      offset += decodeString(inbuffer + offset, this->client_id);
+      offset += decodeString(inbuffer + offset, this->marker_name);
+      offset += decodeString(inbuffer + offset, this->control_name);
+      offset += decode(inbuffer + offset, this->event_type);
       offset += this->pose.deserialize(inbuffer + offset);
-      this->menu_entry_id =  ((uint32_t) (*(inbuffer + offset)));
-      this->menu_entry_id |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->menu_entry_id |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->menu_entry_id |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->menu_entry_id);
+      offset += decode(inbuffer + offset, this->menu_entry_id);
       offset += this->mouse_point.deserialize(inbuffer + offset);
-      union {
-        bool real;
-        uint8_t base;
-      } u_mouse_point_valid;
-      u_mouse_point_valid.base = 0;
-      u_mouse_point_valid.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      this->mouse_point_valid = u_mouse_point_valid.real;
-      offset += sizeof(this->mouse_point_valid);
+      offset += decode(inbuffer + offset, this->mouse_point_valid);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return InteractiveMarkerFeedback::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 1);
+      offset = this->pose.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 4);
+      offset = this->mouse_point.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 1);
+      return offset;
+    }
+
     const char * getType(){ return "visualization_msgs/InteractiveMarkerFeedback"; };
     const char * getMD5(){ return "ab0f1eee058667e28c19ff3ffc3f4b78"; };
 
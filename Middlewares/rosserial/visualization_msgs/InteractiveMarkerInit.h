@@ -18,6 +18,7 @@ namespace visualization_msgs
       typedef uint64_t _seq_num_type;
       _seq_num_type seq_num;
       uint32_t markers_length;
+      uint32_t markers_capacity;
       typedef visualization_msgs::InteractiveMarker _markers_type;
       _markers_type st_markers;
       _markers_type * markers;
@@ -25,32 +26,16 @@ namespace visualization_msgs
     InteractiveMarkerInit():
       server_id(""),
       seq_num(0),
-      markers_length(0), markers(NULL)
+      markers_length(0), markers_capacity(0), markers(NULL)
     {
     }
 
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      uint32_t length_server_id = strlen(this->server_id);
-      varToArr(outbuffer + offset, length_server_id);
-      offset += 4;
-      memcpy(outbuffer + offset, this->server_id, length_server_id);
-      offset += length_server_id;
-      *(outbuffer + offset + 0) = (this->seq_num >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->seq_num >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->seq_num >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->seq_num >> (8 * 3)) & 0xFF;
-      *(outbuffer + offset + 4) = (this->seq_num >> (8 * 4)) & 0xFF;
-      *(outbuffer + offset + 5) = (this->seq_num >> (8 * 5)) & 0xFF;
-      *(outbuffer + offset + 6) = (this->seq_num >> (8 * 6)) & 0xFF;
-      *(outbuffer + offset + 7) = (this->seq_num >> (8 * 7)) & 0xFF;
-      offset += sizeof(this->seq_num);
-      *(outbuffer + offset + 0) = (this->markers_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->markers_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->markers_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->markers_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->markers_length);
+      offset += encodeString(outbuffer + offset, this->server_id);
+      offset += encode(outbuffer + offset, this->seq_num);
+      offset += encode(outbuffer + offset, this->markers_length);
       for( uint32_t i = 0; i < markers_length; i++){
       offset += this->markers[i].serialize(outbuffer + offset);
       }
@@ -60,39 +45,31 @@ namespace visualization_msgs
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t length_server_id;
-      arrToVar(length_server_id, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_server_id; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_server_id-1]=0;
-      this->server_id = (char *)(inbuffer + offset-1);
-      offset += length_server_id;
-      this->seq_num =  ((uint64_t) (*(inbuffer + offset)));
-      this->seq_num |= ((uint64_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->seq_num |= ((uint64_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->seq_num |= ((uint64_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->seq_num |= ((uint64_t) (*(inbuffer + offset + 4))) << (8 * 4);
-      this->seq_num |= ((uint64_t) (*(inbuffer + offset + 5))) << (8 * 5);
-      this->seq_num |= ((uint64_t) (*(inbuffer + offset + 6))) << (8 * 6);
-      this->seq_num |= ((uint64_t) (*(inbuffer + offset + 7))) << (8 * 7);
-      offset += sizeof(this->seq_num);
-      uint32_t markers_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      markers_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      markers_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      markers_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->markers_length);
-      if(markers_lengthT > markers_length)
-        this->markers = (visualization_msgs::InteractiveMarker*)realloc(this->markers, markers_lengthT * sizeof(visualization_msgs::InteractiveMarker));
-      markers_length = markers_lengthT;
-      for( uint32_t i = 0; i < markers_length; i++){
-      offset += this->st_markers.deserialize(inbuffer + offset);
-        memcpy( &(this->markers[i]), &(this->st_markers), sizeof(visualization_msgs::InteractiveMarker));
-      }
+      offset += decodeString(inbuffer + offset, this->server_id);
+      offset += decode(inbuffer + offset, this->seq_num);
+      offset += decodeMsgArray(inbuffer + offset, this->markers, this->markers_length, this->markers_capacity);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return InteractiveMarkerInit::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 8);
+      uint32_t markers_lengthT;
+      offset = wireCount(inbuffer, offset, size, markers_lengthT, 92);
+      for( uint32_t i = 0; (i < markers_lengthT) && (offset >= 0); i++){
+        offset = this->st_markers.wireLength(inbuffer, offset, size);
+      }
+      return offset;
+    }
+
     const char * getType(){ return "visualization_msgs/InteractiveMarkerInit"; };
     const char * getMD5(){ return "d5f2c5045a72456d228676ab91048734"; };
 
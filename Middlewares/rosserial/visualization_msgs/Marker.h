@@ -39,10 +39,12 @@ namespace visualization_msgs
       typedef bool _frame_locked_type;
       _frame_locked_type frame_locked;
       uint32_t points_length;
+      uint32_t points_capacity;
       typedef geometry_msgs::Point _points_type;
       _points_type st_points;
       _points_type * points;
       uint32_t colors_length;
+      uint32_t colors_capacity;
       typedef std_msgs::ColorRGBA _colors_type;
       _colors_type st_colors;
       _colors_type * colors;
@@ -80,8 +82,8 @@ namespace visualization_msgs
       color(),
       lifetime(),
       frame_locked(0),
-      points_length(0), points(NULL),
-      colors_length(0), colors(NULL),
+      points_length(0), points_capacity(0), points(NULL),
+      colors_length(0), colors_capacity(0), colors(NULL),
       text(""),
       mesh_resource(""),
       mesh_use_embedded_materials(0)
@@ -92,94 +94,27 @@ namespace visualization_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      uint32_t length_ns = strlen(this->ns);
-      varToArr(outbuffer + offset, length_ns);
-      offset += 4;
-      memcpy(outbuffer + offset, this->ns, length_ns);
-      offset += length_ns;
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_id;
-      u_id.real = this->id;
-      *(outbuffer + offset + 0) = (u_id.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_id.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_id.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_id.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->id);
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_type;
-      u_type.real = this->type;
-      *(outbuffer + offset + 0) = (u_type.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_type.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_type.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_type.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->type);
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_action;
-      u_action.real = this->action;
-      *(outbuffer + offset + 0) = (u_action.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_action.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_action.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_action.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->action);
+      offset += encodeString(outbuffer + offset, this->ns);
+      offset += encode(outbuffer + offset, this->id);
+      offset += encode(outbuffer + offset, this->type);
+      offset += encode(outbuffer + offset, this->action);
       offset += this->pose.serialize(outbuffer + offset);
       offset += this->scale.serialize(outbuffer + offset);
       offset += this->color.serialize(outbuffer + offset);
-      *(outbuffer + offset + 0) = (this->lifetime.sec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->lifetime.sec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->lifetime.sec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->lifetime.sec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->lifetime.sec);
-      *(outbuffer + offset + 0) = (this->lifetime.nsec >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->lifetime.nsec >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->lifetime.nsec >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->lifetime.nsec >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->lifetime.nsec);
-      union {
-        bool real;
-        uint8_t base;
-      } u_frame_locked;
-      u_frame_locked.real = this->frame_locked;
-      *(outbuffer + offset + 0) = (u_frame_locked.base >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->frame_locked);
-      *(outbuffer + offset + 0) = (this->points_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->points_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->points_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->points_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->points_length);
+      offset += encode(outbuffer + offset, this->lifetime.sec);
+      offset += encode(outbuffer + offset, this->lifetime.nsec);
+      offset += encode(outbuffer + offset, this->frame_locked);
+      offset += encode(outbuffer + offset, this->points_length);
       for( uint32_t i = 0; i < points_length; i++){
       offset += this->points[i].serialize(outbuffer + offset);
       }
-      *(outbuffer + offset + 0) = (this->colors_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->colors_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->colors_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->colors_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->colors_length);
+      offset += encode(outbuffer + offset, this->colors_length);
       for( uint32_t i = 0; i < colors_length; i++){
       offset += this->colors[i].serialize(outbuffer + offset);
       }
-      uint32_t length_text = strlen(this->text);
-      varToArr(outbuffer + offset, length_text);
-      offset += 4;
-      memcpy(outbuffer + offset, this->text, length_text);
-      offset += length_text;
-      uint32_t length_mesh_resource = strlen(this->mesh_resource);
-      varToArr(outbuffer + offset, length_mesh_resource);
-      offset += 4;
-      memcpy(outbuffer + offset, this->mesh_resource, length_mesh_resource);
-      offset += length_mesh_resource;
-      union {
-        bool real;
-        uint8_t base;
-      } u_mesh_use_embedded_materials;
-      u_mesh_use_embedded_materials.real = this->mesh_use_embedded_materials;
-      *(outbuffer + offset + 0) = (u_mesh_use_embedded_materials.base >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->mesh_use_embedded_materials);
+      offset += encodeString(outbuffer + offset, this->text);
+      offset += encodeString(outbuffer + offset, this->mesh_resource);
+      offset += encode(outbuffer + offset, this->mesh_use_embedded_materials);
       return offset;
     }
 
@@ -187,120 +122,54 @@ namespace visualization_msgs
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      uint32_t length_ns;
-      arrToVar(length_ns, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_ns; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_ns-1]=0;
-      this->ns = (char *)(inbuffer + offset-1);
-      offset += length_ns;
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_id;
-      u_id.base = 0;
-      u_id.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_id.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_id.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_id.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->id = u_id.real;
-      offset += sizeof(this->id);
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_type;
-      u_type.base = 0;
-      u_type.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_type.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_type.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_type.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->type = u_type.real;
-      offset += sizeof(this->type);
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_action;
-      u_action.base = 0;
-      u_action.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_action.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_action.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_action.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->action = u_action.real;
-      offset += sizeof(this->action);
+      offset += decodeString(inbuffer + offset, this->ns);
+      offset += decode(inbuffer + offset, this->id);
+      offset += decode(inbuffer + offset, this->type);
+      offset += decode(inbuffer + offset, this->action);
       offset += this->pose.deserialize(inbuffer + offset);
       offset += this->scale.deserialize(inbuffer + offset);
       offset += this->color.deserialize(inbuffer + offset);
-      this->lifetime.sec =  ((uint32_t) (*(inbuffer + offset)));
-      this->lifetime.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->lifetime.sec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->lifetime.sec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->lifetime.sec);
-      this->lifetime.nsec =  ((uint32_t) (*(inbuffer + offset)));
-      this->lifetime.nsec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->lifetime.nsec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->lifetime.nsec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->lifetime.nsec);
-      union {
-        bool real;
-        uint8_t base;
-      } u_frame_locked;
-      u_frame_locked.base = 0;
-      u_frame_locked.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      this->frame_locked = u_frame_locked.real;
-      offset += sizeof(this->frame_locked);
-      uint32_t points_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      points_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      points_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      points_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->points_length);
-      if(points_lengthT > points_length)
-        this->points = (geometry_msgs::Point*)realloc(this->points, points_lengthT * sizeof(geometry_msgs::Point));
-      points_length = points_lengthT;
-      for( uint32_t i = 0; i < points_length; i++){
-      offset += this->st_points.deserialize(inbuffer + offset);
-        memcpy( &(this->points[i]), &(this->st_points), sizeof(geometry_msgs::Point));
-      }
-      uint32_t colors_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      colors_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      colors_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      colors_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->colors_length);
-      if(colors_lengthT > colors_length)
-        this->colors = (std_msgs::ColorRGBA*)realloc(this->colors, colors_lengthT * sizeof(std_msgs::ColorRGBA));
-      colors_length = colors_lengthT;
-      for( uint32_t i = 0; i < colors_length; i++){
-      offset += this->st_colors.deserialize(inbuffer + offset);
-        memcpy( &(this->colors[i]), &(this->st_colors), sizeof(std_msgs::ColorRGBA));
-      }
-      uint32_t length_text;
-      arrToVar(length_text, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_text; ++k){
-          inbuffer[k-1]=inbuffer[k];
+      offset += decode(inbuffer + offset, this->lifetime.sec);
+      offset += decode(inbuffer + offset, this->lifetime.nsec);
+      offset += decode(inbuffer + offset, this->frame_locked);
+      offset += decodeMsgArray(inbuffer + offset, this->points, this->points_length, this->points_capacity);
+      offset += decodeMsgArray(inbuffer + offset, this->colors, this->colors_length, this->colors_capacity);
+      offset += decodeString(inbuffer + offset, this->text);
+      offset += decodeString(inbuffer + offset, this->mesh_resource);
+      offset += decode(inbuffer + offset, this->mesh_use_embedded_materials);
+     return offset;
+    }
+
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return Marker::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = this->header.wireLength(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 12);
+      offset = this->pose.wireLength(inbuffer, offset, size);
+      offset = this->scale.wireLength(inbuffer, offset, size);
+      offset = this->color.wireLength(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 9);
+      uint32_t points_lengthT;
+      offset = wireCount(inbuffer, offset, size, points_lengthT, 24);
+      for( uint32_t i = 0; (i < points_lengthT) && (offset >= 0); i++){
+        offset = this->st_points.wireLength(inbuffer, offset, size);
       }
-      inbuffer[offset+length_text-1]=0;
-      this->text = (char *)(inbuffer + offset-1);
-      offset += length_text;
-      uint32_t length_mesh_resource;
-      arrToVar(length_mesh_resource, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_mesh_resource; ++k){
-          inbuffer[k-1]=inbuffer[k];
+      uint32_t colors_lengthT;
+      offset = wireCount(inbuffer, offset, size, colors_lengthT, 16);
+      for( uint32_t i = 0; (i < colors_lengthT) && (offset >= 0); i++){
+        offset = this->st_colors.wireLength(inbuffer, offset, size);
       }
-      inbuffer[offset+length_mesh_resource-1]=0;
-      this->mesh_resource = (char *)(inbuffer + offset-1);
-      offset += length_mesh_resource;
-      union {
-        bool real;
-        uint8_t base;
-      } u_mesh_use_embedded_materials;
-      u_mesh_use_embedded_materials.base = 0;
-      u_mesh_use_embedded_materials.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      this->mesh_use_embedded_materials = u_mesh_use_embedded_materials.real;
-      offset += sizeof(this->mesh_use_embedded_materials);
-     return offset;
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 1);
+      return offset;
     }
 
     const char * getType(){ return "visualization_msgs/Marker"; };
@@ -14,23 +14,20 @@ namespace visualization_msgs
   {
     public:
       uint32_t markers_length;
+      uint32_t markers_capacity;
       typedef visualization_msgs::Marker _markers_type;
       _markers_type st_markers;
       _markers_type * markers;
 
     MarkerArray():
-      markers_length(0), markers(NULL)
+      markers_length(0), markers_capacity(0), markers(NULL)
     {
     }
 
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->markers_length >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->markers_length >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->markers_length >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->markers_length >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->markers_length);
+      offset += encode(outbuffer + offset, this->markers_length);
       for( uint32_t i = 0; i < markers_length; i++){
       offset += this->markers[i].serialize(outbuffer + offset);
       }
@@ -40,21 +37,27 @@ namespace visualization_msgs
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      uint32_t markers_lengthT = ((uint32_t) (*(inbuffer + offset))); 
-      markers_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
-      markers_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
-      markers_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
-      offset += sizeof(this->markers_length);
-      if(markers_lengthT > markers_length)
-        this->markers = (visualization_msgs::Marker*)realloc(this->markers, markers_lengthT * sizeof(visualization_msgs::Marker));
-      markers_length = markers_lengthT;
-      for( uint32_t i = 0; i < markers_length; i++){
-      offset += this->st_markers.deserialize(inbuffer + offset);
-        memcpy( &(this->markers[i]), &(this->st_markers), sizeof(visualization_msgs::Marker));
-      }
+      offset += decodeMsgArray(inbuffer + offset, this->markers, this->markers_length, this->markers_capacity);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return MarkerArray::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      uint32_t markers_lengthT;
+      offset = wireCount(inbuffer, offset, size, markers_lengthT, 154);
+      for( uint32_t i = 0; (i < markers_lengthT) && (offset >= 0); i++){
+        offset = this->st_markers.wireLength(inbuffer, offset, size);
+      }
+      return offset;
+    }
+
     const char * getType(){ return "visualization_msgs/MarkerArray"; };
     const char * getMD5(){ return "d155b9ce5188fbaf89745847fd5882d7"; };
 
@@ -38,67 +38,41 @@ namespace visualization_msgs
     virtual int serialize(unsigned char *outbuffer) const
     {
       int offset = 0;
-      *(outbuffer + offset + 0) = (this->id >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->id >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->id >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->id >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->id);
-      *(outbuffer + offset + 0) = (this->parent_id >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->parent_id >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->parent_id >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->parent_id >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->parent_id);
-      uint32_t length_title = strlen(this->title);
-      varToArr(outbuffer + offset, length_title);
-      offset += 4;
-      memcpy(outbuffer + offset, this->title, length_title);
-      offset += length_title;
-      uint32_t length_command = strlen(this->command);
-      varToArr(outbuffer + offset, length_command);
-      offset += 4;
-      memcpy(outbuffer + offset, this->command, length_command);
-      offset += length_command;
-      *(outbuffer + offset + 0) = (this->command_type >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->command_type);
+      offset += encode(outbuffer + offset, this->id);
+      offset += encode(outbuffer + offset, this->parent_id);
+      offset += encodeString(outbuffer + offset, this->title);
+      offset += encodeString(outbuffer + offset, this->command);
+      offset += encode(outbuffer + offset, this->command_type);
       return offset;
     }
 
     virtual int deserialize(unsigned char *inbuffer)
     {
       int offset = 0;
-      this->id =  ((uint32_t) (*(inbuffer + offset)));
-      this->id |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->id |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->id |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->id);
-      this->parent_id =  ((uint32_t) (*(inbuffer + offset)));
-      this->parent_id |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->parent_id |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->parent_id |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->parent_id);
-      uint32_t length_title;
-      arrToVar(length_title, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_title; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_title-1]=0;
-      this->title = (char *)(inbuffer + offset-1);
-      offset += length_title;
-      uint32_t length_command;
-      arrToVar(length_command, (inbuffer + offset));
-      offset += 4;
-      for(unsigned int k= offset; k< offset+length_command; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_command-1]=0;
-      this->command = (char *)(inbuffer + offset-1);
-      offset += length_command;
-      this->command_type =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->command_type);
+      offset += decode(inbuffer + offset, this->id);
+      offset += decode(inbuffer + offset, this->parent_id);
+      offset += decodeString(inbuffer + offset, this->title);
+      offset += decodeString(inbuffer + offset, this->command);
+      offset += decode(inbuffer + offset, this->command_type);
      return offset;
     }
 
+    int deserialize(unsigned char *inbuffer, size_t size)
+    {
+      if (wireLength(inbuffer, 0, size) < 0)
+        return -1;
+      return MenuEntry::deserialize(inbuffer);
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      offset = wireSkip(offset, size, 8);
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkipString(inbuffer, offset, size);
+      offset = wireSkip(offset, size, 1);
+      return offset;
+    }
+
     const char * getType(){ return "visualization_msgs/MenuEntry"; };
     const char * getMD5(){ return "b90ec63024573de83b57aa93eb39be2d"; };
 
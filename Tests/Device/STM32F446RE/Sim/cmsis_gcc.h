@@ -43,6 +43,9 @@
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 #endif
 
+/* Simulated priority mask, interrupts are dispatched by sim_nvic.c */
+extern uint32_t SIM_PRIMASK;
+
 
 /* ###########################  Core Function Access  ########################### */
 /** \ingroup  CMSIS_Core_FunctionInterface
@@ -58,6 +61,7 @@
 __attribute__( ( always_inline ) ) __STATIC_INLINE void __enable_irq(void)
 {
   //__ASM volatile ("cpsie i" : : : "memory");
+  SIM_PRIMASK = 0U;
 }
 
 
@@ -69,6 +73,7 @@ __attribute__( ( always_inline ) ) __STATIC_INLINE void __enable_irq(void)
 __attribute__( ( always_inline ) ) __STATIC_INLINE void __disable_irq(void)
 {
   //__ASM volatile ("cpsid i" : : : "memory");
+  SIM_PRIMASK = 1U;
 }
 
 
@@ -201,6 +206,7 @@ __attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __get_PRIMASK(void)
   uint32_t result;
 
   //__ASM volatile ("MRS %0, primask" : "=r" (result) );
+  result = SIM_PRIMASK;
   return(result);
 }
 
@@ -213,6 +219,7 @@ __attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __get_PRIMASK(void)
 __attribute__( ( always_inline ) ) __STATIC_INLINE void __set_PRIMASK(uint32_t priMask)
 {
   //__ASM volatile ("MSR primask, %0" : : "r" (priMask) : "memory");
+  SIM_PRIMASK = priMask & 1U;
 }
 
 
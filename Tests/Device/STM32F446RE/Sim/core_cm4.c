@@ -9,4 +9,6 @@ NVIC_Type       SIM_NVIC_BASE;
 ITM_Type        SIM_ITM_BASE;
 DWT_Type        SIM_DWT_BASE;
 TPI_Type        SIM_TPI_BASE;
-CoreDebug_Type  SIM_CoreDebug_BASE;
\ No newline at end of file
+CoreDebug_Type  SIM_CoreDebug_BASE;
+
+uint32_t        SIM_PRIMASK;
@@ -0,0 +1,213 @@
+#include <time.h>
+
+#include "stm32f4xx_hal.h"
+#include "sim_clock.h"
+#include "sim_context.h"
+#include "sim_dma.h"
+#include "sim_nvic.h"
+#include "sim_usart.h"
+
+extern void SysTick_Handler(void);
+extern __IO uint32_t uwTick;
+
+static uint64_t SIM_HostNs(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void SIM_SysTickAdvance(uint64_t cycles)
+{
+  uint64_t ticks;
+
+  if ((SysTick->CTRL & SysTick_CTRL_ENABLE_Msk) == 0U)
+  {
+    return;
+  }
+
+  if ((SysTick->CTRL & SysTick_CTRL_CLKSOURCE_Msk) != 0U)
+  {
+    ticks = cycles;
+  }
+  else
+  {
+    ticks = (cycles + sim_context->clock.systick_rem) / 8U;
+    sim_context->clock.systick_rem = (uint32_t)((cycles + sim_context->clock.systick_rem) % 8U);
+  }
+
+  while ((ticks > 0U) && ((SysTick->CTRL & SysTick_CTRL_ENABLE_Msk) != 0U))
+  {
+    const uint32_t val = SysTick->VAL & SysTick_VAL_CURRENT_Msk;
+    uint64_t step;
+
+    /* the tick after reaching 0 reloads the counter */
+    if (val == 0U)
+    {
+      SysTick->VAL = SysTick->LOAD & SysTick_LOAD_RELOAD_Msk;
+      ticks--;
+      if (SysTick->VAL == 0U)
+      {
+        /* counter stops with a reload value of 0 */
+        break;
+      }
+      continue;
+    }
+
+    step = (ticks < val) ? ticks : val;
+    SysTick->VAL = val - (uint32_t)step;
+    ticks -= step;
+
+    if (SysTick->VAL == 0U)
+    {
+      SysTick->CTRL |= SysTick_CTRL_COUNTFLAG_Msk;
+      if ((SysTick->CTRL & SysTick_CTRL_TICKINT_Msk) != 0U)
+      {
+        SysTick_Handler();
+      }
+    }
+  }
+}
+
+static void SIM_TimAdvance(uint64_t cycles)
+{
+  uint32_t i;
+
+  for (i = 0U; i < sizeof(SIM_TIM) / sizeof(SIM_TIM[0]); i++)
+  {
+    TIM_TypeDef *tim = &SIM_TIM[i];
+    const uint64_t prescaler = (uint64_t)tim->PSC + 1U;
+    const uint64_t period = (uint64_t)tim->ARR + 1U;
+    uint64_t counts;
+
+    if (((tim->CR1 & TIM_CR1_CEN) == 0U) || (tim->ARR == 0U))
+    {
+      continue;
+    }
+
+    counts = (cycles + sim_context->clock.tim_rem[i]) / prescaler;
+    sim_context->clock.tim_rem[i] = (uint32_t)((cycles + sim_context->clock.tim_rem[i]) % prescaler);
+
+    counts += tim->CNT;
+    if (counts >= period)
+    {
+      tim->SR |= TIM_SR_UIF;
+    }
+    tim->CNT = (uint32_t)(counts % period);
+  }
+}
+
+void SIM_ClockReset(void)
+{
+  uint32_t i;
+
+  sim_context->clock.cycles = 0U;
+  sim_context->clock.systick_rem = 0U;
+  for (i = 0U; i < sizeof(sim_context->clock.tim_rem) / sizeof(sim_context->clock.tim_rem[0]); i++)
+  {
+    sim_context->clock.tim_rem[i] = 0U;
+  }
+  sim_context->clock.real_time = 0;
+  uwTick = 0U;
+}
+
+void SIM_ClockAdvance(uint64_t cycles)
+{
+  /* effects of register writes since the last call take no time */
+  SIM_NvicDispatch();
+
+  /* step from event to event so that handlers see every character and
+   * every memory to memory transfer flag */
+  while (cycles > 0U)
+  {
+    const uint64_t usart = SIM_UsartNextEvent();
+    const uint64_t dma = SIM_DmaNextEvent();
+    const uint64_t next = (usart < dma) ? usart : dma;
+    const uint64_t step = (next < cycles) ? next : cycles;
+
+    sim_context->clock.cycles += step;
+    if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) != 0U)
+    {
+      DWT->CYCCNT += (uint32_t)step;
+    }
+    SIM_TimAdvance(step);
+    SIM_SysTickAdvance(step);
+    SIM_UsartAdvance(step);
+    SIM_DmaAdvance(step);
+    SIM_NvicDispatch();
+
+    cycles -= step;
+  }
+}
+
+void SIM_ClockAdvanceUs(uint64_t us)
+{
+  SIM_ClockAdvance(us * SystemCoreClock / 1000000U);
+}
+
+void SIM_ClockAdvanceMs(uint32_t ms)
+{
+  SIM_ClockAdvance((uint64_t)ms * SystemCoreClock / 1000U);
+}
+
+uint64_t SIM_ClockGetCycles(void)
+{
+  return sim_context->clock.cycles;
+}
+
+void SIM_ClockSetRealTime(int enable)
+{
+  sim_context->clock.real_time = enable;
+  sim_context->clock.real_start_ns = SIM_HostNs();
+  sim_context->clock.real_start = sim_context->clock.cycles;
+}
+
+void SIM_ClockSync(void)
+{
+  uint64_t target;
+
+  if (!sim_context->clock.real_time)
+  {
+    return;
+  }
+
+  target = sim_context->clock.real_start + (SIM_HostNs() - sim_context->clock.real_start_ns) * SystemCoreClock / 1000000000ULL;
+  if (target > sim_context->clock.cycles)
+  {
+    SIM_ClockAdvance(target - sim_context->clock.cycles);
+  }
+}
+
+/* Overrides of the weak HAL time base -----------------------------------------*/
+
+uint32_t HAL_GetTick(void)
+{
+  SIM_ClockSync();
+  return uwTick;
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+  uint32_t tickstart = HAL_GetTick();
+  uint32_t wait = Delay;
+
+  if (wait < HAL_MAX_DELAY)
+  {
+    wait += (uint32_t)HAL_GetTickFreq();
+  }
+
+  /* in virtual time nothing else advances the tick, skip ahead instead of spinning */
+  while ((HAL_GetTick() - tickstart) < wait)
+  {
+    if (!sim_context->clock.real_time)
+    {
+      if ((SysTick->CTRL & (SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_TICKINT_Msk)) !=
+          (SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_TICKINT_Msk))
+      {
+        /* the tick never moves, the device would hang here */
+        return;
+      }
+      SIM_ClockAdvanceMs(wait - (HAL_GetTick() - tickstart));
+    }
+  }
+}
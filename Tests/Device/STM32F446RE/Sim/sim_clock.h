@@ -0,0 +1,74 @@
+/**
+  ******************************************************************************
+  * @file    sim_clock.h
+  * @brief   Virtual time base of the host simulation.
+  *
+  *          The simulated core has no clock of its own. Time only passes when
+  *          a test or benchmark advances it with SIM_ClockAdvance*(), or, in
+  *          real time mode, whenever HAL_GetTick() is called. Advancing time
+  *          counts down SysTick and calls SysTick_Handler() on every underflow
+  *          (which increments uwTick through HAL_IncTick()), counts up all
+  *          enabled TIM counters and the DWT cycle counter, runs the USART
+  *          models and memory to memory DMA streams and dispatches their
+  *          interrupts (sim_nvic.h).
+  *
+  *          Simplifications:
+  *           - all timers count up with the core clock (SystemCoreClock),
+  *             APB prescalers, repetition counters and other counter modes
+  *             are not modelled
+  *           - reading SysTick->CTRL does not clear COUNTFLAG
+  ******************************************************************************
+  */
+
+#ifndef __SIM_CLOCK_H
+#define __SIM_CLOCK_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+  * @brief  Restart virtual time at 0 and leave real time mode, uwTick is
+  *         cleared as well, peripheral registers are kept.
+  */
+void SIM_ClockReset(void);
+
+/**
+  * @brief  Advance virtual time by core clock cycles.
+  */
+void SIM_ClockAdvance(uint64_t cycles);
+
+/**
+  * @brief  Advance virtual time by microseconds, based on SystemCoreClock.
+  */
+void SIM_ClockAdvanceUs(uint64_t us);
+
+/**
+  * @brief  Advance virtual time by milliseconds, based on SystemCoreClock.
+  */
+void SIM_ClockAdvanceMs(uint32_t ms);
+
+/**
+  * @brief  Core clock cycles since the last SIM_ClockReset().
+  */
+uint64_t SIM_ClockGetCycles(void);
+
+/**
+  * @brief  Let virtual time follow the host clock (enable != 0) or only
+  *         advance explicitly (enable == 0, default).
+  */
+void SIM_ClockSetRealTime(int enable);
+
+/**
+  * @brief  In real time mode advance virtual time up to the host clock,
+  *         does nothing otherwise. Called by HAL_GetTick().
+  */
+void SIM_ClockSync(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SIM_CLOCK_H */
@@ -0,0 +1,86 @@
+/**
+  ******************************************************************************
+  * @file    sim_context.h
+  * @brief   State of the simulation models of one device, private to the Sim.
+  *
+  *          All models keep their state in the context selected by
+  *          sim_device.c, so several devices can share one process.
+  ******************************************************************************
+  */
+
+#ifndef __SIM_CONTEXT_H
+#define __SIM_CONTEXT_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include <stdint.h>
+#include "sim_usart.h"
+
+#define SIM_CONTEXT_IRQS  97U   /*!< External interrupts of the device */
+
+typedef struct
+{
+  uint64_t cycles;          /* core cycles since reset */
+  uint32_t systick_rem;     /* core cycles not yet counted by SysTick on HCLK/8 */
+  uint32_t tim_rem[14];     /* core cycles not yet counted by the TIM prescalers */
+  int      real_time;       /* virtual time follows host clock */
+  uint64_t real_start_ns;   /* host time when real time mode started */
+  uint64_t real_start;      /* virtual time when real time mode started */
+} SIM_ClockContext;
+
+typedef struct
+{
+  uint32_t levels[(SIM_CONTEXT_IRQS + 31U) / 32U];  /* interrupt line levels */
+  uint32_t dispatched;                              /* handlers called since reset */
+} SIM_NvicContext;
+
+typedef struct
+{
+  int      active;          /* EN seen by the model */
+  uint32_t total;           /* NDTR when the stream started */
+  uint32_t done;            /* items transferred since start or reload */
+  uint64_t credit;          /* core cycles not yet spent on memory to memory items */
+} SIM_DmaStream;
+
+typedef struct
+{
+  uint8_t  data[SIM_USART_QUEUE_SIZE];
+  uint32_t head;
+  uint32_t size;
+} SIM_UsartQueue;
+
+typedef struct
+{
+  int            enabled;     /* UE seen by the model */
+  uint32_t       sr;          /* status as seen by the model */
+  uint32_t       dr;          /* value kept in DR, mark and received data */
+  uint16_t       tdr;         /* transmit data register */
+  int            tdr_full;
+  uint16_t       shift;       /* transmit shift register */
+  int            shift_full;
+  uint64_t       tx_credit;   /* cycles into the current transmit character */
+  uint64_t       rx_credit;   /* cycles into the current receive character */
+  int            idle_armed;  /* IDLE follows the next empty character time */
+  uint32_t       reasons;     /* flags which raised the interrupt line */
+  SIM_UsartQueue rx;          /* host to device */
+  SIM_UsartQueue tx;          /* device to host */
+} SIM_UsartState;
+
+typedef struct
+{
+  SIM_ClockContext  clock;
+  SIM_NvicContext   nvic;
+  SIM_DmaStream     dma[2][8];
+  SIM_UsartState    usart[6];
+} SIM_Context;
+
+/* Context of the selected device */
+extern SIM_Context *sim_context;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SIM_CONTEXT_H */
@@ -0,0 +1,142 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "stm32f4xx_hal.h"
+#include "sim_context.h"
+#include "sim_device.h"
+
+extern __IO uint32_t uwTick;
+extern uint32_t uwTickPrio;
+extern HAL_TickFreqTypeDef uwTickFreq;
+
+/* Everything which is swapped on a device change */
+#define SIM_DEVICE_REGISTERS(X) \
+  X(SIM_TIM) \
+  X(SIM_RTC) \
+  X(SIM_WWDG) \
+  X(SIM_IWDG) \
+  X(SIM_USART) \
+  X(SIM_SPI) \
+  X(SIM_SPDIFRX) \
+  X(SIM_I2C) \
+  X(SIM_FMPI2C) \
+  X(SIM_CAN) \
+  X(SIM_CEC) \
+  X(SIM_PWR) \
+  X(SIM_DAC) \
+  X(SIM_ADC) \
+  X(SIM_ADC_COM) \
+  X(SIM_SDIO) \
+  X(SIM_SYSCFG) \
+  X(SIM_EXTI) \
+  X(SIM_SAI) \
+  X(SIM_SAI_B1) \
+  X(SIM_SAI_B2) \
+  X(SIM_GPIO) \
+  X(SIM_CRC) \
+  X(SIM_RCC) \
+  X(SIM_FLASH) \
+  X(SIM_DMA) \
+  X(SIM_DCMI) \
+  X(SIM_FMC_Bank1_R_BASE) \
+  X(SIM_FMC_Bank1E_R_BASE) \
+  X(SIM_FMC_Bank3_R_BASE) \
+  X(SIM_FMC_Bank5_6_R_BASE) \
+  X(SIM_QSPI_R_BASE) \
+  X(SIM_DBGMCU_BASE) \
+  X(SIM_USB_OTG_FS_PERIPH_BASE) \
+  X(SIM_USB_OTG_HS_PERIPH_BASE) \
+  X(SIM_SCS_BASE) \
+  X(SIM_SCB_BASE) \
+  X(SIM_SysTick_BASE) \
+  X(SIM_NVIC_BASE) \
+  X(SIM_ITM_BASE) \
+  X(SIM_DWT_BASE) \
+  X(SIM_TPI_BASE) \
+  X(SIM_CoreDebug_BASE) \
+  X(SIM_PRIMASK) \
+  X(uwTick) \
+  X(uwTickPrio) \
+  X(uwTickFreq) \
+  X(SystemCoreClock)
+
+typedef struct
+{
+#define X(name) __typeof__(name) name;
+  SIM_DEVICE_REGISTERS(X)
+#undef X
+} SIM_Registers;
+
+struct SIM_Device
+{
+  SIM_Context   context;    /* model state, in use while selected */
+  SIM_Registers registers;  /* register copy, in use while not selected */
+};
+
+static SIM_Device  sim_default_device;
+static SIM_Device *sim_selected = &sim_default_device;
+
+SIM_Context *sim_context = &sim_default_device.context;
+
+static void SIM_DeviceSave(SIM_Registers *registers)
+{
+#define X(name) memcpy((void *)&registers->name, (const void *)&name, sizeof(name));
+  SIM_DEVICE_REGISTERS(X)
+#undef X
+}
+
+static void SIM_DeviceLoad(const SIM_Registers *registers)
+{
+#define X(name) memcpy((void *)&name, (const void *)&registers->name, sizeof(name));
+  SIM_DEVICE_REGISTERS(X)
+#undef X
+}
+
+SIM_Device *SIM_DeviceCreate(void)
+{
+  SIM_Device *device = (SIM_Device *)calloc(1U, sizeof(SIM_Device));
+
+  if (device)
+  {
+    /* reset values of the HAL and CMSIS globals */
+    device->registers.uwTickPrio = 1UL << __NVIC_PRIO_BITS;
+    device->registers.uwTickFreq = HAL_TICK_FREQ_DEFAULT;
+    device->registers.SystemCoreClock = HSI_VALUE;
+  }
+  return device;
+}
+
+void SIM_DeviceDestroy(SIM_Device *device)
+{
+  if ((device == NULL) || (device == &sim_default_device))
+  {
+    return;
+  }
+  if (device == sim_selected)
+  {
+    SIM_DeviceSelect(NULL);
+  }
+  free(device);
+}
+
+void SIM_DeviceSelect(SIM_Device *device)
+{
+  if (device == NULL)
+  {
+    device = &sim_default_device;
+  }
+  if (device == sim_selected)
+  {
+    return;
+  }
+
+  SIM_DeviceSave(&sim_selected->registers);
+  SIM_DeviceLoad(&device->registers);
+  sim_selected = device;
+  sim_context = &device->context;
+}
+
+SIM_Device *SIM_DeviceSelected(void)
+{
+  return (sim_selected == &sim_default_device) ? NULL : sim_selected;
+}
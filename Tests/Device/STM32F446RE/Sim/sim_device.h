@@ -0,0 +1,56 @@
+/**
+  ******************************************************************************
+  * @file    sim_device.h
+  * @brief   Several simulated devices in one process.
+  *
+  *          A device owns a copy of all peripheral registers, the HAL time
+  *          base and the state of the Sim models (clock, NVIC, DMA, USART).
+  *          SIM_DeviceSelect() swaps the registers of the selected device into
+  *          the register globals, so the HAL and code using the peripheral
+  *          macros work unchanged on the selected device. Handles of the HAL
+  *          and other software state are not swapped, every device needs its
+  *          own objects.
+  *
+  *          The default device is selected at start, tests which do not
+  *          create devices never see a difference.
+  ******************************************************************************
+  */
+
+#ifndef __SIM_DEVICE_H
+#define __SIM_DEVICE_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include <stdint.h>
+
+typedef struct SIM_Device SIM_Device;
+
+/**
+  * @brief  Create a device in reset state, the selection is not changed.
+  * @retval The device, NULL if out of memory
+  */
+SIM_Device *SIM_DeviceCreate(void);
+
+/**
+  * @brief  Destroy a device, the default device is selected if it was selected.
+  */
+void SIM_DeviceDestroy(SIM_Device *device);
+
+/**
+  * @brief  Make device the one all peripheral accesses go to, NULL selects
+  *         the default device.
+  */
+void SIM_DeviceSelect(SIM_Device *device);
+
+/**
+  * @brief  Selected device, NULL for the default device.
+  */
+SIM_Device *SIM_DeviceSelected(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SIM_DEVICE_H */
@@ -0,0 +1,229 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "sim_dma.h"
+#include "sim_nvic.h"
+#include "sim_context.h"
+
+#define SIM_DMA_FEIF    0x01U
+#define SIM_DMA_DMEIF   0x04U
+#define SIM_DMA_TEIF    0x08U
+#define SIM_DMA_HTIF    0x10U
+#define SIM_DMA_TCIF    0x20U
+
+/* Core cycles per memory to memory item, read and write on the AHB plus
+ * arbitration, an estimate as the reference manual gives no figure */
+#define SIM_DMA_M2M_CYCLES  4U
+
+static const IRQn_Type sim_dma_irqs[2][8] =
+{
+  { DMA1_Stream0_IRQn, DMA1_Stream1_IRQn, DMA1_Stream2_IRQn, DMA1_Stream3_IRQn,
+    DMA1_Stream4_IRQn, DMA1_Stream5_IRQn, DMA1_Stream6_IRQn, DMA1_Stream7_IRQn },
+  { DMA2_Stream0_IRQn, DMA2_Stream1_IRQn, DMA2_Stream2_IRQn, DMA2_Stream3_IRQn,
+    DMA2_Stream4_IRQn, DMA2_Stream5_IRQn, DMA2_Stream6_IRQn, DMA2_Stream7_IRQn }
+};
+
+static const uint8_t sim_flag_shift[4] = {0U, 6U, 16U, 22U};
+
+static volatile uint32_t *SIM_DmaIsr(SIM_DMA_TypeDef *dma, uint32_t stream)
+{
+  return (stream < 4U) ? &dma->BASE.LISR : &dma->BASE.HISR;
+}
+
+static void SIM_DmaSetFlags(SIM_DMA_TypeDef *dma, uint32_t stream, uint32_t flags)
+{
+  *SIM_DmaIsr(dma, stream) |= flags << sim_flag_shift[stream & 3U];
+}
+
+static uint32_t SIM_DmaGetFlags(SIM_DMA_TypeDef *dma, uint32_t stream)
+{
+  return (*SIM_DmaIsr(dma, stream) >> sim_flag_shift[stream & 3U]) & 0x3DU;
+}
+
+static int SIM_DmaIsMemToMem(const DMA_Stream_TypeDef *s)
+{
+  return (s->CR & DMA_SxCR_DIR) == DMA_SxCR_DIR_1;
+}
+
+/* Apply the write 1 to clear registers */
+static void SIM_DmaFoldClear(SIM_DMA_TypeDef *dma)
+{
+  dma->BASE.LISR &= ~dma->BASE.LIFCR;
+  dma->BASE.HISR &= ~dma->BASE.HIFCR;
+  dma->BASE.LIFCR = 0U;
+  dma->BASE.HIFCR = 0U;
+}
+
+/* Move the next item of a running stream */
+static void SIM_DmaMove(uint32_t d, uint32_t stream)
+{
+  SIM_DmaStream *state = &sim_context->dma[d][stream];
+  DMA_Stream_TypeDef *s = &SIM_DMA[d].STREAM[stream];
+  uint32_t psize, msize, size;
+  uint8_t *periph, *mem;
+
+  /* the request may come before the next update, flags cleared by the
+   * software before the start must not clear the flags of this transfer */
+  SIM_DmaFoldClear(&SIM_DMA[d]);
+  if (!state->active)
+  {
+    state->active = 1;
+    state->total = s->NDTR;
+    state->done = 0U;
+  }
+
+  psize = 1UL << ((s->CR & DMA_SxCR_PSIZE) >> DMA_SxCR_PSIZE_Pos);
+  msize = 1UL << ((s->CR & DMA_SxCR_MSIZE) >> DMA_SxCR_MSIZE_Pos);
+  size = (psize < msize) ? psize : msize;
+  periph = (uint8_t *)(uintptr_t)s->PAR + ((s->CR & DMA_SxCR_PINC) ? state->done * psize : 0U);
+  mem = (uint8_t *)(uintptr_t)s->M0AR + ((s->CR & DMA_SxCR_MINC) ? state->done * msize : 0U);
+
+  if ((s->CR & DMA_SxCR_DIR) == DMA_SxCR_DIR_0)
+  {
+    memcpy(periph, mem, size);
+  }
+  else
+  {
+    memcpy(mem, periph, size);
+  }
+
+  state->done++;
+  s->NDTR--;
+
+  if (state->done == state->total / 2U)
+  {
+    SIM_DmaSetFlags(&SIM_DMA[d], stream, SIM_DMA_HTIF);
+  }
+
+  if (s->NDTR == 0U)
+  {
+    SIM_DmaSetFlags(&SIM_DMA[d], stream, SIM_DMA_TCIF);
+    if (s->CR & DMA_SxCR_CIRC)
+    {
+      s->NDTR = state->total;
+      state->done = 0U;
+    }
+    else
+    {
+      s->CR &= ~DMA_SxCR_EN;
+      state->active = 0;
+    }
+  }
+}
+
+int SIM_DmaRequest(DMA_TypeDef *dma, uint32_t stream, uint32_t channel)
+{
+  const uint32_t d = (dma == DMA1) ? 0U : 1U;
+  DMA_Stream_TypeDef *s = &SIM_DMA[d].STREAM[stream];
+
+  if (((s->CR & DMA_SxCR_EN) == 0U) || (((s->CR & DMA_SxCR_CHSEL) >> DMA_SxCR_CHSEL_Pos) != channel) ||
+      (s->NDTR == 0U) || SIM_DmaIsMemToMem(s))
+  {
+    return 0;
+  }
+
+  SIM_DmaMove(d, stream);
+  return 1;
+}
+
+uint64_t SIM_DmaNextEvent(void)
+{
+  uint64_t next = UINT64_MAX;
+  uint32_t stream;
+
+  for (stream = 0U; stream < 8U; stream++)
+  {
+    const SIM_DmaStream *state = &sim_context->dma[1][stream];
+    const DMA_Stream_TypeDef *s = &SIM_DMA[1].STREAM[stream];
+    uint64_t items, cycles;
+
+    if (((s->CR & DMA_SxCR_EN) == 0U) || !SIM_DmaIsMemToMem(s) || (s->NDTR == 0U))
+    {
+      continue;
+    }
+
+    /* next flag, half transfer or transfer complete */
+    items = s->NDTR;
+    if (state->active && (state->done < state->total / 2U))
+    {
+      items = state->total / 2U - state->done;
+    }
+    cycles = items * SIM_DMA_M2M_CYCLES;
+    cycles = (cycles > state->credit) ? cycles - state->credit : 1U;
+    next = (cycles < next) ? cycles : next;
+  }
+  return next;
+}
+
+void SIM_DmaAdvance(uint64_t cycles)
+{
+  uint32_t stream;
+
+  for (stream = 0U; stream < 8U; stream++)
+  {
+    SIM_DmaStream *state = &sim_context->dma[1][stream];
+    DMA_Stream_TypeDef *s = &SIM_DMA[1].STREAM[stream];
+
+    if (((s->CR & DMA_SxCR_EN) == 0U) || !SIM_DmaIsMemToMem(s) || (s->NDTR == 0U))
+    {
+      state->credit = 0U;
+      continue;
+    }
+
+    state->credit += cycles;
+    while ((state->credit >= SIM_DMA_M2M_CYCLES) && (s->CR & DMA_SxCR_EN))
+    {
+      state->credit -= SIM_DMA_M2M_CYCLES;
+      SIM_DmaMove(1U, stream);
+    }
+    if ((s->CR & DMA_SxCR_EN) == 0U)
+    {
+      state->credit = 0U;
+    }
+  }
+}
+
+void SIM_DmaUpdate(void)
+{
+  uint32_t d, stream;
+
+  for (d = 0U; d < 2U; d++)
+  {
+    SIM_DMA_TypeDef *dma = &SIM_DMA[d];
+
+    SIM_DmaFoldClear(dma);
+
+    for (stream = 0U; stream < 8U; stream++)
+    {
+      SIM_DmaStream *state = &sim_context->dma[d][stream];
+      DMA_Stream_TypeDef *s = &dma->STREAM[stream];
+      uint32_t flags;
+
+      if ((s->CR & DMA_SxCR_EN) && !state->active && (s->NDTR != 0U))
+      {
+        state->active = 1;
+        state->total = s->NDTR;
+        state->done = 0U;
+      }
+      else if (((s->CR & DMA_SxCR_EN) == 0U) && state->active)
+      {
+        /* disabled by the software before the end */
+        state->active = 0;
+        SIM_DmaSetFlags(dma, stream, SIM_DMA_TCIF);
+      }
+
+      flags = SIM_DmaGetFlags(dma, stream);
+      SIM_NvicSetLevel(sim_dma_irqs[d][stream],
+                       ((flags & SIM_DMA_TCIF) && (s->CR & DMA_SxCR_TCIE)) ||
+                       ((flags & SIM_DMA_HTIF) && (s->CR & DMA_SxCR_HTIE)) ||
+                       ((flags & SIM_DMA_TEIF) && (s->CR & DMA_SxCR_TEIE)) ||
+                       ((flags & SIM_DMA_DMEIF) && (s->CR & DMA_SxCR_DMEIE)) ||
+                       ((flags & SIM_DMA_FEIF) && (s->FCR & DMA_SxFCR_FEIE)));
+    }
+  }
+}
+
+void SIM_DmaReset(void)
+{
+  memset(sim_context->dma, 0, sizeof(sim_context->dma));
+}
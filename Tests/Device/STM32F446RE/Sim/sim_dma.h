@@ -0,0 +1,70 @@
+/**
+  ******************************************************************************
+  * @file    sim_dma.h
+  * @brief   DMA stream model of the host simulation.
+  *
+  *          A stream starts when the software sets EN and latches NDTR. Each
+  *          request of a peripheral model moves one data item between the
+  *          peripheral and memory address, counts down NDTR and raises HTIF
+  *          and TCIF, in circular mode NDTR is reloaded. Clearing EN before
+  *          the end sets TCIF like the device. Writes to LIFCR/HIFCR clear the
+  *          flags on the next update.
+  *
+  *          Memory to memory streams (DMA2 only, like the device) need no
+  *          requests, they copy from PAR to M0AR while time advances, one
+  *          item every SIM_DMA_M2M_CYCLES core cycles.
+  *
+  *          Addresses are 32 bit registers, the test binary is linked without
+  *          PIE so that static and heap memory is addressable. Buffers on the
+  *          stack can not be used for DMA. FIFO packing, bursts and the
+  *          double buffer mode are not modelled.
+  ******************************************************************************
+  */
+
+#ifndef __SIM_DMA_H
+#define __SIM_DMA_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include <stdint.h>
+#include "stm32f4xx.h"
+
+/**
+  * @brief  Request one data item from a stream.
+  * @param  dma      DMA1 or DMA2
+  * @param  stream   Stream number 0 to 7
+  * @param  channel  Channel of the requesting peripheral, 0 to 7
+  * @retval 1 if an item was transferred, 0 if the stream is not ready for
+  *         this channel
+  */
+int SIM_DmaRequest(DMA_TypeDef *dma, uint32_t stream, uint32_t channel);
+
+/**
+  * @brief  Core cycles until the next flag of a memory to memory stream,
+  *         UINT64_MAX if none runs.
+  */
+uint64_t SIM_DmaNextEvent(void);
+
+/**
+  * @brief  Advance the memory to memory streams by core clock cycles.
+  */
+void SIM_DmaAdvance(uint64_t cycles);
+
+/**
+  * @brief  Apply flag clears of the software, start and stop streams and
+  *         update the stream interrupt lines.
+  */
+void SIM_DmaUpdate(void);
+
+/**
+  * @brief  Forget all running streams, registers are kept.
+  */
+void SIM_DmaReset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SIM_DMA_H */
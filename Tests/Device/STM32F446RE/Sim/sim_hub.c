@@ -0,0 +1,279 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "sim_hub.h"
+#include "sim_clock.h"
+#include "sim_usart.h"
+
+typedef struct
+{
+  uint8_t  data[SIM_HUB_BUFFER_SIZE];
+  uint32_t head;
+  uint32_t size;
+} SIM_HubQueue;
+
+typedef struct
+{
+  SIM_Device    *device;
+  USART_TypeDef *usart;
+  SIM_HubLoop    loop;
+  void          *arg;
+  SIM_HubQueue   up;        /* device to link */
+  SIM_HubQueue   host;      /* link to host */
+  SIM_HubQueue   down;      /* host to link */
+  SIM_HubStats   stats;
+} SIM_HubPort;
+
+struct SIM_Hub
+{
+  uint32_t    bandwidth;
+  uint32_t    quantum_us;
+  uint64_t    time_us;
+  uint64_t    credit_rem;   /* byte microseconds not yet spent */
+  uint32_t    next_up;      /* round robin start of the uplink */
+  uint32_t    next_down;    /* round robin start of the downlink */
+  uint32_t    ports;
+  SIM_HubPort port[SIM_HUB_PORTS];
+};
+
+static uint32_t SIM_HubPush(SIM_HubQueue *queue, const uint8_t *data, uint32_t size)
+{
+  uint32_t i;
+
+  if (size > SIM_HUB_BUFFER_SIZE - queue->size)
+  {
+    size = SIM_HUB_BUFFER_SIZE - queue->size;
+  }
+  for (i = 0U; i < size; i++)
+  {
+    queue->data[(queue->head + queue->size + i) % SIM_HUB_BUFFER_SIZE] = data[i];
+  }
+  queue->size += size;
+  return size;
+}
+
+static uint32_t SIM_HubPop(SIM_HubQueue *queue, uint8_t *data, uint32_t size)
+{
+  uint32_t i;
+
+  if (size > queue->size)
+  {
+    size = queue->size;
+  }
+  for (i = 0U; i < size; i++)
+  {
+    data[i] = queue->data[(queue->head + i) % SIM_HUB_BUFFER_SIZE];
+  }
+  queue->head = (queue->head + size) % SIM_HUB_BUFFER_SIZE;
+  queue->size -= size;
+  return size;
+}
+
+/* Undo the last size bytes taken by SIM_HubPop */
+static void SIM_HubUnpop(SIM_HubQueue *queue, uint32_t size)
+{
+  queue->head = (queue->head + SIM_HUB_BUFFER_SIZE - size) % SIM_HUB_BUFFER_SIZE;
+  queue->size += size;
+}
+
+/* Move at most size bytes of one port over the link, the device of the port
+ * is selected for the downlink */
+static uint32_t SIM_HubMove(SIM_HubPort *port, int downlink, uint32_t size)
+{
+  uint8_t chunk[256];
+  uint32_t moved = 0U, n, accepted;
+
+  while (moved < size)
+  {
+    n = SIM_HubPop(downlink ? &port->down : &port->up, chunk,
+                   (size - moved < sizeof(chunk)) ? size - moved : (uint32_t)sizeof(chunk));
+    if (n == 0U)
+    {
+      break;
+    }
+    accepted = downlink ? SIM_UsartInject(port->usart, chunk, n) : SIM_HubPush(&port->host, chunk, n);
+    if (accepted < n)
+    {
+      /* receiver full, the rest waits on the hub */
+      SIM_HubUnpop(downlink ? &port->down : &port->up, n - accepted);
+    }
+    moved += accepted;
+    if (accepted < n)
+    {
+      break;
+    }
+  }
+
+  if (downlink)
+  {
+    port->stats.down += moved;
+  }
+  else
+  {
+    port->stats.up += moved;
+  }
+  return moved;
+}
+
+/* Share credit bytes round robin between all ports with data */
+static void SIM_HubLink(SIM_Hub *hub, int downlink, uint64_t credit)
+{
+  uint32_t *next = downlink ? &hub->next_down : &hub->next_up;
+  uint32_t waiting, share, i, moved, n;
+  SIM_HubPort *port;
+
+  do
+  {
+    waiting = 0U;
+    for (i = 0U; i < hub->ports; i++)
+    {
+      port = &hub->port[i];
+      waiting += ((downlink ? port->down.size : port->up.size) != 0U) ? 1U : 0U;
+    }
+    if ((waiting == 0U) || (credit == 0U))
+    {
+      return;
+    }
+
+    /* equal shares, at least one byte so that a small credit still moves */
+    share = (credit / waiting > SIM_HUB_BUFFER_SIZE) ? SIM_HUB_BUFFER_SIZE : (uint32_t)(credit / waiting);
+    share = (share != 0U) ? share : 1U;
+
+    moved = 0U;
+    for (i = 0U; (i < hub->ports) && (credit != 0U); i++)
+    {
+      port = &hub->port[(*next + i) % hub->ports];
+      if (downlink)
+      {
+        SIM_DeviceSelect(port->device);
+      }
+      n = SIM_HubMove(port, downlink, (share < credit) ? share : (uint32_t)credit);
+      credit -= n;
+      moved += n;
+    }
+    *next = (*next + 1U) % hub->ports;
+  } while (moved != 0U);
+}
+
+SIM_Hub *SIM_HubCreate(uint32_t bandwidth, uint32_t quantum_us)
+{
+  SIM_Hub *hub = (SIM_Hub *)calloc(1U, sizeof(SIM_Hub));
+
+  if (hub)
+  {
+    hub->bandwidth = bandwidth;
+    hub->quantum_us = (quantum_us != 0U) ? quantum_us : 1U;
+  }
+  return hub;
+}
+
+void SIM_HubDestroy(SIM_Hub *hub)
+{
+  free(hub);
+}
+
+int SIM_HubConnect(SIM_Hub *hub, SIM_Device *device, USART_TypeDef *usart, SIM_HubLoop loop, void *arg)
+{
+  SIM_HubPort *port;
+  uint32_t i;
+
+  if (hub->ports == SIM_HUB_PORTS)
+  {
+    return -1;
+  }
+  for (i = 0U; i < hub->ports; i++)
+  {
+    if (hub->port[i].device == device)
+    {
+      return -1;
+    }
+  }
+
+  port = &hub->port[hub->ports];
+  memset(port, 0, sizeof(*port));
+  port->device = device;
+  port->usart = usart;
+  port->loop = loop;
+  port->arg = arg;
+  return (int)hub->ports++;
+}
+
+uint32_t SIM_HubWrite(SIM_Hub *hub, int port, const uint8_t *data, uint32_t size)
+{
+  SIM_HubPort *p = &hub->port[port];
+  uint32_t accepted = SIM_HubPush(&p->down, data, size);
+
+  p->stats.dropped += size - accepted;
+  return accepted;
+}
+
+uint32_t SIM_HubRead(SIM_Hub *hub, int port, uint8_t *data, uint32_t size)
+{
+  return SIM_HubPop(&hub->port[port].host, data, size);
+}
+
+void SIM_HubRun(SIM_Hub *hub, uint64_t us)
+{
+  const uint64_t end = hub->time_us + us;
+  uint8_t chunk[256];
+  uint64_t credit;
+  uint32_t i, n, accepted, backlog;
+  SIM_HubPort *port;
+
+  while (hub->time_us < end)
+  {
+    /* firmware and peripherals of all devices */
+    for (i = 0U; i < hub->ports; i++)
+    {
+      port = &hub->port[i];
+      SIM_DeviceSelect(port->device);
+      if (port->loop)
+      {
+        port->loop(port->arg);
+      }
+      SIM_ClockAdvanceUs(hub->quantum_us);
+
+      while ((n = SIM_UsartTake(port->usart, chunk, sizeof(chunk))) != 0U)
+      {
+        accepted = SIM_HubPush(&port->up, chunk, n);
+        port->stats.dropped += n - accepted;
+      }
+    }
+
+    /* the link, same credit in both directions */
+    if (hub->bandwidth == 0U)
+    {
+      credit = UINT64_MAX;
+    }
+    else
+    {
+      hub->credit_rem += (uint64_t)hub->bandwidth * hub->quantum_us;
+      credit = hub->credit_rem / 1000000U;
+      hub->credit_rem %= 1000000U;
+    }
+    SIM_HubLink(hub, 0, credit);
+    SIM_HubLink(hub, 1, credit);
+
+    for (i = 0U; i < hub->ports; i++)
+    {
+      port = &hub->port[i];
+      backlog = port->up.size + port->down.size;
+      port->stats.backlog = backlog;
+      port->stats.max_backlog = (backlog > port->stats.max_backlog) ? backlog : port->stats.max_backlog;
+    }
+
+    hub->time_us += hub->quantum_us;
+  }
+
+  SIM_DeviceSelect(NULL);
+}
+
+uint64_t SIM_HubGetTime(SIM_Hub *hub)
+{
+  return hub->time_us;
+}
+
+void SIM_HubGetStats(SIM_Hub *hub, int port, SIM_HubStats *stats)
+{
+  *stats = hub->port[port].stats;
+}
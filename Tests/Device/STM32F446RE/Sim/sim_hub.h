@@ -0,0 +1,102 @@
+/**
+  ******************************************************************************
+  * @file    sim_hub.h
+  * @brief   Virtual serial hub between the host and several simulated devices.
+  *
+  *          Every port of the hub connects one USART of one device (see
+  *          sim_device.h) to the host. The hub runs all devices in lock step:
+  *          per quantum every device runs its loop function once and then
+  *          advances its clock by the quantum. Data the devices sent is moved
+  *          towards the host, data the host wrote is moved towards the
+  *          devices, both directions share a link of limited bandwidth like
+  *          a USB hub or an RS485 bus. The bandwidth is divided round robin
+  *          between the ports which have data.
+  *
+  *          Data which does not fit into a full hub buffer is dropped and
+  *          counted, the host side keeps up to SIM_HUB_BUFFER_SIZE bytes per
+  *          port and applies back pressure beyond that.
+  ******************************************************************************
+  */
+
+#ifndef __SIM_HUB_H
+#define __SIM_HUB_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include <stdint.h>
+#include "stm32f4xx.h"
+#include "sim_device.h"
+
+#define SIM_HUB_PORTS        8U      /*!< Ports of one hub */
+#define SIM_HUB_BUFFER_SIZE  4096U   /*!< Buffer per port and direction */
+
+typedef struct SIM_Hub SIM_Hub;
+
+/* Device firmware run once per quantum with the device selected */
+typedef void (*SIM_HubLoop)(void *arg);
+
+typedef struct
+{
+  uint64_t up;        /* bytes delivered to the host */
+  uint64_t down;      /* bytes delivered to the device */
+  uint64_t dropped;   /* bytes lost on a full hub buffer */
+  uint32_t backlog;   /* bytes waiting for the link in both directions */
+  uint32_t max_backlog;
+} SIM_HubStats;
+
+/**
+  * @brief  Create a hub.
+  * @param  bandwidth Link bandwidth in bytes per second and direction,
+  *         0 for an unlimited link
+  * @param  quantum_us Lock step of the devices in microseconds
+  * @retval The hub, NULL if out of memory
+  */
+SIM_Hub *SIM_HubCreate(uint32_t bandwidth, uint32_t quantum_us);
+
+/**
+  * @brief  Destroy a hub, the devices are not destroyed.
+  */
+void SIM_HubDestroy(SIM_Hub *hub);
+
+/**
+  * @brief  Connect a USART of a device to the next free port.
+  * @param  loop Firmware of the device, may be NULL
+  * @retval Port number, -1 if the hub is full or the device is connected
+  */
+int SIM_HubConnect(SIM_Hub *hub, SIM_Device *device, USART_TypeDef *usart, SIM_HubLoop loop, void *arg);
+
+/**
+  * @brief  Queue data from the host for a port.
+  * @retval Number of bytes accepted
+  */
+uint32_t SIM_HubWrite(SIM_Hub *hub, int port, const uint8_t *data, uint32_t size);
+
+/**
+  * @brief  Take data which arrived at the host from a port.
+  * @retval Number of bytes taken
+  */
+uint32_t SIM_HubRead(SIM_Hub *hub, int port, uint8_t *data, uint32_t size);
+
+/**
+  * @brief  Run all devices and the link for at least us microseconds, the
+  *         default device is selected afterwards.
+  */
+void SIM_HubRun(SIM_Hub *hub, uint64_t us);
+
+/**
+  * @brief  Time the hub has run in microseconds.
+  */
+uint64_t SIM_HubGetTime(SIM_Hub *hub);
+
+/**
+  * @brief  Traffic counters of a port.
+  */
+void SIM_HubGetStats(SIM_Hub *hub, int port, SIM_HubStats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SIM_HUB_H */
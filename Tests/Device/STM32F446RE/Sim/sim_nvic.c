@@ -0,0 +1,297 @@
+#include <string.h>
+
+#include "sim_nvic.h"
+#include "sim_context.h"
+#include "sim_dma.h"
+#include "sim_usart.h"
+
+#define SIM_NVIC_IRQS   SIM_CONTEXT_IRQS
+
+void SIM_DefaultHandler(void)
+{
+}
+
+void WWDG_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void PVD_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void TAMP_STAMP_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void RTC_WKUP_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void FLASH_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void RCC_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void EXTI0_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void EXTI1_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void EXTI2_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void EXTI3_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void EXTI4_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void DMA1_Stream0_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void DMA1_Stream1_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void DMA1_Stream2_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void DMA1_Stream3_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void DMA1_Stream4_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void DMA1_Stream5_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void DMA1_Stream6_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void ADC_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void CAN1_TX_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void CAN1_RX0_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void CAN1_RX1_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void CAN1_SCE_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void EXTI9_5_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void TIM1_BRK_TIM9_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void TIM1_UP_TIM10_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void TIM1_TRG_COM_TIM11_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void TIM1_CC_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void TIM2_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void TIM3_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void TIM4_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void I2C1_EV_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void I2C1_ER_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void I2C2_EV_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void I2C2_ER_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void SPI1_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void SPI2_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void USART1_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void USART2_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void USART3_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void EXTI15_10_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void RTC_Alarm_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void OTG_FS_WKUP_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void TIM8_BRK_TIM12_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void TIM8_UP_TIM13_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void TIM8_TRG_COM_TIM14_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void TIM8_CC_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void DMA1_Stream7_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void FMC_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void SDIO_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void TIM5_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void SPI3_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void UART4_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void UART5_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void TIM6_DAC_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void TIM7_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void DMA2_Stream0_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void DMA2_Stream1_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void DMA2_Stream2_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void DMA2_Stream3_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void DMA2_Stream4_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void CAN2_TX_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void CAN2_RX0_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void CAN2_RX1_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void CAN2_SCE_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void OTG_FS_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void DMA2_Stream5_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void DMA2_Stream6_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void DMA2_Stream7_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void USART6_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void I2C3_EV_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void I2C3_ER_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void OTG_HS_EP1_OUT_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void OTG_HS_EP1_IN_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void OTG_HS_WKUP_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void OTG_HS_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void DCMI_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void FPU_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void SPI4_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void SAI1_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void SAI2_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void QUADSPI_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void CEC_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void SPDIF_RX_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void FMPI2C1_EV_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+void FMPI2C1_ER_IRQHandler(void) __attribute__((weak, alias("SIM_DefaultHandler")));
+
+static void (* const sim_vectors[SIM_NVIC_IRQS])(void) =
+{
+  WWDG_IRQHandler,
+  PVD_IRQHandler,
+  TAMP_STAMP_IRQHandler,
+  RTC_WKUP_IRQHandler,
+  FLASH_IRQHandler,
+  RCC_IRQHandler,
+  EXTI0_IRQHandler,
+  EXTI1_IRQHandler,
+  EXTI2_IRQHandler,
+  EXTI3_IRQHandler,
+  EXTI4_IRQHandler,
+  DMA1_Stream0_IRQHandler,
+  DMA1_Stream1_IRQHandler,
+  DMA1_Stream2_IRQHandler,
+  DMA1_Stream3_IRQHandler,
+  DMA1_Stream4_IRQHandler,
+  DMA1_Stream5_IRQHandler,
+  DMA1_Stream6_IRQHandler,
+  ADC_IRQHandler,
+  CAN1_TX_IRQHandler,
+  CAN1_RX0_IRQHandler,
+  CAN1_RX1_IRQHandler,
+  CAN1_SCE_IRQHandler,
+  EXTI9_5_IRQHandler,
+  TIM1_BRK_TIM9_IRQHandler,
+  TIM1_UP_TIM10_IRQHandler,
+  TIM1_TRG_COM_TIM11_IRQHandler,
+  TIM1_CC_IRQHandler,
+  TIM2_IRQHandler,
+  TIM3_IRQHandler,
+  TIM4_IRQHandler,
+  I2C1_EV_IRQHandler,
+  I2C1_ER_IRQHandler,
+  I2C2_EV_IRQHandler,
+  I2C2_ER_IRQHandler,
+  SPI1_IRQHandler,
+  SPI2_IRQHandler,
+  USART1_IRQHandler,
+  USART2_IRQHandler,
+  USART3_IRQHandler,
+  EXTI15_10_IRQHandler,
+  RTC_Alarm_IRQHandler,
+  OTG_FS_WKUP_IRQHandler,
+  TIM8_BRK_TIM12_IRQHandler,
+  TIM8_UP_TIM13_IRQHandler,
+  TIM8_TRG_COM_TIM14_IRQHandler,
+  TIM8_CC_IRQHandler,
+  DMA1_Stream7_IRQHandler,
+  FMC_IRQHandler,
+  SDIO_IRQHandler,
+  TIM5_IRQHandler,
+  SPI3_IRQHandler,
+  UART4_IRQHandler,
+  UART5_IRQHandler,
+  TIM6_DAC_IRQHandler,
+  TIM7_IRQHandler,
+  DMA2_Stream0_IRQHandler,
+  DMA2_Stream1_IRQHandler,
+  DMA2_Stream2_IRQHandler,
+  DMA2_Stream3_IRQHandler,
+  DMA2_Stream4_IRQHandler,
+  0,
+  0,
+  CAN2_TX_IRQHandler,
+  CAN2_RX0_IRQHandler,
+  CAN2_RX1_IRQHandler,
+  CAN2_SCE_IRQHandler,
+  OTG_FS_IRQHandler,
+  DMA2_Stream5_IRQHandler,
+  DMA2_Stream6_IRQHandler,
+  DMA2_Stream7_IRQHandler,
+  USART6_IRQHandler,
+  I2C3_EV_IRQHandler,
+  I2C3_ER_IRQHandler,
+  OTG_HS_EP1_OUT_IRQHandler,
+  OTG_HS_EP1_IN_IRQHandler,
+  OTG_HS_WKUP_IRQHandler,
+  OTG_HS_IRQHandler,
+  DCMI_IRQHandler,
+  0,
+  0,
+  FPU_IRQHandler,
+  0,
+  0,
+  SPI4_IRQHandler,
+  0,
+  0,
+  SAI1_IRQHandler,
+  0,
+  0,
+  0,
+  SAI2_IRQHandler,
+  QUADSPI_IRQHandler,
+  CEC_IRQHandler,
+  SPDIF_RX_IRQHandler,
+  FMPI2C1_EV_IRQHandler,
+  FMPI2C1_ER_IRQHandler
+};
+
+static int      sim_dispatching;
+
+void SIM_NvicSetLevel(IRQn_Type IRQn, int level)
+{
+  const uint32_t n = (uint32_t)IRQn;
+
+  if (n >= SIM_NVIC_IRQS)
+  {
+    return;
+  }
+
+  if (level)
+  {
+    sim_context->nvic.levels[n >> 5U] |= 1UL << (n & 0x1FU);
+  }
+  else
+  {
+    sim_context->nvic.levels[n >> 5U] &= ~(1UL << (n & 0x1FU));
+  }
+}
+
+/* Pending and enabled interrupt with the highest priority, -1 if none */
+static int SIM_NvicNext(void)
+{
+  uint32_t n;
+  int next = -1;
+
+  for (n = 0U; n < SIM_NVIC_IRQS; n++)
+  {
+    const uint32_t bit = 1UL << (n & 0x1FU);
+
+    /* a high line keeps the interrupt pending */
+    NVIC->ISPR[n >> 5U] |= sim_context->nvic.levels[n >> 5U] & bit;
+
+    if ((NVIC->ISPR[n >> 5U] & NVIC->ISER[n >> 5U] & bit) && sim_vectors[n])
+    {
+      if ((next < 0) || (NVIC->IP[n] < NVIC->IP[next]))
+      {
+        next = (int)n;
+      }
+    }
+  }
+
+  return next;
+}
+
+uint32_t SIM_NvicDispatch(void)
+{
+  uint32_t count = 0U;
+
+  /* handlers run to completion */
+  if (sim_dispatching)
+  {
+    return 0U;
+  }
+  sim_dispatching = 1;
+
+  while (count < SIM_NVIC_MAX_DISPATCH)
+  {
+    int n;
+
+    SIM_UsartUpdate();
+    SIM_DmaUpdate();
+
+    n = SIM_NvicNext();
+    if ((n < 0) || (SIM_PRIMASK != 0U))
+    {
+      break;
+    }
+
+    NVIC->ISPR[(uint32_t)n >> 5U] &= ~(1UL << ((uint32_t)n & 0x1FU));
+    NVIC->IABR[(uint32_t)n >> 5U] |= 1UL << ((uint32_t)n & 0x1FU);
+    sim_vectors[n]();
+    NVIC->IABR[(uint32_t)n >> 5U] &= ~(1UL << ((uint32_t)n & 0x1FU));
+
+    SIM_UsartHandled((IRQn_Type)n);
+    count++;
+  }
+
+  sim_context->nvic.dispatched += count;
+  sim_dispatching = 0;
+  return count;
+}
+
+uint32_t SIM_NvicGetDispatched(void)
+{
+  return sim_context->nvic.dispatched;
+}
+
+void SIM_NvicReset(void)
+{
+  memset(NVIC, 0, sizeof(*NVIC));
+  memset(sim_context->nvic.levels, 0, sizeof(sim_context->nvic.levels));
+  sim_context->nvic.dispatched = 0U;
+  SIM_PRIMASK = 0U;
+}
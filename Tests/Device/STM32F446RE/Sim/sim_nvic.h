@@ -0,0 +1,59 @@
+/**
+  ******************************************************************************
+  * @file    sim_nvic.h
+  * @brief   Interrupt dispatch of the host simulation.
+  *
+  *          Peripheral models drive their interrupt lines with
+  *          SIM_NvicSetLevel(). SIM_NvicDispatch() lets the models react to
+  *          register writes of the software, then calls the handlers of all
+  *          pending and enabled interrupts in priority order as long as
+  *          PRIMASK is clear, like the startup code of the device every
+  *          handler is a weak alias of a default handler. SIM_ClockAdvance()
+  *          dispatches on its own, the software only needs to call
+  *          SIM_NvicDispatch() to see the effect of a register write without
+  *          letting time pass.
+  *
+  *          Handlers run to completion, preemption by a higher priority
+  *          interrupt is not modelled.
+  ******************************************************************************
+  */
+
+#ifndef __SIM_NVIC_H
+#define __SIM_NVIC_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include <stdint.h>
+#include "stm32f4xx.h"
+
+#define SIM_NVIC_MAX_DISPATCH   10000U  /*!< Handlers per SIM_NvicDispatch(), bounds interrupt storms */
+
+/**
+  * @brief  Set the level of an interrupt line, a high line keeps the
+  *         interrupt pending.
+  */
+void SIM_NvicSetLevel(IRQn_Type IRQn, int level);
+
+/**
+  * @brief  Update the peripheral models and call the pending handlers.
+  * @retval Number of handlers called
+  */
+uint32_t SIM_NvicDispatch(void);
+
+/**
+  * @brief  Number of handlers called since SIM_NvicReset().
+  */
+uint32_t SIM_NvicGetDispatched(void);
+
+/**
+  * @brief  Disable and clear all interrupts, reset PRIMASK and the line levels.
+  */
+void SIM_NvicReset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SIM_NVIC_H */
@@ -0,0 +1,372 @@
+#include <string.h>
+
+#include "sim_usart.h"
+#include "sim_dma.h"
+#include "sim_nvic.h"
+#include "sim_context.h"
+
+#define SIM_USARTS        (sizeof(SIM_USART) / sizeof(SIM_USART[0]))
+#define SIM_USART_RC_W0   (USART_SR_CTS | USART_SR_LBD | USART_SR_TC | USART_SR_RXNE)
+#define SIM_USART_RX_READ (USART_SR_RXNE | USART_SR_ORE | USART_SR_IDLE | USART_SR_PE | USART_SR_FE | USART_SR_NE)
+
+typedef struct
+{
+  uint8_t dma;      /* 1 or 2, 0 ends the list */
+  uint8_t stream;
+  uint8_t channel;
+} SIM_UsartDma;
+
+/* in order of SIM_USART: USART1, USART2, USART3, UART4, UART5, USART6 */
+static const IRQn_Type sim_usart_irqs[6] =
+{
+  USART1_IRQn, USART2_IRQn, USART3_IRQn, UART4_IRQn, UART5_IRQn, USART6_IRQn
+};
+
+static const SIM_UsartDma sim_usart_tx_dma[6][3] =
+{
+  { {2U, 7U, 4U} },
+  { {1U, 6U, 4U} },
+  { {1U, 3U, 4U}, {1U, 4U, 7U} },
+  { {1U, 4U, 4U} },
+  { {1U, 7U, 4U} },
+  { {2U, 6U, 5U}, {2U, 7U, 5U} }
+};
+
+static const SIM_UsartDma sim_usart_rx_dma[6][3] =
+{
+  { {2U, 2U, 4U}, {2U, 5U, 4U} },
+  { {1U, 5U, 4U} },
+  { {1U, 1U, 4U} },
+  { {1U, 2U, 4U} },
+  { {1U, 0U, 4U} },
+  { {2U, 1U, 5U}, {2U, 2U, 5U} }
+};
+
+static int SIM_UsartIndex(USART_TypeDef *usart)
+{
+  const uint32_t idx = (uint32_t)(usart - SIM_USART);
+  return (idx < SIM_USARTS) ? (int)idx : -1;
+}
+
+static int SIM_QueuePush(SIM_UsartQueue *q, uint8_t data)
+{
+  if (q->size >= SIM_USART_QUEUE_SIZE)
+  {
+    return 0;
+  }
+  q->data[(q->head + q->size) % SIM_USART_QUEUE_SIZE] = data;
+  q->size++;
+  return 1;
+}
+
+static uint8_t SIM_QueuePop(SIM_UsartQueue *q)
+{
+  const uint8_t data = q->data[q->head];
+  q->head = (q->head + 1U) % SIM_USART_QUEUE_SIZE;
+  q->size--;
+  return data;
+}
+
+static int SIM_UsartDmaRequest(const SIM_UsartDma *map)
+{
+  uint32_t i;
+
+  for (i = 0U; (i < 3U) && map[i].dma; i++)
+  {
+    if (SIM_DmaRequest((map[i].dma == 1U) ? DMA1 : DMA2, map[i].stream, map[i].channel))
+    {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/* Core cycles of one character */
+static uint64_t SIM_UsartCharCycles(const USART_TypeDef *u)
+{
+  uint64_t bit = (u->CR1 & USART_CR1_OVER8) ? (((u->BRR & 0xFFF0U) >> 1U) | (u->BRR & 0x7U)) : (u->BRR & 0xFFFFU);
+  const uint64_t bits = 1U + ((u->CR1 & USART_CR1_M) ? 9U : 8U) + ((u->CR2 & USART_CR2_STOP_1) ? 2U : 1U);
+
+  if (bit == 0U)
+  {
+    bit = 16U;
+  }
+  return bit * bits;
+}
+
+static int SIM_UsartRxBusy(const USART_TypeDef *u, const SIM_UsartState *st)
+{
+  return (u->CR1 & USART_CR1_RE) && ((st->rx.size != 0U) || st->idle_armed);
+}
+
+uint32_t SIM_UsartInject(USART_TypeDef *usart, const uint8_t *data, uint32_t size)
+{
+  const int idx = SIM_UsartIndex(usart);
+  uint32_t count = 0U;
+
+  if (idx < 0)
+  {
+    return 0U;
+  }
+
+  while ((count < size) && SIM_QueuePush(&sim_context->usart[idx].rx, data[count]))
+  {
+    count++;
+  }
+  return count;
+}
+
+uint32_t SIM_UsartTake(USART_TypeDef *usart, uint8_t *data, uint32_t size)
+{
+  const int idx = SIM_UsartIndex(usart);
+  uint32_t count = 0U;
+
+  if (idx < 0)
+  {
+    return 0U;
+  }
+
+  while ((count < size) && (sim_context->usart[idx].tx.size != 0U))
+  {
+    data[count++] = SIM_QueuePop(&sim_context->usart[idx].tx);
+  }
+  return count;
+}
+
+uint32_t SIM_UsartAvailable(USART_TypeDef *usart)
+{
+  const int idx = SIM_UsartIndex(usart);
+  return (idx < 0) ? 0U : sim_context->usart[idx].tx.size;
+}
+
+uint64_t SIM_UsartNextEvent(void)
+{
+  uint64_t next = UINT64_MAX;
+  uint32_t i;
+
+  for (i = 0U; i < SIM_USARTS; i++)
+  {
+    const USART_TypeDef *u = &SIM_USART[i];
+    const SIM_UsartState *st = &sim_context->usart[i];
+    const uint64_t chr = SIM_UsartCharCycles(u);
+
+    if (!st->enabled)
+    {
+      continue;
+    }
+    if (st->shift_full && ((chr - st->tx_credit) < next))
+    {
+      next = chr - st->tx_credit;
+    }
+    if (SIM_UsartRxBusy(u, st) && ((chr - st->rx_credit) < next))
+    {
+      next = chr - st->rx_credit;
+    }
+  }
+  return next;
+}
+
+void SIM_UsartAdvance(uint64_t cycles)
+{
+  uint32_t i;
+
+  for (i = 0U; i < SIM_USARTS; i++)
+  {
+    USART_TypeDef *u = &SIM_USART[i];
+    SIM_UsartState *st = &sim_context->usart[i];
+    const uint64_t chr = SIM_UsartCharCycles(u);
+
+    if (!st->enabled)
+    {
+      continue;
+    }
+    st->sr &= u->SR | ~SIM_USART_RC_W0;
+
+    /* transmitter, the shift register goes out on the line */
+    st->tx_credit += cycles;
+    while (st->shift_full && (st->tx_credit >= chr))
+    {
+      st->tx_credit -= chr;
+      SIM_QueuePush(&st->tx, (uint8_t)st->shift);
+      st->shift_full = 0;
+      if (st->tdr_full)
+      {
+        st->shift = st->tdr;
+        st->shift_full = 1;
+        st->tdr_full = 0;
+        st->sr |= USART_SR_TXE;
+      }
+      else
+      {
+        st->sr |= USART_SR_TC;
+      }
+    }
+    if (!st->shift_full)
+    {
+      st->tx_credit = 0U;
+    }
+
+    /* receiver, one byte of the host per character time */
+    st->rx_credit += cycles;
+    while (SIM_UsartRxBusy(u, st) && (st->rx_credit >= chr))
+    {
+      st->rx_credit -= chr;
+      if (st->rx.size != 0U)
+      {
+        const uint8_t data = SIM_QueuePop(&st->rx);
+        if (st->sr & USART_SR_RXNE)
+        {
+          /* previous byte not read, the new one is lost */
+          st->sr |= USART_SR_ORE;
+        }
+        else
+        {
+          st->dr = SIM_USART_DR_MARK | data;
+          u->DR = st->dr;
+          st->sr |= USART_SR_RXNE;
+        }
+        st->idle_armed = 1;
+      }
+      else
+      {
+        st->sr |= USART_SR_IDLE;
+        st->idle_armed = 0;
+      }
+    }
+    if (!SIM_UsartRxBusy(u, st))
+    {
+      st->rx_credit = 0U;
+    }
+
+    u->SR = st->sr;
+  }
+}
+
+void SIM_UsartUpdate(void)
+{
+  uint32_t i;
+
+  for (i = 0U; i < SIM_USARTS; i++)
+  {
+    USART_TypeDef *u = &SIM_USART[i];
+    SIM_UsartState *st = &sim_context->usart[i];
+    uint32_t cr1, cr3, sr;
+
+    if ((u->CR1 & USART_CR1_UE) == 0U)
+    {
+      if (st->enabled)
+      {
+        st->enabled = 0;
+        st->tdr_full = 0;
+        st->shift_full = 0;
+        st->idle_armed = 0;
+      }
+      SIM_NvicSetLevel(sim_usart_irqs[i], 0);
+      continue;
+    }
+
+    if (!st->enabled)
+    {
+      st->enabled = 1;
+      st->sr = USART_SR_TXE | USART_SR_TC;
+      st->dr = SIM_USART_DR_MARK;
+      st->tx_credit = 0U;
+      st->rx_credit = 0U;
+      u->DR = st->dr;
+    }
+
+    /* bits cleared by writing 0 */
+    st->sr &= u->SR | ~SIM_USART_RC_W0;
+
+    for (;;)
+    {
+      /* data written by the software or DMA */
+      if ((u->DR & SIM_USART_DR_MARK) == 0U)
+      {
+        if (u->CR1 & USART_CR1_TE)
+        {
+          st->tdr = (uint16_t)(u->DR & 0x1FFU);
+          st->tdr_full = 1;
+          st->sr &= ~(USART_SR_TXE | USART_SR_TC);
+        }
+        u->DR = st->dr;
+      }
+
+      if (st->tdr_full && !st->shift_full)
+      {
+        st->shift = st->tdr;
+        st->shift_full = 1;
+        st->tdr_full = 0;
+        st->tx_credit = 0U;
+        st->sr |= USART_SR_TXE;
+      }
+
+      if ((u->CR3 & USART_CR3_DMAT) && (st->sr & USART_SR_TXE) && !st->tdr_full)
+      {
+        /* DMA may write a byte only, clear the mark so the write is seen */
+        u->DR = 0U;
+        if (SIM_UsartDmaRequest(sim_usart_tx_dma[i]))
+        {
+          continue;
+        }
+        u->DR = st->dr;
+      }
+
+      if ((u->CR3 & USART_CR3_DMAR) && (st->sr & USART_SR_RXNE) && SIM_UsartDmaRequest(sim_usart_rx_dma[i]))
+      {
+        st->sr &= ~USART_SR_RXNE;
+        continue;
+      }
+
+      break;
+    }
+
+    u->SR = st->sr;
+
+    cr1 = u->CR1;
+    cr3 = u->CR3;
+    sr = st->sr;
+    st->reasons = 0U;
+    if (cr1 & USART_CR1_RXNEIE)
+    {
+      st->reasons |= sr & (USART_SR_RXNE | USART_SR_ORE);
+    }
+    if (cr1 & USART_CR1_IDLEIE)
+    {
+      st->reasons |= sr & USART_SR_IDLE;
+    }
+    if (cr1 & USART_CR1_PEIE)
+    {
+      st->reasons |= sr & USART_SR_PE;
+    }
+    if (cr3 & USART_CR3_EIE)
+    {
+      st->reasons |= sr & (USART_SR_FE | USART_SR_NE | USART_SR_ORE);
+    }
+    SIM_NvicSetLevel(sim_usart_irqs[i], (st->reasons != 0U) ||
+                     ((sr & USART_SR_TXE) && (cr1 & USART_CR1_TXEIE)) ||
+                     ((sr & USART_SR_TC) && (cr1 & USART_CR1_TCIE)));
+  }
+}
+
+void SIM_UsartHandled(IRQn_Type IRQn)
+{
+  uint32_t i;
+
+  for (i = 0U; i < SIM_USARTS; i++)
+  {
+    /* the handler read SR and DR for every receive flag it was raised for */
+    if ((sim_usart_irqs[i] == IRQn) && sim_context->usart[i].enabled)
+    {
+      sim_context->usart[i].sr &= SIM_USART[i].SR | ~SIM_USART_RC_W0;
+      sim_context->usart[i].sr &= ~(sim_context->usart[i].reasons & SIM_USART_RX_READ);
+      sim_context->usart[i].reasons = 0U;
+      SIM_USART[i].SR = sim_context->usart[i].sr;
+    }
+  }
+}
+
+void SIM_UsartReset(void)
+{
+  memset(sim_context->usart, 0, sizeof(sim_context->usart));
+}
@@ -0,0 +1,87 @@
+/**
+  ******************************************************************************
+  * @file    sim_usart.h
+  * @brief   USART model of the host simulation.
+  *
+  *          Every enabled USART sends and receives one character per character
+  *          time, derived from BRR, word length and stop bits with the
+  *          peripheral clocked by the core clock. The host side is a byte
+  *          queue per direction: SIM_UsartInject() feeds the receiver,
+  *          SIM_UsartTake() collects what the transmitter sent. TXE, TC, RXNE,
+  *          ORE and IDLE follow the device, interrupts are raised through
+  *          sim_nvic.c and DMA requests go to sim_dma.c with the channel
+  *          mapping of the device.
+  *
+  *          Registers are plain memory, so the model can not see accesses:
+  *           - a write to DR is detected by bit 31, which the model keeps set
+  *             in DR, received data is found in the low bits of DR
+  *           - SR bits cleared by writing 0 (TC, RXNE) are taken over on the
+  *             next update
+  *           - reading DR can not be seen, RXNE, IDLE and the error flags are
+  *             taken as read once the USART handler ran for them or DMA
+  *             fetched the data
+  ******************************************************************************
+  */
+
+#ifndef __SIM_USART_H
+#define __SIM_USART_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include <stdint.h>
+#include "stm32f4xx.h"
+
+#define SIM_USART_QUEUE_SIZE  4096U         /*!< Bytes per direction and USART */
+#define SIM_USART_DR_MARK     0x80000000U   /*!< Set in DR while not written by the software */
+
+/**
+  * @brief  Queue bytes the host sends to the USART.
+  * @retval Number of bytes queued
+  */
+uint32_t SIM_UsartInject(USART_TypeDef *usart, const uint8_t *data, uint32_t size);
+
+/**
+  * @brief  Take bytes the USART sent to the host.
+  * @retval Number of bytes copied to data
+  */
+uint32_t SIM_UsartTake(USART_TypeDef *usart, uint8_t *data, uint32_t size);
+
+/**
+  * @brief  Number of sent bytes waiting in SIM_UsartTake().
+  */
+uint32_t SIM_UsartAvailable(USART_TypeDef *usart);
+
+/**
+  * @brief  Core cycles until the next character boundary of any busy USART,
+  *         UINT64_MAX if all are idle.
+  */
+uint64_t SIM_UsartNextEvent(void);
+
+/**
+  * @brief  Let the character timers run for cycles core clock cycles.
+  */
+void SIM_UsartAdvance(uint64_t cycles);
+
+/**
+  * @brief  Take over register writes of the software, serve DMA requests and
+  *         update the interrupt lines.
+  */
+void SIM_UsartUpdate(void);
+
+/**
+  * @brief  Called by the dispatcher after the handler of IRQn returned.
+  */
+void SIM_UsartHandled(IRQn_Type IRQn);
+
+/**
+  * @brief  Clear queues and internal state of all USARTs, registers are kept.
+  */
+void SIM_UsartReset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SIM_USART_H */
@@ -25,10 +25,7 @@ GPIO_TypeDef         SIM_GPIO[8];
 CRC_TypeDef          SIM_CRC;
 RCC_TypeDef          SIM_RCC;
 FLASH_TypeDef        SIM_FLASH;
-DMA_TypeDef          SIM_DMA1_BASE;
-DMA_Stream_TypeDef   SIM_DMA1_STREAM[8];
-DMA_TypeDef          SIM_DMA2_BASE;
-DMA_Stream_TypeDef   SIM_DMA2_STREAM[8];
+SIM_DMA_TypeDef      SIM_DMA[2] __attribute__((aligned(0x400)));
 DCMI_TypeDef         SIM_DCMI;
 FMC_Bank1_TypeDef    SIM_FMC_Bank1_R_BASE;
 FMC_Bank1E_TypeDef   SIM_FMC_Bank1E_R_BASE;
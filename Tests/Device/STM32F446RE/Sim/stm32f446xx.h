@@ -1083,6 +1083,17 @@ typedef struct
   * @{
   */ 
 
+/**
+  * @brief DMA controller with the register layout of the device. Instances are
+  *        aligned and spaced like on the device (1 kB), the HAL computes the
+  *        flag registers of a stream from its address.
+  */
+typedef struct
+{
+  DMA_TypeDef         BASE;       /*!< LISR, HISR, LIFCR, HIFCR, Address offset: 0x00 */
+  DMA_Stream_TypeDef  STREAM[8];  /*!< Streams 0 to 7,           Address offset: 0x10 */
+} __attribute__((aligned(0x400))) SIM_DMA_TypeDef;
+
 extern TIM_TypeDef          SIM_TIM[14];
 extern RTC_TypeDef          SIM_RTC;
 extern WWDG_TypeDef         SIM_WWDG;
@@ -1108,10 +1119,7 @@ extern GPIO_TypeDef         SIM_GPIO[8];
 extern CRC_TypeDef          SIM_CRC;
 extern RCC_TypeDef          SIM_RCC;
 extern FLASH_TypeDef        SIM_FLASH;
-extern DMA_TypeDef          SIM_DMA1_BASE;
-extern DMA_Stream_TypeDef   SIM_DMA1_STREAM[8];
-extern DMA_TypeDef          SIM_DMA2_BASE;
-extern DMA_Stream_TypeDef   SIM_DMA2_STREAM[8];
+extern SIM_DMA_TypeDef      SIM_DMA[2];
 extern DCMI_TypeDef         SIM_DCMI;
 extern FMC_Bank1_TypeDef    SIM_FMC_Bank1_R_BASE;
 extern FMC_Bank1E_TypeDef   SIM_FMC_Bank1E_R_BASE;
@@ -1162,7 +1170,7 @@ extern USB_OTG_GlobalTypeDef  SIM_USB_OTG_HS_PERIPH_BASE;
 #define TIM1                ((TIM_TypeDef *)      &SIM_TIM[0])
 #define TIM8                ((TIM_TypeDef *)      &SIM_TIM[7])
 #define USART1              ((USART_TypeDef *)    &SIM_USART[0])
-#define USART6              ((USART_TypeDef *)    &SIM_USART[1])
+#define USART6              ((USART_TypeDef *)    &SIM_USART[5])
 #define ADC1                ((ADC_TypeDef *)      &SIM_ADC[0])
 #define ADC2                ((ADC_TypeDef *)      &SIM_ADC[1])
 #define ADC3                ((ADC_TypeDef *)      &SIM_ADC[2])
@@ -1194,24 +1202,24 @@ extern USB_OTG_GlobalTypeDef  SIM_USB_OTG_HS_PERIPH_BASE;
 #define CRC                 ((CRC_TypeDef *)        &SIM_CRC)
 #define RCC                 ((RCC_TypeDef *)        &SIM_RCC)
 #define FLASH               ((FLASH_TypeDef *)      &SIM_FLASH)
-#define DMA1                ((DMA_TypeDef *)        &SIM_DMA1_BASE)
-#define DMA1_Stream0        ((DMA_Stream_TypeDef *) &SIM_DMA1_STREAM[0])
-#define DMA1_Stream1        ((DMA_Stream_TypeDef *) &SIM_DMA1_STREAM[1])
-#define DMA1_Stream2        ((DMA_Stream_TypeDef *) &SIM_DMA1_STREAM[2])
-#define DMA1_Stream3        ((DMA_Stream_TypeDef *) &SIM_DMA1_STREAM[3])
-#define DMA1_Stream4        ((DMA_Stream_TypeDef *) &SIM_DMA1_STREAM[4])
-#define DMA1_Stream5        ((DMA_Stream_TypeDef *) &SIM_DMA1_STREAM[5])
-#define DMA1_Stream6        ((DMA_Stream_TypeDef *) &SIM_DMA1_STREAM[6])
-#define DMA1_Stream7        ((DMA_Stream_TypeDef *) &SIM_DMA1_STREAM[7])
-#define DMA2                ((DMA_TypeDef *)        &SIM_DMA2_BASE)
-#define DMA2_Stream0        ((DMA_Stream_TypeDef *) &SIM_DMA2_STREAM[0])
-#define DMA2_Stream1        ((DMA_Stream_TypeDef *) &SIM_DMA2_STREAM[1])
-#define DMA2_Stream2        ((DMA_Stream_TypeDef *) &SIM_DMA2_STREAM[2])
-#define DMA2_Stream3        ((DMA_Stream_TypeDef *) &SIM_DMA2_STREAM[3])
-#define DMA2_Stream4        ((DMA_Stream_TypeDef *) &SIM_DMA2_STREAM[4])
-#define DMA2_Stream5        ((DMA_Stream_TypeDef *) &SIM_DMA2_STREAM[5])
-#define DMA2_Stream6        ((DMA_Stream_TypeDef *) &SIM_DMA2_STREAM[6])
-#define DMA2_Stream7        ((DMA_Stream_TypeDef *) &SIM_DMA2_STREAM[7])
+#define DMA1                ((DMA_TypeDef *)        &SIM_DMA[0].BASE)
+#define DMA1_Stream0        ((DMA_Stream_TypeDef *) &SIM_DMA[0].STREAM[0])
+#define DMA1_Stream1        ((DMA_Stream_TypeDef *) &SIM_DMA[0].STREAM[1])
+#define DMA1_Stream2        ((DMA_Stream_TypeDef *) &SIM_DMA[0].STREAM[2])
+#define DMA1_Stream3        ((DMA_Stream_TypeDef *) &SIM_DMA[0].STREAM[3])
+#define DMA1_Stream4        ((DMA_Stream_TypeDef *) &SIM_DMA[0].STREAM[4])
+#define DMA1_Stream5        ((DMA_Stream_TypeDef *) &SIM_DMA[0].STREAM[5])
+#define DMA1_Stream6        ((DMA_Stream_TypeDef *) &SIM_DMA[0].STREAM[6])
+#define DMA1_Stream7        ((DMA_Stream_TypeDef *) &SIM_DMA[0].STREAM[7])
+#define DMA2                ((DMA_TypeDef *)        &SIM_DMA[1].BASE)
+#define DMA2_Stream0        ((DMA_Stream_TypeDef *) &SIM_DMA[1].STREAM[0])
+#define DMA2_Stream1        ((DMA_Stream_TypeDef *) &SIM_DMA[1].STREAM[1])
+#define DMA2_Stream2        ((DMA_Stream_TypeDef *) &SIM_DMA[1].STREAM[2])
+#define DMA2_Stream3        ((DMA_Stream_TypeDef *) &SIM_DMA[1].STREAM[3])
+#define DMA2_Stream4        ((DMA_Stream_TypeDef *) &SIM_DMA[1].STREAM[4])
+#define DMA2_Stream5        ((DMA_Stream_TypeDef *) &SIM_DMA[1].STREAM[5])
+#define DMA2_Stream6        ((DMA_Stream_TypeDef *) &SIM_DMA[1].STREAM[6])
+#define DMA2_Stream7        ((DMA_Stream_TypeDef *) &SIM_DMA[1].STREAM[7])
 #define DCMI                ((DCMI_TypeDef *)       &SIM_DCMI)
 #define FMC_Bank1           ((FMC_Bank1_TypeDef *)  &SIM_FMC_Bank1_R_BASE)
 #define FMC_Bank1E          ((FMC_Bank1E_TypeDef *) &SIM_FMC_Bank1E_R_BASE)
@@ -0,0 +1,192 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file DispatchNode.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Node with virtual or statically bound subscribers and publishers
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef DISPATCH_NODE_H_
+#define DISPATCH_NODE_H_
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdint.h>
+
+#include "ros/node_handle.h"
+#include "geometry_msgs/Twist.h"
+#include "sensor_msgs/Imu.h"
+#include "std_msgs/Int32.h"
+/* -------------------------------------------------------------------------------*/
+
+/**
+ * @brief Hardware which reads from a fixed buffer and counts written bytes
+ */
+class DispatchHardware
+{
+  public:
+
+    DispatchHardware(void) :
+    _rx(nullptr),
+    _rx_size(0u),
+    _rx_pos(0u),
+    _tx_bytes(0u)
+    {
+
+    }
+
+    void init()
+    {
+      _rx_pos = 0u;
+    }
+
+    int read()
+    {
+      return (_rx_pos < _rx_size) ? _rx[_rx_pos++] : -1;
+    }
+
+    void write(uint8_t* data, int length)
+    {
+      (void) data;
+      _tx_bytes += static_cast<uint32_t>(length);
+    }
+
+    unsigned long time()
+    {
+      return 0u;
+    }
+
+    const uint8_t*  _rx;        //!< Frames handed out by read()
+    uint32_t        _rx_size;   //!< Size of _rx
+    uint32_t        _rx_pos;    //!< Next byte to read
+    uint32_t        _tx_bytes;  //!< Bytes passed to write()
+};
+
+void dispatchInt32(const std_msgs::Int32& msg);
+void dispatchTwist(const geometry_msgs::Twist& msg);
+void dispatchImu(const sensor_msgs::Imu& msg);
+
+/**
+ * @brief Three topics in each direction, either with the upstream
+ *        Subscriber / Publisher or with StaticSubscriber / StaticPublisher
+ *
+ * Subscriber ids are 100 to 102 in the order int32, twist, imu.
+ *
+ * @tparam STATIC       Use the statically bound classes
+ * @tparam NodeHandleT  Node handle on DispatchHardware
+ */
+template<bool STATIC, typename NodeHandleT>
+struct DispatchNode;
+
+template<typename NodeHandleT>
+struct DispatchNode<false, NodeHandleT>
+{
+  DispatchNode() :
+  sub_int32("int32", &dispatchInt32),
+  sub_twist("twist", &dispatchTwist),
+  sub_imu("imu", &dispatchImu),
+  pub_int32("int32_out", &int32),
+  pub_twist("twist_out", &twist),
+  pub_imu("imu_out", &imu)
+  {
+    nh.subscribe(sub_int32);
+    nh.subscribe(sub_twist);
+    nh.subscribe(sub_imu);
+    nh.advertise(pub_int32);
+    nh.advertise(pub_twist);
+    nh.advertise(pub_imu);
+  }
+
+  void publish()
+  {
+    pub_int32.publish(&int32);
+    pub_twist.publish(&twist);
+    pub_imu.publish(&imu);
+  }
+
+  NodeHandleT                             nh;
+  std_msgs::Int32                         int32;
+  geometry_msgs::Twist                    twist;
+  sensor_msgs::Imu                        imu;
+  ros::Subscriber<std_msgs::Int32>        sub_int32;
+  ros::Subscriber<geometry_msgs::Twist>   sub_twist;
+  ros::Subscriber<sensor_msgs::Imu>       sub_imu;
+  ros::Publisher                          pub_int32;
+  ros::Publisher                          pub_twist;
+  ros::Publisher                          pub_imu;
+};
+
+template<typename NodeHandleT>
+struct DispatchNode<true, NodeHandleT>
+{
+  DispatchNode() :
+  sub_int32("int32"),
+  sub_twist("twist"),
+  sub_imu("imu"),
+  pub_int32("int32_out", &int32),
+  pub_twist("twist_out", &twist),
+  pub_imu("imu_out", &imu)
+  {
+    nh.subscribe(sub_int32);
+    nh.subscribe(sub_twist);
+    nh.subscribe(sub_imu);
+    nh.advertise(pub_int32);
+    nh.advertise(pub_twist);
+    nh.advertise(pub_imu);
+  }
+
+  void publish()
+  {
+    pub_int32.publish(int32);
+    pub_twist.publish(twist);
+    pub_imu.publish(imu);
+  }
+
+  NodeHandleT                                                 nh;
+  std_msgs::Int32                                             int32;
+  geometry_msgs::Twist                                        twist;
+  sensor_msgs::Imu                                            imu;
+  ros::StaticSubscriber<std_msgs::Int32, &dispatchInt32>      sub_int32;
+  ros::StaticSubscriber<geometry_msgs::Twist, &dispatchTwist> sub_twist;
+  ros::StaticSubscriber<sensor_msgs::Imu, &dispatchImu>       sub_imu;
+  ros::StaticPublisher<std_msgs::Int32, NodeHandleT>          pub_int32;
+  ros::StaticPublisher<geometry_msgs::Twist, NodeHandleT>     pub_twist;
+  ros::StaticPublisher<sensor_msgs::Imu, NodeHandleT>         pub_imu;
+};
+
+#endif /* DISPATCH_NODE_H_ */
@@ -0,0 +1,315 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file MsgBench.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Serialization benchmark for the generated rosserial messages
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef MSG_BENCH_H_
+#define MSG_BENCH_H_
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+/* -------------------------------------------------------------------------------*/
+
+/* Benchmark Configuration -------------------------------------------------------*/
+constexpr uint32_t  MSG_BENCH_BUF_SIZE    = 8u * 1024u * 1024u; //!< Size of serialization buffers
+constexpr uint32_t  MSG_BENCH_STRINGS     = 64u;                //!< Number of random strings
+constexpr uint32_t  MSG_BENCH_STRING_LEN  = 24u;                //!< Maximum random string length
+/* -------------------------------------------------------------------------------*/
+
+/**
+ * @brief Deterministic random source used to fill messages
+ *
+ * Also owns everything allocated for variable length arrays, which is
+ * released together with the generator.
+ */
+class MsgBenchRng
+{
+  public:
+
+    explicit MsgBenchRng(const uint32_t seed) :
+    _state(seed ? seed : 0x9e3779b9u),
+    _strings(),
+    _deleters()
+    {
+      for(uint32_t idx = 0u; idx < MSG_BENCH_STRINGS; idx++)
+      {
+        std::string str(next() % MSG_BENCH_STRING_LEN, ' ');
+        for(auto& c : str)
+        {
+          c = static_cast<char>('a' + (next() % 26u));
+        }
+        _strings.push_back(str);
+      }
+    }
+
+    ~MsgBenchRng()
+    {
+      for(auto& del : _deleters)
+      {
+        del.first(del.second);
+      }
+    }
+
+    uint32_t next()
+    {
+      // xorshift32
+      _state ^= _state << 13u;
+      _state ^= _state >> 17u;
+      _state ^= _state << 5u;
+      return _state;
+    }
+
+    uint64_t next64()
+    {
+      return (static_cast<uint64_t>(next()) << 32u) | next();
+    }
+
+    /**
+     * @brief Random float in [-1000, 1000] which is exactly representable
+     *        in the float64 wire format as well
+     */
+    float nextFloat()
+    {
+      return (static_cast<float>(next() % 2000001u) - 1000000.0f) / 1024.0f;
+    }
+
+    char* nextString()
+    {
+      return &_strings[next() % MSG_BENCH_STRINGS][0];
+    }
+
+    template<typename T>
+    T* alloc(const uint32_t size)
+    {
+      if(0u == size)
+      {
+        return nullptr;
+      }
+
+      T* data = new T[size]();
+      _deleters.push_back(std::make_pair(&MsgBenchRng::release<T>, static_cast<void*>(data)));
+      return data;
+    }
+
+  private:
+
+    template<typename T>
+    static void release(void* data)
+    {
+      delete[] static_cast<T*>(data);
+    }
+
+    uint32_t                  _state;   //!< Generator state
+    std::vector<std::string>  _strings; //!< Pool of random strings
+    std::vector<std::pair<void (*)(void*), void*> > _deleters; //!< Allocated arrays
+};
+
+/**
+ * @brief Options of a benchmark run
+ */
+struct MsgBenchOptions
+{
+  uint32_t  seed;         //!< Seed for the random data
+  double    min_time_s;   //!< Minimum measurement time per direction
+  FILE*     dump;         //!< Optional file receiving the serialized bytes
+};
+
+/**
+ * @brief Result of one message at one array size
+ */
+struct MsgBenchResult
+{
+  uint32_t  array_size;     //!< Length of variable length arrays
+  uint32_t  bytes;          //!< Serialized size
+  double    serialize_ns;   //!< Time per serialize() call
+  double    deserialize_ns; //!< Time per deserialize() call
+  bool      round_trip;     //!< Deserialized message serializes to the same bytes
+  bool      length_check;   //!< wireLength() matches, truncated data is rejected
+};
+
+typedef bool (*MsgBenchFunc)(const MsgBenchOptions&, const uint32_t, MsgBenchResult&);
+
+/**
+ * @brief Benchmark registered for one message type
+ */
+struct MsgBenchEntry
+{
+  MsgBenchEntry(const char* type_name, MsgBenchFunc func) :
+  type(type_name),
+  bench(func)
+  {
+
+  }
+
+  const char*   type;  //!< ROS message type
+  MsgBenchFunc  bench; //!< Benchmark function
+};
+
+typedef std::vector<MsgBenchEntry> MsgBenchList;
+
+/**
+ * @brief Add all generated messages to the list
+ */
+void registerMessages(MsgBenchList& list);
+
+/**
+ * @brief Buffers of MSG_BENCH_BUF_SIZE shared by all benchmarks
+ */
+uint8_t* msgBenchBuffer(const uint32_t idx);
+
+/**
+ * @brief Run func repeatedly for at least min_time_s and return ns per call
+ */
+template<typename FuncT>
+double msgBenchMeasure(const double min_time_s, FuncT func)
+{
+  typedef std::chrono::steady_clock Clock;
+
+  uint64_t  iterations = 1u;
+  double    elapsed_ns = 0.0;
+
+  while(true)
+  {
+    const Clock::time_point start = Clock::now();
+    for(uint64_t idx = 0u; idx < iterations; idx++)
+    {
+      func();
+    }
+    elapsed_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+    if((elapsed_ns >= (min_time_s * 1e9)) || (iterations >= (1ull << 30u)))
+    {
+      break;
+    }
+    iterations *= 2u;
+  }
+
+  return elapsed_ns / static_cast<double>(iterations);
+}
+
+/**
+ * @brief Fill a message of type MsgT, check the round trip and time both
+ *        directions
+ *
+ * Deserialization terminates strings inside the input buffer, so every
+ * deserialize() call gets a fresh copy of the serialized data. The cost of
+ * that copy is measured separately and subtracted.
+ */
+template<typename MsgT, void (*Fill)(MsgT&, MsgBenchRng&, uint32_t, uint32_t)>
+bool benchMessage(const MsgBenchOptions& options, const uint32_t array_size, MsgBenchResult& result)
+{
+  uint8_t* const serialized   = msgBenchBuffer(0u);
+  uint8_t* const input        = msgBenchBuffer(1u);
+  uint8_t* const reserialized = msgBenchBuffer(2u);
+
+  MsgBenchRng rng(options.seed ^ (array_size * 0x01000193u));
+  MsgT        msg;
+  MsgT        copy;
+
+  Fill(msg, rng, array_size, 0u);
+
+  const int size = msg.serialize(serialized);
+  if((size < 0) || (static_cast<uint32_t>(size) > MSG_BENCH_BUF_SIZE))
+  {
+    return false;
+  }
+
+  // Round trip
+  memcpy(input, serialized, size);
+  const int used    = copy.deserialize(input);
+  const int resize  = copy.serialize(reserialized);
+
+  result.array_size = array_size;
+  result.bytes      = static_cast<uint32_t>(size);
+  result.round_trip = (used == size) && (resize == size) &&
+                      (0 == memcmp(serialized, reserialized, size));
+
+  // Bounds check: the full message validates, one byte less does not
+  memcpy(input, serialized, size);
+  result.length_check = (msg.wireLength(serialized, 0, size) == size) &&
+                        ((0 == size) || (copy.deserialize(input, size - 1) < 0)) &&
+                        (copy.deserialize(input, size) == size);
+
+  if(nullptr != options.dump)
+  {
+    fprintf(options.dump, "%s %u %d\n", msg.getType(), array_size, size);
+    fwrite(serialized, 1u, size, options.dump);
+    fputc('\n', options.dump);
+  }
+
+  if(options.min_time_s <= 0.0)
+  {
+    result.serialize_ns   = 0.0;
+    result.deserialize_ns = 0.0;
+    return true;
+  }
+
+  // Timing
+  result.serialize_ns = msgBenchMeasure(options.min_time_s, [&]() {
+    msg.serialize(serialized);
+    __asm__ __volatile__("" : : "r"(serialized) : "memory");
+  });
+
+  const double copy_ns = msgBenchMeasure(options.min_time_s, [&]() {
+    memcpy(input, serialized, size);
+    __asm__ __volatile__("" : : "r"(input) : "memory");
+  });
+
+  const double deserialize_ns = msgBenchMeasure(options.min_time_s, [&]() {
+    memcpy(input, serialized, size);
+    copy.deserialize(input);
+    __asm__ __volatile__("" : : "r"(input) : "memory");
+  });
+
+  result.deserialize_ns = (deserialize_ns > copy_ns) ? (deserialize_ns - copy_ns) : 0.0;
+
+  return true;
+}
+
+#endif /* MSG_BENCH_H_ */
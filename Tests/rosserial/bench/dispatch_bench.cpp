@@ -0,0 +1,199 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file dispatch_bench.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Virtual Subscriber / Publisher against StaticSubscriber / StaticPublisher
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdio.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "MsgBench.h"
+#include "DispatchNode.h"
+#include "ros/profiler.h"
+/* -------------------------------------------------------------------------------*/
+
+/* Benchmark Configuration -------------------------------------------------------*/
+constexpr double    DISPATCH_BENCH_TIME_S = 0.2;  //!< Measurement time per variant
+constexpr int       DISPATCH_BENCH_TOPICS = 3;    //!< Topics per direction of DispatchNode
+/* -------------------------------------------------------------------------------*/
+
+/**
+ * @brief Time stamp counter, nanoseconds where there is none
+ */
+struct DispatchClock
+{
+  static uint32_t cycles()
+  {
+#if defined(__x86_64__) || defined(__i386__)
+    return static_cast<uint32_t>(__rdtsc());
+#else
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint32_t>(ts.tv_sec * 1000000000ull + ts.tv_nsec);
+#endif
+  }
+};
+
+typedef ros::CycleProfiler<DispatchClock, 6> DispatchProfiler;
+typedef ros::NodeHandle_<DispatchHardware, 3, 3, 512, 512, DispatchProfiler> DispatchNodeHandle;
+
+static volatile int32_t dispatch_sink;
+
+void dispatchInt32(const std_msgs::Int32& msg)
+{
+  dispatch_sink = msg.data;
+}
+
+void dispatchTwist(const geometry_msgs::Twist& msg)
+{
+  dispatch_sink = static_cast<int32_t>(msg.linear.x);
+}
+
+void dispatchImu(const sensor_msgs::Imu& msg)
+{
+  dispatch_sink = static_cast<int32_t>(msg.orientation.w);
+}
+
+/**
+ * @brief Append a rosserial frame holding msg to buffer
+ *
+ * @return Size of the frame
+ */
+static uint32_t appendFrame(uint8_t* buffer, const uint16_t topic, const ros::Msg& msg)
+{
+  const uint16_t size = static_cast<uint16_t>(msg.serialize(buffer + 7u));
+
+  buffer[0] = 0xffu;
+  buffer[1] = 0xfeu;
+  buffer[2] = static_cast<uint8_t>(size & 0xffu);
+  buffer[3] = static_cast<uint8_t>(size >> 8u);
+  buffer[4] = static_cast<uint8_t>(255u - (((size & 0xffu) + (size >> 8u)) % 256u));
+  buffer[5] = static_cast<uint8_t>(topic & 0xffu);
+  buffer[6] = static_cast<uint8_t>(topic >> 8u);
+
+  uint32_t checksum = buffer[5] + buffer[6];
+  for(uint16_t idx = 0u; idx < size; idx++)
+  {
+    checksum += buffer[7u + idx];
+  }
+  buffer[7u + size] = static_cast<uint8_t>(255u - (checksum % 256u));
+
+  return 8u + size;
+}
+
+/**
+ * @brief Receive and publish one message per topic, print ns per message and
+ *        the mean ticks of the dispatch and serialize stages
+ */
+template<bool STATIC>
+static void run(const char* name, const uint8_t* frames, const uint32_t size)
+{
+  static DispatchNode<STATIC, DispatchNodeHandle> node;
+  DispatchHardware* hw = node.nh.getHardware();
+
+  node.nh.initNode();
+  node.int32.data = 7;
+  node.twist.linear.x = 0.5;
+  node.imu.orientation.w = 1.0;
+
+  /* a topic request configures the node handle, so it publishes */
+  uint8_t request[8];
+  request[0] = 0xffu;
+  request[1] = 0xfeu;
+  request[2] = 0u;
+  request[3] = 0u;
+  request[4] = 0xffu;
+  request[5] = 0u;
+  request[6] = 0u;
+  request[7] = 0xffu;
+  hw->_rx = request;
+  hw->_rx_size = sizeof(request);
+  hw->_rx_pos = 0u;
+  node.nh.spinOnce();
+
+  hw->_rx = frames;
+  hw->_rx_size = size;
+  node.nh.getProfiler()->reset();
+
+  const double receive_ns = msgBenchMeasure(DISPATCH_BENCH_TIME_S, [&]() {
+    hw->_rx_pos = 0u;
+    node.nh.spinOnce();
+  }) / DISPATCH_BENCH_TOPICS;
+
+  const double publish_ns = msgBenchMeasure(DISPATCH_BENCH_TIME_S, [&]() {
+    node.publish();
+    __asm__ __volatile__("" : : : "memory");
+  }) / DISPATCH_BENCH_TOPICS;
+
+  const DispatchProfiler* profiler = node.nh.getProfiler();
+  printf("%-10s %12.1f %12.1f %14u %14u\n", name, receive_ns, publish_ns,
+         profiler->getStage(ros::PROFILE_DISPATCH).mean(),
+         profiler->getStage(ros::PROFILE_SERIALIZE).mean());
+}
+
+/**
+ * @brief Compare both variants on the same frames
+ */
+int main()
+{
+  std_msgs::Int32       int32;
+  geometry_msgs::Twist  twist;
+  sensor_msgs::Imu      imu;
+  uint8_t               frames[1024];
+  uint32_t              size = 0u;
+
+  int32.data = 42;
+  twist.linear.x = 1.0;
+  imu.orientation.w = 1.0;
+  size += appendFrame(frames + size, 100u, int32);
+  size += appendFrame(frames + size, 101u, twist);
+  size += appendFrame(frames + size, 102u, imu);
+
+  printf("%-10s %12s %12s %14s %14s\n", "variant", "receive ns", "publish ns", "dispatch ticks", "serialize ticks");
+  run<false>("virtual", frames, size);
+  run<true>("static", frames, size);
+
+  return 0;
+}
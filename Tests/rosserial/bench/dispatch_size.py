@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+#
+# Report the flash used by virtual and statically bound subscribers
+#
+# Author: Martin Bauernschmitt
+# Date: 17.10.2026
+#
+# Usage: dispatch_size.py [--cxx <compiler>] [--flags "<flags>"]
+#
+# DispatchNode.h is compiled once with Subscriber / Publisher and once with
+# StaticSubscriber / StaticPublisher. Each object file holds the node, its
+# spinOnce() and the publishing of all topics. The size of .text and of the
+# read only data, which holds the vtables, is reported.
+#
+# The cross compiler is used when available, so the numbers match the
+# target. Otherwise the host compiler is used, which is only good for
+# relative comparisons.
+
+import argparse
+import os
+import shutil
+import subprocess
+import tempfile
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+ROSSERIAL_DIR = os.path.abspath(os.path.join(SCRIPT_DIR, '..', '..', '..', 'Middlewares', 'rosserial'))
+
+TARGET_CXX = 'arm-none-eabi-g++'
+TARGET_FLAGS = '-mcpu=cortex-m4 -mthumb -mfpu=fpv4-sp-d16 -mfloat-abi=hard -Os -fno-exceptions -fno-rtti'
+HOST_FLAGS = '-Os -fno-exceptions -fno-rtti'
+
+SOURCE = '''#include "DispatchNode.h"
+
+typedef ros::NodeHandle_<DispatchHardware, 3, 3, 512, 512> DispatchNodeHandle;
+
+DispatchNode<%s, DispatchNodeHandle> dispatch_node;
+
+int dispatch_spin()
+{
+  return dispatch_node.nh.spinOnce();
+}
+
+void dispatch_publish()
+{
+  dispatch_node.publish();
+}
+'''
+
+
+def measure(cxx, flags, static, work_dir):
+  name = 'static' if static else 'virtual'
+  source = os.path.join(work_dir, name + '.cpp')
+  obj = os.path.join(work_dir, name + '.o')
+
+  with open(source, 'w') as out:
+    out.write(SOURCE % ('true' if static else 'false'))
+
+  cmd = [cxx, '-std=c++11', '-c', '-I', ROSSERIAL_DIR, '-I', SCRIPT_DIR, source, '-o', obj] + flags.split()
+  subprocess.check_call(cmd)
+
+  text = 0
+  rodata = 0
+  output = subprocess.check_output(['size', '-A', obj]).decode()
+  for line in output.splitlines():
+    fields = line.split()
+    if not fields:
+      continue
+    if fields[0].startswith('.text'):
+      text += int(fields[1])
+    elif fields[0].startswith('.rodata') or fields[0].startswith('.data.rel.ro'):
+      rodata += int(fields[1])
+
+  return text, rodata
+
+
+def main():
+  parser = argparse.ArgumentParser(description='Flash of virtual and static dispatch')
+  parser.add_argument('--cxx', help='compiler (default: %s if available)' % TARGET_CXX)
+  parser.add_argument('--flags', help='compiler flags')
+  args = parser.parse_args()
+
+  cxx = args.cxx
+  if cxx is None:
+    cxx = TARGET_CXX if shutil.which(TARGET_CXX) else 'g++'
+  flags = args.flags
+  if flags is None:
+    flags = TARGET_FLAGS if cxx == TARGET_CXX else HOST_FLAGS
+
+  print('Compiler: %s %s' % (cxx, flags))
+
+  work_dir = tempfile.mkdtemp(prefix='dispatch_size_')
+  try:
+    print('%-10s %10s %10s %10s' % ('variant', 'text', 'rodata', 'total'))
+    for static in (False, True):
+      text, rodata = measure(cxx, flags, static, work_dir)
+      print('%-10s %10d %10d %10d' % ('static' if static else 'virtual', text, rodata, text + rodata))
+  finally:
+    shutil.rmtree(work_dir)
+
+
+if __name__ == '__main__':
+  main()
@@ -0,0 +1,191 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file dma_copy_bench.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Crossover between memcpy and the DMA2 copy service
+ * 
+ * For every size the CPU time of memcpy is compared with the CPU time the
+ * DMA path costs: queueing the copy in copy() plus the stream interrupt.
+ * The DMA latency is the simulated time until the callback. CPU times are
+ * host nanoseconds, so the crossover printed here holds for the host. On
+ * the device the same program with the DWT cycle counter as clock gives
+ * the value for STM_DMA_COPY_THRESHOLD.
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "STMDmaCopy.h"
+#include "sim_clock.h"
+#include "sim_dma.h"
+#include "sim_nvic.h"
+/* -------------------------------------------------------------------------------*/
+
+/* Benchmark Configuration -------------------------------------------------------*/
+constexpr uint32_t  DMA_BENCH_MAX_SIZE  = 65536u;   //!< Largest copy
+constexpr int       DMA_BENCH_RUNS      = 200;      //!< Copies per size, the fastest one counts
+/* -------------------------------------------------------------------------------*/
+
+// DMA buffers need static storage, see sim_dma.h
+static ros::STMDmaCopy  dma_copy(DMA2_Stream0, 0u);
+static uint8_t          src_data[DMA_BENCH_MAX_SIZE] __attribute__((aligned(4)));
+static uint8_t          dst_data[DMA_BENCH_MAX_SIZE] __attribute__((aligned(4)));
+static uint64_t         irq_ns;
+static bool             copy_done;
+static uint64_t         done_cycles;
+
+static uint64_t hostNs()
+{
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+extern "C"
+{
+  void DMA2_Stream0_IRQHandler(void)
+  {
+    const uint64_t start = hostNs();
+    dma_copy.irq();
+    irq_ns += hostNs() - start;
+  }
+}
+
+static void copyDone(void*)
+{
+  copy_done = true;
+  done_cycles = SIM_ClockGetCycles();
+}
+
+/**
+ * @brief Fastest memcpy of size bytes in ns
+ */
+static uint64_t measureCpu(const uint32_t size)
+{
+  uint64_t best = UINT64_MAX;
+
+  for(int run = 0; run < DMA_BENCH_RUNS; run++)
+  {
+    const uint64_t start = hostNs();
+    memcpy(dst_data, src_data, size);
+    __asm__ volatile("" : : "r"(dst_data) : "memory");
+    const uint64_t elapsed = hostNs() - start;
+    best = (elapsed < best) ? elapsed : best;
+  }
+  return best;
+}
+
+/**
+ * @brief Fastest CPU time of a DMA copy in ns and its simulated latency
+ */
+static uint64_t measureDma(const uint32_t size, const bool aligned, uint64_t& latency)
+{
+  uint8_t* const dst = aligned ? dst_data : &dst_data[1];
+  const uint32_t length = aligned ? size : size - 1u;
+  uint64_t best = UINT64_MAX;
+
+  for(int run = 0; run < DMA_BENCH_RUNS; run++)
+  {
+    copy_done = false;
+    irq_ns = 0u;
+    const uint64_t start_cycles = SIM_ClockGetCycles();
+
+    const uint64_t start = hostNs();
+    dma_copy.copy(dst, src_data, length, copyDone, nullptr);
+    const uint64_t issue = hostNs() - start;
+
+    // The clock stops at every flag of the stream, the callback sees the
+    // cycle of the transfer complete interrupt
+    while(!copy_done)
+    {
+      SIM_ClockAdvance(4096u);
+    }
+    latency = done_cycles - start_cycles;
+
+    const uint64_t elapsed = issue + irq_ns;
+    best = (elapsed < best) ? elapsed : best;
+  }
+  return best;
+}
+
+/**
+ * @brief Copy sizes from 16 bytes to 64 kB
+ *
+ * Usage: dma_copy_bench
+ */
+int main(int, char**)
+{
+  uint32_t crossover = 0u;
+
+  SIM_ClockReset();
+  dma_copy.init();
+  NVIC_EnableIRQ(DMA2_Stream0_IRQn);
+
+  printf("%8s %10s %10s %14s %10s %14s\n", "bytes", "memcpy ns", "dma cpu ns", "dma cycles", "bytes dma", "bytes cycles");
+  for(uint32_t size = 16u; size <= DMA_BENCH_MAX_SIZE; size *= 2u)
+  {
+    uint64_t latency = 0u, latency_bytes = 0u;
+    const uint64_t cpu_ns = measureCpu(size);
+    const uint64_t dma_ns = measureDma(size, true, latency);
+    const uint64_t bytes_ns = measureDma(size, false, latency_bytes);
+
+    printf("%8u %10llu %10llu %14llu %10llu %14llu\n", size,
+           static_cast<unsigned long long>(cpu_ns), static_cast<unsigned long long>(dma_ns),
+           static_cast<unsigned long long>(latency), static_cast<unsigned long long>(bytes_ns),
+           static_cast<unsigned long long>(latency_bytes));
+
+    if((0u == crossover) && (cpu_ns > dma_ns))
+    {
+      crossover = size;
+    }
+  }
+
+  if(0u != crossover)
+  {
+    printf("\nDMA costs the CPU less than memcpy from %u bytes\n", crossover);
+  }
+  else
+  {
+    printf("\nmemcpy is cheaper for all sizes\n");
+  }
+  return 0;
+}
@@ -0,0 +1,215 @@
+#!/usr/bin/env python3
+#
+# Generate the message benchmark sources for every rosserial message header
+#
+# Author: Martin Bauernschmitt
+# Date: 17.10.2026
+#
+# Usage: gen_msg_bench.py <rosserial dir> <output dir>
+#
+# The message headers are parsed for their field declarations. For every
+# package one source file is written which fills all its messages with
+# random data and registers them in the benchmark. One file per package keeps
+# headers with clashing include guards (e.g. roscpp/Empty.h and
+# std_srvs/Empty.h) out of the same translation unit.
+
+import io
+import os
+import re
+import sys
+
+# Directories which do not contain generated messages
+SKIP_DIRS = ('ros',)
+SKIP_FILES = ('tf/tf.h', 'tf/transform_broadcaster.h')
+
+INT_TYPES = ('int8_t', 'uint8_t', 'int16_t', 'uint16_t', 'int32_t',
+             'uint32_t', 'int64_t', 'uint64_t')
+STRING_TYPES = ('const char*', 'char*')
+TIME_TYPES = ('ros::Time', 'ros::Duration')
+
+
+class Field(object):
+  def __init__(self, name, type_name, kind, count=None):
+    self.name = name
+    self.type = type_name
+    self.kind = kind        # scalar, fixarray or vararray
+    self.count = count
+
+
+class Message(object):
+  def __init__(self, header, namespace, name, fields):
+    self.header = header
+    self.namespace = namespace
+    self.name = name
+    self.fields = fields
+
+  @property
+  def cpp_type(self):
+    return '%s::%s' % (self.namespace, self.name)
+
+  @property
+  def ros_type(self):
+    return '%s/%s' % (self.namespace, self.name)
+
+
+def find_headers(root):
+  headers = []
+  for package in sorted(os.listdir(root)):
+    path = os.path.join(root, package)
+    if not os.path.isdir(path) or package in SKIP_DIRS:
+      continue
+    for name in sorted(os.listdir(path)):
+      rel = '%s/%s' % (package, name)
+      if name.endswith('.h') and rel not in SKIP_FILES:
+        headers.append(rel)
+  return headers
+
+
+def parse_header(root, rel):
+  text = open(os.path.join(root, rel)).read()
+  namespace = re.search(r'^namespace (\w+)', text, re.M)
+  if namespace is None:
+    return []
+  namespace = namespace.group(1)
+  messages = []
+  pattern = r'\n  class (\w+) : public ros::Msg\n  \{\n    public:\n(.*?)\n    \1\(\)'
+  for match in re.finditer(pattern, text, re.S):
+    name, body = match.group(1), match.group(2)
+    types = {}
+    fields = []
+    for line in body.split('\n'):
+      line = line.strip()
+      m = re.match(r'typedef (.+) _(\w+)_type;$', line)
+      if m:
+        types[m.group(2)] = m.group(1).strip()
+        continue
+      m = re.match(r'_(\w+)_type \* \1;$', line)
+      if m:
+        fields.append(Field(m.group(1), types[m.group(1)], 'vararray'))
+        continue
+      m = re.match(r'_(\w+)_type \1\[(\d+)\];$', line)
+      if m:
+        fields.append(Field(m.group(1), types[m.group(1)], 'fixarray', int(m.group(2))))
+        continue
+      m = re.match(r'([\w:]+) (\w+)\[(\d+)\];$', line)
+      if m:
+        fields.append(Field(m.group(2), m.group(1), 'fixarray', int(m.group(3))))
+        continue
+      m = re.match(r'_(\w+)_type \1;$', line)
+      if m:
+        fields.append(Field(m.group(1), types[m.group(1)], 'scalar'))
+        continue
+      if (not line or line.startswith('enum') or line.startswith('static const')
+          or re.match(r'uint32_t \w+_(length|capacity);$', line) or re.match(r'_(\w+)_type st_\1;$', line)):
+        continue
+      raise ValueError('%s: cannot parse "%s"' % (rel, line))
+    messages.append(Message(rel, namespace, name, fields))
+  return messages
+
+
+def fill_value(type_name, target):
+  """Return the statement filling a single value of the given type"""
+  if type_name == 'float':
+    return '%s = rng.nextFloat();' % target
+  if type_name == 'bool':
+    return '%s = (rng.next() & 1u) != 0u;' % target
+  if type_name in INT_TYPES:
+    return '%s = static_cast<%s>(rng.next64());' % (target, type_name)
+  if type_name in STRING_TYPES:
+    return '%s = rng.nextString();' % target
+  if type_name in TIME_TYPES:
+    return '%s.sec = rng.next(); %s.nsec = rng.next() %% 1000000000u;' % (target, target)
+  return 'fill(%s, rng, size, depth + 1u);' % target
+
+
+def write_fill(out, msg):
+  out.write('void fill(%s& msg, MsgBenchRng& rng, uint32_t size, uint32_t depth)\n{\n' % msg.cpp_type)
+  if not msg.fields:
+    out.write('  (void)msg; (void)rng; (void)size; (void)depth;\n')
+  else:
+    out.write('  const uint32_t length = (0u == depth) ? size : ((size < 2u) ? size : 2u);\n')
+    out.write('  (void)length;\n')
+  for field in msg.fields:
+    target = 'msg.%s' % field.name
+    if field.kind == 'scalar':
+      out.write('  %s\n' % fill_value(field.type, target))
+    elif field.kind == 'fixarray':
+      out.write('  for(uint32_t idx = 0u; idx < %du; idx++)\n' % field.count)
+      out.write('  {\n    %s\n  }\n' % fill_value(field.type, target + '[idx]'))
+    else:
+      out.write('  %s_length = length;\n' % target)
+      out.write('  %s = rng.alloc<%s>(length);\n' % (target, field.type))
+      out.write('  for(uint32_t idx = 0u; idx < length; idx++)\n')
+      out.write('  {\n    %s\n  }\n' % fill_value(field.type, target + '[idx]'))
+  out.write('}\n\n')
+
+
+def write_if_changed(path, text):
+  # Keeps timestamps of unchanged files so a reconfigure does not rebuild them
+  if os.path.exists(path) and open(path).read() == text:
+    return
+  with open(path, 'w') as out:
+    out.write(text)
+
+
+def main():
+  root, out_dir = sys.argv[1], sys.argv[2]
+  if not os.path.isdir(out_dir):
+    os.makedirs(out_dir)
+
+  packages = {}
+  for header in find_headers(root):
+    packages.setdefault(header.split('/')[0], []).append(header)
+
+  all_messages = []
+  names = []
+  for package, headers in sorted(packages.items()):
+    messages = []
+    msg_headers = []
+    for header in headers:
+      parsed = parse_header(root, header)
+      if parsed:
+        msg_headers.append(header)
+        messages.extend(parsed)
+    all_messages.extend(messages)
+    if not messages:
+      continue
+
+    names.append(package)
+    out = io.StringIO()
+    out.write('// Generated by gen_msg_bench.py, do not edit\n\n')
+    for header in msg_headers:
+      out.write('#include "%s"\n' % header)
+    out.write('#include "MsgBench.h"\n#include "msg_bench_fill.h"\n\n')
+    for msg in messages:
+      write_fill(out, msg)
+    out.write('void registerMessages_%s(MsgBenchList& list)\n{\n' % package)
+    for msg in messages:
+      out.write('  list.push_back(MsgBenchEntry("%s", &benchMessage<%s, &fill>));\n' % (msg.ros_type, msg.cpp_type))
+    out.write('}\n')
+    write_if_changed(os.path.join(out_dir, 'msg_bench_%s.cpp' % package), out.getvalue())
+
+  out = io.StringIO()
+  out.write('// Generated by gen_msg_bench.py, do not edit\n\n')
+  out.write('#ifndef MSG_BENCH_FILL_H_\n#define MSG_BENCH_FILL_H_\n\n#include "MsgBench.h"\n\n')
+  for msg in all_messages:
+    out.write('namespace %s { class %s; }\n' % (msg.namespace, msg.name))
+  out.write('\n')
+  for msg in all_messages:
+    out.write('void fill(%s& msg, MsgBenchRng& rng, uint32_t size, uint32_t depth);\n' % msg.cpp_type)
+  out.write('\n#endif\n')
+  write_if_changed(os.path.join(out_dir, 'msg_bench_fill.h'), out.getvalue())
+
+  out = io.StringIO()
+  out.write('// Generated by gen_msg_bench.py, do not edit\n\n#include "MsgBench.h"\n\n')
+  for package in names:
+    out.write('void registerMessages_%s(MsgBenchList& list);\n' % package)
+  out.write('\nvoid registerMessages(MsgBenchList& list)\n{\n')
+  for package in names:
+    out.write('  registerMessages_%s(list);\n' % package)
+  out.write('}\n')
+  write_if_changed(os.path.join(out_dir, 'msg_bench_registry.cpp'), out.getvalue())
+
+
+if __name__ == '__main__':
+  main()
@@ -0,0 +1,207 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file main.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Benchmark of the generated rosserial messages
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "MsgBench.h"
+/* -------------------------------------------------------------------------------*/
+
+static uint8_t bench_buffers[3][MSG_BENCH_BUF_SIZE];
+
+uint8_t* msgBenchBuffer(const uint32_t idx)
+{
+  return bench_buffers[idx];
+}
+
+static void printUsage(const char* name)
+{
+  printf("Usage: %s [options]\n", name);
+  printf("  --sizes <a,b,..>    Lengths of variable length arrays (default 0,1,16,128)\n");
+  printf("  --min-time <s>      Minimum measurement time per direction (default 0.01,\n");
+  printf("                      0 only checks the round trip)\n");
+  printf("  --filter <text>     Only run message types containing text\n");
+  printf("  --seed <n>          Seed of the random data (default 1)\n");
+  printf("  --json <file>       Write results as JSON to file instead of stdout\n");
+  printf("  --dump <file>       Write the serialized messages to file\n");
+}
+
+static std::vector<uint32_t> parseSizes(const char* arg)
+{
+  std::vector<uint32_t> sizes;
+  std::string           list(arg);
+  size_t                start = 0u;
+
+  while(start <= list.size())
+  {
+    size_t end = list.find(',', start);
+    if(std::string::npos == end)
+    {
+      end = list.size();
+    }
+    if(end > start)
+    {
+      sizes.push_back(static_cast<uint32_t>(strtoul(list.substr(start, end - start).c_str(), nullptr, 10)));
+    }
+    start = end + 1u;
+  }
+
+  return sizes;
+}
+
+/**
+ * @brief Benchmark serialization of all generated messages
+ */
+int main(int argc, char** argv)
+{
+  MsgBenchOptions       options = {1u, 0.01, nullptr};
+  std::vector<uint32_t> sizes   = {0u, 1u, 16u, 128u};
+  const char*           filter  = nullptr;
+  const char*           json    = nullptr;
+
+  for(int idx = 1; idx < argc; idx++)
+  {
+    const bool has_value = (idx + 1) < argc;
+
+    if(has_value && (0 == strcmp(argv[idx], "--sizes")))
+    {
+      sizes = parseSizes(argv[++idx]);
+    }
+    else if(has_value && (0 == strcmp(argv[idx], "--min-time")))
+    {
+      options.min_time_s = atof(argv[++idx]);
+    }
+    else if(has_value && (0 == strcmp(argv[idx], "--filter")))
+    {
+      filter = argv[++idx];
+    }
+    else if(has_value && (0 == strcmp(argv[idx], "--seed")))
+    {
+      options.seed = static_cast<uint32_t>(strtoul(argv[++idx], nullptr, 10));
+    }
+    else if(has_value && (0 == strcmp(argv[idx], "--json")))
+    {
+      json = argv[++idx];
+    }
+    else if(has_value && (0 == strcmp(argv[idx], "--dump")))
+    {
+      options.dump = fopen(argv[++idx], "wb");
+    }
+    else
+    {
+      printUsage(argv[0]);
+      return 2;
+    }
+  }
+
+  FILE* out = (nullptr != json) ? fopen(json, "w") : stdout;
+  if(nullptr == out)
+  {
+    fprintf(stderr, "Cannot open %s\n", json);
+    return 2;
+  }
+
+  MsgBenchList list;
+  registerMessages(list);
+
+  uint32_t failures = 0u;
+  bool     first    = true;
+
+  fprintf(out, "[\n");
+  for(const auto& entry : list)
+  {
+    if((nullptr != filter) && (nullptr == strstr(entry.type, filter)))
+    {
+      continue;
+    }
+
+    for(const auto size : sizes)
+    {
+      MsgBenchResult result;
+      if(!entry.bench(options, size, result))
+      {
+        fprintf(stderr, "%s[%u]: serialized size exceeds buffer\n", entry.type, size);
+        failures++;
+        continue;
+      }
+
+      if(!result.round_trip)
+      {
+        fprintf(stderr, "%s[%u]: round trip mismatch\n", entry.type, size);
+        failures++;
+      }
+
+      if(!result.length_check)
+      {
+        fprintf(stderr, "%s[%u]: length check failed\n", entry.type, size);
+        failures++;
+      }
+
+      fprintf(out, "%s  {\"type\": \"%s\", \"array_size\": %u, \"bytes\": %u, "
+                   "\"serialize_ns\": %.1f, \"deserialize_ns\": %.1f, \"round_trip\": %s, "
+                   "\"length_check\": %s}",
+              first ? "" : ",\n", entry.type, result.array_size, result.bytes,
+              result.serialize_ns, result.deserialize_ns, result.round_trip ? "true" : "false",
+              result.length_check ? "true" : "false");
+      first = false;
+    }
+  }
+  fprintf(out, "\n]\n");
+
+  if(stdout != out)
+  {
+    fclose(out);
+  }
+  if(nullptr != options.dump)
+  {
+    fclose(options.dump);
+  }
+
+  return (0u == failures) ? 0 : 1;
+}
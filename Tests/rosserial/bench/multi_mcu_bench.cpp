@@ -0,0 +1,389 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file multi_mcu_bench.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Several simulated nodes rebooting at once behind one serial hub
+ * 
+ * All devices boot at the same time and the host negotiates with all of them
+ * like rosserial_python does: it requests the topics, answers every time
+ * request and repeats the request when a node did not announce all its
+ * topics within a second. Afterwards every node publishes all its topics at
+ * a fixed rate and the host counts the messages which arrive. The hub link
+ * is the shared bottleneck, its bandwidth is swept or given on the command
+ * line: multi_mcu_bench [devices] [bandwidth in bytes/s, 0 = unlimited]
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <new>
+
+#include "ros/node_handle.h"
+#include "std_msgs/Int32.h"
+#include "SimSerialHardware.h"
+#include "sim_device.h"
+#include "sim_hub.h"
+/* -------------------------------------------------------------------------------*/
+
+/* Benchmark Configuration -------------------------------------------------------*/
+constexpr uint32_t  MULTI_BENCH_DEVICES     = 6u;       //!< Default number of devices
+constexpr int       MULTI_BENCH_PUBS        = 6;        //!< Publishers per node
+constexpr int       MULTI_BENCH_SUBS        = 2;        //!< Subscribers per node
+constexpr uint32_t  MULTI_BENCH_RATE_HZ     = 50u;      //!< Publish rate of every topic
+constexpr uint32_t  MULTI_BENCH_QUANTUM_US  = 250u;     //!< Lock step of the hub
+constexpr uint32_t  MULTI_BENCH_RETRY_MS    = 1000u;    //!< Host repeats the topic request
+constexpr uint32_t  MULTI_BENCH_STORM_MS    = 10000u;   //!< Limit of the negotiation phase
+constexpr uint32_t  MULTI_BENCH_STEADY_MS   = 5000u;    //!< Length of the publishing phase
+/* -------------------------------------------------------------------------------*/
+
+typedef ros::NodeHandle_<SimSerialHardware, MULTI_BENCH_SUBS, MULTI_BENCH_PUBS, 256, 1024> BenchNodeHandle;
+
+static void int32Callback(const std_msgs::Int32&)
+{
+}
+
+/**
+ * @brief Firmware of one device, publishes once connected
+ *
+ * Publishers and subscribers are members, their topic names are filled in
+ * by setup() before they are registered.
+ */
+struct BenchNode
+{
+  static_assert((MULTI_BENCH_PUBS == 6) && (MULTI_BENCH_SUBS == 2), "Update the initializers of pubs and subs");
+
+  BenchNode() :
+  pubs{{names[0], &msg}, {names[1], &msg}, {names[2], &msg},
+       {names[3], &msg}, {names[4], &msg}, {names[5], &msg}},
+  subs{{names[MULTI_BENCH_PUBS], int32Callback}, {names[MULTI_BENCH_PUBS + 1], int32Callback}}
+  {
+
+  }
+
+  BenchNodeHandle                     nh;
+  char                                names[MULTI_BENCH_PUBS + MULTI_BENCH_SUBS][32];
+  std_msgs::Int32                     msg;
+  ros::Publisher                      pubs[MULTI_BENCH_PUBS];
+  ros::Subscriber<std_msgs::Int32>    subs[MULTI_BENCH_SUBS];
+  bool                                publishing;
+  uint32_t                            next_publish;
+  uint32_t                            published;
+
+  void setup(const uint32_t device)
+  {
+    for(int idx = 0; idx < MULTI_BENCH_PUBS; idx++)
+    {
+      snprintf(names[idx], sizeof(names[idx]), "n%u/pub%d", device, idx);
+    }
+    for(int idx = 0; idx < MULTI_BENCH_SUBS; idx++)
+    {
+      snprintf(names[MULTI_BENCH_PUBS + idx], sizeof(names[MULTI_BENCH_PUBS + idx]), "n%u/sub%d", device, idx);
+    }
+
+    HAL_InitTick(0u);
+    nh.initNode();
+    for(int idx = 0; idx < MULTI_BENCH_PUBS; idx++)
+    {
+      nh.advertise(pubs[idx]);
+    }
+    for(int idx = 0; idx < MULTI_BENCH_SUBS; idx++)
+    {
+      nh.subscribe(subs[idx]);
+    }
+    publishing    = false;
+    next_publish  = 0u;
+    published     = 0u;
+  }
+};
+
+/* Static like the firmware, the simulated DMA registers only hold 32 bit addresses */
+alignas(BenchNode) static uint8_t node_storage[SIM_HUB_PORTS][sizeof(BenchNode)];
+
+static void benchLoop(void* arg)
+{
+  BenchNode* node = static_cast<BenchNode*>(arg);
+
+  node->nh.spinOnce();
+  if(node->publishing && node->nh.connected() && (HAL_GetTick() >= node->next_publish))
+  {
+    node->next_publish = HAL_GetTick() + 1000u / MULTI_BENCH_RATE_HZ;
+    for(int idx = 0; idx < MULTI_BENCH_PUBS; idx++)
+    {
+      node->msg.data = static_cast<int32_t>(node->published++);
+      node->pubs[idx].publish(&node->msg);
+    }
+  }
+}
+
+/**
+ * @brief Host side of one port, collects frames and negotiates
+ */
+struct HostPort
+{
+  uint8_t   buffer[2u * SIM_HUB_BUFFER_SIZE];
+  uint32_t  size;
+  uint32_t  topics;         //!< Topic infos since the last request
+  uint32_t  requests;       //!< Topic requests sent
+  uint32_t  requested_ms;   //!< Time of the last request
+  uint32_t  negotiated_ms;  //!< Time all topics were known, 0 before
+  uint32_t  messages;       //!< Data frames received
+  uint32_t  bad;            //!< Bytes skipped to find a frame
+};
+
+static void sendFrame(SIM_Hub* hub, const int port, const uint16_t topic, const uint8_t* payload, const uint16_t size)
+{
+  uint8_t frame[32];
+  uint32_t checksum = (topic & 0xffu) + (topic >> 8u);
+
+  frame[0] = 0xffu;
+  frame[1] = 0xfeu;
+  frame[2] = static_cast<uint8_t>(size & 0xffu);
+  frame[3] = static_cast<uint8_t>(size >> 8u);
+  frame[4] = static_cast<uint8_t>(255u - (((size & 0xffu) + (size >> 8u)) % 256u));
+  frame[5] = static_cast<uint8_t>(topic & 0xffu);
+  frame[6] = static_cast<uint8_t>(topic >> 8u);
+  for(uint16_t idx = 0u; idx < size; idx++)
+  {
+    frame[7u + idx] = payload[idx];
+    checksum += payload[idx];
+  }
+  frame[7u + size] = static_cast<uint8_t>(255u - (checksum % 256u));
+  SIM_HubWrite(hub, port, frame, 8u + size);
+}
+
+/**
+ * @brief Read a port and handle all complete frames
+ */
+static void hostPoll(SIM_Hub* hub, const int port, HostPort& host, const uint32_t now_ms)
+{
+  uint32_t pos = 0u;
+
+  host.size += SIM_HubRead(hub, port, &host.buffer[host.size], sizeof(host.buffer) - host.size);
+
+  while(pos + 8u <= host.size)
+  {
+    const uint8_t* frame = &host.buffer[pos];
+    const uint32_t length = frame[2] | (frame[3] << 8u);
+
+    if((0xffu != frame[0]) || (0xfeu != frame[1]) || ((frame[2] + frame[3] + frame[4]) % 256u != 255u))
+    {
+      pos++;
+      host.bad++;
+      continue;
+    }
+    if(pos + 8u + length > host.size)
+    {
+      break;
+    }
+
+    const uint16_t topic = static_cast<uint16_t>(frame[5] | (frame[6] << 8u));
+    if(ros::TopicInfo::ID_TIME == topic)
+    {
+      const uint8_t time[8] = {0u};
+      sendFrame(hub, port, ros::TopicInfo::ID_TIME, time, sizeof(time));
+    }
+    else if((ros::TopicInfo::ID_PUBLISHER == topic) || (ros::TopicInfo::ID_SUBSCRIBER == topic))
+    {
+      host.topics++;
+      if((MULTI_BENCH_PUBS + MULTI_BENCH_SUBS == host.topics) && (0u == host.negotiated_ms))
+      {
+        host.negotiated_ms = now_ms;
+      }
+    }
+    else if(topic >= 100u)
+    {
+      host.messages++;
+    }
+    pos += 8u + length;
+  }
+
+  memmove(host.buffer, &host.buffer[pos], host.size - pos);
+  host.size -= pos;
+
+  // Ask again when the node did not answer completely
+  if((0u == host.negotiated_ms) && ((0u == host.requests) || (now_ms - host.requested_ms >= MULTI_BENCH_RETRY_MS)))
+  {
+    sendFrame(hub, port, ros::TopicInfo::ID_PUBLISHER, nullptr, 0u);
+    host.topics = 0u;
+    host.requests++;
+    host.requested_ms = now_ms;
+  }
+}
+
+static double wallSeconds()
+{
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Boot all devices at once, negotiate and publish
+ */
+static void runBench(const uint32_t devices, const uint32_t bandwidth)
+{
+  SIM_Hub* hub = SIM_HubCreate(bandwidth, MULTI_BENCH_QUANTUM_US);
+  SIM_Device** device = new SIM_Device*[devices];
+  BenchNode** nodes = new BenchNode*[devices];
+  HostPort* hosts = new HostPort[devices]();
+  uint32_t now_ms = 0u, all_ms = 0u, requests = 0u, messages = 0u, published = 0u, bad = 0u;
+  uint64_t up = 0u, down = 0u, dropped = 0u;
+  uint32_t max_backlog = 0u;
+
+  for(uint32_t idx = 0u; idx < devices; idx++)
+  {
+    device[idx] = SIM_DeviceCreate();
+    nodes[idx] = new(node_storage[idx]) BenchNode();
+    SIM_DeviceSelect(device[idx]);
+    nodes[idx]->setup(idx);
+    SIM_HubConnect(hub, device[idx], USART2, benchLoop, nodes[idx]);
+  }
+  SIM_DeviceSelect(nullptr);
+
+  const double start = wallSeconds();
+
+  // Negotiation storm
+  for(; (now_ms < MULTI_BENCH_STORM_MS) && (0u == all_ms); now_ms++)
+  {
+    SIM_HubRun(hub, 1000u);
+    all_ms = now_ms;
+    for(uint32_t idx = 0u; idx < devices; idx++)
+    {
+      hostPoll(hub, static_cast<int>(idx), hosts[idx], now_ms);
+      all_ms = (0u == hosts[idx].negotiated_ms) ? 0u : all_ms;
+    }
+  }
+
+  // Steady publishing
+  for(uint32_t idx = 0u; idx < devices; idx++)
+  {
+    nodes[idx]->publishing = true;
+    hosts[idx].messages = 0u;
+  }
+  for(const uint32_t end_ms = now_ms + MULTI_BENCH_STEADY_MS; now_ms < end_ms; now_ms++)
+  {
+    SIM_HubRun(hub, 1000u);
+    for(uint32_t idx = 0u; idx < devices; idx++)
+    {
+      hostPoll(hub, static_cast<int>(idx), hosts[idx], now_ms);
+    }
+  }
+
+  const double wall = wallSeconds() - start;
+
+  for(uint32_t idx = 0u; idx < devices; idx++)
+  {
+    SIM_HubStats stats;
+    SIM_HubGetStats(hub, static_cast<int>(idx), &stats);
+    up += stats.up;
+    down += stats.down;
+    dropped += stats.dropped;
+    max_backlog = (stats.max_backlog > max_backlog) ? stats.max_backlog : max_backlog;
+    requests += hosts[idx].requests;
+    messages += hosts[idx].messages;
+    published += nodes[idx]->published;
+    bad += hosts[idx].bad;
+  }
+
+  char link[16];
+  if(0u == bandwidth)
+  {
+    snprintf(link, sizeof(link), "unlimited");
+  }
+  else
+  {
+    snprintf(link, sizeof(link), "%u", bandwidth);
+  }
+  char negotiated[16];
+  if(0u == all_ms)
+  {
+    snprintf(negotiated, sizeof(negotiated), "never");
+  }
+  else
+  {
+    snprintf(negotiated, sizeof(negotiated), "%u", all_ms);
+  }
+
+  printf("%8u %10s %11s %9u %10llu %10llu %9llu %8u %9u %9u %7u %8.1f\n",
+         devices, link, negotiated, requests,
+         static_cast<unsigned long long>(up), static_cast<unsigned long long>(down),
+         static_cast<unsigned long long>(dropped), max_backlog,
+         published, messages, bad, (now_ms * 1e-3) / wall);
+
+  for(uint32_t idx = 0u; idx < devices; idx++)
+  {
+    nodes[idx]->~BenchNode();
+    SIM_DeviceDestroy(device[idx]);
+  }
+  delete[] hosts;
+  delete[] nodes;
+  delete[] device;
+  SIM_HubDestroy(hub);
+}
+
+int main(int argc, char** argv)
+{
+  const uint32_t devices = (argc > 1) ? static_cast<uint32_t>(atoi(argv[1])) : MULTI_BENCH_DEVICES;
+
+  if((0u == devices) || (devices > SIM_HUB_PORTS))
+  {
+    fprintf(stderr, "1 to %u devices\n", SIM_HUB_PORTS);
+    return 1;
+  }
+
+  printf("%8s %10s %11s %9s %10s %10s %9s %8s %9s %9s %7s %8s\n",
+         "devices", "link B/s", "all up ms", "requests", "up B", "down B",
+         "dropped", "backlog", "published", "received", "skipped", "sim/wall");
+
+  if(argc > 2)
+  {
+    runBench(devices, static_cast<uint32_t>(atoi(argv[2])));
+  }
+  else
+  {
+    const uint32_t bandwidths[] = {0u, 80000u, 40000u, 20000u, 10000u};
+    for(const uint32_t bandwidth : bandwidths)
+    {
+      runBench(devices, bandwidth);
+    }
+  }
+  return 0;
+}
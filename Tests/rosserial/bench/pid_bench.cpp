@@ -0,0 +1,137 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file pid_bench.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Benchmark of the float and Q15 PID banks
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdio.h>
+
+#include "MsgBench.h"
+#include "francor/pid_bank.h"
+/* -------------------------------------------------------------------------------*/
+
+/* Benchmark Configuration -------------------------------------------------------*/
+constexpr int       PID_BENCH_CHANNELS  = 32;     //!< Channels per bank
+constexpr float     PID_BENCH_DT        = 0.001f; //!< Cycle time in s
+constexpr double    PID_BENCH_TIME_S    = 0.2;    //!< Measurement time per bank
+/* -------------------------------------------------------------------------------*/
+
+/**
+ * @brief Reference: one controller object per channel
+ */
+struct ScalarPid
+{
+  float kp, ki, kd, i_max, out_max;
+  float error, integral;
+
+  float update(const float setpoint, const float measured, const float dt)
+  {
+    const float e = setpoint - measured;
+    const float de = (e - error) / dt;
+
+    integral += ki * dt * e;
+    if(integral > i_max)  integral = i_max;
+    if(integral < -i_max) integral = -i_max;
+    error = e;
+
+    float u = kp * e + integral + kd * de;
+    if(u > out_max)  u = out_max;
+    if(u < -out_max) u = -out_max;
+    return u;
+  }
+};
+
+static float setpoint[PID_BENCH_CHANNELS];
+static float measured[PID_BENCH_CHANNELS];
+static float output[PID_BENCH_CHANNELS];
+alignas(4) static int16_t setpoint_q15[PID_BENCH_CHANNELS];
+alignas(4) static int16_t measured_q15[PID_BENCH_CHANNELS];
+alignas(4) static int16_t output_q15[PID_BENCH_CHANNELS];
+
+template<typename FuncT>
+static double perChannel(FuncT func)
+{
+  return msgBenchMeasure(PID_BENCH_TIME_S, [&]() {
+    func();
+    __asm__ __volatile__("" : : : "memory");
+  }) / PID_BENCH_CHANNELS;
+}
+
+/**
+ * @brief Compare both banks with one controller object per channel
+ */
+int main()
+{
+  typedef francor::PidBankQ15<PID_BENCH_CHANNELS> BankQ15;
+
+  MsgBenchRng                           rng(1u);
+  ScalarPid                             scalar[PID_BENCH_CHANNELS];
+  francor::PidBank<PID_BENCH_CHANNELS>  bank;
+  BankQ15                               bank_q15;
+
+  for(int c = 0; c < PID_BENCH_CHANNELS; c++)
+  {
+    setpoint[c]     = static_cast<float>(rng.next() % 1000u) / 2000.0f;
+    measured[c]     = static_cast<float>(rng.next() % 1000u) / 2000.0f;
+    setpoint_q15[c] = BankQ15::toQ15(setpoint[c]);
+    measured_q15[c] = BankQ15::toQ15(measured[c]);
+
+    scalar[c] = ScalarPid{1.5f, 20.0f, 0.002f, 0.5f, 1.0f, 0.0f, 0.0f};
+    bank.setGains(c, 1.5f, 20.0f, 0.002f, 0.5f, 1.0f);
+    bank_q15.setGains(c, 1.5f, 20.0f, 0.002f, PID_BENCH_DT);
+  }
+
+  printf("%-20s %10s\n", "ns per channel", "update");
+  printf("%-20s %10.2f\n", "scalar float",
+         perChannel([&]() {
+           for(int c = 0; c < PID_BENCH_CHANNELS; c++)
+           {
+             output[c] = scalar[c].update(setpoint[c], measured[c], PID_BENCH_DT);
+           }
+         }));
+  printf("%-20s %10.2f\n", "PidBank",
+         perChannel([&]() { bank.update(setpoint, measured, output, PID_BENCH_DT); }));
+  printf("%-20s %10.2f\n", "PidBankQ15",
+         perChannel([&]() { bank_q15.update(setpoint_q15, measured_q15, output_q15); }));
+
+  return 0;
+}
@@ -0,0 +1,283 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file replay_bench.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Parse throughput and callback timing of NodeHandle_ on a replayed capture
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdio.h>
+#include <time.h>
+
+#include "MsgBench.h"
+#include "ros/node_handle.h"
+#include "ros/profiler.h"
+#include "std_msgs/Int32.h"
+#include "CaptureHardware.h"
+#include "ReplayHardware.h"
+/* -------------------------------------------------------------------------------*/
+
+/* Benchmark Configuration -------------------------------------------------------*/
+constexpr int       REPLAY_BENCH_SUBS     = 8;        //!< Subscribers, topic ids 100 and up
+constexpr uint32_t  REPLAY_BENCH_FRAMES   = 200000u;  //!< Frames of the synthetic capture
+constexpr uint32_t  REPLAY_BENCH_BURST    = 4u;       //!< Frames per spinOnce of the synthetic capture
+constexpr int       REPLAY_BENCH_RUNS     = 5;        //!< Replays, the fastest one is reported
+constexpr char      REPLAY_BENCH_FILE[]   = "replay_bench.rscap";
+/* -------------------------------------------------------------------------------*/
+
+/**
+ * @brief Nanosecond clock standing in for the cycle counter
+ */
+struct HostClock
+{
+  static uint32_t cycles()
+  {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint32_t>(ts.tv_sec * 1000000000ull + ts.tv_nsec);
+  }
+};
+
+/**
+ * @brief Hardware sending Int32 frames to random subscribers in bursts,
+ *        with 1 ms between bursts
+ */
+class SyntheticHardware
+{
+  public:
+
+    SyntheticHardware(void) :
+    _rng(1u),
+    _frame(),
+    _frame_size(0u),
+    _frame_pos(0u),
+    _frames(0u),
+    _time(0u)
+    {
+
+    }
+
+    void init()
+    {
+
+    }
+
+    int read()
+    {
+      if(_frame_pos >= _frame_size)
+      {
+        if((_frames >= REPLAY_BENCH_FRAMES) || ((_frame_size != 0u) && ((_frames % REPLAY_BENCH_BURST) == 0u)))
+        {
+          _frame_size = 0u;
+          _time++;
+          return -1;
+        }
+        nextFrame();
+      }
+      return _frame[_frame_pos++];
+    }
+
+    void write(uint8_t*, int)
+    {
+
+    }
+
+    unsigned long time()
+    {
+      return _time;
+    }
+
+    bool done() const
+    {
+      return _frames >= REPLAY_BENCH_FRAMES;
+    }
+
+  private:
+
+    void nextFrame()
+    {
+      std_msgs::Int32 msg;
+      const uint16_t  topic = 100u + _rng.next() % REPLAY_BENCH_SUBS;
+
+      msg.data = static_cast<int32_t>(_rng.next());
+      const uint16_t size = msg.serialize(&_frame[7]);
+
+      _frame[0] = 0xffu;
+      _frame[1] = 0xfeu;
+      _frame[2] = static_cast<uint8_t>(size & 0xffu);
+      _frame[3] = static_cast<uint8_t>(size >> 8u);
+      _frame[4] = static_cast<uint8_t>(255u - (((size & 0xffu) + (size >> 8u)) % 256u));
+      _frame[5] = static_cast<uint8_t>(topic & 0xffu);
+      _frame[6] = static_cast<uint8_t>(topic >> 8u);
+
+      uint32_t checksum = _frame[5] + _frame[6];
+      for(uint16_t idx = 0u; idx < size; idx++)
+      {
+        checksum += _frame[7u + idx];
+      }
+      _frame[7u + size] = static_cast<uint8_t>(255u - (checksum % 256u));
+
+      _frame_size = 8u + size;
+      _frame_pos  = 0u;
+      _frames++;
+    }
+
+    MsgBenchRng   _rng;
+    uint8_t       _frame[16];
+    uint32_t      _frame_size;
+    uint32_t      _frame_pos;
+    uint32_t      _frames;
+    unsigned long _time;
+};
+
+typedef ros::NodeHandle_<ros::CaptureHardware<SyntheticHardware, CaptureFile>, REPLAY_BENCH_SUBS, 2> SyntheticNodeHandle;
+typedef ros::CycleProfiler<HostClock, REPLAY_BENCH_SUBS + 2> ReplayProfiler;
+typedef ros::NodeHandle_<ReplayHardware, REPLAY_BENCH_SUBS, 2, 512, 512, ReplayProfiler> ReplayNodeHandle;
+
+static uint32_t callbacks = 0u;
+
+static void int32Callback(const std_msgs::Int32&)
+{
+  callbacks++;
+}
+
+/**
+ * @brief Write the synthetic capture to path
+ */
+static bool writeSynthetic(const char* path)
+{
+  static SyntheticNodeHandle  nh;
+  CaptureFile                 file;
+
+  if(!file.open(path))
+  {
+    return false;
+  }
+
+  nh.initNode();
+  nh.getHardware()->setSink(&file);
+  while(!nh.getHardware()->done())
+  {
+    nh.spinOnce();
+  }
+  nh.spinOnce();
+  nh.getHardware()->setSink(nullptr);
+  return true;
+}
+
+/**
+ * @brief Replay a capture, by default a synthetic one
+ *
+ * Usage: replay_bench [capture]
+ */
+int main(int argc, char** argv)
+{
+  const char* path = (argc > 1) ? argv[1] : REPLAY_BENCH_FILE;
+
+  if((argc <= 1) && !writeSynthetic(path))
+  {
+    fprintf(stderr, "Could not write %s\n", path);
+    return 1;
+  }
+
+  static ReplayNodeHandle nh;
+  char                    names[REPLAY_BENCH_SUBS][8];
+
+  nh.initNode();
+  for(int idx = 0; idx < REPLAY_BENCH_SUBS; idx++)
+  {
+    snprintf(names[idx], sizeof(names[idx]), "sub%d", idx);
+    nh.subscribe(*new ros::Subscriber<std_msgs::Int32>(names[idx], int32Callback));
+  }
+
+  ReplayHardware* hw = nh.getHardware();
+  if(!hw->open(path))
+  {
+    fprintf(stderr, "%s is no capture\n", path);
+    return 1;
+  }
+
+  double   best_s = 0.0;
+  uint32_t spins  = 0u;
+  for(int run = 0; run < REPLAY_BENCH_RUNS; run++)
+  {
+    hw->rewind();
+    nh.getProfiler()->reset();
+    callbacks = 0u;
+    spins     = 0u;
+
+    const uint32_t start = HostClock::cycles();
+    while(!hw->done())
+    {
+      nh.spinOnce();
+      spins++;
+    }
+    const double elapsed_s = (HostClock::cycles() - start) * 1e-9;
+    if((run == 0) || (elapsed_s < best_s))
+    {
+      best_s = elapsed_s;
+    }
+  }
+
+  const ReplayProfiler* profiler = nh.getProfiler();
+  printf("capture             %10u bytes\n", hw->getSize());
+  printf("reads               %10u\n", hw->getReads());
+  printf("spins               %10u\n", spins);
+  printf("callbacks           %10u\n", callbacks);
+  printf("write mismatches    %10u\n", hw->getWriteMismatches());
+  printf("replay              %10.3f ms\n", best_s * 1e3);
+  printf("throughput          %10.1f MB/s\n", hw->getReads() / best_s * 1e-6);
+  printf("\n%-19s %10s %10s %10s\n", "ns", "mean", "p90", "max");
+  for(int stage = 0; stage < ros::PROFILE_STAGES; stage++)
+  {
+    const ReplayProfiler::Histogram& h = profiler->getStage(stage);
+    if(h.count)
+    {
+      printf("%-19s %10u %10u %10u\n", ReplayProfiler::getStageName(stage), h.mean(), h.percentile(90), h.max);
+    }
+  }
+  for(int idx = 0; idx < REPLAY_BENCH_SUBS; idx++)
+  {
+    const ReplayProfiler::Histogram* h = profiler->getTopic(100 + idx);
+    printf("%-19s %10u %10u %10u\n", names[idx], h->mean(), h->percentile(90), h->max);
+  }
+
+  return 0;
+}
@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+#
+# Report the code size of every rosserial message
+#
+# Author: Martin Bauernschmitt
+# Date: 17.10.2026
+#
+# Usage: size_report.py [--baseline <git revision>] [--cxx <compiler>]
+#                       [--flags "<flags>"] [--json <file>]
+#
+# Every message header is compiled into its own object file which calls
+# serialize() and deserialize() of all messages in it. The size of .text is
+# reported per header. With --baseline the same is done for the message
+# headers of the given git revision and the difference is shown.
+#
+# The cross compiler is used when available, so the numbers match the
+# target. Otherwise the host compiler is used, which is only good for
+# relative comparisons.
+
+import argparse
+import concurrent.futures
+import json
+import os
+import re
+import shutil
+import subprocess
+import tempfile
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+REPO_DIR = os.path.abspath(os.path.join(SCRIPT_DIR, '..', '..', '..'))
+ROSSERIAL_REL = os.path.join('Middlewares', 'rosserial')
+
+# Directories and files which do not contain generated messages
+SKIP_DIRS = ('ros',)
+SKIP_FILES = ('tf/tf.h', 'tf/transform_broadcaster.h')
+
+TARGET_CXX = 'arm-none-eabi-g++'
+TARGET_FLAGS = '-mcpu=cortex-m4 -mthumb -mfpu=fpv4-sp-d16 -mfloat-abi=hard -Os -fno-exceptions -fno-rtti'
+HOST_FLAGS = '-Os -fno-exceptions -fno-rtti'
+
+
+def find_headers(root):
+  headers = []
+  for package in sorted(os.listdir(root)):
+    path = os.path.join(root, package)
+    if not os.path.isdir(path) or package in SKIP_DIRS:
+      continue
+    for name in sorted(os.listdir(path)):
+      rel = '%s/%s' % (package, name)
+      if name.endswith('.h') and rel not in SKIP_FILES:
+        headers.append(rel)
+  return headers
+
+
+def find_messages(root, header):
+  text = open(os.path.join(root, header)).read()
+  namespace = re.search(r'^namespace (\w+)', text, re.M)
+  if namespace is None:
+    return []
+  return ['%s::%s' % (namespace.group(1), name)
+          for name in re.findall(r'\n  class (\w+) : public ros::Msg\n', text)]
+
+
+def compile_header(cxx, flags, root, header, work_dir):
+  messages = find_messages(root, header)
+  if not messages:
+    return header, None
+
+  name = header.replace('/', '_')[:-2]
+  source = os.path.join(work_dir, name + '.cpp')
+  obj = os.path.join(work_dir, name + '.o')
+
+  with open(source, 'w') as out:
+    out.write('#include "%s"\n\n' % header)
+    for idx, msg in enumerate(messages):
+      out.write('int size_report_serialize_%d(const %s& msg, unsigned char* buffer)\n' % (idx, msg))
+      out.write('{\n  return msg.%s::serialize(buffer);\n}\n\n' % msg)
+      out.write('int size_report_deserialize_%d(%s& msg, unsigned char* buffer)\n' % (idx, msg))
+      out.write('{\n  return msg.%s::deserialize(buffer);\n}\n\n' % msg)
+
+  cmd = [cxx, '-std=c++11', '-c', '-I', root, source, '-o', obj] + flags.split()
+  if subprocess.call(cmd, stderr=subprocess.DEVNULL) != 0:
+    print('warning: %s does not compile, skipped' % os.path.join(root, header))
+    return header, None
+
+  text = 0
+  output = subprocess.check_output(['size', '-A', obj]).decode()
+  for line in output.splitlines():
+    fields = line.split()
+    if fields and fields[0].startswith('.text'):
+      text += int(fields[1])
+
+  return header, text
+
+
+def measure(cxx, flags, root, jobs):
+  work_dir = tempfile.mkdtemp(prefix='size_report_')
+  try:
+    headers = find_headers(root)
+    sizes = {}
+    with concurrent.futures.ThreadPoolExecutor(max_workers=jobs) as pool:
+      futures = [pool.submit(compile_header, cxx, flags, root, h, work_dir) for h in headers]
+      for future in futures:
+        header, text = future.result()
+        if text is not None:
+          sizes[header] = text
+    return sizes
+  finally:
+    shutil.rmtree(work_dir)
+
+
+def export_revision(revision, dest):
+  archive = subprocess.Popen(['git', '-C', REPO_DIR, 'archive', revision, ROSSERIAL_REL],
+                             stdout=subprocess.PIPE)
+  subprocess.check_call(['tar', '-x', '-C', dest], stdin=archive.stdout)
+  if archive.wait() != 0:
+    raise RuntimeError('git archive %s failed' % revision)
+  return os.path.join(dest, ROSSERIAL_REL)
+
+
+def main():
+  parser = argparse.ArgumentParser(description='Code size of the rosserial messages')
+  parser.add_argument('--baseline', help='git revision to compare against')
+  parser.add_argument('--cxx', help='compiler (default: %s if available)' % TARGET_CXX)
+  parser.add_argument('--flags', help='compiler flags')
+  parser.add_argument('--json', help='write results to this file')
+  parser.add_argument('--jobs', type=int, default=os.cpu_count() or 1)
+  args = parser.parse_args()
+
+  cxx = args.cxx
+  if cxx is None:
+    cxx = TARGET_CXX if shutil.which(TARGET_CXX) else 'g++'
+  flags = args.flags
+  if flags is None:
+    flags = TARGET_FLAGS if cxx == TARGET_CXX else HOST_FLAGS
+
+  print('Compiler: %s %s' % (cxx, flags))
+
+  current = measure(cxx, flags, os.path.join(REPO_DIR, ROSSERIAL_REL), args.jobs)
+
+  baseline = {}
+  if args.baseline:
+    base_dir = tempfile.mkdtemp(prefix='size_report_base_')
+    try:
+      baseline = measure(cxx, flags, export_revision(args.baseline, base_dir), args.jobs)
+    finally:
+      shutil.rmtree(base_dir)
+
+  print('%-60s %10s %10s %8s' % ('header', 'baseline', 'current', 'delta'))
+  total_base = 0
+  total_cur = 0
+  results = []
+  for header in sorted(current):
+    cur = current[header]
+    base = baseline.get(header)
+    total_cur += cur
+    if base is not None:
+      total_base += base
+      print('%-60s %10d %10d %+8d' % (header, base, cur, cur - base))
+    else:
+      print('%-60s %10s %10d %8s' % (header, '-', cur, ''))
+    results.append({'header': header, 'text': cur, 'baseline_text': base})
+
+  if baseline:
+    print('%-60s %10d %10d %+8d' % ('total', total_base, total_cur, total_cur - total_base))
+  else:
+    print('%-60s %10s %10d' % ('total', '-', total_cur))
+
+  if args.json:
+    with open(args.json, 'w') as out:
+      json.dump({'compiler': cxx, 'flags': flags, 'baseline': args.baseline,
+                 'headers': results}, out, indent=2)
+
+
+if __name__ == '__main__':
+  main()
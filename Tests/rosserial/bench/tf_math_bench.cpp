@@ -0,0 +1,147 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file tf_math_bench.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Benchmark of the single precision tf math against libm
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <math.h>
+#include <stdio.h>
+
+#include "MsgBench.h"
+#include "tf/tf_math.h"
+/* -------------------------------------------------------------------------------*/
+
+/* Benchmark Configuration -------------------------------------------------------*/
+constexpr uint32_t  TF_BENCH_ANGLES   = 1024u;  //!< Number of input angles
+constexpr double    TF_BENCH_TIME_S   = 0.2;    //!< Measurement time per function
+/* -------------------------------------------------------------------------------*/
+
+static float  angles[TF_BENCH_ANGLES];
+static volatile float sink;
+
+/**
+ * @brief Reference: quaternion from roll, pitch and yaw with libm double
+ */
+static geometry_msgs::Quaternion quaternionFromRPYDouble(const double roll, const double pitch, const double yaw)
+{
+  const double sr = sin(0.5 * roll), cr = cos(0.5 * roll);
+  const double sp = sin(0.5 * pitch), cp = cos(0.5 * pitch);
+  const double sy = sin(0.5 * yaw), cy = cos(0.5 * yaw);
+
+  geometry_msgs::Quaternion q;
+  q.x = sr * cp * cy - cr * sp * sy;
+  q.y = cr * sp * cy + sr * cp * sy;
+  q.z = cr * cp * sy - sr * sp * cy;
+  q.w = cr * cp * cy + sr * sp * sy;
+  return q;
+}
+
+/**
+ * @brief Reference: roll, pitch and yaw with libm double
+ */
+static void getRPYDouble(const geometry_msgs::Quaternion& q, double& roll, double& pitch, double& yaw)
+{
+  const double x = q.x, y = q.y, z = q.z, w = q.w;
+  roll  = atan2(2.0 * (w * x + y * z), 1.0 - 2.0 * (x * x + y * y));
+  pitch = asin(fmax(-1.0, fmin(1.0, 2.0 * (w * y - z * x))));
+  yaw   = atan2(2.0 * (w * z + x * y), 1.0 - 2.0 * (y * y + z * z));
+}
+
+template<typename FuncT>
+static double perAngle(FuncT func)
+{
+  return msgBenchMeasure(TF_BENCH_TIME_S, [&]() {
+    for(uint32_t idx = 0u; idx < TF_BENCH_ANGLES; idx++)
+    {
+      func(angles[idx]);
+    }
+  }) / TF_BENCH_ANGLES;
+}
+
+static void report(const char* name, const double float_ns, const double double_ns)
+{
+  printf("%-20s %10.2f %10.2f %8.2fx\n", name, float_ns, double_ns, double_ns / float_ns);
+}
+
+/**
+ * @brief Compare the single precision tf math with libm double precision
+ */
+int main()
+{
+  MsgBenchRng rng(1u);
+  for(auto& angle : angles)
+  {
+    angle = static_cast<float>(rng.next() % 62832u) / 10000.0f - 3.1416f;
+  }
+
+  printf("%-20s %10s %10s %9s\n", "ns per call", "float", "libm", "speedup");
+
+  report("sin + cos",
+         perAngle([](const float a) { float s, c; tf::fastSinCos(a, s, c); sink = s + c; }),
+         perAngle([](const float a) { sink = static_cast<float>(sin(a) + cos(a)); }));
+
+  report("atan2",
+         perAngle([](const float a) { sink = tf::fastAtan2(a, 1.5f - a); }),
+         perAngle([](const float a) { sink = static_cast<float>(atan2(a, 1.5 - a)); }));
+
+  report("quaternionFromYaw",
+         perAngle([](const float a) { sink = tf::quaternionFromYaw(a).w; }),
+         perAngle([](const float a) { sink = quaternionFromRPYDouble(0.0, 0.0, a).w; }));
+
+  report("quaternionFromRPY",
+         perAngle([](const float a) { sink = tf::quaternionFromRPY(a, 0.5f * a, -a).w; }),
+         perAngle([](const float a) { sink = quaternionFromRPYDouble(a, 0.5 * a, -a).w; }));
+
+  report("getRPY",
+         perAngle([](const float a) {
+           float r, p, y;
+           tf::getRPY(tf::quaternionFromYaw(a), r, p, y);
+           sink = r + p + y;
+         }),
+         perAngle([](const float a) {
+           double r, p, y;
+           getRPYDouble(tf::quaternionFromYaw(a), r, p, y);
+           sink = static_cast<float>(r + p + y);
+         }));
+
+  return 0;
+}
@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+#
+# Convert a node handle event trace into the Chrome trace format
+#
+# Author: Martin Bauernschmitt
+# Date: 17.10.2026
+#
+# Usage: trace_to_chrome.py <trace file> [--hz <clock>] [-o <json file>]
+#
+# The trace file holds the raw entries of ros::TraceRing, 8 bytes each,
+# e.g. the data of the messages of francor::TracePublisher written one
+# after the other. Stamps are converted to microseconds with the clock
+# frequency of the tracer, wrap arounds of the 32 bit counter are removed.
+# Open the result in chrome://tracing or https://ui.perfetto.dev.
+
+import argparse
+import json
+import struct
+import sys
+
+ENTRY = struct.Struct('<IHBB')
+
+# Event ids of ros/trace.h
+TRACE_MODE = 1
+TRACE_FRAME_BEGIN = 2
+TRACE_FRAME_END = 3
+TRACE_CHECKSUM_ERROR = 4
+TRACE_RESYNC = 5
+TRACE_PUBLISH_BEGIN = 6
+TRACE_PUBLISH_END = 7
+TRACE_CALLBACK_BEGIN = 8
+TRACE_CALLBACK_END = 9
+TRACE_CONNECT = 10
+TRACE_DISCONNECT = 11
+
+MODES = ('first_ff', 'protocol_ver', 'size_l', 'size_h', 'size_checksum',
+         'topic_l', 'topic_h', 'message', 'msg_checksum')
+RESYNC = ('timeout', 'protocol', 'length')
+DISCONNECT = ('sync', 'stuck', 'host')
+
+# Threads of the timeline
+TID_RX = 1
+TID_TX = 2
+TID_CALLBACK = 3
+
+
+def read_entries(data):
+  usable = len(data) - len(data) % ENTRY.size
+  return [ENTRY.unpack_from(data, offset) for offset in range(0, usable, ENTRY.size)]
+
+
+def name_of(table, index):
+  return table[index] if index < len(table) else str(index)
+
+
+def convert(entries, hz):
+  events = [
+    {'name': 'thread_name', 'ph': 'M', 'pid': 1, 'tid': TID_RX, 'args': {'name': 'receive'}},
+    {'name': 'thread_name', 'ph': 'M', 'pid': 1, 'tid': TID_TX, 'args': {'name': 'publish'}},
+    {'name': 'thread_name', 'ph': 'M', 'pid': 1, 'tid': TID_CALLBACK, 'args': {'name': 'callbacks'}},
+  ]
+
+  base = None
+  last = 0
+  wraps = 0
+  in_frame = False
+
+  for stamp, arg, event, value in entries:
+    if base is not None and stamp < last:
+      wraps += 1
+    last = stamp
+    ticks = stamp + (wraps << 32)
+    if base is None:
+      base = ticks
+    ts = (ticks - base) * 1e6 / hz
+
+    def add(name, ph, tid, args=None):
+      e = {'name': name, 'ph': ph, 'ts': ts, 'pid': 1, 'tid': tid}
+      if ph == 'i':
+        e['s'] = 't'
+      if args:
+        e['args'] = args
+      events.append(e)
+
+    if event == TRACE_MODE:
+      events.append({'name': 'mode', 'ph': 'C', 'ts': ts, 'pid': 1, 'args': {'mode': value}})
+      if value == 0 and in_frame:
+        add('frame', 'E', TID_RX)
+        in_frame = False
+    elif event == TRACE_FRAME_BEGIN:
+      if in_frame:
+        add('frame', 'E', TID_RX)
+      add('frame', 'B', TID_RX)
+      in_frame = True
+    elif event == TRACE_FRAME_END:
+      add('frame end', 'i', TID_RX, {'topic': arg})
+    elif event == TRACE_CHECKSUM_ERROR:
+      add('checksum error', 'i', TID_RX, {'topic': arg, 'stage': 'message' if value else 'length'})
+    elif event == TRACE_RESYNC:
+      add('resync', 'i', TID_RX, {'reason': name_of(RESYNC, value), 'topic': arg})
+    elif event == TRACE_PUBLISH_BEGIN:
+      add('publish %d' % arg, 'B', TID_TX, {'topic': arg})
+    elif event == TRACE_PUBLISH_END:
+      add('publish', 'E', TID_TX, {'written': bool(value), 'length': arg})
+    elif event == TRACE_CALLBACK_BEGIN:
+      add('callback %d' % arg, 'B', TID_CALLBACK, {'topic': arg})
+    elif event == TRACE_CALLBACK_END:
+      add('callback', 'E', TID_CALLBACK)
+    elif event == TRACE_CONNECT:
+      add('connect', 'i', TID_RX)
+    elif event == TRACE_DISCONNECT:
+      add('disconnect', 'i', TID_RX, {'reason': name_of(DISCONNECT, value)})
+    else:
+      add('event %d' % event, 'i', TID_RX, {'value': value, 'arg': arg})
+
+  return {'traceEvents': events, 'displayTimeUnit': 'ns',
+          'otherData': {'modes': list(MODES)}}
+
+
+def main():
+  parser = argparse.ArgumentParser(description='Convert a node handle event trace into the Chrome trace format')
+  parser.add_argument('trace', help='file with the raw trace entries, - for stdin')
+  parser.add_argument('--hz', type=float, default=180e6, help='clock frequency of the stamps')
+  parser.add_argument('-o', '--output', help='output file, default stdout')
+  args = parser.parse_args()
+
+  if args.trace == '-':
+    data = sys.stdin.buffer.read()
+  else:
+    with open(args.trace, 'rb') as f:
+      data = f.read()
+
+  result = convert(read_entries(data), args.hz)
+  text = json.dumps(result, indent=1)
+  if args.output:
+    with open(args.output, 'w') as f:
+      f.write(text)
+  else:
+    print(text)
+
+
+if __name__ == '__main__':
+  main()
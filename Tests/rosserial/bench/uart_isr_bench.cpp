@@ -0,0 +1,406 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file uart_isr_bench.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Interrupt cost of the HAL UART driver against STMHardwareLL
+ * 
+ * Both paths move the same traffic over the simulated USART2 with DMA in
+ * both directions: a circular receive DMA which the main loop polls and a
+ * transmit ring sent chunk by chunk. The HAL path starts transfers with
+ * HAL_UART_Receive_DMA() / HAL_UART_Transmit_DMA() and runs
+ * HAL_UART_IRQHandler() and HAL_DMA_IRQHandler(), the LL path runs
+ * STMHardwareLL. The handlers are timed with the host clock, the numbers
+ * compare the two paths but are no Cortex-M4 cycles.
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "STMHardwareLL.h"
+#include "ros/profiler.h"
+#include "sim_clock.h"
+#include "sim_dma.h"
+#include "sim_nvic.h"
+#include "sim_usart.h"
+/* -------------------------------------------------------------------------------*/
+
+/* Benchmark Configuration -------------------------------------------------------*/
+constexpr uint32_t  ISR_BENCH_MS      = 2000u;  //!< Simulated time per run
+constexpr int       ISR_BENCH_BINS    = 24;     //!< Histogram bins
+/* -------------------------------------------------------------------------------*/
+
+/**
+ * @brief Traffic of one run
+ */
+struct IsrBenchLoad
+{
+  uint32_t baud;
+  uint32_t frames;          //!< 12 byte frames the device writes per period
+  uint32_t frame_ms;        //!< Period of the device
+  uint32_t burst;           //!< Bytes the host sends per burst
+  uint32_t burst_ms;        //!< Time between bursts
+};
+
+enum IsrSource
+{
+  ISR_USART,
+  ISR_RX_DMA,
+  ISR_TX_DMA,
+  ISR_SOURCES
+};
+
+static const char* const isr_names[ISR_SOURCES] = {"USART2", "DMA1_Stream5 rx", "DMA1_Stream6 tx"};
+
+typedef ros::CycleHistogram<ISR_BENCH_BINS> IsrHistogram;
+
+extern UART_HandleTypeDef huart2;
+
+// DMA needs static storage, see sim_dma.h
+static DMA_HandleTypeDef    hdma_usart2_rx;
+static DMA_HandleTypeDef    hdma_usart2_tx;
+static ros::STMHardwareLL   ll_hardware;
+static bool                 use_ll;
+static IsrHistogram         isr_ns[ISR_SOURCES];
+static uint64_t             clock_ns;   //!< Cost of reading the clock twice
+
+static uint64_t hostNs()
+{
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+/**
+ * @brief Record the duration of a handler without the cost of the clock
+ */
+static void isrDone(const IsrSource source, const uint64_t start)
+{
+  const uint64_t elapsed = hostNs() - start;
+  isr_ns[source].add(static_cast<uint32_t>((elapsed > clock_ns) ? elapsed - clock_ns : 0u));
+}
+
+/**
+ * @brief Transport of the HAL path, the same rings as STMHardwareLL
+ */
+struct HalTransport
+{
+  uint8_t   rx_buffer[ros::STM_HW_BUF_SIZE];
+  uint16_t  rx_read_pos;
+  uint8_t   tx_buffer[ros::STM_HW_BUF_SIZE];
+  uint16_t  tx_head;
+  uint16_t  tx_tail;
+  uint16_t  tx_busy;
+
+  void init()
+  {
+    rx_read_pos = 0u;
+    tx_head     = 0u;
+    tx_tail     = 0u;
+    tx_busy     = 0u;
+    HAL_UART_Receive_DMA(&huart2, rx_buffer, ros::STM_HW_BUF_SIZE);
+  }
+
+  int read()
+  {
+    const uint16_t write_pos = static_cast<uint16_t>((ros::STM_HW_BUF_SIZE - __HAL_DMA_GET_COUNTER(huart2.hdmarx)) &
+                                                     (ros::STM_HW_BUF_SIZE - 1u));
+    if(rx_read_pos == write_pos)
+    {
+      return -1;
+    }
+    const int value = rx_buffer[rx_read_pos];
+    rx_read_pos = static_cast<uint16_t>((rx_read_pos + 1u) & (ros::STM_HW_BUF_SIZE - 1u));
+    return value;
+  }
+
+  void write(uint8_t* data, const uint16_t size)
+  {
+    for(uint16_t idx = 0u; idx < size; idx++)
+    {
+      if(((tx_head + 1u) & (ros::STM_HW_BUF_SIZE - 1u)) == tx_tail)
+      {
+        break;
+      }
+      tx_buffer[tx_head] = data[idx];
+      tx_head = static_cast<uint16_t>((tx_head + 1u) & (ros::STM_HW_BUF_SIZE - 1u));
+    }
+
+    __disable_irq();
+    if(0u == tx_busy)
+    {
+      start();
+    }
+    __enable_irq();
+  }
+
+  void start()
+  {
+    const uint16_t count = (tx_head >= tx_tail) ? static_cast<uint16_t>(tx_head - tx_tail)
+                                                : static_cast<uint16_t>(ros::STM_HW_BUF_SIZE - tx_tail);
+    if(0u != count)
+    {
+      tx_busy = count;
+      HAL_UART_Transmit_DMA(&huart2, &tx_buffer[tx_tail], count);
+    }
+  }
+
+  void txComplete()
+  {
+    tx_tail = static_cast<uint16_t>((tx_tail + tx_busy) & (ros::STM_HW_BUF_SIZE - 1u));
+    tx_busy = 0u;
+    start();
+  }
+};
+
+static HalTransport hal_transport;
+
+extern "C"
+{
+  void USART2_IRQHandler(void)
+  {
+    const uint64_t start = hostNs();
+    if(use_ll)
+    {
+      ll_hardware.usartIrq();
+    }
+    else
+    {
+      HAL_UART_IRQHandler(&huart2);
+    }
+    isrDone(ISR_USART, start);
+  }
+
+  void DMA1_Stream5_IRQHandler(void)
+  {
+    const uint64_t start = hostNs();
+    HAL_DMA_IRQHandler(&hdma_usart2_rx);
+    isrDone(ISR_RX_DMA, start);
+  }
+
+  void DMA1_Stream6_IRQHandler(void)
+  {
+    const uint64_t start = hostNs();
+    if(use_ll)
+    {
+      ll_hardware.txDmaIrq();
+    }
+    else
+    {
+      HAL_DMA_IRQHandler(&hdma_usart2_tx);
+    }
+    isrDone(ISR_TX_DMA, start);
+  }
+
+  void HAL_UART_TxCpltCallback(UART_HandleTypeDef*)
+  {
+    hal_transport.txComplete();
+  }
+}
+
+static void initDma(DMA_HandleTypeDef& hdma, DMA_Stream_TypeDef* stream, const uint32_t dir, const uint32_t mode)
+{
+  memset(&hdma, 0, sizeof(hdma));
+  hdma.Instance                 = stream;
+  hdma.Init.Channel             = DMA_CHANNEL_4;
+  hdma.Init.Direction           = dir;
+  hdma.Init.PeriphInc           = DMA_PINC_DISABLE;
+  hdma.Init.MemInc              = DMA_MINC_ENABLE;
+  hdma.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  hdma.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+  hdma.Init.Mode                = mode;
+  hdma.Init.Priority            = DMA_PRIORITY_LOW;
+  hdma.Init.FIFOMode            = DMA_FIFOMODE_DISABLE;
+  HAL_DMA_Init(&hdma);
+}
+
+/**
+ * @brief Reset the simulation and bring up USART2 for one path
+ */
+static void setupPath(const IsrBenchLoad& load, const bool ll)
+{
+  memset(USART2, 0, sizeof(*USART2));
+  memset(DMA1, 0, sizeof(SIM_DMA[0]));
+  SIM_ClockReset();
+  SIM_NvicReset();
+  SIM_DmaReset();
+  SIM_UsartReset();
+  for(int idx = 0; idx < ISR_SOURCES; idx++)
+  {
+    isr_ns[idx].reset();
+  }
+
+  memset(&huart2, 0, sizeof(huart2));
+  huart2.Instance           = USART2;
+  huart2.Init.BaudRate      = load.baud;
+  huart2.Init.WordLength    = UART_WORDLENGTH_8B;
+  huart2.Init.StopBits      = UART_STOPBITS_1;
+  huart2.Init.Parity        = UART_PARITY_NONE;
+  huart2.Init.Mode          = UART_MODE_TX_RX;
+  huart2.Init.HwFlowCtl     = UART_HWCONTROL_NONE;
+  huart2.Init.OverSampling  = UART_OVERSAMPLING_16;
+  HAL_UART_Init(&huart2);
+
+  use_ll = ll;
+  if(ll)
+  {
+    ll_hardware.init();
+  }
+  else
+  {
+    initDma(hdma_usart2_rx, DMA1_Stream5, DMA_PERIPH_TO_MEMORY, DMA_CIRCULAR);
+    initDma(hdma_usart2_tx, DMA1_Stream6, DMA_MEMORY_TO_PERIPH, DMA_NORMAL);
+    __HAL_LINKDMA(&huart2, hdmarx, hdma_usart2_rx);
+    __HAL_LINKDMA(&huart2, hdmatx, hdma_usart2_tx);
+    hal_transport.init();
+  }
+
+  NVIC_EnableIRQ(USART2_IRQn);
+  NVIC_EnableIRQ(DMA1_Stream5_IRQn);
+  NVIC_EnableIRQ(DMA1_Stream6_IRQn);
+}
+
+/**
+ * @brief Run one load on one path and print a row per interrupt source
+ */
+static void runPath(const IsrBenchLoad& load, const bool ll)
+{
+  static uint8_t burst[ros::STM_HW_BUF_SIZE];
+  static uint8_t frame[12];
+  uint8_t out[256];
+  uint64_t sent = 0u, received = 0u, taken = 0u;
+
+  setupPath(load, ll);
+
+  for(uint32_t ms = 0u; ms < ISR_BENCH_MS; ms++)
+  {
+    if(0u == (ms % load.burst_ms))
+    {
+      SIM_UsartInject(USART2, burst, load.burst);
+    }
+
+    // Main loop of the device
+    for(uint32_t idx = 0u; (0u == (ms % load.frame_ms)) && (idx < load.frames); idx++)
+    {
+      if(ll)
+      {
+        ll_hardware.write(frame, sizeof(frame));
+      }
+      else
+      {
+        hal_transport.write(frame, sizeof(frame));
+      }
+      sent += sizeof(frame);
+    }
+    while((ll ? ll_hardware.read() : hal_transport.read()) >= 0)
+    {
+      received++;
+    }
+
+    SIM_ClockAdvanceUs(1000u);
+    for(uint32_t count; (count = SIM_UsartTake(USART2, out, sizeof(out))) != 0u;)
+    {
+      taken += count;
+    }
+  }
+
+  NVIC_DisableIRQ(USART2_IRQn);
+  NVIC_DisableIRQ(DMA1_Stream5_IRQn);
+  NVIC_DisableIRQ(DMA1_Stream6_IRQn);
+
+  uint64_t total_ns = 0u;
+  uint32_t total_irqs = 0u;
+  for(int idx = 0; idx < ISR_SOURCES; idx++)
+  {
+    total_ns += isr_ns[idx].sum;
+    total_irqs += isr_ns[idx].count;
+  }
+  const double kbytes = (taken + received) / 1024.0;
+
+  printf("%-4s %8u %7llu %7llu %7llu  %-16s %7s %7s %7s %7u %9.1f %9.1f\n",
+         ll ? "LL" : "HAL", load.baud,
+         static_cast<unsigned long long>(sent), static_cast<unsigned long long>(taken),
+         static_cast<unsigned long long>(received), "all", "", "", "",
+         total_irqs, total_irqs / kbytes, total_ns / kbytes);
+  for(int idx = 0; idx < ISR_SOURCES; idx++)
+  {
+    const IsrHistogram& h = isr_ns[idx];
+    if(0u != h.count)
+    {
+      clock_ns = UINT64_MAX;
+  for(int idx = 0; idx < 10000; idx++)
+  {
+    const uint64_t start = hostNs();
+    const uint64_t elapsed = hostNs() - start;
+    clock_ns = (elapsed < clock_ns) ? elapsed : clock_ns;
+  }
+
+  printf("%-4s %8s %7s %7s %7s  %-16s %7u %7u %7u %7u\n", "", "", "", "", "",
+             isr_names[idx], h.mean(), h.percentile(90), h.max, h.count);
+    }
+  }
+}
+
+/**
+ * @brief Same traffic on the HAL and on the LL path
+ *
+ * Usage: uart_isr_bench
+ */
+int main(int, char**)
+{
+  static const IsrBenchLoad loads[] =
+  {
+    // A node publishing a few topics at 100 Hz on 115200 baud
+    {115200u, 6u, 10u, 48u, 10u},
+    // Fast link with many small frames and larger host bursts
+    {921600u, 6u, 1u, 256u, 5u},
+  };
+
+  printf("%-4s %8s %7s %7s %7s  %-16s %7s %7s %7s %7s %9s %9s\n",
+         "path", "baud", "queued", "sent", "recv", "interrupt", "ns mean", "ns p90", "ns max",
+         "count", "irqs/kB", "ns/kB");
+  for(const IsrBenchLoad& load : loads)
+  {
+    runPath(load, false);
+    runPath(load, true);
+  }
+  return 0;
+}
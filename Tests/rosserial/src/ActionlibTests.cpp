@@ -0,0 +1,298 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file ActionlibTests.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Tests of action server and client
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <CppUTest/TestHarness.h>
+#include <cstring>
+#include "ros/node_handle.h"
+#include "actionlib/action_server.h"
+#include "actionlib/action_client.h"
+#include "actionlib/TestAction.h"
+#include "TestHardware.h"
+/* -------------------------------------------------------------------------------*/
+
+typedef ros::NodeHandle_<TestHardware, 5, 5, 256, 256> TestNodeHandle;
+typedef actionlib::ActionServer<TestNodeHandle, actionlib::TestAction, 2> TestServer;
+typedef actionlib::ActionClient<TestNodeHandle, actionlib::TestAction> TestClient;
+
+/* Topic ids: subscribers from 100, publishers from 105 */
+constexpr int SERVER_GOAL     = 100;
+constexpr int SERVER_CANCEL   = 101;
+constexpr int SERVER_STATUS   = 105;
+constexpr int SERVER_RESULT   = 106;
+constexpr int SERVER_FEEDBACK = 107;
+constexpr int CLIENT_STATUS   = 100;
+constexpr int CLIENT_FEEDBACK = 101;
+constexpr int CLIENT_RESULT   = 102;
+constexpr int CLIENT_GOAL     = 105;
+constexpr int CLIENT_CANCEL   = 106;
+
+static int      goals_received  = 0;
+static int32_t  last_goal       = 0;
+static int      cancels         = 0;
+static int      done_calls      = 0;
+static uint8_t  done_status     = 0u;
+static int32_t  done_result     = 0;
+static int32_t  last_feedback   = 0;
+
+static bool onGoal(TestServer::GoalHandle, const actionlib::TestGoal& goal)
+{
+  goals_received++;
+  last_goal = goal.goal;
+  return goal.goal >= 0;
+}
+
+static void onCancel(TestServer::GoalHandle)
+{
+  cancels++;
+}
+
+static void onDone(uint8_t status, const actionlib::TestResult& result)
+{
+  done_calls++;
+  done_status = status;
+  done_result = result.result;
+}
+
+static void onFeedback(const actionlib::TestFeedback& feedback)
+{
+  last_feedback = feedback.feedback;
+}
+
+TEST_GROUP(Actionlib)
+{
+  void setup()
+  {
+    goals_received = 0;
+    cancels        = 0;
+    done_calls     = 0;
+    last_feedback  = 0;
+
+    _server.init(_server_nh);
+    _client.init(_client_nh);
+    connect(_server_nh);
+    connect(_client_nh);
+  }
+
+  void connect(TestNodeHandle& nh)
+  {
+    nh.initNode();
+    nh.getHardware()->injectFrame(rosserial_msgs::TopicInfo::ID_PUBLISHER, nullptr, 0u);
+    nh.spinOnce();
+    nh.getHardware()->clearTx();
+    CHECK(nh.connected());
+  }
+
+  /**
+   * @brief Hand the frames written by one node handle to the other, returns
+   *        number of frames with topic id from
+   */
+  uint32_t forward(TestNodeHandle& src, TestNodeHandle& dst, const int from, const int to)
+  {
+    return src.getHardware()->forEachFrame(from, [&](uint8_t* payload, const uint32_t size) {
+      dst.getHardware()->injectFrame(to, payload, static_cast<uint16_t>(size));
+      dst.spinOnce();
+    });
+  }
+
+  /**
+   * @brief Deliver everything the server sent to the client
+   */
+  void serverToClient()
+  {
+    forward(_server_nh, _client_nh, SERVER_STATUS, CLIENT_STATUS);
+    forward(_server_nh, _client_nh, SERVER_FEEDBACK, CLIENT_FEEDBACK);
+    forward(_server_nh, _client_nh, SERVER_RESULT, CLIENT_RESULT);
+    _server_nh.getHardware()->clearTx();
+  }
+
+  int sendGoal(const int32_t value)
+  {
+    actionlib::TestGoal goal;
+    goal.goal = value;
+    CHECK(_client.sendGoal(goal));
+    LONGS_EQUAL(1u, forward(_client_nh, _server_nh, CLIENT_GOAL, SERVER_GOAL));
+    _client_nh.getHardware()->clearTx();
+    return goals_received;
+  }
+
+  TestNodeHandle  _server_nh;
+  TestNodeHandle  _client_nh;
+  TestServer      _server{"move", &onGoal, &onCancel};
+  TestClient      _client{"move", &onDone, &onFeedback};
+};
+
+TEST(Actionlib, GoalSucceeds)
+{
+  actionlib::TestFeedback feedback;
+  actionlib::TestResult   result;
+
+  LONGS_EQUAL(actionlib_msgs::GoalStatus::LOST, _client.getState());
+  LONGS_EQUAL(1, sendGoal(7));
+  LONGS_EQUAL(7, last_goal);
+  LONGS_EQUAL(actionlib_msgs::GoalStatus::PENDING, _client.getState());
+  CHECK(_server.isActive(0));
+  STRCMP_EQUAL(_client.getGoalId(), _server.getGoalId(0));
+
+  CHECK(_server.update() > 0);
+  serverToClient();
+  LONGS_EQUAL(actionlib_msgs::GoalStatus::ACTIVE, _client.getState());
+
+  feedback.feedback = 3;
+  CHECK(_server.publishFeedback(0, feedback));
+  serverToClient();
+  LONGS_EQUAL(3, last_feedback);
+
+  result.result = 42;
+  CHECK(_server.setSucceeded(0, result));
+  CHECK_FALSE(_server.isActive(0));
+  serverToClient();
+  LONGS_EQUAL(1, done_calls);
+  LONGS_EQUAL(actionlib_msgs::GoalStatus::SUCCEEDED, done_status);
+  LONGS_EQUAL(42, done_result);
+  CHECK(_client.isDone());
+}
+
+TEST(Actionlib, GoalRejected)
+{
+  sendGoal(-1);
+  CHECK_FALSE(_server.isActive(0));
+  LONGS_EQUAL(actionlib_msgs::GoalStatus::REJECTED, _server.getStatus(0));
+  serverToClient();
+  LONGS_EQUAL(actionlib_msgs::GoalStatus::REJECTED, done_status);
+  CHECK(_client.isDone());
+}
+
+TEST(Actionlib, CancelPreemptsGoal)
+{
+  actionlib::TestResult result;
+
+  sendGoal(1);
+  CHECK(_client.cancelGoal());
+  LONGS_EQUAL(1u, forward(_client_nh, _server_nh, CLIENT_CANCEL, SERVER_CANCEL));
+  LONGS_EQUAL(1, cancels);
+  CHECK(_server.isCancelRequested(0));
+
+  CHECK(_server.setCanceled(0, result));
+  serverToClient();
+  LONGS_EQUAL(actionlib_msgs::GoalStatus::PREEMPTED, done_status);
+}
+
+TEST(Actionlib, FeedbackRateLimited)
+{
+  actionlib::TestFeedback feedback;
+
+  sendGoal(1);
+  CHECK(_server.publishFeedback(0, feedback));
+  CHECK_FALSE(_server.publishFeedback(0, feedback));
+  _server_nh.getHardware()->_time += 100u;
+  CHECK(_server.publishFeedback(0, feedback));
+  CHECK_FALSE(_server.publishFeedback(1, feedback));
+}
+
+TEST(Actionlib, SlotsReusedAfterFinish)
+{
+  TestNodeHandle&       nh = _server_nh;
+  actionlib::TestResult result;
+
+  sendGoal(1);
+  _client_nh.getHardware()->_time += 1000u;
+  sendGoal(2);
+  CHECK(_server.isActive(0));
+  CHECK(_server.isActive(1));
+
+  // no slot left
+  _client_nh.getHardware()->_time += 1000u;
+  nh.getHardware()->clearTx();
+  sendGoal(3);
+  LONGS_EQUAL(2, goals_received);
+  serverToClient();
+  LONGS_EQUAL(actionlib_msgs::GoalStatus::REJECTED, done_status);
+
+  // finished goal gives its slot to the next one
+  _server.setSucceeded(0, result);
+  _client_nh.getHardware()->_time += 1000u;
+  sendGoal(4);
+  LONGS_EQUAL(3, goals_received);
+  CHECK(_server.isActive(0));
+  STRCMP_EQUAL(_client.getGoalId(), _server.getGoalId(0));
+}
+
+TEST(Actionlib, StatusPublishedPeriodically)
+{
+  CHECK(_server.update() > 0);
+  LONGS_EQUAL(0, _server.update());
+  _server_nh.getHardware()->_time += 200u;
+  CHECK(_server.update() > 0);
+
+  sendGoal(1);
+  CHECK(_server.update() > 0);
+}
+
+TEST(Actionlib, FinishedGoalsExpire)
+{
+  actionlib::TestResult result;
+
+  sendGoal(1);
+  _server.setSucceeded(0, result);
+  _server_nh.getHardware()->_time += TestServer::STATUS_KEEP_MS - 1u;
+  _server.update();
+  LONGS_EQUAL(actionlib_msgs::GoalStatus::SUCCEEDED, _server.getStatus(0));
+  _server_nh.getHardware()->_time += 1u;
+  _server.update();
+  LONGS_EQUAL(actionlib_msgs::GoalStatus::LOST, _server.getStatus(0));
+}
+
+TEST(Actionlib, TopicNames)
+{
+  actionlib::ActionTopics topics;
+  char                    ns[80];
+
+  STRCMP_EQUAL("arm/move/feedback", topics.make(actionlib::ACTION_FEEDBACK, "arm/move"));
+  memset(ns, 'a', sizeof(ns) - 1u);
+  ns[sizeof(ns) - 1u] = '\0';
+  const char* name = topics.make(actionlib::ACTION_RESULT, ns);
+  LONGS_EQUAL(actionlib::ACTION_TOPIC_LEN - 1, strlen(name));
+  STRCMP_EQUAL("/result", name + strlen(name) - 7u);
+}
@@ -0,0 +1,262 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file BatchedTransformBroadcasterTests.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Tests of the batched transform broadcaster
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <CppUTest/TestHarness.h>
+#include <cstring>
+#include "ros/node_handle.h"
+#include "tf/batched_transform_broadcaster.h"
+#include "TestHardware.h"
+/* -------------------------------------------------------------------------------*/
+
+typedef ros::NodeHandle_<TestHardware, 5, 5, 256, 256> TestNodeHandle;
+typedef tf::BatchedTransformBroadcaster<TestNodeHandle, 8, 2> TestBroadcaster;
+
+// Publisher ids follow the subscriber ids, /tf is advertised before /tf_static
+constexpr int TF_ID        = 100 + 5;
+constexpr int TF_STATIC_ID = 100 + 5 + 1;
+
+static const char* child_frames[] = {"frame0", "frame1", "frame2", "frame3", "frame4"};
+
+TEST_GROUP(BatchedTransformBroadcaster)
+{
+  void setup()
+  {
+    _nh.initNode();
+    _br.init(_nh);
+  }
+
+  void connect()
+  {
+    _nh.getHardware()->injectFrame(rosserial_msgs::TopicInfo::ID_PUBLISHER, nullptr, 0u);
+    _nh.spinOnce();
+    _nh.getHardware()->clearTx();
+    CHECK(_nh.connected());
+  }
+
+  geometry_msgs::TransformStamped makeTransform(const uint32_t idx, const float x)
+  {
+    geometry_msgs::TransformStamped transform;
+
+    transform.header.frame_id       = "base";
+    transform.child_frame_id        = child_frames[idx];
+    transform.transform.translation.x = x;
+    transform.transform.rotation.w  = 1.0f;
+    return transform;
+  }
+
+  /**
+   * @brief Parse the frames written to the test hardware, returns number of
+   *        frames with the given topic id and the transforms of the last one
+   */
+  template<typename MsgT>
+  uint32_t parseFrames(const int topic, MsgT& msg)
+  {
+    // every frame starts with the sync byte
+    _nh.getHardware()->forEachFrame(TEST_HW_ANY_TOPIC, [&](uint8_t* payload, const uint32_t) {
+      CHECK(0xffu == payload[-7]);
+    });
+
+    return _nh.getHardware()->forEachFrame(topic, [&](uint8_t* payload, const uint32_t size) {
+      CHECK(static_cast<int>(size) == msg.deserialize(payload, size));
+    });
+  }
+
+  TestNodeHandle  _nh;
+  TestBroadcaster _br;
+};
+
+TEST(BatchedTransformBroadcaster, OneMessagePerFlush)
+{
+  tf::tfMessage msg;
+
+  connect();
+
+  for(uint32_t idx = 0u; idx < 2u; idx++)
+  {
+    CHECK(_br.sendTransform(makeTransform(idx, static_cast<float>(idx))));
+  }
+  CHECK(2 == _br.getQueued());
+  CHECK(0u == _nh.getHardware()->_tx_size);
+
+  CHECK(2 == _br.flush());
+  CHECK(0 == _br.getQueued());
+
+  CHECK(1u == parseFrames(TF_ID, msg));
+  CHECK(2u == msg.transforms_length);
+  STRCMP_EQUAL("frame1", msg.transforms[1].child_frame_id);
+  DOUBLES_EQUAL(1.0, msg.transforms[1].transform.translation.x, 0.0);
+}
+
+TEST(BatchedTransformBroadcaster, QueuedTransformReplaced)
+{
+  tf::tfMessage msg;
+
+  connect();
+
+  CHECK(_br.sendTransform(makeTransform(0u, 1.0f)));
+  CHECK(_br.sendTransform(makeTransform(0u, 2.0f)));
+  CHECK(1 == _br.getQueued());
+  CHECK(1 == _br.flush());
+
+  CHECK(1u == parseFrames(TF_ID, msg));
+  CHECK(1u == msg.transforms_length);
+  DOUBLES_EQUAL(2.0, msg.transforms[0].transform.translation.x, 0.0);
+}
+
+TEST(BatchedTransformBroadcaster, RateLimitPerChildFrame)
+{
+  connect();
+  _br.setMinPeriod(100u);
+
+  _nh.getHardware()->_time = 1000u;
+  CHECK(_br.sendTransform(makeTransform(0u, 0.0f)));
+  CHECK(1 == _br.flush());
+
+  _nh.getHardware()->_time = 1050u;
+  CHECK_FALSE(_br.sendTransform(makeTransform(0u, 0.0f)));
+  CHECK(_br.sendTransform(makeTransform(1u, 0.0f)));
+  CHECK(1 == _br.flush());
+
+  _nh.getHardware()->_time = 1100u;
+  CHECK(_br.sendTransform(makeTransform(0u, 0.0f)));
+  CHECK_FALSE(_br.sendTransform(makeTransform(1u, 0.0f)));
+}
+
+TEST(BatchedTransformBroadcaster, ChildFrameIdCopied)
+{
+  geometry_msgs::TransformStamped transform = makeTransform(0u, 0.0f);
+  char                            name[8];
+
+  connect();
+  _br.setMinPeriod(100u);
+
+  strcpy(name, "frame0");
+  transform.child_frame_id = name;
+  _nh.getHardware()->_time = 1000u;
+  CHECK(_br.sendTransform(transform));
+  CHECK(1 == _br.flush());
+
+  /* the buffer now names another frame, which is not rate limited */
+  strcpy(name, "frame1");
+  CHECK(_br.sendTransform(transform));
+  CHECK_FALSE(_br.sendTransform(makeTransform(0u, 0.0f)));
+}
+
+TEST(BatchedTransformBroadcaster, ChildFrameIdTooLong)
+{
+  geometry_msgs::TransformStamped transform = makeTransform(0u, 0.0f);
+  char                            name[33];
+
+  connect();
+
+  memset(name, 'a', 32u);
+  name[32] = '\0';
+  transform.child_frame_id = name;
+  CHECK_FALSE(_br.sendTransform(transform));
+
+  name[31] = '\0';
+  CHECK(_br.sendTransform(transform));
+}
+
+TEST(BatchedTransformBroadcaster, SplitToFitOutputBuffer)
+{
+  tf::tfMessage msg;
+
+  connect();
+
+  // About 88 bytes per transform, two fit into the 256 byte output buffer
+  for(uint32_t idx = 0u; idx < 5u; idx++)
+  {
+    CHECK(_br.sendTransform(makeTransform(idx, 0.0f)));
+  }
+  CHECK(5 == _br.flush());
+
+  CHECK(3u == parseFrames(TF_ID, msg));
+  CHECK(1u == msg.transforms_length);
+  STRCMP_EQUAL("frame4", msg.transforms[0].child_frame_id);
+}
+
+TEST(BatchedTransformBroadcaster, StaticAfterNegotiation)
+{
+  tf2_msgs::TFMessage msg;
+
+  CHECK(_br.sendStaticTransform(makeTransform(0u, 3.0f)));
+  CHECK(_br.sendStaticTransform(makeTransform(1u, 4.0f)));
+  CHECK_FALSE(_br.sendStaticTransform(makeTransform(2u, 5.0f)));
+
+  // Not connected yet
+  _br.flush();
+  CHECK(0u == _nh.getHardware()->_tx_size);
+
+  // tf2 listeners only connect to the tf2 type on /tf_static
+  _nh.getHardware()->injectFrame(rosserial_msgs::TopicInfo::ID_PUBLISHER, nullptr, 0u);
+  _nh.spinOnce();
+  const char* type = "tf2_msgs/TFMessage";
+  CHECK(nullptr != memmem(_nh.getHardware()->_tx_buffer, _nh.getHardware()->_tx_size, type, strlen(type)));
+  _nh.getHardware()->clearTx();
+  CHECK(_nh.connected());
+
+  _br.flush();
+  CHECK(1u == parseFrames(TF_STATIC_ID, msg));
+  CHECK(2u == msg.transforms_length);
+  DOUBLES_EQUAL(4.0, msg.transforms[1].transform.translation.x, 0.0);
+
+  // Only once per negotiation
+  _nh.getHardware()->clearTx();
+  _br.flush();
+  CHECK(0u == _nh.getHardware()->_tx_size);
+
+  connect();
+  _br.flush();
+  CHECK(1u == parseFrames(TF_STATIC_ID, msg));
+}
+
+TEST(BatchedTransformBroadcaster, NotConnected)
+{
+  CHECK(_br.sendTransform(makeTransform(0u, 0.0f)));
+  CHECK(0 == _br.flush());
+  CHECK(0 == _br.getQueued());
+  CHECK(0u == _nh.getHardware()->_tx_size);
+}
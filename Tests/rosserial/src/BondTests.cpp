@@ -0,0 +1,234 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file BondTests.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Tests of the heartbeat bond
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <CppUTest/TestHarness.h>
+#include <cstring>
+#include "ros/node_handle.h"
+#include "bondcpp/bond.h"
+#include "TestHardware.h"
+/* -------------------------------------------------------------------------------*/
+
+typedef ros::NodeHandle_<TestHardware, 5, 5, 256, 512> TestNodeHandle;
+typedef bond::Bond<TestNodeHandle> TestBond;
+
+// Subscriber and publisher ids in order of registration
+constexpr int BOND_SUB_ID = 100;
+constexpr int BOND_PUB_ID = 100 + 5;
+
+static int broken_count = 0;
+static int formed_count = 0;
+
+static void onBroken()
+{
+  broken_count++;
+}
+
+static void onFormed()
+{
+  formed_count++;
+}
+
+TEST_GROUP(Bond)
+{
+  void setup()
+  {
+    broken_count = 0;
+    formed_count = 0;
+
+    _bond.setHeartbeatPeriod(0.1f);
+    _bond.setHeartbeatTimeout(0.3f);
+    _bond.init(_nh);
+    _nh.initNode();
+    _nh.getHardware()->injectFrame(rosserial_msgs::TopicInfo::ID_PUBLISHER, nullptr, 0u);
+    _nh.spinOnce();
+    _nh.getHardware()->clearTx();
+    CHECK(_nh.connected());
+  }
+
+  void advance(const unsigned long ms)
+  {
+    _nh.getHardware()->_time += ms;
+  }
+
+  void injectStatus(const char* id, const char* instance_id, const bool active)
+  {
+    bond::Status  msg;
+    unsigned char buffer[128];
+
+    msg.id                = id;
+    msg.instance_id       = instance_id;
+    msg.active            = active;
+    msg.heartbeat_timeout = 0.3f;
+    msg.heartbeat_period  = 0.1f;
+    _nh.getHardware()->injectFrame(BOND_SUB_ID, buffer, msg.serialize(buffer));
+    _nh.spinOnce();
+  }
+
+  /**
+   * @brief Parse the frames written to the test hardware, returns number of
+   *        heartbeats and deserializes the last one into msg
+   */
+  uint32_t parseFrames(bond::Status& msg)
+  {
+    const uint32_t count = _nh.getHardware()->forEachFrame(BOND_PUB_ID, [&](uint8_t* payload, const uint32_t size) {
+      memcpy(_rx, payload, size);
+      CHECK(static_cast<int>(size) == msg.deserialize(_rx, size));
+    });
+
+    _nh.getHardware()->clearTx();
+    return count;
+  }
+
+  TestNodeHandle  _nh;
+  TestBond        _bond{"bond", "base", onBroken, onFormed};
+  unsigned char   _rx[512];
+};
+
+TEST(Bond, PublishesHeartbeats)
+{
+  bond::Status msg;
+
+  CHECK(_bond.update() > 0);
+  LONGS_EQUAL(0, _bond.update());
+  advance(99u);
+  LONGS_EQUAL(0, _bond.update());
+  advance(1u);
+  CHECK(_bond.update() > 0);
+
+  LONGS_EQUAL(2u, parseFrames(msg));
+  STRCMP_EQUAL("base", msg.id);
+  STRCMP_EQUAL(_bond.getInstanceId(), msg.instance_id);
+  LONGS_EQUAL(8u, strlen(msg.instance_id));
+  STRCMP_EQUAL("", msg.header.frame_id);
+  CHECK(msg.active);
+  DOUBLES_EQUAL(0.1, msg.heartbeat_period, 1e-6);
+  DOUBLES_EQUAL(0.3, msg.heartbeat_timeout, 1e-6);
+}
+
+TEST(Bond, FormsAndBreaksOnTimeout)
+{
+  bond::Status msg;
+
+  _bond.update();
+  CHECK(_bond.isBroken());
+  LONGS_EQUAL(0, formed_count);
+
+  advance(50u);
+  injectStatus("base", "host", true);
+  CHECK(_bond.isAlive(_nh.getHardware()->_time));
+  parseFrames(msg);
+
+  // formed, answered at once
+  CHECK(_bond.update() > 0);
+  CHECK(!_bond.isBroken());
+  LONGS_EQUAL(1, formed_count);
+  LONGS_EQUAL(1u, parseFrames(msg));
+
+  advance(300u);
+  _bond.update();
+  CHECK(!_bond.isBroken());
+
+  advance(1u);
+  CHECK(!_bond.isAlive(_nh.getHardware()->_time));
+  _bond.update();
+  CHECK(_bond.isBroken());
+  LONGS_EQUAL(1, broken_count);
+
+  // formed again by the next heartbeat
+  injectStatus("base", "host", true);
+  _bond.update();
+  CHECK(!_bond.isBroken());
+  LONGS_EQUAL(2, formed_count);
+}
+
+TEST(Bond, IgnoresOwnAndOtherHeartbeats)
+{
+  injectStatus("base", _bond.getInstanceId(), true);
+  injectStatus("arm", "host", true);
+  _bond.update();
+  CHECK(_bond.isBroken());
+  LONGS_EQUAL(0, formed_count);
+}
+
+TEST(Bond, PeerGoingDownBreaksAtOnce)
+{
+  injectStatus("base", "host", true);
+  _bond.update();
+  CHECK(!_bond.isBroken());
+
+  injectStatus("base", "host", false);
+  CHECK(!_bond.isAlive(_nh.getHardware()->_time));
+  _bond.update();
+  CHECK(_bond.isBroken());
+  LONGS_EQUAL(1, broken_count);
+}
+
+TEST(Bond, BreakBondAnnouncesInactive)
+{
+  bond::Status msg;
+
+  injectStatus("base", "host", true);
+  _bond.update();
+  parseFrames(msg);
+
+  _bond.breakBond();
+  _bond.update();
+  CHECK(_bond.isBroken());
+
+  // dead heartbeats every DEAD_PUBLISH_PERIOD
+  advance(50u);
+  CHECK(_bond.update() > 0);
+  LONGS_EQUAL(2u, parseFrames(msg));
+  CHECK(!msg.active);
+
+  injectStatus("base", "host", true);
+  _bond.update();
+  CHECK(_bond.isBroken());
+
+  _bond.start();
+  injectStatus("base", "host", true);
+  _bond.update();
+  CHECK(!_bond.isBroken());
+}
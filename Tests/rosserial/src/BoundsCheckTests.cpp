@@ -0,0 +1,438 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file BoundsCheckTests.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Tests of the bounds-checked deserialization
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <CppUTest/TestHarness.h>
+#include <cstring>
+#include "ros/node_handle.h"
+#include "sensor_msgs/LaserScan.h"
+#include "sensor_msgs/PointCloud.h"
+#include "std_msgs/Empty.h"
+#include "std_msgs/Int32.h"
+#include "std_srvs/Trigger.h"
+#include "TestHardware.h"
+/* -------------------------------------------------------------------------------*/
+
+typedef ros::NodeHandle_<TestHardware, 5, 5, 256, 256> TestNodeHandle;
+
+static uint32_t received_count = 0u;
+
+static void int32Callback(const std_msgs::Int32& msg)
+{
+  (void) msg;
+  received_count++;
+}
+
+/**
+ * @brief Length check of a message holding std_msgs/Empty[] events, as the
+ *        generator writes it
+ */
+class EmptyArray : public ros::Msg
+{
+  public:
+
+    virtual int serialize(unsigned char*) const
+    {
+      return 0;
+    }
+
+    virtual int deserialize(unsigned char*)
+    {
+      return 0;
+    }
+
+    int wireLength(const unsigned char *inbuffer, int offset, size_t size) const
+    {
+      uint32_t events_lengthT;
+      offset = wireCount(inbuffer, offset, size, events_lengthT, 0);
+      for( uint32_t i = 0; (i < events_lengthT) && (offset >= 0); i++){
+        offset = this->st_events.wireLength(inbuffer, offset, size);
+      }
+      return offset;
+    }
+
+    const char * getType(){ return "test/EmptyArray"; };
+    const char * getMD5(){ return ""; };
+
+    std_msgs::Empty st_events;
+};
+
+/**
+ * @brief Subscriber written against the callback without frame size
+ */
+class LegacySubscriber : public ros::Subscriber_
+{
+  public:
+
+    LegacySubscriber() :
+    _frames(0u)
+    {
+      topic_ = "legacy";
+    }
+
+    virtual void callback(unsigned char* data)
+    {
+      _msg.deserialize(data);
+      _frames++;
+    }
+
+    virtual int getEndpointType()
+    {
+      return rosserial_msgs::TopicInfo::ID_SUBSCRIBER;
+    }
+
+    virtual const char * getMsgType()
+    {
+      return _msg.getType();
+    }
+
+    virtual const char * getMsgMD5()
+    {
+      return _msg.getMD5();
+    }
+
+    std_msgs::Int32 _msg;
+    uint32_t        _frames;
+};
+
+TEST_GROUP(BoundsCheck)
+{
+  void setup()
+  {
+    received_count = 0u;
+
+    _scan.header.frame_id   = "laser";
+    _scan.angle_min         = -1.5f;
+    _scan.ranges            = _ranges;
+    _scan.ranges_length     = 3u;
+    _ranges[0]              = 1.0f;
+    _ranges[1]              = 2.0f;
+    _ranges[2]              = 3.0f;
+
+    _size = _scan.serialize(_buffer);
+  }
+
+  void connect()
+  {
+    _nh.initNode();
+    _nh.getHardware()->injectFrame(rosserial_msgs::TopicInfo::ID_PUBLISHER, nullptr, 0u);
+    _nh.spinOnce();
+    CHECK(_nh.connected());
+  }
+
+  sensor_msgs::LaserScan  _scan;
+  float                   _ranges[3];
+  uint8_t                 _buffer[128];
+  int                     _size;
+  TestNodeHandle          _nh;
+};
+
+TEST(BoundsCheck, CompleteMessage)
+{
+  sensor_msgs::LaserScan scan;
+
+  CHECK(_size == _scan.wireLength(_buffer, 0, _size));
+  CHECK(_size == scan.deserialize(_buffer, _size));
+  STRCMP_EQUAL("laser", scan.header.frame_id);
+  CHECK(3u == scan.ranges_length);
+  DOUBLES_EQUAL(3.0, scan.ranges[2], 0.0);
+
+  free(scan.ranges);
+}
+
+TEST(BoundsCheck, TruncatedMessage)
+{
+  for(int size = 0; size < _size; size++)
+  {
+    sensor_msgs::LaserScan scan;
+
+    CHECK(-1 == scan.deserialize(_buffer, size));
+    CHECK(0u == scan.ranges_length);
+    POINTERS_EQUAL(nullptr, scan.ranges);
+  }
+}
+
+TEST(BoundsCheck, CorruptArrayLength)
+{
+  sensor_msgs::LaserScan scan;
+
+  // ranges_length follows the header (seq, stamp, "laser") and 7 floats
+  const int length_pos = 4 + 8 + 4 + 5 + 7 * 4;
+  CHECK(3u == _buffer[length_pos]);
+  memset(&_buffer[length_pos], 0xff, 4u);
+
+  CHECK(-1 == scan.deserialize(_buffer, _size));
+  POINTERS_EQUAL(nullptr, scan.ranges);
+}
+
+TEST(BoundsCheck, ArrayOfEmptyMessages)
+{
+  EmptyArray    msg;
+  const uint8_t wire[4] = {0xe8u, 0x03u, 0u, 0u};
+
+  // 1000 elements in no bytes
+  LONGS_EQUAL(4, msg.wireLength(wire, 0, sizeof(wire)));
+}
+
+TEST(BoundsCheck, ArrayCountBoundByElementSize)
+{
+  uint8_t  wire[4 + 24] = {3u, 0u, 0u, 0u};
+  uint32_t count        = 0u;
+
+  // three elements of 12 bytes do not fit into 24 bytes, of 8 bytes they do
+  LONGS_EQUAL(-1, ros::Msg::wireCount(wire, 0, sizeof(wire), count, 12));
+  LONGS_EQUAL(0u, count);
+  LONGS_EQUAL(4, ros::Msg::wireCount(wire, 0, sizeof(wire), count, 8));
+  LONGS_EQUAL(3u, count);
+}
+
+TEST(BoundsCheck, NestedArrayElementsOwnTheirArrays)
+{
+  sensor_msgs::PointCloud       cloud;
+  sensor_msgs::PointCloud       copy;
+  sensor_msgs::ChannelFloat32   channels[2];
+  float                         values[2][2] = {{1.0f, 2.0f}, {3.0f, 4.0f}};
+  uint8_t                       buffer[128];
+
+  channels[0].name          = "a";
+  channels[0].values        = values[0];
+  channels[0].values_length = 2u;
+  channels[1].name          = "b";
+  channels[1].values        = values[1];
+  channels[1].values_length = 2u;
+  cloud.header.frame_id     = "cloud";
+  cloud.channels            = channels;
+  cloud.channels_length     = 2u;
+
+  // deserialize terminates strings in the buffer, keep the original
+  uint8_t wire[128];
+  const int size = cloud.serialize(wire);
+  memcpy(buffer, wire, size);
+  CHECK(size == copy.deserialize(buffer, size));
+  CHECK(copy.channels[0].values != copy.channels[1].values);
+  STRCMP_EQUAL("a", copy.channels[0].name);
+  DOUBLES_EQUAL(2.0, copy.channels[0].values[1], 0.0);
+  STRCMP_EQUAL("b", copy.channels[1].name);
+  DOUBLES_EQUAL(4.0, copy.channels[1].values[1], 0.0);
+
+  uint8_t again[128];
+  CHECK(size == copy.serialize(again));
+  MEMCMP_EQUAL(wire, again, size);
+
+  free(copy.channels[0].values);
+  free(copy.channels[1].values);
+  delete[] copy.channels;
+}
+
+TEST(BoundsCheck, NestedArrayKeepsStorageWhenShrinking)
+{
+  sensor_msgs::PointCloud       cloud;
+  sensor_msgs::PointCloud       copy;
+  sensor_msgs::ChannelFloat32   channels[2];
+  float                         values[2][2] = {{1.0f, 2.0f}, {3.0f, 4.0f}};
+  uint8_t                       wire[128];
+  uint8_t                       buffer[128];
+
+  channels[0].name          = "a";
+  channels[0].values        = values[0];
+  channels[0].values_length = 2u;
+  channels[1].name          = "b";
+  channels[1].values        = values[1];
+  channels[1].values_length = 2u;
+  cloud.header.frame_id     = "cloud";
+  cloud.channels            = channels;
+  cloud.channels_length     = 2u;
+
+  int size = cloud.serialize(wire);
+  memcpy(buffer, wire, size);
+  CHECK(size == copy.deserialize(buffer, size));
+  CHECK(2u == copy.channels_capacity);
+  float* const second = copy.channels[1].values;
+
+  // one channel, the second element keeps its values array
+  cloud.channels_length = 1u;
+  size = cloud.serialize(wire);
+  memcpy(buffer, wire, size);
+  CHECK(size == copy.deserialize(buffer, size));
+  CHECK(1u == copy.channels_length);
+  CHECK(2u == copy.channels_capacity);
+  POINTERS_EQUAL(second, copy.channels[1].values);
+
+  // two channels again reuse the element instead of constructing it anew
+  cloud.channels_length = 2u;
+  size = cloud.serialize(wire);
+  memcpy(buffer, wire, size);
+  CHECK(size == copy.deserialize(buffer, size));
+  CHECK(2u == copy.channels_length);
+  POINTERS_EQUAL(second, copy.channels[1].values);
+  DOUBLES_EQUAL(4.0, copy.channels[1].values[1], 0.0);
+
+  free(copy.channels[0].values);
+  free(copy.channels[1].values);
+  delete[] copy.channels;
+}
+
+TEST(BoundsCheck, NestedArrayLeavesUserStorage)
+{
+  sensor_msgs::PointCloud       cloud;
+  sensor_msgs::PointCloud       copy;
+  sensor_msgs::ChannelFloat32   channels[2];
+  sensor_msgs::ChannelFloat32   user[1];
+  float                         values[2][2] = {{1.0f, 2.0f}, {3.0f, 4.0f}};
+  uint8_t                       wire[128];
+
+  channels[0].name          = "a";
+  channels[0].values        = values[0];
+  channels[0].values_length = 2u;
+  channels[1].name          = "b";
+  channels[1].values        = values[1];
+  channels[1].values_length = 2u;
+  cloud.header.frame_id     = "cloud";
+  cloud.channels            = channels;
+  cloud.channels_length     = 2u;
+
+  // storage of the user, capacity 0: the decoder must not free it
+  copy.channels         = user;
+  copy.channels_length  = 1u;
+
+  const int size = cloud.serialize(wire);
+  CHECK(size == copy.deserialize(wire, size));
+  CHECK(user != copy.channels);
+  CHECK(2u == copy.channels_capacity);
+  DOUBLES_EQUAL(4.0, copy.channels[1].values[1], 0.0);
+
+  free(copy.channels[0].values);
+  free(copy.channels[1].values);
+  delete[] copy.channels;
+}
+
+TEST(BoundsCheck, ShortFrameDropped)
+{
+  ros::Subscriber<std_msgs::Int32> sub("int", &int32Callback);
+
+  CHECK(_nh.subscribe(sub));
+  connect();
+
+  const uint8_t payload[4] = {1u, 2u, 3u, 4u};
+  _nh.getHardware()->injectFrame(sub.id_, payload, 2u);
+  _nh.spinOnce();
+  CHECK(0u == received_count);
+
+  _nh.getHardware()->injectFrame(sub.id_, payload, 4u);
+  _nh.spinOnce();
+  CHECK(1u == received_count);
+}
+
+TEST(BoundsCheck, OversizedFrameDropped)
+{
+  ros::Subscriber<std_msgs::Int32> sub("int", &int32Callback);
+  uint8_t payload[300];
+
+  CHECK(_nh.subscribe(sub));
+  connect();
+
+  // Larger than the input buffer of 256 bytes
+  memset(payload, 0xaa, sizeof(payload));
+  _nh.getHardware()->injectFrame(sub.id_, payload, sizeof(payload));
+  _nh.spinOnce();
+  CHECK(0u == received_count);
+
+  _nh.getHardware()->injectFrame(sub.id_, payload, 4u);
+  _nh.spinOnce();
+  CHECK(1u == received_count);
+}
+
+TEST(BoundsCheck, UnknownTopicIgnored)
+{
+  ros::Subscriber<std_msgs::Int32> sub("int", &int32Callback);
+  const uint8_t payload[4] = {1u, 2u, 3u, 4u};
+
+  CHECK(_nh.subscribe(sub));
+  connect();
+
+  _nh.getHardware()->injectFrame(100u + 5u, payload, 4u);
+  _nh.getHardware()->injectFrame(0x7fffu, payload, 4u);
+  _nh.spinOnce();
+  CHECK(0u == received_count);
+}
+
+TEST(BoundsCheck, LegacySubscriberCallback)
+{
+  LegacySubscriber  sub;
+  const uint8_t     payload[4] = {0x2au, 0u, 0u, 0u};
+
+  CHECK(_nh.subscribe(sub));
+  connect();
+
+  _nh.getHardware()->injectFrame(sub.id_, payload, 4u);
+  _nh.spinOnce();
+  CHECK(1u == sub._frames);
+  CHECK(42 == sub._msg.data);
+}
+
+TEST(BoundsCheck, ServiceClientBrokenReply)
+{
+  ros::ServiceClient<std_srvs::TriggerRequest, std_srvs::TriggerResponse> client("trigger");
+  std_srvs::TriggerRequest  request;
+  std_srvs::TriggerResponse response;
+
+  CHECK(_nh.serviceClient(client));
+  connect();
+
+  // success flag without the message string, the call has to end anyway
+  const uint8_t broken[2] = {1u, 5u};
+  _nh.getHardware()->injectFrame(client.id_, broken, sizeof(broken));
+  CHECK_FALSE(client.call(request, response));
+  CHECK_FALSE(client.waiting);
+
+  std_srvs::TriggerResponse reply;
+  uint8_t                   wire[32];
+  reply.success = true;
+  reply.message = "ok";
+  const int size = reply.serialize(wire);
+  _nh.getHardware()->injectFrame(client.id_, wire, size);
+  CHECK_TRUE(client.call(request, response));
+  CHECK_TRUE(response.success);
+  STRCMP_EQUAL("ok", response.message);
+}
@@ -0,0 +1,204 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file CaptureReplayTests.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Tests of the serial capture and replay hardware
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <CppUTest/TestHarness.h>
+#include <cstdio>
+#include "ros/node_handle.h"
+#include "std_msgs/Int32.h"
+#include "CaptureHardware.h"
+#include "TestHardware.h"
+#include "ReplayHardware.h"
+/* -------------------------------------------------------------------------------*/
+
+typedef ros::CaptureHardware<TestHardware, CaptureFile> CapturedHardware;
+
+constexpr char      CAPTURE_TEST_FILE[] = "CaptureReplayTests.rscap";
+constexpr int       CAPTURE_SUB_ID      = 100;
+constexpr int       CAPTURE_MSGS        = 5;
+
+/**
+ * @brief Node which echoes every received value doubled, so all writes
+ *        follow from the received stream
+ */
+template<class Hardware>
+class EchoNode
+{
+  public:
+
+    EchoNode(void) :
+    _sub("cmd", &EchoNode::callback, this),
+    _pub("state", &_echo),
+    _count(0),
+    _factor(2)
+    {
+      _nh.initNode();
+      _nh.subscribe(_sub);
+      _nh.advertise(_pub);
+    }
+
+    void callback(const std_msgs::Int32& msg)
+    {
+      if(_count < CAPTURE_MSGS)
+      {
+        _values[_count] = msg.data;
+      }
+      _count++;
+      _echo.data = msg.data * _factor;
+      _pub.publish(&_echo);
+    }
+
+    ros::NodeHandle_<Hardware, 2, 2, 256, 256>                _nh;
+    std_msgs::Int32                                           _echo;
+    ros::Subscriber<std_msgs::Int32, EchoNode<Hardware> >     _sub;
+    ros::Publisher                                            _pub;
+    int32_t                                                   _values[CAPTURE_MSGS];
+    int                                                       _count;
+    int32_t                                                   _factor;
+};
+
+TEST_GROUP(CaptureReplay)
+{
+  void setup()
+  {
+    CHECK(_file.open(CAPTURE_TEST_FILE));
+    _live._nh.getHardware()->setSink(&_file);
+
+    TestHardware* hw = _live._nh.getHardware();
+    hw->injectFrame(rosserial_msgs::TopicInfo::ID_PUBLISHER, nullptr, 0u);
+    _live._nh.spinOnce();
+
+    for(int idx = 0; idx < CAPTURE_MSGS; idx++)
+    {
+      std_msgs::Int32 msg;
+      uint8_t         buffer[8];
+
+      msg.data = 1000 * idx - 7;
+      hw->injectFrame(CAPTURE_SUB_ID, buffer, msg.serialize(buffer));
+      hw->_time += 700u;
+      _live._nh.spinOnce();
+      _live._nh.spinOnce();
+    }
+
+    _live._nh.getHardware()->setSink(nullptr);
+    _file.close();
+  }
+
+  void teardown()
+  {
+    remove(CAPTURE_TEST_FILE);
+  }
+
+  void replay(EchoNode<ReplayHardware>& node)
+  {
+    ReplayHardware* hw = node._nh.getHardware();
+    for(int spins = 0; !hw->done() && (spins < 1000); spins++)
+    {
+      node._nh.spinOnce();
+    }
+    CHECK(hw->done());
+  }
+
+  CaptureFile                 _file;
+  EchoNode<CapturedHardware>  _live;
+};
+
+TEST(CaptureReplay, ReplaysCallbacksAndWrites)
+{
+  EchoNode<ReplayHardware> node;
+  ReplayHardware* hw = node._nh.getHardware();
+
+  CHECK(hw->open(CAPTURE_TEST_FILE));
+  replay(node);
+
+  LONGS_EQUAL(CAPTURE_MSGS, _live._count);
+  LONGS_EQUAL(CAPTURE_MSGS, node._count);
+  for(int idx = 0; idx < CAPTURE_MSGS; idx++)
+  {
+    LONGS_EQUAL(_live._values[idx], node._values[idx]);
+  }
+  LONGS_EQUAL(_live._nh.getHardware()->_time, hw->time());
+
+  // topic negotiation, sync requests and echoes are identical
+  CHECK(hw->getWrites() > static_cast<uint32_t>(CAPTURE_MSGS));
+  LONGS_EQUAL(0u, hw->getWriteMismatches());
+  LONGS_EQUAL(0u, hw->getWriteExtra());
+
+  // a second replay gives the same result
+  hw->rewind();
+  node._count = 0;
+  replay(node);
+  LONGS_EQUAL(CAPTURE_MSGS, node._count);
+  LONGS_EQUAL(0u, hw->getWriteMismatches());
+}
+
+TEST(CaptureReplay, DetectsDivergence)
+{
+  EchoNode<ReplayHardware> node;
+  ReplayHardware* hw = node._nh.getHardware();
+
+  node._factor = 3;
+  CHECK(hw->open(CAPTURE_TEST_FILE));
+  replay(node);
+
+  LONGS_EQUAL(CAPTURE_MSGS, node._count);
+  LONGS_EQUAL(CAPTURE_MSGS, hw->getWriteMismatches());
+}
+
+TEST(CaptureReplay, RejectsInvalidCapture)
+{
+  ReplayHardware hw;
+  const uint8_t  invalid[6] = {'R', 'S', 'C', '0', 'E', 'E'};
+  const uint8_t  truncated[8] = {'R', 'S', 'C', '1', 'R', 0x42u, 'T', 0x01u};
+
+  CHECK_FALSE(hw.open("does/not/exist.rscap"));
+  CHECK_FALSE(hw.open(invalid, sizeof(invalid)));
+  LONGS_EQUAL(-1, hw.read());
+
+  CHECK(hw.open(truncated, sizeof(truncated)));
+  LONGS_EQUAL(0x42, hw.read());
+  LONGS_EQUAL(-1, hw.read());
+  LONGS_EQUAL(0u, hw.time());
+  CHECK(hw.done());
+}
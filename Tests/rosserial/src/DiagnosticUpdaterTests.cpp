@@ -0,0 +1,327 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file DiagnosticUpdaterTests.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Tests of the diagnostic updater
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <CppUTest/TestHarness.h>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include "ros/node_handle.h"
+#include "francor/diagnostic_updater.h"
+#include "TestHardware.h"
+/* -------------------------------------------------------------------------------*/
+
+typedef ros::NodeHandle_<TestHardware, 5, 5, 256, 256> TestNodeHandle;
+typedef francor::DiagnosticUpdater<TestNodeHandle, 4, 4, 16> TestUpdater;
+
+// First publisher id follows the subscriber ids
+constexpr int DIAG_ID = 100 + 5;
+
+typedef diagnostic_msgs::DiagnosticStatus Status;
+
+TEST_GROUP(DiagnosticUpdater)
+{
+  void setup()
+  {
+    _updater.init(_nh);
+    _motor   = _updater.addStatus("motor");
+    _battery = _updater.addStatus("battery");
+    _current = _updater.addValue(_motor, "current");
+    _enabled = _updater.addValue(_motor, "enabled");
+    _voltage = _updater.addValue(_battery, "voltage");
+
+    _nh.initNode();
+    _nh.getHardware()->injectFrame(rosserial_msgs::TopicInfo::ID_PUBLISHER, nullptr, 0u);
+    _nh.spinOnce();
+    _nh.getHardware()->clearTx();
+    CHECK(_nh.connected());
+  }
+
+  /**
+   * @brief Parse the frames written to the test hardware, returns number of
+   *        diagnostic frames and the statuses of all of them
+   */
+  uint32_t parseFrames(uint32_t& statuses)
+  {
+    statuses = 0u;
+    const uint32_t count = _nh.getHardware()->forEachFrame(DIAG_ID, [&](uint8_t* payload, const uint32_t size) {
+      memcpy(_rx, payload, size);
+      CHECK(static_cast<int>(size) == _msg.deserialize(_rx, size));
+      statuses += _msg.status_length;
+    });
+    _nh.getHardware()->clearTx();
+
+    return count;
+  }
+
+  TestNodeHandle                  _nh;
+  TestUpdater                     _updater{"board"};
+  diagnostic_msgs::DiagnosticArray _msg;
+  unsigned char                   _rx[256];
+  int                             _motor;
+  int                             _battery;
+  int                             _current;
+  int                             _enabled;
+  int                             _voltage;
+};
+
+TEST(DiagnosticUpdater, FirstUpdatePublishesAll)
+{
+  uint32_t statuses = 0u;
+
+  LONGS_EQUAL(2, _updater.update());
+  LONGS_EQUAL(1u, parseFrames(statuses));
+  LONGS_EQUAL(2u, statuses);
+  STRCMP_EQUAL("motor", _msg.status[0].name);
+  STRCMP_EQUAL("board", _msg.status[0].hardware_id);
+  LONGS_EQUAL(Status::STALE, _msg.status[0].level);
+  LONGS_EQUAL(2u, _msg.status[0].values_length);
+  LONGS_EQUAL(1u, _msg.status[1].values_length);
+  STRCMP_EQUAL("voltage", _msg.status[1].values[0].key);
+
+  // nothing changed
+  _nh.getHardware()->_time += 500u;
+  LONGS_EQUAL(0, _updater.update());
+  LONGS_EQUAL(0u, parseFrames(statuses));
+}
+
+TEST(DiagnosticUpdater, ChangePublishesOnlyChangedStatus)
+{
+  uint32_t statuses = 0u;
+
+  _updater.update();
+  parseFrames(statuses);
+
+  _nh.getHardware()->_time += 200u;
+  _updater.setStatus(_battery, Status::WARN, "low");
+  LONGS_EQUAL(1, _updater.update());
+  LONGS_EQUAL(1u, parseFrames(statuses));
+  LONGS_EQUAL(1u, statuses);
+  STRCMP_EQUAL("battery", _msg.status[0].name);
+  STRCMP_EQUAL("low", _msg.status[0].message);
+  LONGS_EQUAL(Status::WARN, _msg.status[0].level);
+
+  // same level and message is no change
+  _nh.getHardware()->_time += 200u;
+  _updater.setStatus(_battery, Status::WARN, "low");
+  LONGS_EQUAL(0, _updater.update());
+
+  // value changes wait for the heartbeat
+  _updater.setValue(_battery, _voltage, 11.5f);
+  LONGS_EQUAL(0, _updater.update());
+  _nh.getHardware()->_time += 1000u;
+  LONGS_EQUAL(2, _updater.update());
+  parseFrames(statuses);
+  STRCMP_EQUAL("11.500", _msg.status[1].values[0].value);
+}
+
+TEST(DiagnosticUpdater, ChangesLimitedByMinPeriod)
+{
+  _updater.update();
+
+  _nh.getHardware()->_time += 50u;
+  _updater.setStatus(_motor, Status::ERROR, "stalled");
+  LONGS_EQUAL(0, _updater.update());
+  _nh.getHardware()->_time += 50u;
+  LONGS_EQUAL(1, _updater.update());
+}
+
+TEST(DiagnosticUpdater, ValuesFormattedWhenPublished)
+{
+  uint32_t statuses = 0u;
+
+  _updater.setValue(_motor, _current, static_cast<int32_t>(-42));
+  _updater.setValue(_motor, _enabled, true);
+  _updater.setValue(_battery, _voltage, "n/a");
+  _updater.update();
+  parseFrames(statuses);
+  STRCMP_EQUAL("n/a", _msg.status[1].values[0].value);
+
+  // statuses of a deserialized array share the values of the last one, so
+  // look at the motor alone
+  _nh.getHardware()->_time += 100u;
+  _updater.trigger(_motor);
+  LONGS_EQUAL(1, _updater.update());
+  parseFrames(statuses);
+  STRCMP_EQUAL("-42", _msg.status[0].values[0].value);
+  STRCMP_EQUAL("True", _msg.status[0].values[1].value);
+}
+
+TEST(DiagnosticUpdater, ReconnectPublishesAll)
+{
+  uint32_t statuses = 0u;
+
+  _updater.update();
+  parseFrames(statuses);
+
+  _nh.getHardware()->_time += 200u;
+  _nh.getHardware()->injectFrame(rosserial_msgs::TopicInfo::ID_PUBLISHER, nullptr, 0u);
+  _nh.spinOnce();
+  _nh.getHardware()->clearTx();
+  LONGS_EQUAL(2, _updater.update());
+}
+
+TEST(DiagnosticUpdater, SplitsLargeArrays)
+{
+  typedef ros::NodeHandle_<TestHardware, 5, 5, 256, 128> SmallNodeHandle;
+
+  SmallNodeHandle                                   nh;
+  francor::DiagnosticUpdater<SmallNodeHandle, 4, 1> updater("board");
+  diagnostic_msgs::DiagnosticArray                  msg;
+
+  updater.init(nh);
+  for(int idx = 0; idx < 4; idx++)
+  {
+    updater.addValue(updater.addStatus("some status"), "some key");
+  }
+  CHECK(-1 == updater.addStatus("one too many"));
+
+  nh.initNode();
+  nh.getHardware()->injectFrame(rosserial_msgs::TopicInfo::ID_PUBLISHER, nullptr, 0u);
+  nh.spinOnce();
+  nh.getHardware()->clearTx();
+
+  LONGS_EQUAL(4, updater.update());
+
+  uint32_t statuses = 0u;
+  const uint32_t frames = nh.getHardware()->forEachFrame(TEST_HW_ANY_TOPIC, [&](uint8_t* payload, const uint32_t size) {
+    CHECK((size + 8u) <= 128u);
+    memcpy(_rx, payload, size);
+    CHECK(static_cast<int>(size) == msg.deserialize(_rx, size));
+    statuses += msg.status_length;
+  });
+  CHECK(frames > 1u);
+  LONGS_EQUAL(4u, statuses);
+}
+
+TEST(DiagnosticUpdater, DropsStatusLargerThanBuffer)
+{
+  typedef ros::NodeHandle_<TestHardware, 5, 5, 256, 128> SmallNodeHandle;
+
+  static char                                       message[120];
+  SmallNodeHandle                                   nh;
+  francor::DiagnosticUpdater<SmallNodeHandle, 2, 1> updater("board");
+  diagnostic_msgs::DiagnosticArray                  msg;
+
+  memset(message, 'x', sizeof(message) - 1u);
+  updater.init(nh);
+  updater.setStatus(updater.addStatus("large"), diagnostic_msgs::DiagnosticStatus::WARN, message);
+  updater.addStatus("small");
+
+  nh.initNode();
+  nh.getHardware()->injectFrame(rosserial_msgs::TopicInfo::ID_PUBLISHER, nullptr, 0u);
+  nh.spinOnce();
+  nh.getHardware()->clearTx();
+
+  LONGS_EQUAL(1, updater.update());
+  LONGS_EQUAL(1u, updater.getDropped());
+
+  TestHardware*   hw    = nh.getHardware();
+  const uint32_t  size  = hw->_tx_buffer[2u] | (hw->_tx_buffer[3u] << 8u);
+  LONGS_EQUAL(size + 8u, hw->_tx_size);
+  memcpy(_rx, &hw->_tx_buffer[7u], size);
+  CHECK(static_cast<int>(size) == msg.deserialize(_rx, size));
+  LONGS_EQUAL(1u, msg.status_length);
+  STRCMP_EQUAL("small", msg.status[0].name);
+}
+
+TEST(DiagnosticUpdater, FailedPublishIsRepeated)
+{
+  uint32_t statuses = 0u;
+
+  _updater.update();
+  parseFrames(statuses);
+
+  // the hardware cannot take the frame, the transition must not get lost
+  _nh.getHardware()->_time += 200u;
+  _nh.getHardware()->_tx_limit = 0u;
+  _updater.setStatus(_motor, Status::ERROR, "stall");
+  LONGS_EQUAL(0, _updater.update());
+  LONGS_EQUAL(1u, _updater.getFailed());
+  LONGS_EQUAL(0u, parseFrames(statuses));
+
+  _nh.getHardware()->_time += 200u;
+  _nh.getHardware()->_tx_limit = TEST_HW_BUF_SIZE;
+  LONGS_EQUAL(1, _updater.update());
+  LONGS_EQUAL(1u, parseFrames(statuses));
+  STRCMP_EQUAL("motor", _msg.status[0].name);
+  LONGS_EQUAL(Status::ERROR, _msg.status[0].level);
+
+  // published once, nothing left
+  _nh.getHardware()->_time += 200u;
+  LONGS_EQUAL(0, _updater.update());
+  LONGS_EQUAL(1u, _updater.getFailed());
+}
+
+TEST_GROUP(DiagnosticFormat)
+{
+  std::string formatFloat(const float number, const int decimals = 3)
+  {
+    char buffer[24];
+    const int length = TestUpdater::formatFloat(buffer, number, decimals);
+    LONGS_EQUAL(strlen(buffer), length);
+    return std::string(buffer);
+  }
+};
+
+TEST(DiagnosticFormat, Float)
+{
+  STRCMP_EQUAL("0.000", formatFloat(0.0f).c_str());
+  STRCMP_EQUAL("-1.250", formatFloat(-1.25f).c_str());
+  STRCMP_EQUAL("1.000", formatFloat(0.9999f).c_str());
+  STRCMP_EQUAL("3", formatFloat(2.5f, 0).c_str());
+  STRCMP_EQUAL("nan", formatFloat(NAN).c_str());
+  STRCMP_EQUAL("-inf", formatFloat(-INFINITY).c_str());
+  STRCMP_EQUAL("1.000e10", formatFloat(1e10f).c_str());
+}
+
+TEST(DiagnosticFormat, Int)
+{
+  char buffer[16];
+
+  LONGS_EQUAL(1, TestUpdater::formatInt(buffer, 0));
+  STRCMP_EQUAL("0", buffer);
+  LONGS_EQUAL(11, TestUpdater::formatInt(buffer, INT32_MIN));
+  STRCMP_EQUAL("-2147483648", buffer);
+}
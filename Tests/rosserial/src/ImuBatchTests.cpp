@@ -0,0 +1,205 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file ImuBatchTests.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Tests of the IMU batcher
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <CppUTest/TestHarness.h>
+#include <cstring>
+#include "ros/node_handle.h"
+#include "francor/imu_batcher.h"
+#include "TestHardware.h"
+/* -------------------------------------------------------------------------------*/
+
+typedef ros::NodeHandle_<TestHardware, 5, 5, 256, 512> TestNodeHandle;
+typedef francor::ImuBatcher<TestNodeHandle, 4> TestBatcher;
+
+// First publisher id follows the subscriber ids
+constexpr int IMU_ID = 100 + 5;
+
+TEST_GROUP(ImuBatch)
+{
+  void setup()
+  {
+    _nh.initNode();
+    _batcher.init(_nh);
+    _nh.getHardware()->injectFrame(rosserial_msgs::TopicInfo::ID_PUBLISHER, nullptr, 0u);
+    _nh.spinOnce();
+    _nh.getHardware()->clearTx();
+    CHECK(_nh.connected());
+  }
+
+  int addSample(TestBatcher& batcher, const uint32_t sec, const uint32_t nsec, const float value)
+  {
+    const float gyro[3]  = {value, value + 1.0f, value + 2.0f};
+    const float accel[3] = {-value, -value - 1.0f, -value - 2.0f};
+    return batcher.addSample(ros::Time(sec, nsec), gyro, accel);
+  }
+
+  /**
+   * @brief Parse the frames written to the test hardware, returns number of
+   *        batches and deserializes the last one into msg
+   */
+  uint32_t parseFrames(francor_msgs::ImuBatch& msg)
+  {
+    return _nh.getHardware()->forEachFrame(IMU_ID, [&](uint8_t* payload, const uint32_t size) {
+      memcpy(_rx, payload, size);
+      CHECK(static_cast<int>(size) == msg.deserialize(_rx, size));
+    });
+  }
+
+  TestNodeHandle  _nh;
+  TestBatcher     _batcher{"imu/batch", "imu"};
+  unsigned char   _rx[512];
+};
+
+TEST(ImuBatch, PublishesWhenFull)
+{
+  francor_msgs::ImuBatch msg;
+
+  for(uint32_t idx = 0u; idx < 3u; idx++)
+  {
+    LONGS_EQUAL(0, addSample(_batcher, 10u, idx * 1000000u, static_cast<float>(idx)));
+  }
+  LONGS_EQUAL(0u, parseFrames(msg));
+  LONGS_EQUAL(3, _batcher.getLength());
+
+  CHECK(addSample(_batcher, 10u, 3000000u, 3.0f) > 0);
+  LONGS_EQUAL(0, _batcher.getLength());
+  LONGS_EQUAL(1u, parseFrames(msg));
+
+  LONGS_EQUAL(4u, msg.time_offset_length);
+  LONGS_EQUAL(0u, msg.orientation_length);
+  LONGS_EQUAL(12u, msg.angular_velocity_length);
+  LONGS_EQUAL(12u, msg.linear_acceleration_length);
+  LONGS_EQUAL(10u, msg.header.stamp.sec);
+  LONGS_EQUAL(0u, msg.header.stamp.nsec);
+  STRCMP_EQUAL("imu", msg.header.frame_id);
+  LONGS_EQUAL(3000000u, msg.time_offset[3]);
+  DOUBLES_EQUAL(5.0, msg.angular_velocity[11], 0.0);
+  DOUBLES_EQUAL(-5.0, msg.linear_acceleration[11], 0.0);
+}
+
+TEST(ImuBatch, FlushPublishesPartialBatch)
+{
+  francor_msgs::ImuBatch msg;
+
+  LONGS_EQUAL(0, _batcher.flush());
+  addSample(_batcher, 1u, 0u, 1.0f);
+  CHECK(_batcher.flush() > 0);
+  LONGS_EQUAL(1u, parseFrames(msg));
+  LONGS_EQUAL(1u, msg.time_offset_length);
+  LONGS_EQUAL(0, _batcher.flush());
+}
+
+TEST(ImuBatch, OffsetOverflowAndTimeJumpStartNewBatch)
+{
+  francor_msgs::ImuBatch msg;
+
+  addSample(_batcher, 1u, 0u, 1.0f);
+  // 5s do not fit into the 32 bit ns offset
+  CHECK(addSample(_batcher, 6u, 0u, 2.0f) > 0);
+  LONGS_EQUAL(1u, parseFrames(msg));
+  LONGS_EQUAL(1u, msg.time_offset_length);
+  LONGS_EQUAL(1, _batcher.getLength());
+
+  _nh.getHardware()->clearTx();
+  CHECK(addSample(_batcher, 5u, 999000000u, 3.0f) > 0);
+  LONGS_EQUAL(1u, parseFrames(msg));
+  LONGS_EQUAL(6u, msg.header.stamp.sec);
+  LONGS_EQUAL(1, _batcher.getLength());
+}
+
+TEST(ImuBatch, ExpandRestoresImu)
+{
+  francor_msgs::ImuBatch msg;
+  sensor_msgs::Imu       imu;
+  float                  cov[9] = {1.0f, 0.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 3.0f};
+
+  _batcher.setCovariances(cov, cov, cov);
+  addSample(_batcher, 7u, 999000000u, 1.0f);
+  addSample(_batcher, 8u, 1000000u, 4.0f);
+  _batcher.flush();
+  LONGS_EQUAL(1u, parseFrames(msg));
+  LONGS_EQUAL(2u, TestBatcher::size(msg));
+
+  CHECK(TestBatcher::expand(msg, 1u, imu));
+  LONGS_EQUAL(8u, imu.header.stamp.sec);
+  LONGS_EQUAL(1000000u, imu.header.stamp.nsec);
+  STRCMP_EQUAL("imu", imu.header.frame_id);
+  DOUBLES_EQUAL(4.0, imu.angular_velocity.x, 0.0);
+  DOUBLES_EQUAL(6.0, imu.angular_velocity.z, 0.0);
+  DOUBLES_EQUAL(-5.0, imu.linear_acceleration.y, 0.0);
+  DOUBLES_EQUAL(2.0, imu.angular_velocity_covariance[4], 0.0);
+  DOUBLES_EQUAL(-1.0, imu.orientation_covariance[0], 0.0);
+  DOUBLES_EQUAL(1.0, imu.orientation.w, 0.0);
+
+  CHECK_FALSE(TestBatcher::expand(msg, 2u, imu));
+}
+
+TEST(ImuBatch, ExpandWithOrientation)
+{
+  TestBatcher            batcher("imu/batch_q", "imu", true);
+  francor_msgs::ImuBatch msg;
+  sensor_msgs::Imu       imu;
+  const float            gyro[3]  = {0.0f, 0.0f, 0.0f};
+  const float            q[4]     = {0.0f, 0.0f, 0.6f, 0.8f};
+
+  batcher.init(_nh);
+  batcher.addSample(ros::Time(1u, 0u), gyro, gyro, q);
+  batcher.addSample(ros::Time(1u, 10u), gyro, gyro);
+  _nh.getHardware()->clearTx();
+  CHECK(batcher.flush() > 0);
+
+  TestHardware* hw = _nh.getHardware();
+  const uint32_t size = hw->_tx_buffer[2u] | (hw->_tx_buffer[3u] << 8u);
+  memcpy(_rx, &hw->_tx_buffer[7u], size);
+  CHECK(static_cast<int>(size) == msg.deserialize(_rx, size));
+  LONGS_EQUAL(8u, msg.orientation_length);
+
+  CHECK(TestBatcher::expand(msg, 0u, imu));
+  DOUBLES_EQUAL(0.6, imu.orientation.z, 1e-6);
+  DOUBLES_EQUAL(0.0, imu.orientation_covariance[0], 0.0);
+  CHECK(TestBatcher::expand(msg, 1u, imu));
+  DOUBLES_EQUAL(1.0, imu.orientation.w, 0.0);
+  LONGS_EQUAL(10u, imu.header.stamp.nsec);
+}
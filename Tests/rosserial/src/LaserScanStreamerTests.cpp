@@ -0,0 +1,308 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file LaserScanStreamerTests.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Tests of the streamed laser scan publisher
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <CppUTest/TestHarness.h>
+#include <cmath>
+#include <cstring>
+#include "ros/node_handle.h"
+#include "francor/laser_scan_streamer.h"
+#include "TestHardware.h"
+/* -------------------------------------------------------------------------------*/
+
+typedef ros::NodeHandle_<TestHardware, 5, 5, 256, 256> TestNodeHandle;
+typedef francor::LaserScanStreamer<TestNodeHandle, 4> TestStreamer;
+
+// First publisher id follows the subscriber ids
+constexpr int SCAN_ID = 100 + 5;
+constexpr uint32_t POINTS = 10u;
+
+TEST_GROUP(LaserScanStreamer)
+{
+  void setup()
+  {
+    _streamer.init(_nh);
+    _streamer.setGeometry(-1.0f, 0.25f, POINTS, 0.1f, 0.05f, 20.0f);
+    _nh.initNode();
+    _nh.getHardware()->injectFrame(rosserial_msgs::TopicInfo::ID_PUBLISHER, nullptr, 0u);
+    _nh.spinOnce();
+    _nh.getHardware()->clearTx();
+    CHECK(_nh.connected());
+
+    for(uint32_t idx = 0u; idx < POINTS; idx++)
+    {
+      _ranges[idx] = 1.0f + 0.5f * static_cast<float>(idx);
+    }
+  }
+
+  /**
+   * @brief Frame the regular publisher sends for the same scan
+   */
+  uint32_t referenceFrame(uint8_t* frame, const uint32_t seq, const float* ranges)
+  {
+    TestNodeHandle          nh;
+    sensor_msgs::LaserScan  scan;
+    ros::Publisher          pub("scan", &scan);
+
+    nh.advertise(pub);
+    nh.initNode();
+    nh.getHardware()->injectFrame(rosserial_msgs::TopicInfo::ID_PUBLISHER, nullptr, 0u);
+    nh.spinOnce();
+    nh.getHardware()->clearTx();
+
+    scan.header.seq       = seq;
+    scan.header.stamp     = ros::Time(3u, 500u);
+    scan.header.frame_id  = "laser";
+    scan.angle_min        = -1.0f;
+    scan.angle_max        = -1.0f + 0.25f * (POINTS - 1u);
+    scan.angle_increment  = 0.25f;
+    scan.time_increment   = 0.1f / POINTS;
+    scan.scan_time        = 0.1f;
+    scan.range_min        = 0.05f;
+    scan.range_max        = 20.0f;
+    scan.ranges_length    = POINTS;
+    scan.ranges           = const_cast<float*>(ranges);
+
+    CHECK(pub.publish(&scan) > 0);
+    memcpy(frame, nh.getHardware()->_tx_buffer, nh.getHardware()->_tx_size);
+    return nh.getHardware()->_tx_size;
+  }
+
+  /**
+   * @brief Whether the frame at buffer passes the checksum test of the host
+   */
+  bool checksumValid(const uint8_t* buffer)
+  {
+    const uint32_t size = buffer[2] | (buffer[3] << 8u);
+    uint32_t       sum  = 0u;
+
+    for(uint32_t idx = 5u; idx < (size + 8u); idx++)
+    {
+      sum += buffer[idx];
+    }
+    return (sum % 256u) == 255u;
+  }
+
+  TestNodeHandle  _nh;
+  TestStreamer    _streamer{"scan", "laser"};
+  float           _ranges[POINTS];
+  uint8_t         _reference[512];
+};
+
+TEST(LaserScanStreamer, StreamMatchesRegularPublish)
+{
+  TestHardware* hw = _nh.getHardware();
+
+  CHECK(_streamer.begin(ros::Time(3u, 500u)));
+  LONGS_EQUAL(7 + 16 + 5 + 32, hw->_tx_size);
+  LONGS_EQUAL(SCAN_ID, hw->_tx_buffer[5] | (hw->_tx_buffer[6] << 8));
+
+  LONGS_EQUAL(3u, _streamer.addSector(&_ranges[0], 3u));
+  LONGS_EQUAL(7 + 16 + 5 + 32 + 12, hw->_tx_size);
+  LONGS_EQUAL(3u, _streamer.addSector(&_ranges[3], 3u));
+  CHECK(_streamer.isOpen());
+
+  // last sector is cut at the end of the revolution
+  LONGS_EQUAL(4u, _streamer.addSector(&_ranges[6], 6u));
+  CHECK_FALSE(_streamer.isOpen());
+  LONGS_EQUAL(-1, _nh.getFrameRemaining());
+
+  const uint32_t size = referenceFrame(_reference, 0u, _ranges);
+  LONGS_EQUAL(size, hw->_tx_size);
+  LONGS_EQUAL(8 + _streamer.getLength(), hw->_tx_size);
+  MEMCMP_EQUAL(_reference, hw->_tx_buffer, size);
+  CHECK(checksumValid(hw->_tx_buffer));
+}
+
+TEST(LaserScanStreamer, OtherFrameHeldWhileOpen)
+{
+  TestHardware*   hw = _nh.getHardware();
+  std_msgs::Time  time;
+
+  CHECK(_streamer.begin(ros::Time(3u, 500u)));
+  const uint32_t size = hw->_tx_size;
+
+  // the first frame waits for the end of the scan, the second is dropped
+  LONGS_EQUAL(16, _nh.publishStatic(rosserial_msgs::TopicInfo::ID_TIME, time));
+  LONGS_EQUAL(-1, _nh.publishStatic(rosserial_msgs::TopicInfo::ID_TIME, time));
+  LONGS_EQUAL(size, hw->_tx_size);
+
+  _streamer.addSector(_ranges, POINTS);
+  const uint32_t scan_size = 8u + _streamer.getLength();
+  LONGS_EQUAL(scan_size + 16u, hw->_tx_size);
+  LONGS_EQUAL(rosserial_msgs::TopicInfo::ID_TIME, hw->_tx_buffer[scan_size + 5u]);
+
+  CHECK(_nh.publishStatic(rosserial_msgs::TopicInfo::ID_TIME, time) > 0);
+}
+
+TEST(LaserScanStreamer, SyncRequestWaitsForEndOfScan)
+{
+  TestHardware* hw = _nh.getHardware();
+
+  CHECK(_streamer.begin(ros::Time(3u, 500u)));
+  const uint32_t size = hw->_tx_size;
+
+  _nh.requestSyncTime();
+  LONGS_EQUAL(size, hw->_tx_size);
+
+  _streamer.addSector(_ranges, POINTS);
+  const uint32_t scan_size = 8u + _streamer.getLength();
+  LONGS_EQUAL(scan_size + 16u, hw->_tx_size);
+  LONGS_EQUAL(rosserial_msgs::TopicInfo::ID_TIME, hw->_tx_buffer[scan_size + 5u]);
+}
+
+TEST(LaserScanStreamer, NegotiationCompletesOpenScan)
+{
+  TestHardware* hw = _nh.getHardware();
+  const uint32_t negotiations = _nh.getNegotiationCount();
+
+  CHECK(_streamer.begin(ros::Time(3u, 500u)));
+  _streamer.addSector(_ranges, 3u);
+
+  hw->injectFrame(rosserial_msgs::TopicInfo::ID_PUBLISHER, nullptr, 0u);
+  _nh.spinOnce();
+
+  // scan is padded with zeros, then sync request and topic info follow
+  const uint32_t scan_size = 8u + _streamer.getLength();
+  CHECK_FALSE(_streamer.isOpen());
+  LONGS_EQUAL(0u, _streamer.getRemaining());
+  LONGS_EQUAL(0u, _streamer.addSector(_ranges, POINTS));
+  CHECK(hw->_tx_size > scan_size + 16u);
+  LONGS_EQUAL(0u, hw->_tx_buffer[scan_size - 2u]);
+  CHECK_FALSE(checksumValid(hw->_tx_buffer));
+  LONGS_EQUAL(rosserial_msgs::TopicInfo::ID_TIME, hw->_tx_buffer[scan_size + 5u]);
+  LONGS_EQUAL(rosserial_msgs::TopicInfo::ID_PUBLISHER, hw->_tx_buffer[scan_size + 16u + 5u]);
+
+  CHECK(_nh.connected());
+  LONGS_EQUAL(negotiations + 1u, _nh.getNegotiationCount());
+  CHECK(_streamer.begin(ros::Time(3u, 600u)));
+}
+
+TEST(LaserScanStreamer, FrameLengthIsLimited)
+{
+  _streamer.setGeometry(-1.0f, 0.001f, 8200u, 0.1f, 0.05f, 20.0f);
+  CHECK(_streamer.getLength() > 0x7fff);
+  CHECK_FALSE(_streamer.begin(ros::Time(3u, 500u)));
+  LONGS_EQUAL(-1, _nh.getFrameRemaining());
+}
+
+TEST(LaserScanStreamer, BeginCompletesOpenScanWithNan)
+{
+  TestHardware* hw = _nh.getHardware();
+  float         expected[POINTS];
+
+  for(uint32_t idx = 0u; idx < POINTS; idx++)
+  {
+    expected[idx] = (idx < 2u) ? _ranges[idx] : NAN;
+  }
+
+  CHECK(_streamer.begin(ros::Time(3u, 500u)));
+  _streamer.addSector(_ranges, 2u);
+  CHECK(_streamer.begin(ros::Time(3u, 600u)));
+  LONGS_EQUAL(POINTS, _streamer.getRemaining());
+
+  const uint32_t size = referenceFrame(_reference, 0u, expected);
+  MEMCMP_EQUAL(_reference, hw->_tx_buffer, size);
+
+  // second scan continues with the next sequence number
+  LONGS_EQUAL(1u, hw->_tx_buffer[size + 7u]);
+}
+
+TEST(LaserScanStreamer, NotSentWhileDisconnected)
+{
+  TestNodeHandle nh;
+  TestStreamer   streamer("scan", "laser");
+
+  streamer.init(nh);
+  nh.initNode();
+  CHECK_FALSE(streamer.begin(ros::Time(1u, 0u)));
+  LONGS_EQUAL(0u, streamer.addSector(_ranges, POINTS));
+  LONGS_EQUAL(0u, nh.getHardware()->_tx_size);
+}
+
+TEST(LaserScanStreamer, SectorAbortedWhenHardwareFull)
+{
+  TestHardware* hw = _nh.getHardware();
+
+  CHECK(_streamer.begin(ros::Time(3u, 500u)));
+  LONGS_EQUAL(3u, _streamer.addSector(_ranges, 3u));
+
+  // a chunk of 4 points does not fit, nothing of it is written
+  const uint32_t size = hw->_tx_size;
+  hw->_tx_limit = size + 6u;
+  LONGS_EQUAL(0u, _streamer.addSector(&_ranges[3], 4u));
+  CHECK_FALSE(_streamer.isOpen());
+  LONGS_EQUAL(0u, _streamer.addSector(&_ranges[7], 3u));
+
+  // padding has filled the space, the rest follows once the ring drained
+  LONGS_EQUAL(size + 6u, hw->_tx_size);
+  LONGS_EQUAL(-1, _nh.getFrameRemaining());
+  CHECK_FALSE(_streamer.begin(ros::Time(3u, 600u)));
+  hw->_tx_limit = TEST_HW_BUF_SIZE;
+  _nh.spinOnce();
+
+  // the host reads a complete frame and discards it
+  const uint32_t scan_size = 8u + _streamer.getLength();
+  LONGS_EQUAL(scan_size, hw->_tx_size);
+  LONGS_EQUAL(0u, hw->_tx_buffer[size]);
+  CHECK_FALSE(checksumValid(hw->_tx_buffer));
+
+  // aborted scan and the scan refused while it was padded
+  LONGS_EQUAL(2u, _nh.getCounters(SCAN_ID)->drops);
+
+  CHECK(_streamer.begin(ros::Time(3u, 700u)));
+  _streamer.addSector(_ranges, POINTS);
+  CHECK(checksumValid(&hw->_tx_buffer[scan_size]));
+}
+
+TEST(LaserScanStreamer, HeaderDoesNotFit)
+{
+  TestHardware* hw = _nh.getHardware();
+
+  hw->_tx_limit = 4u;
+  CHECK_FALSE(_streamer.begin(ros::Time(3u, 500u)));
+  CHECK_FALSE(_streamer.isOpen());
+  LONGS_EQUAL(-1, _nh.getFrameRemaining());
+  LONGS_EQUAL(0u, hw->_tx_size);
+}
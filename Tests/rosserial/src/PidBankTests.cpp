@@ -0,0 +1,344 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file PidBankTests.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Tests of the PID banks and their telemetry
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <CppUTest/TestHarness.h>
+#include <cstring>
+#include "ros/node_handle.h"
+#include "francor/pid_bank.h"
+#include "francor/pid_telemetry.h"
+#include "TestHardware.h"
+/* -------------------------------------------------------------------------------*/
+
+typedef ros::NodeHandle_<TestHardware, 5, 5, 256, 512> TestNodeHandle;
+typedef francor::PidBank<4> TestBank;
+typedef francor::PidBankQ15<4> TestBankQ15;
+typedef francor::PidTelemetry<TestNodeHandle, 4, 4> TestTelemetry;
+
+// First publisher id follows the subscriber ids
+constexpr int PID_STATE_ID = 100 + 5;
+
+constexpr float PID_DT = 0.01f;
+
+static const char* const PID_NAMES[4] = {"left", "right", "lift", "tilt"};
+
+TEST_GROUP(PidBank)
+{
+  void setup()
+  {
+    _nh.initNode();
+    _telemetry.init(_nh);
+    _nh.getHardware()->injectFrame(rosserial_msgs::TopicInfo::ID_PUBLISHER, nullptr, 0u);
+    _nh.spinOnce();
+    _nh.getHardware()->clearTx();
+    CHECK(_nh.connected());
+  }
+
+  /**
+   * @brief Parse the frames written to the test hardware, returns number of
+   *        states and deserializes the last one into msg
+   */
+  uint32_t parseFrames(control_msgs::PidState& msg)
+  {
+    const uint32_t count = _nh.getHardware()->forEachFrame(PID_STATE_ID, [&](uint8_t* payload, const uint32_t size) {
+      memcpy(_rx, payload, size);
+      CHECK(static_cast<int>(size) == msg.deserialize(_rx, size));
+    });
+
+    _nh.getHardware()->clearTx();
+    return count;
+  }
+
+  TestNodeHandle  _nh;
+  TestTelemetry   _telemetry{"pid_state", PID_NAMES, PID_DT, 2u, 0.05f, 3u};
+  TestBank        _bank;
+  unsigned char   _rx[512];
+};
+
+TEST(PidBank, FloatTermsAndLimits)
+{
+  const float setpoint[4] = {1.0f, 1.0f, 10.0f, 0.0f};
+  const float measured[4] = {0.5f, 0.5f, 0.0f, 0.0f};
+  float       output[4];
+
+  _bank.setGains(0, 2.0f, 0.0f, 0.0f, 0.0f, 100.0f);
+  _bank.setGains(1, 0.0f, 10.0f, 0.0f, 0.08f, 100.0f);
+  _bank.setGains(2, 1.0f, 0.0f, 0.0f, 0.0f, 3.0f);
+  _bank.setGains(3, 0.0f, 0.0f, 0.1f, 0.0f, 100.0f);
+
+  _bank.update(setpoint, measured, output, PID_DT);
+  DOUBLES_EQUAL(1.0, output[0], 1e-6);
+  DOUBLES_EQUAL(0.05, output[1], 1e-6);
+  DOUBLES_EQUAL(3.0, output[2], 1e-6);
+  DOUBLES_EQUAL(0.0, output[3], 1e-6);
+
+  // integral is limited, derivative acts on the error change
+  const float moved[4] = {0.5f, 0.5f, 0.0f, -0.1f};
+  _bank.update(setpoint, moved, output, PID_DT);
+  DOUBLES_EQUAL(0.08, output[1], 1e-6);
+  DOUBLES_EQUAL(1.0, output[3], 1e-5);
+
+  francor::PidSample sample;
+  _bank.getSample(3, sample, PID_DT);
+  DOUBLES_EQUAL(0.1, sample.error, 1e-6);
+  DOUBLES_EQUAL(0.1, sample.delta, 1e-6);
+  DOUBLES_EQUAL(1.0, sample.d_term, 1e-5);
+  DOUBLES_EQUAL(1.0, sample.output, 1e-5);
+
+  _bank.reset(1);
+  _bank.update(setpoint, moved, output, PID_DT);
+  DOUBLES_EQUAL(0.05, output[1], 1e-6);
+}
+
+TEST(PidBank, DualLaneHelpersSaturate)
+{
+  using namespace francor::dsp;
+
+  const uint32_t a = pack(30000, -30000);
+  const uint32_t b = pack(10000, 10000);
+
+  LONGS_EQUAL(32767, lo(qadd16(a, b)));
+  LONGS_EQUAL(-20000, hi(qadd16(a, b)));
+  LONGS_EQUAL(20000, lo(qsub16(a, b)));
+  LONGS_EQUAL(-32768, hi(qsub16(a, b)));
+  LONGS_EQUAL(30000 * 10000 - 30000 * 10000 + 5, smlad(a, b, 5));
+  LONGS_EQUAL(300000000, smulbb(a, b));
+  LONGS_EQUAL(-300000000, smultt(a, b));
+}
+
+TEST(PidBank, FixedPointFollowsFloat)
+{
+  TestBankQ15 bank_q15;
+  const float kp[4] = {0.5f, 1.5f, 2.0f, 0.25f};
+  const float ki[4] = {5.0f, 0.0f, 10.0f, 20.0f};
+  const float kd[4] = {0.0f, 0.002f, 0.001f, 0.0f};
+
+  for(int c = 0; c < 4; c++)
+  {
+    _bank.setGains(c, kp[c], ki[c], kd[c], 1.0f, 1.0f);
+    bank_q15.setGains(c, kp[c], ki[c], kd[c], PID_DT);
+  }
+
+  float             setpoint[4], measured[4], output[4];
+  alignas(4) int16_t setpoint_q15[4], measured_q15[4], output_q15[4];
+
+  for(int step = 0; step < 50; step++)
+  {
+    for(int c = 0; c < 4; c++)
+    {
+      setpoint[c]     = 0.3f - 0.1f * c;
+      measured[c]     = 0.2f * sinf(0.1f * step + c);
+      setpoint_q15[c] = TestBankQ15::toQ15(setpoint[c]);
+      measured_q15[c] = TestBankQ15::toQ15(measured[c]);
+    }
+
+    _bank.update(setpoint, measured, output, PID_DT);
+    bank_q15.update(setpoint_q15, measured_q15, output_q15);
+
+    for(int c = 0; c < 4; c++)
+    {
+      DOUBLES_EQUAL(output[c], output_q15[c] / 32768.0f, 0.01);
+    }
+  }
+
+  francor::PidSample sample;
+  francor::PidSample sample_q15;
+  _bank.getSample(2, sample, PID_DT);
+  bank_q15.getSample(2, sample_q15, PID_DT);
+  DOUBLES_EQUAL(sample.error, sample_q15.error, 1e-3);
+  DOUBLES_EQUAL(sample.i_term, sample_q15.i_term, 0.01);
+  DOUBLES_EQUAL(sample.output, sample_q15.output, 0.01);
+}
+
+TEST(PidBank, FixedPointSaturates)
+{
+  TestBankQ15 bank_q15;
+  alignas(4) int16_t setpoint[4] = {32767, -32768, 16384, 0};
+  alignas(4) int16_t measured[4] = {-32768, 32767, 0, 0};
+  alignas(4) int16_t output[4];
+
+  for(int c = 0; c < 4; c++)
+  {
+    bank_q15.setGains(c, 4.0f, 100.0f, 0.0f, PID_DT);
+  }
+
+  for(int step = 0; step < 10; step++)
+  {
+    bank_q15.update(setpoint, measured, output);
+  }
+  LONGS_EQUAL(32767, output[0]);
+  LONGS_EQUAL(-32768, output[1]);
+  LONGS_EQUAL(32767, output[2]);
+  LONGS_EQUAL(0, output[3]);
+
+  francor::PidSample sample;
+  bank_q15.getSample(0, sample, PID_DT);
+  DOUBLES_EQUAL(1.0, sample.error, 1e-4);
+  DOUBLES_EQUAL(1.0, sample.i_term, 1e-4);
+
+  bank_q15.reset(0);
+  bank_q15.getSample(0, sample, PID_DT);
+  DOUBLES_EQUAL(0.0, sample.i_term, 0.0);
+  bank_q15.getSample(1, sample, PID_DT);
+  DOUBLES_EQUAL(-1.0, sample.i_term, 1e-4);
+}
+
+TEST(PidBank, FixedPointIntegralIsSymmetric)
+{
+  TestBankQ15 bank_q15;
+
+  // arrays at an odd lane, not 4 byte aligned
+  alignas(4) int16_t buffer[3][5];
+  int16_t* setpoint = &buffer[0][1];
+  int16_t* measured = &buffer[1][1];
+  int16_t* output   = &buffer[2][1];
+
+  // ki * dt is one step of Q12, an error of 1000 adds less than half a bit
+  for(int c = 0; c < 4; c++)
+  {
+    bank_q15.setGains(c, 0.0f, 1.0f / (4096.0f * PID_DT), 0.0f, PID_DT);
+    setpoint[c] = 0;
+  }
+  measured[0] = -1000;
+  measured[1] = 1000;
+  measured[2] = -3000;
+  measured[3] = 3000;
+
+  for(int step = 0; step < 100; step++)
+  {
+    bank_q15.update(setpoint, measured, output);
+  }
+  LONGS_EQUAL(0, output[0]);
+  LONGS_EQUAL(0, output[1]);
+  LONGS_EQUAL(100, output[2]);
+  LONGS_EQUAL(-100, output[3]);
+}
+
+TEST(PidBank, TelemetryIsDecimatedRoundRobin)
+{
+  control_msgs::PidState msg;
+  const float setpoint[4] = {1.0f, 2.0f, 3.0f, 4.0f};
+  const float measured[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+  float       output[4];
+
+  for(int c = 0; c < 4; c++)
+  {
+    _bank.setGains(c, 1.0f, 0.0f, 0.0f, 0.0f, 10.0f);
+  }
+
+  for(uint32_t step = 0u; step < 8u; step++)
+  {
+    _bank.update(setpoint, measured, output, PID_DT);
+    _telemetry.sample(_bank, ros::Time(1u, step));
+  }
+
+  // every second cycle, channels in turn, all new
+  LONGS_EQUAL(2, _telemetry.update(2));
+  LONGS_EQUAL(2u, parseFrames(msg));
+  STRCMP_EQUAL("right", msg.header.frame_id);
+  LONGS_EQUAL(3u, msg.header.stamp.nsec);
+
+  LONGS_EQUAL(2, _telemetry.update());
+  LONGS_EQUAL(2u, parseFrames(msg));
+  STRCMP_EQUAL("tilt", msg.header.frame_id);
+  LONGS_EQUAL(7u, msg.header.stamp.nsec);
+  DOUBLES_EQUAL(4.0, msg.error, 1e-6);
+  DOUBLES_EQUAL(4.0, msg.p_term, 1e-6);
+  DOUBLES_EQUAL(4.0, msg.output, 1e-6);
+  DOUBLES_EQUAL(PID_DT, msg.timestep.toSec(), 1e-6);
+
+  LONGS_EQUAL(0, _telemetry.update());
+}
+
+TEST(PidBank, TelemetrySendsOnDelta)
+{
+  control_msgs::PidState msg;
+  float       setpoint[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+  const float measured[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+  float       output[4];
+
+  for(int c = 0; c < 4; c++)
+  {
+    _bank.setGains(c, 1.0f, 0.0f, 0.0f, 0.0f, 10.0f);
+  }
+
+  // first round is published, unchanged rounds are skipped until the keepalive
+  for(int round = 0; round < 5; round++)
+  {
+    for(int step = 0; step < 8; step++)
+    {
+      _bank.update(setpoint, measured, output, PID_DT);
+      _telemetry.sample(_bank, ros::Time(1u, 0u));
+    }
+    LONGS_EQUAL((round == 0 || round == 4) ? 4 : 0, _telemetry.update());
+  }
+  LONGS_EQUAL(8u, parseFrames(msg));
+
+  // a change beyond the deadband is published at once
+  setpoint[1] = 1.1f;
+  for(int step = 0; step < 8; step++)
+  {
+    _bank.update(setpoint, measured, output, PID_DT);
+    _telemetry.sample(_bank, ros::Time(1u, 0u));
+  }
+  LONGS_EQUAL(1, _telemetry.update());
+  LONGS_EQUAL(1u, parseFrames(msg));
+  STRCMP_EQUAL("right", msg.header.frame_id);
+  DOUBLES_EQUAL(1.1, msg.output, 1e-6);
+}
+
+TEST(PidBank, TelemetryDropsWhenFull)
+{
+  const float setpoint[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+  float       output[4];
+
+  for(int step = 0; step < 12; step++)
+  {
+    _bank.update(setpoint, setpoint, output, PID_DT);
+    _telemetry.sample(_bank, ros::Time(1u, 0u));
+  }
+
+  LONGS_EQUAL(2u, _telemetry.getDropped());
+  LONGS_EQUAL(4, _telemetry.update());
+}
@@ -0,0 +1,220 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file ProfilerTests.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Tests of the cycle profiling hooks of the node handle
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <CppUTest/TestHarness.h>
+#include <cstring>
+#include <type_traits>
+#include "ros/node_handle.h"
+#include "std_msgs/Int32.h"
+#include "francor/diagnostic_updater.h"
+#include "francor/profile_diagnostics.h"
+#include "STMHardware.h"
+#include "TestHardware.h"
+/* -------------------------------------------------------------------------------*/
+
+/* Cycle costs of the simulated hardware */
+constexpr uint32_t PROFILE_READ_CYCLES      = 10u;   //!< Per received byte
+constexpr uint32_t PROFILE_WRITE_CYCLES     = 4u;    //!< Per sent byte
+constexpr uint32_t PROFILE_CALLBACK_CYCLES  = 500u;  //!< Per callback
+
+/**
+ * @brief Test hardware which advances the simulated DWT cycle counter
+ */
+class ProfiledHardware : public TestHardware
+{
+  public:
+
+    int read()
+    {
+      DWT->CYCCNT += PROFILE_READ_CYCLES;
+      return TestHardware::read();
+    }
+
+    void write(uint8_t* data, int length)
+    {
+      DWT->CYCCNT += PROFILE_WRITE_CYCLES * length;
+      TestHardware::write(data, length);
+    }
+};
+
+typedef ros::CycleProfiler<ros::STMHardware, 4> TestProfiler;
+typedef ros::NodeHandle_<ProfiledHardware, 2, 2, 256, 256, TestProfiler> ProfiledNodeHandle;
+typedef ros::NodeHandle_<TestHardware, 2, 2, 256, 256> PlainNodeHandle;
+typedef francor::DiagnosticUpdater<ProfiledNodeHandle, 3, ros::PROFILE_STAGES, 16> TestUpdater;
+typedef francor::ProfileDiagnostics<TestUpdater, TestProfiler> TestDiagnostics;
+
+// Subscriber and publisher ids in order of registration
+constexpr int PROFILE_SUB_ID = 100;
+constexpr int PROFILE_PUB_ID = 100 + 2;
+
+static void int32Callback(const std_msgs::Int32&)
+{
+  DWT->CYCCNT += PROFILE_CALLBACK_CYCLES;
+}
+
+TEST_GROUP(Profiler)
+{
+  void setup()
+  {
+    DWT->CYCCNT = 0u;
+    _nh.initNode();
+    _nh.subscribe(_sub);
+    _nh.advertise(_pub);
+    _nh.getHardware()->injectFrame(rosserial_msgs::TopicInfo::ID_PUBLISHER, nullptr, 0u);
+    _nh.spinOnce();
+    _nh.getHardware()->clearTx();
+    _nh.getProfiler()->reset();
+  }
+
+  ProfiledNodeHandle                _nh;
+  std_msgs::Int32                   _msg;
+  ros::Subscriber<std_msgs::Int32>  _sub{"cmd", int32Callback};
+  ros::Publisher                    _pub{"state", &_msg};
+};
+
+TEST(Profiler, HistogramBinsAndPercentile)
+{
+  TestProfiler::Histogram h;
+  h.reset();
+
+  h.add(0u);
+  h.add(1u);
+  h.add(5u);
+  h.add(7u);
+  h.add(1000u);
+
+  LONGS_EQUAL(5u, h.count);
+  LONGS_EQUAL(1000u, h.max);
+  LONGS_EQUAL(202u, h.mean());
+  LONGS_EQUAL(2u, h.bins[0]);
+  LONGS_EQUAL(2u, h.bins[2]);
+  LONGS_EQUAL(1u, h.bins[9]);
+  LONGS_EQUAL(1u, h.percentile(40u));
+  LONGS_EQUAL(7u, h.percentile(80u));
+  LONGS_EQUAL(1000u, h.percentile(100u));
+
+  // everything above the last bin is counted there
+  h.add(0xffffffffu);
+  LONGS_EQUAL(1u, h.bins[19]);
+}
+
+TEST(Profiler, MeasuresPublish)
+{
+  _pub.publish(&_msg);
+
+  // Int32 frame: 12 bytes
+  const TestProfiler* p = _nh.getProfiler();
+  LONGS_EQUAL(1u, p->getStage(ros::PROFILE_SERIALIZE).count);
+  LONGS_EQUAL(1u, p->getStage(ros::PROFILE_CHECKSUM).count);
+  LONGS_EQUAL(0u, p->getStage(ros::PROFILE_CHECKSUM).max);
+  LONGS_EQUAL(12u * PROFILE_WRITE_CYCLES, p->getStage(ros::PROFILE_WRITE).max);
+  LONGS_EQUAL(12u * PROFILE_WRITE_CYCLES, p->getTopic(PROFILE_PUB_ID)->max);
+  LONGS_EQUAL(0u, p->getTopic(PROFILE_SUB_ID)->count);
+  CHECK(p->getTopic(100 + 4) == nullptr);
+}
+
+TEST(Profiler, MeasuresSpinStages)
+{
+  std_msgs::Int32 msg;
+  uint8_t         buffer[8];
+
+  _nh.getHardware()->injectFrame(PROFILE_SUB_ID, buffer, msg.serialize(buffer));
+  _nh.spinOnce();
+
+  // 12 bytes and the failing read at the end
+  const TestProfiler* p = _nh.getProfiler();
+  LONGS_EQUAL(1u, p->getStage(ros::PROFILE_SPIN).count);
+  LONGS_EQUAL(13u * PROFILE_READ_CYCLES + PROFILE_CALLBACK_CYCLES, p->getStage(ros::PROFILE_SPIN).max);
+  LONGS_EQUAL(13u * PROFILE_READ_CYCLES, p->getStage(ros::PROFILE_PARSE).max);
+  LONGS_EQUAL(PROFILE_CALLBACK_CYCLES, p->getStage(ros::PROFILE_DISPATCH).max);
+  LONGS_EQUAL(PROFILE_CALLBACK_CYCLES, p->getTopic(PROFILE_SUB_ID)->max);
+  STRCMP_EQUAL("dispatch", TestProfiler::getStageName(ros::PROFILE_DISPATCH));
+}
+
+TEST(Profiler, ReportsDiagnostics)
+{
+  ProfiledNodeHandle                nh;
+  TestUpdater                       updater{"board"};
+  TestDiagnostics                   diagnostics{updater, *nh.getProfiler()};
+  diagnostic_msgs::DiagnosticArray  msg;
+  unsigned char                     rx[256];
+
+  nh.initNode();
+  nh.advertise(_pub);
+  updater.init(nh);
+  CHECK(diagnostics.init());
+  CHECK(diagnostics.addTopic(PROFILE_PUB_ID, "state cycles"));
+  CHECK_FALSE(diagnostics.addTopic(PROFILE_SUB_ID, "cmd cycles"));
+  CHECK_FALSE(diagnostics.addTopic(100 + 4, "none"));
+
+  nh.getHardware()->injectFrame(rosserial_msgs::TopicInfo::ID_PUBLISHER, nullptr, 0u);
+  nh.spinOnce();
+  nh.getProfiler()->reset();
+  _pub.publish(&_msg);
+  nh.getHardware()->clearTx();
+
+  diagnostics.update();
+  LONGS_EQUAL(3, updater.update());
+
+  // statuses are split over frames, the topic is the last one
+  uint32_t size = 0u;
+  nh.getHardware()->forEachFrame(TEST_HW_ANY_TOPIC, [&](uint8_t* payload, const uint32_t frame_size) {
+    memcpy(rx, payload, frame_size);
+    size = frame_size;
+  });
+  CHECK(static_cast<int>(size) == msg.deserialize(rx, size));
+  const diagnostic_msgs::DiagnosticStatus& status = msg.status[msg.status_length - 1u];
+  STRCMP_EQUAL("state cycles", status.name);
+  LONGS_EQUAL(4u, status.values_length);
+  STRCMP_EQUAL("1", status.values[0].value);
+  STRCMP_EQUAL("48", status.values[3].value);
+}
+
+TEST(Profiler, NullProfilerHasNoState)
+{
+  CHECK(std::is_empty<ros::NullProfiler>::value);
+  PlainNodeHandle nh;
+  CHECK(nh.getProfiler() != nullptr);
+}
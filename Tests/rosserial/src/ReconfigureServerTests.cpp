@@ -0,0 +1,260 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file ReconfigureServerTests.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Tests of the dynamic_reconfigure server
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <CppUTest/TestHarness.h>
+#include <cstring>
+#include "ros/node_handle.h"
+#include "dynamic_reconfigure/server.h"
+#include "TestHardware.h"
+/* -------------------------------------------------------------------------------*/
+
+typedef ros::NodeHandle_<TestHardware, 5, 5, 256, 128> TestNodeHandle;
+typedef dynamic_reconfigure::Server<TestNodeHandle, 4> TestServer;
+
+/* Topic ids: service request 100, publishers from 105 */
+constexpr int REQUEST_ID      = 100;
+constexpr int RESPONSE_ID     = 105;
+constexpr int DESCRIPTION_ID  = 106;
+constexpr int UPDATE_ID       = 107;
+
+static uint32_t applied_level = 0u;
+static int      apply_calls   = 0;
+
+static void onApply(uint32_t level)
+{
+  applied_level = level;
+  apply_calls++;
+}
+
+TEST_GROUP(ReconfigureServer)
+{
+  void setup()
+  {
+    applied_level = 0u;
+    apply_calls   = 0;
+    _kp      = 1.0f;
+    _mode    = 2;
+    _enabled = false;
+
+    CHECK(_server.addDouble("kp", &_kp, 0.0f, 10.0f, "Proportional gain", 1u));
+    CHECK(_server.addInt("mode", &_mode, 0, 3, "Mode", 2u));
+    CHECK(_server.addBool("enabled", &_enabled, "", 4u));
+    _server.init(_nh);
+
+    _nh.initNode();
+    _nh.getHardware()->injectFrame(rosserial_msgs::TopicInfo::ID_PUBLISHER, nullptr, 0u);
+    _nh.spinOnce();
+    _nh.getHardware()->clearTx();
+    CHECK(_nh.connected());
+  }
+
+  /**
+   * @brief Find the last frame with topic id, returns its payload size or -1
+   */
+  int findFrame(const int topic)
+  {
+    int found = -1;
+
+    // the checksum covers the topic id in front of the payload
+    _nh.getHardware()->forEachFrame(TEST_HW_ANY_TOPIC, [&](uint8_t* payload, const uint32_t size) {
+      uint32_t checksum = 0u;
+      for(const uint8_t* data = payload - 2; data < payload + size; data++)
+      {
+        checksum += *data;
+      }
+      LONGS_EQUAL(255u - (checksum % 256u), payload[size]);
+    });
+
+    _nh.getHardware()->forEachFrame(topic, [&](uint8_t* payload, const uint32_t size) {
+      memcpy(_rx, payload, size);
+      found = static_cast<int>(size);
+    });
+
+    return found;
+  }
+
+  void request(const float kp, const int32_t mode)
+  {
+    dynamic_reconfigure::ReconfigureRequest req;
+    dynamic_reconfigure::DoubleParameter    doubles[2];
+    dynamic_reconfigure::IntParameter       ints[1];
+    uint8_t                                 buffer[256];
+
+    doubles[0].name   = "unknown";
+    doubles[0].value  = 5.0f;
+    doubles[1].name   = "kp";
+    doubles[1].value  = kp;
+    ints[0].name      = "mode";
+    ints[0].value     = mode;
+
+    req.config.doubles_length = 2u;
+    req.config.doubles        = doubles;
+    req.config.ints_length    = 1u;
+    req.config.ints           = ints;
+
+    const int size = req.serialize(buffer);
+
+    _nh.getHardware()->injectFrame(REQUEST_ID, buffer, static_cast<uint16_t>(size));
+    _nh.spinOnce();
+  }
+
+  TestNodeHandle  _nh;
+  TestServer      _server{"controller", &onApply};
+  float           _kp;
+  int32_t         _mode;
+  bool            _enabled;
+  uint8_t         _rx[2048];
+};
+
+TEST(ReconfigureServer, DescriptionAfterNegotiation)
+{
+  dynamic_reconfigure::ConfigDescription description;
+  dynamic_reconfigure::Config            config;
+
+  CHECK(_server.update());
+  // larger than the output buffer of the node handle, so it was streamed
+  const int size = findFrame(DESCRIPTION_ID);
+  CHECK(size > 128);
+  LONGS_EQUAL(size, description.deserialize(_rx, size));
+
+  LONGS_EQUAL(1u, description.groups_length);
+  STRCMP_EQUAL("Default", description.groups[0].name);
+  LONGS_EQUAL(3u, description.groups[0].parameters_length);
+  STRCMP_EQUAL("kp", description.groups[0].parameters[0].name);
+  STRCMP_EQUAL("double", description.groups[0].parameters[0].type);
+  STRCMP_EQUAL("Proportional gain", description.groups[0].parameters[0].description);
+  STRCMP_EQUAL("int", description.groups[0].parameters[1].type);
+  LONGS_EQUAL(4u, description.groups[0].parameters[2].level);
+  DOUBLES_EQUAL(10.0, description.max.doubles[0].value, 0.0);
+  LONGS_EQUAL(3, description.max.ints[0].value);
+  DOUBLES_EQUAL(1.0, description.dflt.doubles[0].value, 0.0);
+
+  const int update = findFrame(UPDATE_ID);
+  CHECK(update > 0);
+  LONGS_EQUAL(update, config.deserialize(_rx, update));
+  LONGS_EQUAL(2, config.ints[0].value);
+
+  _nh.getHardware()->clearTx();
+  CHECK_FALSE(_server.update());
+  LONGS_EQUAL(0u, _nh.getHardware()->_tx_size);
+}
+
+TEST(ReconfigureServer, RequestAppliedBetweenCycles)
+{
+  dynamic_reconfigure::Config config;
+
+  _server.update();
+  _nh.getHardware()->clearTx();
+
+  request(2.5f, 7);
+  const int size = findFrame(RESPONSE_ID);
+  CHECK(size > 0);
+  LONGS_EQUAL(size, config.deserialize(_rx, size));
+  DOUBLES_EQUAL(2.5, config.doubles[0].value, 0.0);
+  // clamped to the limit
+  LONGS_EQUAL(3, config.ints[0].value);
+
+  // nothing changes before apply()
+  DOUBLES_EQUAL(1.0, _kp, 0.0);
+  LONGS_EQUAL(2, _mode);
+
+  CHECK(_server.apply());
+  DOUBLES_EQUAL(2.5, _kp, 0.0);
+  LONGS_EQUAL(3, _mode);
+  CHECK_FALSE(_enabled);
+  LONGS_EQUAL(1, apply_calls);
+  LONGS_EQUAL(1u | 2u, applied_level);
+  CHECK_FALSE(_server.apply());
+
+  _nh.getHardware()->clearTx();
+  CHECK(_server.update());
+  CHECK(findFrame(UPDATE_ID) > 0);
+  CHECK_FALSE(_server.update());
+}
+
+TEST(ReconfigureServer, UnchangedRequestNotPublished)
+{
+  _server.update();
+
+  request(1.0f, 2);
+  CHECK(_server.apply());
+  LONGS_EQUAL(1, apply_calls);
+  LONGS_EQUAL(0u, applied_level);
+
+  _nh.getHardware()->clearTx();
+  CHECK_FALSE(_server.update());
+  LONGS_EQUAL(-1, findFrame(UPDATE_ID));
+}
+
+TEST(ReconfigureServer, LaterRequestKeepsEarlierValues)
+{
+  dynamic_reconfigure::Config            config;
+  dynamic_reconfigure::ReconfigureRequest req;
+  dynamic_reconfigure::BoolParameter      bools[1];
+  uint8_t                                 buffer[64];
+
+  request(4.0f, 1);
+  bools[0].name     = "enabled";
+  bools[0].value    = true;
+  req.config.bools_length = 1u;
+  req.config.bools  = bools;
+  const int length  = req.serialize(buffer);
+  _nh.getHardware()->injectFrame(REQUEST_ID, buffer, static_cast<uint16_t>(length));
+  _nh.spinOnce();
+
+  _server.apply();
+  DOUBLES_EQUAL(4.0, _kp, 0.0);
+  LONGS_EQUAL(1, _mode);
+  CHECK(_enabled);
+}
+
+TEST(ReconfigureServer, TableFull)
+{
+  float extra = 0.0f;
+
+  CHECK(_server.addDouble("ki", &extra, 0.0f, 1.0f));
+  CHECK_FALSE(_server.addDouble("kd", &extra, 0.0f, 1.0f));
+  LONGS_EQUAL(4, _server.getLength());
+}
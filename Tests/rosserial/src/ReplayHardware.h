@@ -0,0 +1,360 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file ReplayHardware.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Host hardware which replays a serial capture
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef ROS_REPLAY_HARDWARE_H_
+#define ROS_REPLAY_HARDWARE_H_
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "CaptureHardware.h"
+/* -------------------------------------------------------------------------------*/
+
+/**
+ * @brief Capture sink which writes to a file on the host
+ */
+class CaptureFile
+{
+  public:
+
+    CaptureFile(void) :
+    _file(nullptr)
+    {
+
+    }
+
+    ~CaptureFile(void)
+    {
+      close();
+    }
+
+    bool open(const char* path)
+    {
+      close();
+      _file = fopen(path, "wb");
+      return _file != nullptr;
+    }
+
+    void close()
+    {
+      if(_file)
+      {
+        fclose(_file);
+        _file = nullptr;
+      }
+    }
+
+    void capture(const uint8_t* data, const uint32_t size)
+    {
+      if(_file)
+      {
+        fwrite(data, 1u, size, _file);
+      }
+    }
+
+  private:
+
+    FILE*   _file;  //!< Capture file, nullptr if closed
+};
+
+/**
+ * @brief Hardware for NodeHandle_ which replays a capture of CaptureHardware
+ *
+ * Reads, times and writes are replayed with separate cursors, so every
+ * read() and time() returns the recorded value in recorded order even if the
+ * node handle interleaves the calls differently. write() is compared against
+ * the recorded writes. Files are mapped into memory, so large captures are
+ * replayed without copying.
+ */
+class ReplayHardware
+{
+  public:
+
+    ReplayHardware(void) :
+    _data(nullptr),
+    _size(0u),
+    _mapped(false),
+    _read_pos(0u),
+    _time_pos(0u),
+    _write_pos(0u),
+    _time(0u),
+    _reads(0u),
+    _writes(0u),
+    _write_mismatches(0u),
+    _write_extra(0u)
+    {
+
+    }
+
+    ~ReplayHardware(void)
+    {
+      close();
+    }
+
+    /**
+     * @brief Map a capture file into memory
+     * 
+     * @return true if the file is a capture
+     */
+    bool open(const char* path)
+    {
+      close();
+
+      const int fd = ::open(path, O_RDONLY);
+      if(fd < 0)
+      {
+        return false;
+      }
+
+      struct stat st;
+      void* data = MAP_FAILED;
+      if((fstat(fd, &st) == 0) && (st.st_size > 0))
+      {
+        data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+      }
+      ::close(fd);
+
+      if(data == MAP_FAILED)
+      {
+        return false;
+      }
+
+      madvise(data, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+      _mapped = true;
+      return attach(static_cast<const uint8_t*>(data), static_cast<uint32_t>(st.st_size));
+    }
+
+    /**
+     * @brief Replay a capture from memory, data must outlive the replay
+     * 
+     * @return true if data is a capture
+     */
+    bool open(const uint8_t* data, const uint32_t size)
+    {
+      close();
+      return attach(data, size);
+    }
+
+    void close()
+    {
+      if(_mapped)
+      {
+        munmap(const_cast<uint8_t*>(_data), _size);
+      }
+      _data   = nullptr;
+      _size   = 0u;
+      _mapped = false;
+      rewind();
+    }
+
+    /**
+     * @brief Restart the replay from the beginning of the capture
+     */
+    void rewind()
+    {
+      _read_pos         = sizeof(ros::CAPTURE_MAGIC);
+      _time_pos         = sizeof(ros::CAPTURE_MAGIC);
+      _write_pos        = sizeof(ros::CAPTURE_MAGIC);
+      _time             = 0u;
+      _reads            = 0u;
+      _writes           = 0u;
+      _write_mismatches = 0u;
+      _write_extra      = 0u;
+    }
+
+    void init()
+    {
+
+    }
+
+    int read()
+    {
+      if(!seek(_read_pos, ros::CAPTURE_READ, ros::CAPTURE_EMPTY))
+      {
+        return -1;
+      }
+
+      _reads++;
+      if(_data[_read_pos] == ros::CAPTURE_EMPTY)
+      {
+        _read_pos += 1u;
+        return -1;
+      }
+
+      const int data = _data[_read_pos + 1u];
+      _read_pos += 2u;
+      return data;
+    }
+
+    void write(uint8_t* data, int length)
+    {
+      if(!seek(_write_pos, ros::CAPTURE_WRITE, ros::CAPTURE_WRITE))
+      {
+        _write_extra++;
+        return;
+      }
+
+      const uint32_t size = recordSize(_write_pos) - 3u;
+      if((size != static_cast<uint32_t>(length)) || memcmp(&_data[_write_pos + 3u], data, size))
+      {
+        _write_mismatches++;
+      }
+      _writes++;
+      _write_pos += size + 3u;
+    }
+
+    /**
+     * @brief Recorded time, the last one stays after the end of the capture
+     */
+    unsigned long time()
+    {
+      if(seek(_time_pos, ros::CAPTURE_TIME, ros::CAPTURE_TIME))
+      {
+        const uint8_t* value = &_data[_time_pos + 1u];
+        _time = static_cast<uint32_t>(value[0]) | (static_cast<uint32_t>(value[1]) << 8u) |
+                (static_cast<uint32_t>(value[2]) << 16u) | (static_cast<uint32_t>(value[3]) << 24u);
+        _time_pos += 5u;
+      }
+      return _time;
+    }
+
+    /**
+     * @brief All recorded reads have been replayed
+     */
+    bool done()
+    {
+      return !seek(_read_pos, ros::CAPTURE_READ, ros::CAPTURE_EMPTY);
+    }
+
+    uint32_t getSize() const              { return _size; }
+    uint32_t getReads() const             { return _reads; }
+    uint32_t getWrites() const            { return _writes; }
+    uint32_t getWriteMismatches() const   { return _write_mismatches; }
+    uint32_t getWriteExtra() const        { return _write_extra; }
+
+  private:
+
+    bool attach(const uint8_t* data, const uint32_t size)
+    {
+      _data = data;
+      _size = size;
+
+      if((size < sizeof(ros::CAPTURE_MAGIC)) || memcmp(data, ros::CAPTURE_MAGIC, sizeof(ros::CAPTURE_MAGIC)))
+      {
+        close();
+        return false;
+      }
+
+      rewind();
+      return true;
+    }
+
+    /**
+     * @brief Size of the record at pos, 0 if it is truncated or unknown
+     */
+    uint32_t recordSize(const uint32_t pos) const
+    {
+      uint32_t size = 0u;
+      switch(_data[pos])
+      {
+        case ros::CAPTURE_EMPTY: size = 1u; break;
+        case ros::CAPTURE_READ:  size = 2u; break;
+        case ros::CAPTURE_TIME:  size = 5u; break;
+        case ros::CAPTURE_WRITE:
+          if((pos + 3u) <= _size)
+          {
+            size = 3u + (static_cast<uint32_t>(_data[pos + 1u]) | (static_cast<uint32_t>(_data[pos + 2u]) << 8u));
+          }
+          break;
+        default: break;
+      }
+      return ((pos + size) <= _size) ? size : 0u;
+    }
+
+    /**
+     * @brief Advance pos to the next record of type a or b
+     * 
+     * @return false if there is none
+     */
+    bool seek(uint32_t& pos, const uint8_t a, const uint8_t b) const
+    {
+      while(pos < _size)
+      {
+        const uint32_t size = recordSize(pos);
+        if(size == 0u)
+        {
+          pos = _size;
+          return false;
+        }
+        if((_data[pos] == a) || (_data[pos] == b))
+        {
+          return true;
+        }
+        pos += size;
+      }
+      return false;
+    }
+
+    const uint8_t*  _data;              //!< Capture
+    uint32_t        _size;              //!< Size of capture
+    bool            _mapped;            //!< Capture is a mapped file
+
+    uint32_t        _read_pos;          //!< Position of next read record
+    uint32_t        _time_pos;          //!< Position of next time record
+    uint32_t        _write_pos;         //!< Position of next write record
+    uint32_t        _time;              //!< Last replayed time
+
+    uint32_t        _reads;             //!< Replayed read records
+    uint32_t        _writes;            //!< Compared write records
+    uint32_t        _write_mismatches;  //!< Writes which differ from the capture
+    uint32_t        _write_extra;       //!< Writes after the last recorded one
+};
+
+#endif /* ROS_REPLAY_HARDWARE_H_ */
@@ -0,0 +1,275 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file STMDmaCopyTests.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Tests of the DMA2 memory to memory copy service
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <CppUTest/TestHarness.h>
+#include <cstring>
+#include "STMDmaCopy.h"
+#include "sim_clock.h"
+#include "sim_dma.h"
+#include "sim_nvic.h"
+/* -------------------------------------------------------------------------------*/
+
+constexpr uint32_t DMA_COPY_TEST_SIZE = 70000u;
+
+// DMA buffers need static storage, see sim_dma.h
+static ros::STMDmaCopy  dma_copy(DMA2_Stream0, 256u);
+static uint8_t          src_data[DMA_COPY_TEST_SIZE] __attribute__((aligned(4)));
+static uint8_t          dst_data[DMA_COPY_TEST_SIZE] __attribute__((aligned(4)));
+static int              done_order[ros::STM_DMA_COPY_QUEUE + 1u];
+static uint32_t         done_count;
+
+extern "C"
+{
+  void DMA2_Stream0_IRQHandler(void)
+  {
+    dma_copy.irq();
+  }
+}
+
+static void copyDone(void* arg)
+{
+  done_order[done_count++ % (ros::STM_DMA_COPY_QUEUE + 1u)] = static_cast<int>(reinterpret_cast<intptr_t>(arg));
+}
+
+TEST_GROUP(STMDmaCopy)
+{
+  void setup()
+  {
+    memset(DMA2, 0, sizeof(SIM_DMA[1]));
+    SIM_ClockReset();
+    SIM_NvicReset();
+    SIM_DmaReset();
+
+    for(uint32_t idx = 0u; idx < DMA_COPY_TEST_SIZE; idx++)
+    {
+      src_data[idx] = static_cast<uint8_t>(idx * 13u + (idx >> 8u));
+    }
+    memset(dst_data, 0, sizeof(dst_data));
+    memset(done_order, 0, sizeof(done_order));
+    done_count = 0u;
+
+    dma_copy = ros::STMDmaCopy(DMA2_Stream0, 256u);
+    dma_copy.init();
+    NVIC_EnableIRQ(DMA2_Stream0_IRQn);
+  }
+
+  void teardown()
+  {
+    NVIC_DisableIRQ(DMA2_Stream0_IRQn);
+    SIM_NvicReset();
+    SIM_DmaReset();
+    memset(DMA2, 0, sizeof(SIM_DMA[1]));
+  }
+};
+
+TEST(STMDmaCopy, InitConfiguresMemoryToMemory)
+{
+  CHECK_EQUAL(DMA_SxCR_DIR_1, DMA2_Stream0->CR & DMA_SxCR_DIR);
+  CHECK(0u != (DMA2_Stream0->CR & DMA_SxCR_PINC));
+  CHECK(0u != (DMA2_Stream0->CR & DMA_SxCR_MINC));
+  CHECK(0u != (DMA2_Stream0->FCR & DMA_SxFCR_DMDIS));
+}
+
+TEST(STMDmaCopy, SmallCopyUsesCpu)
+{
+  CHECK_FALSE(dma_copy.copy(dst_data, src_data, 255u, copyDone, reinterpret_cast<void*>(7)));
+
+  CHECK_EQUAL(1u, done_count);
+  CHECK_EQUAL(7, done_order[0]);
+  MEMCMP_EQUAL(src_data, dst_data, 255u);
+  CHECK_EQUAL(1u, dma_copy.getCpuCopies());
+  CHECK_EQUAL(0u, DMA2_Stream0->CR & DMA_SxCR_EN);
+}
+
+TEST(STMDmaCopy, LargeCopyCompletesInInterrupt)
+{
+  CHECK_TRUE(dma_copy.copy(dst_data, src_data, 1024u, copyDone, reinterpret_cast<void*>(1)));
+  CHECK_TRUE(dma_copy.busy());
+  CHECK_EQUAL(256u, DMA2_Stream0->NDTR);
+
+  // 256 words take 1024 cycles
+  SIM_ClockAdvance(1000u);
+  CHECK_EQUAL(0u, done_count);
+
+  SIM_ClockAdvance(100u);
+  CHECK_EQUAL(1u, done_count);
+  CHECK_FALSE(dma_copy.busy());
+  MEMCMP_EQUAL(src_data, dst_data, 1024u);
+  CHECK_EQUAL(0u, dst_data[1024]);
+  CHECK_EQUAL(1u, dma_copy.getDmaCopies());
+}
+
+TEST(STMDmaCopy, UnalignedCopyMovesBytes)
+{
+  CHECK_TRUE(dma_copy.copy(&dst_data[1], src_data, 300u, copyDone, nullptr));
+  CHECK_EQUAL(300u, DMA2_Stream0->NDTR);
+  CHECK_EQUAL(0u, DMA2_Stream0->CR & DMA_SxCR_MSIZE);
+
+  SIM_ClockAdvance(1200u);
+
+  CHECK_EQUAL(1u, done_count);
+  MEMCMP_EQUAL(src_data, &dst_data[1], 300u);
+  CHECK_EQUAL(0u, dst_data[0]);
+  CHECK_EQUAL(0u, dst_data[301]);
+}
+
+TEST(STMDmaCopy, AlignedCopyMovesTailSeparately)
+{
+  CHECK_TRUE(dma_copy.copy(dst_data, src_data, 1027u, copyDone, nullptr));
+  CHECK_EQUAL(256u, DMA2_Stream0->NDTR);
+
+  SIM_ClockAdvance(1024u + 3u * 4u + 10u);
+
+  CHECK_EQUAL(1u, done_count);
+  MEMCMP_EQUAL(src_data, dst_data, 1027u);
+  CHECK_EQUAL(0u, dst_data[1027]);
+}
+
+TEST(STMDmaCopy, CopyLargerThanStreamRunsInParts)
+{
+  CHECK_TRUE(dma_copy.copy(&dst_data[1], &src_data[1], DMA_COPY_TEST_SIZE - 1u, copyDone, nullptr));
+  CHECK_EQUAL(ros::STM_DMA_COPY_MAX_ITEMS, DMA2_Stream0->NDTR);
+
+  SIM_ClockAdvance(4u * DMA_COPY_TEST_SIZE + 10u);
+
+  CHECK_EQUAL(1u, done_count);
+  MEMCMP_EQUAL(&src_data[1], &dst_data[1], DMA_COPY_TEST_SIZE - 1u);
+}
+
+TEST(STMDmaCopy, QueueRunsInOrderAndFallsBackWhenFull)
+{
+  for(uint32_t idx = 0u; idx < ros::STM_DMA_COPY_QUEUE; idx++)
+  {
+    CHECK_TRUE(dma_copy.copy(&dst_data[idx * 512u], &src_data[idx * 512u], 512u, copyDone,
+                             reinterpret_cast<void*>(static_cast<intptr_t>(idx + 1u))));
+  }
+
+  // The queue is full, the CPU copies at once
+  const uint32_t last = ros::STM_DMA_COPY_QUEUE * 512u;
+  CHECK_FALSE(dma_copy.copy(&dst_data[last], &src_data[last], 512u, copyDone, reinterpret_cast<void*>(100)));
+  CHECK_EQUAL(1u, done_count);
+  CHECK_EQUAL(100, done_order[0]);
+
+  SIM_ClockAdvance(ros::STM_DMA_COPY_QUEUE * 512u + 100u);
+
+  CHECK_EQUAL(ros::STM_DMA_COPY_QUEUE + 1u, done_count);
+  for(uint32_t idx = 0u; idx < ros::STM_DMA_COPY_QUEUE; idx++)
+  {
+    CHECK_EQUAL(static_cast<int>(idx + 1u), done_order[idx + 1u]);
+  }
+  MEMCMP_EQUAL(src_data, dst_data, 512u * (ros::STM_DMA_COPY_QUEUE + 1u));
+}
+
+TEST(STMDmaCopy, FifoErrorKeepsStreamRunning)
+{
+  CHECK_TRUE(dma_copy.copy(dst_data, src_data, 1024u, copyDone, nullptr));
+
+  // HAL_DMA_IRQHandler reports FE, the stream and the HAL state stay busy
+  dma_copy._hdma.ErrorCode = HAL_DMA_ERROR_FE;
+  ros::STMDmaCopy::transferError(&dma_copy._hdma);
+  CHECK_EQUAL(0u, done_count);
+  CHECK_TRUE(dma_copy.busy());
+
+  SIM_ClockAdvance(1100u);
+
+  CHECK_EQUAL(1u, done_count);
+  CHECK_FALSE(dma_copy.busy());
+  CHECK_EQUAL(0u, dma_copy.getErrors());
+  MEMCMP_EQUAL(src_data, dst_data, 1024u);
+}
+
+TEST(STMDmaCopy, TransferErrorFinishesOnCpu)
+{
+  CHECK_TRUE(dma_copy.copy(dst_data, src_data, 1024u, copyDone, reinterpret_cast<void*>(1)));
+  CHECK_TRUE(dma_copy.copy(&dst_data[1024], &src_data[1024], 1024u, copyDone, reinterpret_cast<void*>(2)));
+
+  // HAL_DMA_IRQHandler stops the stream on TE before the callback
+  __HAL_DMA_DISABLE(&dma_copy._hdma);
+  dma_copy._hdma.State      = HAL_DMA_STATE_READY;
+  dma_copy._hdma.Lock       = HAL_UNLOCKED;
+  dma_copy._hdma.ErrorCode  = HAL_DMA_ERROR_TE;
+  ros::STMDmaCopy::transferError(&dma_copy._hdma);
+
+  CHECK_EQUAL(1u, done_count);
+  CHECK_EQUAL(1, done_order[0]);
+  CHECK_EQUAL(1u, dma_copy.getErrors());
+  CHECK(0u != (DMA2_Stream0->CR & DMA_SxCR_EN));
+
+  SIM_ClockAdvance(1100u);
+
+  CHECK_EQUAL(2u, done_count);
+  CHECK_EQUAL(2, done_order[1]);
+  CHECK_FALSE(dma_copy.busy());
+  MEMCMP_EQUAL(src_data, dst_data, 2048u);
+
+  // the first copy only counts as error
+  CHECK_EQUAL(1u, dma_copy.getDmaCopies());
+  CHECK_EQUAL(1u, dma_copy.getErrors());
+}
+
+TEST(STMDmaCopy, StartFailureFinishesOnCpu)
+{
+  dma_copy._hdma.State = HAL_DMA_STATE_BUSY;
+
+  CHECK_TRUE(dma_copy.copy(dst_data, src_data, 1024u, copyDone, reinterpret_cast<void*>(3)));
+
+  CHECK_EQUAL(1u, done_count);
+  CHECK_EQUAL(3, done_order[0]);
+  CHECK_FALSE(dma_copy.busy());
+  CHECK_EQUAL(1u, dma_copy.getErrors());
+  CHECK_EQUAL(0u, dma_copy.getDmaCopies());
+  MEMCMP_EQUAL(src_data, dst_data, 1024u);
+  dma_copy._hdma.State = HAL_DMA_STATE_READY;
+}
+
+TEST(STMDmaCopy, NoStreamUsesCpu)
+{
+  ros::STMDmaCopy cpu_copy(nullptr, 0u);
+  cpu_copy.init();
+
+  CHECK_FALSE(cpu_copy.copy(dst_data, src_data, 4096u, copyDone, nullptr));
+  CHECK_EQUAL(1u, done_count);
+  MEMCMP_EQUAL(src_data, dst_data, 4096u);
+}
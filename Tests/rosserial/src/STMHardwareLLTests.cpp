@@ -0,0 +1,332 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file STMHardwareLLTests.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Tests of the register level STM32 hardware on the simulated USART6
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <CppUTest/TestHarness.h>
+#include <cstring>
+#include <type_traits>
+#include "STMHardwareLL.h"
+#include "ros.h"
+#include "sim_clock.h"
+#include "sim_dma.h"
+#include "sim_nvic.h"
+#include "sim_usart.h"
+/* -------------------------------------------------------------------------------*/
+
+constexpr uint32_t SIM_LL_BAUD = 115200u;
+
+// USART2 and DMA1 belong to the HAL tests, this hardware runs on USART6.
+// The handle is a template argument and needs external linkage in C++11.
+UART_HandleTypeDef          huart6;
+static ros::STMHardwareLL_<huart6,
+                           ros::STMDmaStream<2u, 1u, 5u>,
+                           ros::STMDmaStream<2u, 6u, 5u>,
+                           ros::STM_HW_BUF_SIZE,
+                           ros::STM_HW_BUF_SIZE> ll_hardware;
+static uint32_t             usart6_irqs;
+static uint32_t             tx_dma_irqs;
+
+extern "C"
+{
+  void USART6_IRQHandler(void)
+  {
+    usart6_irqs++;
+    ll_hardware.usartIrq();
+  }
+
+  void DMA2_Stream6_IRQHandler(void)
+  {
+    tx_dma_irqs++;
+    ll_hardware.txDmaIrq();
+  }
+}
+
+TEST_GROUP(STMHardwareLL)
+{
+  void setup()
+  {
+    memset(USART6, 0, sizeof(*USART6));
+    memset(DMA2, 0, sizeof(SIM_DMA[1]));
+    SIM_ClockReset();
+    SIM_NvicReset();
+    SIM_DmaReset();
+    SIM_UsartReset();
+    usart6_irqs = 0u;
+    tx_dma_irqs = 0u;
+
+    memset(&huart6, 0, sizeof(huart6));
+    huart6.Instance           = USART6;
+    huart6.Init.BaudRate      = SIM_LL_BAUD;
+    huart6.Init.WordLength    = UART_WORDLENGTH_8B;
+    huart6.Init.StopBits      = UART_STOPBITS_1;
+    huart6.Init.Parity        = UART_PARITY_NONE;
+    huart6.Init.Mode          = UART_MODE_TX_RX;
+    huart6.Init.HwFlowCtl     = UART_HWCONTROL_NONE;
+    huart6.Init.OverSampling  = UART_OVERSAMPLING_16;
+    CHECK(HAL_OK == HAL_UART_Init(&huart6));
+
+    ll_hardware.init();
+    NVIC_EnableIRQ(USART6_IRQn);
+    NVIC_EnableIRQ(DMA2_Stream6_IRQn);
+  }
+
+  void teardown()
+  {
+    NVIC_DisableIRQ(USART6_IRQn);
+    NVIC_DisableIRQ(DMA2_Stream6_IRQn);
+    SIM_NvicReset();
+    SIM_UsartReset();
+    SIM_DmaReset();
+    memset(USART6, 0, sizeof(*USART6));
+    memset(DMA2, 0, sizeof(SIM_DMA[1]));
+  }
+
+  /**
+   * @brief Time of a number of characters on the line, with a margin for
+   *        the rounding of the baudrate register
+   */
+  uint64_t charsUs(const uint32_t chars)
+  {
+    return (chars * 10u * 1000000ull) / SIM_LL_BAUD + 20u;
+  }
+};
+
+TEST(STMHardwareLL, DmaHelpers)
+{
+  POINTERS_EQUAL(DMA2, ros::ll::dmaController(DMA2_Stream6));
+  CHECK_EQUAL(6u, ros::ll::dmaStreamIndex(DMA2_Stream6));
+  CHECK_EQUAL(16u, ros::ll::dmaFlagShift(DMA2_Stream6));
+  CHECK_EQUAL(6u, ros::ll::dmaFlagShift(DMA2_Stream1));
+
+  DMA2->HIFCR = 0u;
+  ros::ll::dmaClearFlags(DMA2_Stream6);
+  CHECK_EQUAL(0x3Du << 16u, DMA2->HIFCR);
+
+  POINTERS_EQUAL(DMA1_Stream5, ros::ll::dmaStream(DMA1, 5u));
+  POINTERS_EQUAL(DMA2_Stream0, ros::ll::dmaStream(DMA2, 0u));
+}
+
+TEST(STMHardwareLL, StreamBinding)
+{
+  typedef ros::STMDmaStream<1u, 5u, 4u> Usart2Rx;
+  typedef ros::STMDmaStream<2u, 6u, 5u> Usart6Tx;
+
+  POINTERS_EQUAL(DMA1_Stream5, Usart2Rx::stream());
+  CHECK_EQUAL(DMA_CHANNEL_4, Usart2Rx::channel);
+  POINTERS_EQUAL(DMA2_Stream6, Usart6Tx::stream());
+  CHECK_EQUAL(DMA_CHANNEL_5, Usart6Tx::channel);
+}
+
+TEST(STMHardwareLL, RingSizesSetRam)
+{
+  typedef ros::STMHardwareLL_<huart6,
+                              ros::STMDmaStream<2u, 1u, 5u>,
+                              ros::STMDmaStream<2u, 6u, 5u>,
+                              64u, 128u> SmallHardware;
+
+  CHECK(sizeof(SmallHardware) + 2u * ros::STM_HW_BUF_SIZE - 64u - 128u == sizeof(ll_hardware));
+  POINTERS_EQUAL(USART6, ll_hardware._usart);
+}
+
+TEST(STMHardwareLL, InitConfiguresStreams)
+{
+  CHECK_EQUAL(DMA_CHANNEL_5 | DMA_SxCR_MINC | DMA_SxCR_CIRC | DMA_SxCR_EN, DMA2_Stream1->CR);
+  CHECK_EQUAL(ros::STM_HW_BUF_SIZE, DMA2_Stream1->NDTR);
+  CHECK_EQUAL(ros::ll::busAddress(&USART6->DR), DMA2_Stream1->PAR);
+  CHECK_EQUAL(ros::ll::busAddress(ll_hardware._rx_buffer), DMA2_Stream1->M0AR);
+
+  CHECK_EQUAL(DMA_CHANNEL_5 | DMA_SxCR_DIR_0 | DMA_SxCR_MINC | DMA_SxCR_TCIE, DMA2_Stream6->CR);
+  CHECK_EQUAL(ros::ll::busAddress(&USART6->DR), DMA2_Stream6->PAR);
+
+  CHECK_EQUAL(USART_CR3_DMAR | USART_CR3_DMAT, USART6->CR3 & (USART_CR3_DMAR | USART_CR3_DMAT));
+  CHECK(0u != (USART6->CR1 & USART_CR1_IDLEIE));
+}
+
+TEST(STMHardwareLL, ReadNoData)
+{
+  SIM_ClockAdvanceUs(1000u);
+
+  CHECK_EQUAL(-1, ll_hardware.read());
+  CHECK_FALSE(ll_hardware.rxIdle());
+}
+
+TEST(STMHardwareLL, ReadBurstRaisesIdleOnce)
+{
+  const uint8_t msg[] = "Hello World!";
+
+  SIM_UsartInject(USART6, msg, sizeof(msg));
+  SIM_ClockAdvanceUs(charsUs(sizeof(msg) + 1u));
+
+  CHECK_TRUE(ll_hardware.rxIdle());
+  CHECK_FALSE(ll_hardware.rxIdle());
+  CHECK_EQUAL(1u, usart6_irqs);
+  CHECK_EQUAL(0u, USART6->SR & USART_SR_IDLE);
+
+  for(uint32_t idx = 0u; idx < sizeof(msg); idx++)
+  {
+    CHECK_EQUAL(msg[idx], ll_hardware.read());
+  }
+  CHECK_EQUAL(-1, ll_hardware.read());
+}
+
+TEST(STMHardwareLL, ReadWrapsAround)
+{
+  uint8_t data[300];
+  uint32_t received = 0u;
+
+  for(uint32_t idx = 0u; idx < sizeof(data); idx++)
+  {
+    data[idx] = static_cast<uint8_t>(idx * 7u);
+  }
+
+  for(uint32_t round = 0u; round < 4u; round++)
+  {
+    SIM_UsartInject(USART6, data, sizeof(data));
+    SIM_ClockAdvanceUs(charsUs(sizeof(data) + 1u));
+
+    for(uint32_t idx = 0u; idx < sizeof(data); idx++, received++)
+    {
+      CHECK_EQUAL(data[idx], ll_hardware.read());
+    }
+    CHECK_EQUAL(-1, ll_hardware.read());
+  }
+  CHECK(received > 2u * ros::STM_HW_BUF_SIZE);
+}
+
+TEST(STMHardwareLL, WriteSendsWithOneInterrupt)
+{
+  uint8_t msg[] = "Hello Host!";
+  uint8_t out[32];
+
+  ll_hardware.write(msg, sizeof(msg));
+  CHECK(0u != (DMA2_Stream6->CR & DMA_SxCR_EN));
+
+  SIM_ClockAdvanceUs(charsUs(sizeof(msg) + 1u));
+
+  CHECK_EQUAL(sizeof(msg), SIM_UsartTake(USART6, out, sizeof(out)));
+  MEMCMP_EQUAL(msg, out, sizeof(msg));
+  CHECK_EQUAL(1u, tx_dma_irqs);
+  CHECK_EQUAL(0u, usart6_irqs);
+  CHECK_EQUAL(0u, ll_hardware._tx_busy);
+  CHECK_EQUAL(ll_hardware._tx_head, ll_hardware._tx_tail);
+}
+
+TEST(STMHardwareLL, WriteWhileBusyIsSentNext)
+{
+  uint8_t first[] = "first ";
+  uint8_t second[] = "second";
+  uint8_t out[32];
+
+  ll_hardware.write(first, 6);
+  SIM_ClockAdvanceUs(charsUs(2u));
+  ll_hardware.write(second, 6);
+  CHECK_EQUAL(6u, ll_hardware._tx_busy);
+
+  SIM_ClockAdvanceUs(charsUs(13u));
+
+  CHECK_EQUAL(12u, SIM_UsartTake(USART6, out, sizeof(out)));
+  MEMCMP_EQUAL("first second", out, 12u);
+  CHECK_EQUAL(2u, tx_dma_irqs);
+}
+
+TEST(STMHardwareLL, WriteWrapsRing)
+{
+  uint8_t data[400];
+  uint8_t out[400];
+
+  for(uint32_t idx = 0u; idx < sizeof(data); idx++)
+  {
+    data[idx] = static_cast<uint8_t>(idx);
+  }
+
+  for(uint32_t round = 0u; round < 2u; round++)
+  {
+    ll_hardware.write(data, sizeof(data));
+    SIM_ClockAdvanceUs(charsUs(sizeof(data) + 1u));
+
+    CHECK_EQUAL(sizeof(data), SIM_UsartTake(USART6, out, sizeof(out)));
+    MEMCMP_EQUAL(data, out, sizeof(data));
+  }
+
+  // The second write ran over the end of the ring in two chunks
+  CHECK_EQUAL(3u, tx_dma_irqs);
+}
+
+TEST(STMHardwareLL, WriteDropsWholeFrameOnFullRing)
+{
+  static uint8_t data[ros::STM_HW_BUF_SIZE + 10u];
+  static uint8_t out[ros::STM_HW_BUF_SIZE];
+
+  // larger than the ring, nothing is queued
+  CHECK_EQUAL(static_cast<int>(decltype(ll_hardware)::TX_CAPACITY), ll_hardware.txSpace());
+  CHECK_FALSE(ll_hardware.write(data, sizeof(data)));
+  CHECK_EQUAL(1u, ll_hardware.getTxDropped());
+  CHECK_EQUAL(0u, DMA2_Stream6->CR & DMA_SxCR_EN);
+
+  // the second frame does not fit behind the first one
+  CHECK_TRUE(ll_hardware.write(data, 300));
+  CHECK_EQUAL(static_cast<int>(decltype(ll_hardware)::TX_CAPACITY) - 300, ll_hardware.txSpace());
+  CHECK_FALSE(ll_hardware.write(data, 300));
+  CHECK_EQUAL(2u, ll_hardware.getTxDropped());
+
+  SIM_ClockAdvanceUs(charsUs(301u));
+  CHECK_EQUAL(300u, SIM_UsartTake(USART6, out, sizeof(out)));
+
+  // a frame of the whole capacity fits once the ring is empty
+  CHECK_TRUE(ll_hardware.write(data, decltype(ll_hardware)::TX_CAPACITY));
+  CHECK_EQUAL(2u, ll_hardware.getTxDropped());
+}
+
+TEST(STMHardwareLL, DefaultRingHoldsFrameOfNodeHandle)
+{
+  // the default node handle talks over this link
+  CHECK((std::is_same<ros::NodeHandle, ros::NodeHandle_<ros::STMHardwareLL>>::value));
+  CHECK(static_cast<int>(ros::STMHardwareLL::TX_CAPACITY) >= ros::NodeHandle::OUTPUT_BUFFER_SIZE);
+  CHECK_EQUAL(static_cast<int>(ros::STMHardwareLL::TX_CAPACITY),
+              ros::HardwareTxCapacity<ros::STMHardwareLL>::value);
+  CHECK_EQUAL(0, ros::HardwareTxCapacity<ros::STMHardware>::value);
+
+  // NodeHandle_ checks the free space before every piece of a stream
+  CHECK_EQUAL(ll_hardware.txSpace(), ros::HardwareTxSpace<decltype(ll_hardware)>::get(ll_hardware));
+}
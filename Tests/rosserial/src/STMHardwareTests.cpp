@@ -52,6 +52,11 @@ constexpr uint32_t ROSSERIAL_DEFAULT_BAUD = 57600u;
 
 extern UART_HandleTypeDef huart2;
 
+// Second link with a small ring, the handle is only used for its settings.
+// A template argument needs a handle with external linkage in C++11.
+UART_HandleTypeDef huart3;
+typedef ros::STMHardware_<huart3, 16u> SmallHardware;
+
 TEST_GROUP(STMHardware)
 {
   void setup()
@@ -69,13 +74,11 @@ TEST_GROUP(STMHardware)
   {
     CHECK(huart2.Instance == _hardware._serial.Instance);
     CHECK(ros::STM_HW_DEF_BAUD == _hardware._baud);
-    CHECK(0u == _hardware._tx_size);
     CHECK(0u == _hardware._rx_read_pos);
     CHECK(0u == _hardware._rx_size);
     
     for(auto idx = 0u; idx < ros::STM_HW_BUF_SIZE; idx++)
     {
-      CHECK(0u == _hardware._tx_buffer[idx]);
       CHECK(0u == _hardware._rx_buffer[idx]);
     }
   }
@@ -107,7 +110,6 @@ TEST(STMHardware, InitResetValue)
 {
   // Set values
   _hardware._baud = 1234;
-  _hardware._tx_buffer[0] = 2;
   _hardware._rx_buffer[0] = 3;
   _hardware._rx_read_pos = 5;
   _hardware._rx_size = 45;
@@ -117,6 +119,19 @@ TEST(STMHardware, InitResetValue)
   checkValueReset();
 }
 
+TEST(STMHardware, InitStartsCycleCounter)
+{
+  CoreDebug->DEMCR  = 0u;
+  DWT->CTRL         = 0u;
+  _hardware.init();
+
+  CHECK(0u != (CoreDebug->DEMCR & CoreDebug_DEMCR_TRCENA_Msk));
+  CHECK(0u != (DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk));
+
+  DWT->CYCCNT = 1234u;
+  CHECK(1234u == ros::STMHardware::cycles());
+}
+
 TEST(STMHardware, ReadNoData)
 {
   _hardware.init();
@@ -144,4 +159,39 @@ TEST(STMHardware, ReadData)
   }
 
   CHECK(0 == _hardware._rx_size);
-}
\ No newline at end of file
+}
+
+TEST(STMHardware, TemplateUsesHandle)
+{
+  SmallHardware hardware;
+
+  huart3.Init.BaudRate = 230400u;
+  hardware.init();
+
+  POINTERS_EQUAL(&huart3, &hardware._serial);
+  CHECK(230400u == hardware._baud);
+  CHECK(sizeof(hardware._rx_buffer) == 16u);
+  CHECK(sizeof(hardware) < sizeof(_hardware));
+}
+
+TEST(STMHardware, ReadWrapsAround)
+{
+  SmallHardware hardware;
+  hardware.init();
+
+  // Ring is filled from position 12 over the end
+  hardware._rx_read_pos = 12u;
+  for(auto idx = 0u; idx < 8u; idx++)
+  {
+    hardware._rx_buffer[(12u + idx) & 15u] = static_cast<uint8_t>('a' + idx);
+  }
+  hardware._rx_size = 8u;
+
+  for(auto idx = 0u; idx < 8u; idx++)
+  {
+    CHECK(static_cast<int>('a' + idx) == hardware.read());
+  }
+
+  CHECK(4u == hardware._rx_read_pos);
+  CHECK(-1 == hardware.read());
+}
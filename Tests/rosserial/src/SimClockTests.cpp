@@ -0,0 +1,234 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file SimClockTests.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Tests of the virtual time base of the simulation
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <CppUTest/TestHarness.h>
+#include <ctime>
+#include "ros/node_handle.h"
+#include "std_msgs/Int32.h"
+#include "STMHardware.h"
+#include "sim_clock.h"
+/* -------------------------------------------------------------------------------*/
+
+typedef ros::NodeHandle_<ros::STMHardware, 2, 2, 256, 256> SimNodeHandle;
+
+constexpr int SIM_CLOCK_SUB_ID = 100;
+
+static void int32Callback(const std_msgs::Int32&)
+{
+}
+
+TEST_GROUP(SimClock)
+{
+  void setup()
+  {
+    resetTimers();
+    SIM_ClockReset();
+    HAL_InitTick(0u);
+  }
+
+  void teardown()
+  {
+    resetTimers();
+    SIM_ClockReset();
+  }
+
+  /**
+   * @brief Clear the simulated timer registers, CALIB is read only
+   */
+  void resetTimers()
+  {
+    SysTick->CTRL = 0u;
+    SysTick->LOAD = 0u;
+    SysTick->VAL  = 0u;
+    *TIM2         = TIM_TypeDef{};
+  }
+
+  /**
+   * @brief Append raw bytes to the receive buffer of the hardware
+   */
+  void inject(ros::STMHardware* hw, const uint8_t* data, const uint16_t size)
+  {
+    memcpy(&hw->_rx_buffer[hw->_rx_read_pos + hw->_rx_size], data, size);
+    hw->_rx_size += size;
+  }
+};
+
+TEST(SimClock, SysTickDrivesHalTick)
+{
+  const uint32_t ticks_per_ms = SystemCoreClock / 1000u;
+
+  LONGS_EQUAL(ticks_per_ms - 1u, SysTick->LOAD);
+  LONGS_EQUAL(0u, HAL_GetTick());
+
+  // first tick reloads, underflow after a full period
+  SIM_ClockAdvance(ticks_per_ms - 1u);
+  LONGS_EQUAL(0u, HAL_GetTick());
+  LONGS_EQUAL(1u, SysTick->VAL);
+  SIM_ClockAdvance(1u);
+  LONGS_EQUAL(1u, HAL_GetTick());
+  CHECK(SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk);
+
+  SIM_ClockAdvanceMs(1000u);
+  LONGS_EQUAL(1001u, HAL_GetTick());
+  CHECK(SIM_ClockGetCycles() == 1001ull * ticks_per_ms);
+
+  // no interrupt, no tick
+  SysTick->CTRL &= ~SysTick_CTRL_TICKINT_Msk;
+  SIM_ClockAdvanceMs(5u);
+  LONGS_EQUAL(1001u, HAL_GetTick());
+}
+
+TEST(SimClock, SysTickOnDividedClock)
+{
+  SysTick->CTRL &= ~SysTick_CTRL_CLKSOURCE_Msk;
+  SysTick->LOAD = 99u;
+
+  // 100 ticks of HCLK/8, advanced in uneven steps
+  for(int idx = 0; idx < 100; idx++)
+  {
+    SIM_ClockAdvance(3u);
+    SIM_ClockAdvance(5u);
+  }
+  LONGS_EQUAL(1u, HAL_GetTick());
+  LONGS_EQUAL(0u, SysTick->VAL);
+}
+
+TEST(SimClock, TimerCountsAndOverflows)
+{
+  TIM2->PSC = 15u;
+  TIM2->ARR = 999u;
+
+  SIM_ClockAdvance(1600u);
+  LONGS_EQUAL(0u, TIM2->CNT);
+
+  TIM2->CR1 |= TIM_CR1_CEN;
+  SIM_ClockAdvance(1615u);
+  LONGS_EQUAL(100u, TIM2->CNT);
+  LONGS_EQUAL(0u, TIM2->SR & TIM_SR_UIF);
+
+  SIM_ClockAdvance(900u * 16u);
+  LONGS_EQUAL(0u, TIM2->CNT);
+  CHECK(TIM2->SR & TIM_SR_UIF);
+}
+
+TEST(SimClock, CycleCounter)
+{
+  DWT->CTRL   = 0u;
+  DWT->CYCCNT = 0u;
+  SIM_ClockAdvance(100u);
+  LONGS_EQUAL(0u, DWT->CYCCNT);
+
+  DWT->CTRL = DWT_CTRL_CYCCNTENA_Msk;
+  SIM_ClockAdvance(100u);
+  LONGS_EQUAL(100u, ros::STMHardware::cycles());
+  DWT->CTRL = 0u;
+}
+
+TEST(SimClock, DelaySkipsAhead)
+{
+  HAL_Delay(250u);
+  LONGS_EQUAL(251u, HAL_GetTick());
+
+  // returns instead of hanging without tick interrupt
+  SysTick->CTRL = 0u;
+  HAL_Delay(10u);
+  LONGS_EQUAL(251u, HAL_GetTick());
+}
+
+TEST(SimClock, RealTime)
+{
+  const timespec sleep = {0, 20000000};
+
+  SIM_ClockSetRealTime(1);
+  const uint32_t start = HAL_GetTick();
+  nanosleep(&sleep, nullptr);
+  CHECK((HAL_GetTick() - start) >= 19u);
+
+  SIM_ClockSetRealTime(0);
+  const uint32_t stop = HAL_GetTick();
+  nanosleep(&sleep, nullptr);
+  LONGS_EQUAL(stop, HAL_GetTick());
+}
+
+TEST(SimClock, NodeHandleMessageTimeout)
+{
+  SimNodeHandle                     nh;
+  ros::Subscriber<std_msgs::Int32>  sub("cmd", int32Callback);
+  const uint8_t                     header[7] = {0xffu, 0xfeu, 0x04u, 0x00u, 0xfbu, SIM_CLOCK_SUB_ID, 0x00u};
+
+  nh.initNode();
+  nh.subscribe(sub);
+
+  // frame stops after the header
+  inject(nh.getHardware(), header, sizeof(header));
+  nh.spinOnce();
+  SIM_ClockAdvanceMs(ros::SERIAL_MSG_TIMEOUT);
+  nh.spinOnce();
+  LONGS_EQUAL(0u, nh.getCounters(SIM_CLOCK_SUB_ID)->drops);
+
+  SIM_ClockAdvanceMs(1u);
+  nh.spinOnce();
+  LONGS_EQUAL(1u, nh.getCounters(SIM_CLOCK_SUB_ID)->drops);
+}
+
+TEST(SimClock, NodeHandleSyncTimeout)
+{
+  SimNodeHandle nh;
+  const uint8_t negotiate[8] = {0xffu, 0xfeu, 0x00u, 0x00u, 0xffu, 0x00u, 0x00u, 0xffu};
+
+  nh.initNode();
+  SIM_ClockAdvanceMs(100u);
+  inject(nh.getHardware(), negotiate, sizeof(negotiate));
+  nh.spinOnce();
+  CHECK(nh.connected());
+
+  SIM_ClockAdvanceMs(ros::SYNC_SECONDS * 2200u);
+  nh.spinOnce();
+  CHECK(nh.connected());
+
+  SIM_ClockAdvanceMs(1u);
+  nh.spinOnce();
+  CHECK_FALSE(nh.connected());
+}
@@ -0,0 +1,342 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file SimHubTests.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Tests of several simulated devices on a virtual serial hub
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <CppUTest/TestHarness.h>
+#include <cstring>
+#include "ros/node_handle.h"
+#include "std_msgs/Int32.h"
+#include "SimSerialHardware.h"
+#include "sim_device.h"
+#include "sim_hub.h"
+/* -------------------------------------------------------------------------------*/
+
+typedef ros::NodeHandle_<SimSerialHardware, 2, 2, 256, 256> HubNodeHandle;
+
+constexpr uint32_t SIM_HUB_NODES = 4u;
+
+/**
+ * @brief Firmware which writes a fixed block every quantum
+ */
+static void floodLoop(void* arg)
+{
+  static uint8_t block[64] = {0u};
+  static_cast<SimSerialHardware*>(arg)->write(block, sizeof(block));
+}
+
+/**
+ * @brief Firmware which collects everything it receives
+ */
+struct EchoDevice
+{
+  SimSerialHardware hw;
+  uint8_t           received[256];
+  uint32_t          size;
+};
+
+static void echoLoop(void* arg)
+{
+  EchoDevice* echo = static_cast<EchoDevice*>(arg);
+  int value;
+
+  while((value = echo->hw.read()) >= 0)
+  {
+    echo->received[echo->size++ % sizeof(echo->received)] = static_cast<uint8_t>(value);
+  }
+}
+
+/**
+ * @brief Firmware with a node which publishes one topic
+ */
+struct PublisherNode
+{
+  HubNodeHandle   nh;
+  std_msgs::Int32 msg;
+  ros::Publisher  pub;
+
+  PublisherNode(void) :
+  nh(),
+  msg(),
+  pub("value", &msg)
+  {
+
+  }
+};
+
+static void nodeLoop(void* arg)
+{
+  static_cast<PublisherNode*>(arg)->nh.spinOnce();
+}
+
+TEST_GROUP(SimHub)
+{
+  SIM_Device* _devices[SIM_HUB_NODES];
+  SIM_Hub*    _hub;
+
+  void setup()
+  {
+    for(uint32_t idx = 0u; idx < SIM_HUB_NODES; idx++)
+    {
+      _devices[idx] = SIM_DeviceCreate();
+    }
+    _hub = nullptr;
+  }
+
+  void teardown()
+  {
+    SIM_HubDestroy(_hub);
+    for(uint32_t idx = 0u; idx < SIM_HUB_NODES; idx++)
+    {
+      SIM_DeviceDestroy(_devices[idx]);
+    }
+    POINTERS_EQUAL(nullptr, SIM_DeviceSelected());
+  }
+
+  /**
+   * @brief Start the HAL time base and hardware on a device
+   */
+  void boot(const uint32_t idx, SimSerialHardware& hw)
+  {
+    SIM_DeviceSelect(_devices[idx]);
+    HAL_InitTick(0u);
+    hw.init();
+    SIM_DeviceSelect(nullptr);
+  }
+
+  /**
+   * @brief Send a rosserial frame from the host to a port
+   */
+  void sendFrame(const int port, const uint16_t topic, const uint8_t* payload, const uint16_t size)
+  {
+    uint8_t frame[64];
+    uint32_t checksum = (topic & 0xffu) + (topic >> 8u);
+
+    frame[0] = 0xffu;
+    frame[1] = 0xfeu;
+    frame[2] = static_cast<uint8_t>(size & 0xffu);
+    frame[3] = static_cast<uint8_t>(size >> 8u);
+    frame[4] = static_cast<uint8_t>(255u - (((size & 0xffu) + (size >> 8u)) % 256u));
+    frame[5] = static_cast<uint8_t>(topic & 0xffu);
+    frame[6] = static_cast<uint8_t>(topic >> 8u);
+    for(uint16_t idx = 0u; idx < size; idx++)
+    {
+      frame[7u + idx] = payload[idx];
+      checksum += payload[idx];
+    }
+    frame[7u + size] = static_cast<uint8_t>(255u - (checksum % 256u));
+
+    CHECK_EQUAL(8u + size, SIM_HubWrite(_hub, port, frame, 8u + size));
+  }
+
+  /**
+   * @brief Count the frames of a topic in data received from a port
+   */
+  uint32_t countFrames(const uint8_t* data, const uint32_t size, const uint16_t topic)
+  {
+    uint32_t count = 0u;
+
+    for(uint32_t idx = 0u; idx + 7u < size; idx++)
+    {
+      if((0xffu == data[idx]) && (0xfeu == data[idx + 1u]))
+      {
+        const uint32_t length = data[idx + 2u] | (data[idx + 3u] << 8u);
+        if((data[idx + 5u] | (data[idx + 6u] << 8u)) == topic)
+        {
+          count++;
+        }
+        idx += 7u + length;
+      }
+    }
+    return count;
+  }
+};
+
+TEST(SimHub, DevicesAreIsolated)
+{
+  static SimSerialHardware hw;
+
+  USART2->BRR = 123u;
+  _hub = SIM_HubCreate(0u, 1000u);
+  boot(0u, hw);
+  SIM_HubConnect(_hub, _devices[0], USART2, nullptr, nullptr);
+  SIM_HubConnect(_hub, _devices[1], USART2, nullptr, nullptr);
+  SIM_HubRun(_hub, 10000u);
+
+  CHECK_EQUAL(10000u, SIM_HubGetTime(_hub));
+  CHECK_EQUAL(123u, USART2->BRR);
+
+  SIM_DeviceSelect(_devices[0]);
+  CHECK_EQUAL(10u, HAL_GetTick());
+  CHECK_EQUAL(16000000u / 115200u, USART2->BRR);
+
+  SIM_DeviceSelect(_devices[1]);
+  CHECK_EQUAL(0u, HAL_GetTick());
+  CHECK_EQUAL(0u, USART2->BRR);
+
+  SIM_DeviceSelect(nullptr);
+  USART2->BRR = 0u;
+}
+
+TEST(SimHub, ConnectRejectsSecondPortOfDevice)
+{
+  _hub = SIM_HubCreate(0u, 1000u);
+
+  CHECK_EQUAL(0, SIM_HubConnect(_hub, _devices[0], USART2, nullptr, nullptr));
+  CHECK_EQUAL(-1, SIM_HubConnect(_hub, _devices[0], USART1, nullptr, nullptr));
+  CHECK_EQUAL(1, SIM_HubConnect(_hub, _devices[1], USART2, nullptr, nullptr));
+}
+
+TEST(SimHub, DownlinkReachesDevice)
+{
+  static EchoDevice echo;
+  const uint8_t data[] = "hello device";
+
+  echo.size = 0u;
+  _hub = SIM_HubCreate(0u, 1000u);
+  boot(0u, echo.hw);
+  const int port = SIM_HubConnect(_hub, _devices[0], USART2, echoLoop, &echo);
+
+  CHECK_EQUAL(sizeof(data), SIM_HubWrite(_hub, port, data, sizeof(data)));
+  SIM_HubRun(_hub, 5000u);
+
+  CHECK_EQUAL(sizeof(data), echo.size);
+  MEMCMP_EQUAL(data, echo.received, sizeof(data));
+}
+
+TEST(SimHub, UnlimitedLinkRunsAtBaudrate)
+{
+  static SimSerialHardware hw;
+  SIM_HubStats stats;
+
+  _hub = SIM_HubCreate(0u, 1000u);
+  boot(0u, hw);
+  uint8_t host[SIM_HUB_BUFFER_SIZE];
+  const int port = SIM_HubConnect(_hub, _devices[0], USART2, floodLoop, &hw);
+
+  for(uint32_t ms = 0u; ms < 1000u; ms += 10u)
+  {
+    SIM_HubRun(_hub, 10000u);
+    SIM_HubRead(_hub, port, host, sizeof(host));
+  }
+  SIM_HubGetStats(_hub, port, &stats);
+
+  // 10 bits per character
+  CHECK(stats.up > 11400u);
+  CHECK(stats.up <= 11520u);
+  CHECK_EQUAL(0u, stats.dropped);
+}
+
+TEST(SimHub, BandwidthIsSharedBetweenPorts)
+{
+  static SimSerialHardware hw[2];
+  SIM_HubStats stats[2];
+  uint8_t host[SIM_HUB_BUFFER_SIZE];
+
+  _hub = SIM_HubCreate(8000u, 1000u);
+  for(uint32_t idx = 0u; idx < 2u; idx++)
+  {
+    boot(idx, hw[idx]);
+    SIM_HubConnect(_hub, _devices[idx], USART2, floodLoop, &hw[idx]);
+  }
+
+  for(uint32_t ms = 0u; ms < 1000u; ms += 10u)
+  {
+    SIM_HubRun(_hub, 10000u);
+    SIM_HubRead(_hub, 0, host, sizeof(host));
+    SIM_HubRead(_hub, 1, host, sizeof(host));
+  }
+  SIM_HubGetStats(_hub, 0, &stats[0]);
+  SIM_HubGetStats(_hub, 1, &stats[1]);
+
+  CHECK_EQUAL(8000u, stats[0].up + stats[1].up);
+  CHECK(stats[0].up >= 3990u);
+  CHECK(stats[1].up >= 3990u);
+  CHECK(stats[0].dropped > 0u);
+  CHECK(stats[0].max_backlog > SIM_HUB_BUFFER_SIZE - 64u);
+}
+
+TEST(SimHub, NodesNegotiateTogether)
+{
+  // static like the firmware, the DMA registers only hold 32 bit addresses
+  static PublisherNode nodes[SIM_HUB_NODES];
+  uint8_t host[SIM_HUB_BUFFER_SIZE];
+
+  _hub = SIM_HubCreate(20000u, 500u);
+  for(uint32_t idx = 0u; idx < SIM_HUB_NODES; idx++)
+  {
+    SIM_DeviceSelect(_devices[idx]);
+    HAL_InitTick(0u);
+    nodes[idx].nh.initNode();
+    nodes[idx].nh.advertise(nodes[idx].pub);
+    SIM_DeviceSelect(nullptr);
+    CHECK_EQUAL(static_cast<int>(idx), SIM_HubConnect(_hub, _devices[idx], USART2, nodeLoop, &nodes[idx]));
+  }
+
+  // The host asks all nodes for their topics at once
+  for(int port = 0; port < static_cast<int>(SIM_HUB_NODES); port++)
+  {
+    sendFrame(port, ros::TopicInfo::ID_PUBLISHER, nullptr, 0u);
+  }
+  SIM_HubRun(_hub, 50000u);
+
+  for(uint32_t idx = 0u; idx < SIM_HUB_NODES; idx++)
+  {
+    const uint32_t size = SIM_HubRead(_hub, static_cast<int>(idx), host, sizeof(host));
+    CHECK_EQUAL(1u, countFrames(host, size, ros::TopicInfo::ID_PUBLISHER));
+    CHECK_EQUAL(1u, countFrames(host, size, ros::TopicInfo::ID_TIME));
+    CHECK_TRUE(nodes[idx].nh.connected());
+
+    SIM_DeviceSelect(_devices[idx]);
+    nodes[idx].msg.data = static_cast<int32_t>(idx);
+    nodes[idx].pub.publish(&nodes[idx].msg);
+    SIM_DeviceSelect(nullptr);
+  }
+  SIM_HubRun(_hub, 10000u);
+
+  for(uint32_t idx = 0u; idx < SIM_HUB_NODES; idx++)
+  {
+    const uint32_t size = SIM_HubRead(_hub, static_cast<int>(idx), host, sizeof(host));
+    CHECK_EQUAL(1u, countFrames(host, size, nodes[idx].pub.id_));
+  }
+}
@@ -0,0 +1,193 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file SimSerialHardware.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Register level rosserial hardware for simulated devices
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef ROS_SIM_SERIAL_HARDWARE_H_
+#define ROS_SIM_SERIAL_HARDWARE_H_
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdint.h>
+#include <string.h>
+
+#include "stm32f4xx_hal.h"
+/* -------------------------------------------------------------------------------*/
+
+/* Hardware Configuration --------------------------------------------------------*/
+constexpr uint16_t  SIM_HW_BUF_SIZE = 1024u;  //!< Size of tx/rx buffer, holds a full negotiation
+constexpr uint32_t  SIM_HW_DMA_FLAGS = 0x3Du; //!< All flags of one DMA stream
+/* -------------------------------------------------------------------------------*/
+
+/**
+ * @brief Hardware on USART2 with DMA in both directions and no interrupts,
+ *        as used by the nodes on a SIM_Hub
+ * 
+ * Receiving runs on a circular DMA (DMA1 stream 5), transmitting on a normal
+ * DMA (DMA1 stream 6) which is restarted with the collected data whenever
+ * the previous transfer finished. All registers go to the selected device,
+ * so the object must only be used while its device is selected. The DMA
+ * keeps 32 bit addresses, objects must be static or on the heap.
+ */
+class SimSerialHardware
+{
+  public:
+
+    explicit SimSerialHardware(const uint32_t baud = 115200u) :
+    _baud(baud),
+    _rx_buffer(),
+    _rx_read_pos(0u),
+    _tx_buffer(),
+    _tx_active(0u),
+    _tx_size(0u)
+    {
+
+    }
+
+    /**
+     * @brief Configure USART2 and both DMA streams of the selected device
+     */
+    void init()
+    {
+      __HAL_RCC_USART2_CLK_ENABLE();
+      __HAL_RCC_DMA1_CLK_ENABLE();
+
+      _rx_read_pos  = 0u;
+      _tx_active    = 0u;
+      _tx_size      = 0u;
+
+      // Receive stream, circular over the whole buffer
+      DMA1_Stream5->CR    = 0u;
+      DMA1->HIFCR         = SIM_HW_DMA_FLAGS << 6u;
+      DMA1_Stream5->PAR   = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(&USART2->DR));
+      DMA1_Stream5->M0AR  = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(_rx_buffer));
+      DMA1_Stream5->NDTR  = SIM_HW_BUF_SIZE;
+      DMA1_Stream5->CR    = DMA_CHANNEL_4 | DMA_SxCR_MINC | DMA_SxCR_CIRC | DMA_SxCR_EN;
+
+      // Transmit stream, started by write()
+      DMA1_Stream6->CR    = DMA_CHANNEL_4 | DMA_SxCR_DIR_0 | DMA_SxCR_MINC;
+      DMA1_Stream6->PAR   = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(&USART2->DR));
+
+      USART2->BRR = SystemCoreClock / _baud;
+      USART2->CR3 = USART_CR3_DMAR | USART_CR3_DMAT;
+      USART2->CR1 = USART_CR1_UE | USART_CR1_TE | USART_CR1_RE;
+    }
+
+    /**
+     * @brief Read next received byte
+     * 
+     * @return int Received byte or -1 if nothing was received
+     */
+    int read()
+    {
+      const uint16_t write_pos = static_cast<uint16_t>((SIM_HW_BUF_SIZE - DMA1_Stream5->NDTR) % SIM_HW_BUF_SIZE);
+
+      flush();
+
+      if(_rx_read_pos == write_pos)
+      {
+        return -1;
+      }
+
+      const int value = _rx_buffer[_rx_read_pos];
+      _rx_read_pos = static_cast<uint16_t>((_rx_read_pos + 1u) % SIM_HW_BUF_SIZE);
+      return value;
+    }
+
+    /**
+     * @brief Queue data for the transmit DMA, data which does not fit
+     *        is dropped
+     */
+    void write(uint8_t* data, const int size)
+    {
+      uint16_t length = static_cast<uint16_t>(size);
+
+      if(length > SIM_HW_BUF_SIZE - _tx_size)
+      {
+        length = static_cast<uint16_t>(SIM_HW_BUF_SIZE - _tx_size);
+      }
+      memcpy(&_tx_buffer[_tx_active ^ 1u][_tx_size], data, length);
+      _tx_size = static_cast<uint16_t>(_tx_size + length);
+
+      flush();
+    }
+
+    /**
+     * @brief Milliseconds since start from the HAL time base
+     */
+    unsigned long time()
+    {
+      return HAL_GetTick();
+    }
+
+    /**
+     * @brief Start the transmit DMA with the queued data once it is idle
+     */
+    void flush()
+    {
+      if((0u == _tx_size) || (DMA1_Stream6->CR & DMA_SxCR_EN))
+      {
+        return;
+      }
+
+      _tx_active ^= 1u;
+      DMA1->HIFCR         = SIM_HW_DMA_FLAGS << 16u;
+      DMA1_Stream6->M0AR  = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(_tx_buffer[_tx_active]));
+      DMA1_Stream6->NDTR  = _tx_size;
+      DMA1_Stream6->CR   |= DMA_SxCR_EN;
+      _tx_size = 0u;
+    }
+
+#ifndef BUILD_TESTS
+  protected:
+#endif
+
+    uint32_t  _baud;                              //!< Baudrate
+
+    uint8_t   _rx_buffer[SIM_HW_BUF_SIZE];        //!< Target of the receive DMA
+    uint16_t  _rx_read_pos;                       //!< Next byte to read
+
+    uint8_t   _tx_buffer[2][SIM_HW_BUF_SIZE];     //!< Transmitting and collecting buffer
+    uint8_t   _tx_active;                         //!< Buffer owned by the DMA
+    uint16_t  _tx_size;                           //!< Data in the collecting buffer
+};
+
+#endif /* ROS_SIM_SERIAL_HARDWARE_H_ */
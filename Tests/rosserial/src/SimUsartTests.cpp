@@ -0,0 +1,321 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file SimUsartTests.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Tests of the interrupt driven USART and DMA models of the simulation
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <CppUTest/TestHarness.h>
+#include <cstring>
+#include "stm32f4xx_hal.h"
+#include "sim_clock.h"
+#include "sim_dma.h"
+#include "sim_nvic.h"
+#include "sim_usart.h"
+/* -------------------------------------------------------------------------------*/
+
+extern UART_HandleTypeDef huart2;
+
+constexpr uint32_t  SIM_USART_BAUD      = 115200u;
+constexpr uint32_t  SIM_USART_RX_SIZE   = 16u;
+
+// DMA and callbacks need static storage, see sim_dma.h
+static DMA_HandleTypeDef  hdma_usart2_tx;
+static DMA_HandleTypeDef  hdma_usart2_rx;
+static uint8_t            tx_data[64];
+static uint8_t            rx_data[SIM_USART_RX_SIZE];
+
+static int  tx_complete;
+static int  rx_complete;
+static int  rx_half_complete;
+static int  uart_errors;
+static int  irq_order[4];
+static int  irq_count;
+
+extern "C"
+{
+  void USART2_IRQHandler(void)
+  {
+    HAL_UART_IRQHandler(&huart2);
+  }
+
+  void DMA1_Stream5_IRQHandler(void)
+  {
+    HAL_DMA_IRQHandler(&hdma_usart2_rx);
+  }
+
+  void DMA1_Stream6_IRQHandler(void)
+  {
+    HAL_DMA_IRQHandler(&hdma_usart2_tx);
+  }
+
+  void TIM6_DAC_IRQHandler(void)
+  {
+    irq_order[irq_count++ & 3] = TIM6_DAC_IRQn;
+  }
+
+  void TIM7_IRQHandler(void)
+  {
+    irq_order[irq_count++ & 3] = TIM7_IRQn;
+  }
+
+  void HAL_UART_TxCpltCallback(UART_HandleTypeDef*)
+  {
+    tx_complete++;
+  }
+
+  void HAL_UART_RxCpltCallback(UART_HandleTypeDef*)
+  {
+    rx_complete++;
+  }
+
+  void HAL_UART_RxHalfCpltCallback(UART_HandleTypeDef*)
+  {
+    rx_half_complete++;
+  }
+
+  void HAL_UART_ErrorCallback(UART_HandleTypeDef*)
+  {
+    uart_errors++;
+  }
+}
+
+TEST_GROUP(SimUsart)
+{
+  void setup()
+  {
+    memset(USART2, 0, sizeof(*USART2));
+    memset(DMA1, 0, sizeof(SIM_DMA[0]));
+    SIM_ClockReset();
+    SIM_NvicReset();
+    SIM_DmaReset();
+    SIM_UsartReset();
+
+    tx_complete       = 0;
+    rx_complete       = 0;
+    rx_half_complete  = 0;
+    uart_errors       = 0;
+    irq_count         = 0;
+
+    huart2.Instance           = USART2;
+    huart2.Init.BaudRate      = SIM_USART_BAUD;
+    huart2.Init.WordLength    = UART_WORDLENGTH_8B;
+    huart2.Init.StopBits      = UART_STOPBITS_1;
+    huart2.Init.Parity        = UART_PARITY_NONE;
+    huart2.Init.Mode          = UART_MODE_TX_RX;
+    huart2.Init.HwFlowCtl     = UART_HWCONTROL_NONE;
+    huart2.Init.OverSampling  = UART_OVERSAMPLING_16;
+    huart2.gState             = HAL_UART_STATE_RESET;
+    huart2.RxState            = HAL_UART_STATE_RESET;
+    CHECK(HAL_OK == HAL_UART_Init(&huart2));
+
+    initDma(hdma_usart2_tx, DMA1_Stream6, DMA_MEMORY_TO_PERIPH, DMA_NORMAL);
+    initDma(hdma_usart2_rx, DMA1_Stream5, DMA_PERIPH_TO_MEMORY, DMA_CIRCULAR);
+    __HAL_LINKDMA(&huart2, hdmatx, hdma_usart2_tx);
+    __HAL_LINKDMA(&huart2, hdmarx, hdma_usart2_rx);
+
+    HAL_NVIC_EnableIRQ(USART2_IRQn);
+    HAL_NVIC_EnableIRQ(DMA1_Stream5_IRQn);
+    HAL_NVIC_EnableIRQ(DMA1_Stream6_IRQn);
+  }
+
+  void teardown()
+  {
+    SIM_NvicReset();
+    SIM_UsartReset();
+    memset(USART2, 0, sizeof(*USART2));
+    memset(DMA1, 0, sizeof(SIM_DMA[0]));
+  }
+
+  void initDma(DMA_HandleTypeDef& hdma, DMA_Stream_TypeDef* stream, const uint32_t dir, const uint32_t mode)
+  {
+    memset(&hdma, 0, sizeof(hdma));
+    hdma.Instance                 = stream;
+    hdma.Init.Channel             = DMA_CHANNEL_4;
+    hdma.Init.Direction           = dir;
+    hdma.Init.PeriphInc           = DMA_PINC_DISABLE;
+    hdma.Init.MemInc              = DMA_MINC_ENABLE;
+    hdma.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    hdma.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+    hdma.Init.Mode                = mode;
+    hdma.Init.Priority            = DMA_PRIORITY_LOW;
+    hdma.Init.FIFOMode            = DMA_FIFOMODE_DISABLE;
+    CHECK(HAL_OK == HAL_DMA_Init(&hdma));
+  }
+
+  /**
+   * @brief Core cycles of n characters with 8N1 at SIM_USART_BAUD
+   */
+  uint64_t charCycles(const uint32_t n)
+  {
+    return static_cast<uint64_t>(USART2->BRR) * 10u * n;
+  }
+};
+
+TEST(SimUsart, DmaLayoutMatchesHal)
+{
+  // the HAL derives the flag registers from the stream address
+  LONGS_EQUAL(16u, hdma_usart2_tx.StreamIndex);
+  LONGS_EQUAL(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(&DMA1->HISR)), hdma_usart2_tx.StreamBaseAddress);
+  LONGS_EQUAL(6u, hdma_usart2_rx.StreamIndex);
+  LONGS_EQUAL(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(&DMA1->HISR)), hdma_usart2_rx.StreamBaseAddress);
+}
+
+TEST(SimUsart, TransmitIt)
+{
+  const char  msg[] = "interrupt";
+  uint8_t     sent[16];
+
+  memcpy(tx_data, msg, sizeof(msg) - 1u);
+  CHECK(HAL_OK == HAL_UART_Transmit_IT(&huart2, tx_data, sizeof(msg) - 1u));
+
+  SIM_ClockAdvance(charCycles(sizeof(msg) - 2u));
+  LONGS_EQUAL(sizeof(msg) - 2u, SIM_UsartAvailable(USART2));
+  LONGS_EQUAL(0, tx_complete);
+
+  SIM_ClockAdvance(charCycles(1u));
+  LONGS_EQUAL(1, tx_complete);
+  LONGS_EQUAL(sizeof(msg) - 1u, SIM_UsartTake(USART2, sent, sizeof(sent)));
+  MEMCMP_EQUAL(msg, sent, sizeof(msg) - 1u);
+  CHECK(HAL_UART_STATE_READY == huart2.gState);
+}
+
+TEST(SimUsart, TransmitDma)
+{
+  uint8_t sent[64];
+
+  for(uint32_t idx = 0u; idx < sizeof(tx_data); idx++)
+  {
+    tx_data[idx] = static_cast<uint8_t>(idx * 7u);
+  }
+  CHECK(HAL_OK == HAL_UART_Transmit_DMA(&huart2, tx_data, sizeof(tx_data)));
+
+  // 64 bytes at 115200 baud take 5.6 ms
+  SIM_ClockAdvanceMs(5u);
+  LONGS_EQUAL(0, tx_complete);
+  SIM_ClockAdvanceMs(1u);
+  LONGS_EQUAL(1, tx_complete);
+  CHECK(HAL_UART_STATE_READY == huart2.gState);
+  LONGS_EQUAL(0u, USART2->CR3 & USART_CR3_DMAT);
+
+  LONGS_EQUAL(sizeof(tx_data), SIM_UsartTake(USART2, sent, sizeof(sent)));
+  MEMCMP_EQUAL(tx_data, sent, sizeof(tx_data));
+}
+
+TEST(SimUsart, ReceiveIt)
+{
+  const uint8_t msg[4] = {0x11u, 0x22u, 0x33u, 0x44u};
+
+  memset(rx_data, 0, sizeof(rx_data));
+  CHECK(HAL_OK == HAL_UART_Receive_IT(&huart2, rx_data, sizeof(msg)));
+  LONGS_EQUAL(sizeof(msg), SIM_UsartInject(USART2, msg, sizeof(msg)));
+
+  SIM_ClockAdvance(charCycles(sizeof(msg)));
+  LONGS_EQUAL(1, rx_complete);
+  LONGS_EQUAL(0, uart_errors);
+  MEMCMP_EQUAL(msg, rx_data, sizeof(msg));
+  CHECK(HAL_UART_STATE_READY == huart2.RxState);
+}
+
+TEST(SimUsart, ReceiveDmaCircular)
+{
+  uint8_t msg[24];
+
+  for(uint32_t idx = 0u; idx < sizeof(msg); idx++)
+  {
+    msg[idx] = static_cast<uint8_t>(idx + 1u);
+  }
+  CHECK(HAL_OK == HAL_UART_Receive_DMA(&huart2, rx_data, SIM_USART_RX_SIZE));
+  SIM_UsartInject(USART2, msg, sizeof(msg));
+
+  SIM_ClockAdvance(charCycles(SIM_USART_RX_SIZE / 2u));
+  LONGS_EQUAL(1, rx_half_complete);
+  LONGS_EQUAL(0, rx_complete);
+
+  SIM_ClockAdvance(charCycles(sizeof(msg) - SIM_USART_RX_SIZE / 2u));
+  LONGS_EQUAL(2, rx_half_complete);
+  LONGS_EQUAL(1, rx_complete);
+  LONGS_EQUAL(0, uart_errors);
+
+  // the last 8 bytes wrapped around to the start
+  MEMCMP_EQUAL(&msg[SIM_USART_RX_SIZE], rx_data, sizeof(msg) - SIM_USART_RX_SIZE);
+  MEMCMP_EQUAL(&msg[SIM_USART_RX_SIZE / 2u], &rx_data[SIM_USART_RX_SIZE / 2u], SIM_USART_RX_SIZE / 2u);
+  LONGS_EQUAL(SIM_USART_RX_SIZE / 2u, __HAL_DMA_GET_COUNTER(&hdma_usart2_rx));
+}
+
+TEST(SimUsart, Overrun)
+{
+  const uint8_t msg[3] = {1u, 2u, 3u};
+
+  SIM_UsartInject(USART2, msg, sizeof(msg));
+  SIM_ClockAdvance(charCycles(sizeof(msg)));
+
+  CHECK(USART2->SR & USART_SR_RXNE);
+  CHECK(USART2->SR & USART_SR_ORE);
+  LONGS_EQUAL(1u, USART2->DR & 0xffu);
+}
+
+TEST(SimUsart, NvicPriorityAndMask)
+{
+  HAL_NVIC_SetPriority(TIM6_DAC_IRQn, 2u, 0u);
+  HAL_NVIC_SetPriority(TIM7_IRQn, 1u, 0u);
+  HAL_NVIC_EnableIRQ(TIM6_DAC_IRQn);
+  HAL_NVIC_EnableIRQ(TIM7_IRQn);
+
+  __disable_irq();
+  HAL_NVIC_SetPendingIRQ(TIM6_DAC_IRQn);
+  HAL_NVIC_SetPendingIRQ(TIM7_IRQn);
+  LONGS_EQUAL(0u, SIM_NvicDispatch());
+  LONGS_EQUAL(1u, HAL_NVIC_GetPendingIRQ(TIM7_IRQn));
+
+  __enable_irq();
+  LONGS_EQUAL(2u, SIM_NvicDispatch());
+  LONGS_EQUAL(TIM7_IRQn, irq_order[0]);
+  LONGS_EQUAL(TIM6_DAC_IRQn, irq_order[1]);
+
+  // disabled interrupts stay pending
+  HAL_NVIC_DisableIRQ(TIM7_IRQn);
+  HAL_NVIC_SetPendingIRQ(TIM7_IRQn);
+  LONGS_EQUAL(0u, SIM_NvicDispatch());
+  HAL_NVIC_EnableIRQ(TIM7_IRQn);
+  LONGS_EQUAL(1u, SIM_NvicDispatch());
+  LONGS_EQUAL(TIM7_IRQn, irq_order[2]);
+}
@@ -0,0 +1,216 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file StaticDispatchTests.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Tests for statically bound publishers and subscribers
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <CppUTest/TestHarness.h>
+#include <cstring>
+#include "ros/node_handle.h"
+#include "std_msgs/Int32.h"
+#include "TestHardware.h"
+/* -------------------------------------------------------------------------------*/
+
+typedef ros::NodeHandle_<TestHardware, 5, 5, 256, 256> TestNodeHandle;
+
+static int32_t  received_value = 0;
+static uint32_t received_count = 0u;
+
+static void int32Callback(const std_msgs::Int32& msg)
+{
+  received_value = msg.data;
+  received_count++;
+}
+
+/**
+ * @brief Subscriber which replaces the callback of its base
+ */
+class CountingSubscriber : public ros::Subscriber<std_msgs::Int32>
+{
+  public:
+
+    CountingSubscriber() :
+    ros::Subscriber<std_msgs::Int32>("counting", &int32Callback),
+    _frames(0u)
+    {
+
+    }
+
+    virtual void callback(unsigned char* data, size_t size)
+    {
+      _frames++;
+      ros::Subscriber<std_msgs::Int32>::callback(data, size);
+    }
+
+    uint32_t _frames;
+};
+
+TEST_GROUP(StaticDispatch)
+{
+  void setup()
+  {
+    received_value = 0;
+    received_count = 0u;
+    _nh.initNode();
+  }
+
+  void connect()
+  {
+    _nh.getHardware()->injectFrame(rosserial_msgs::TopicInfo::ID_PUBLISHER, nullptr, 0u);
+    _nh.spinOnce();
+    _nh.getHardware()->clearTx();
+    CHECK(_nh.connected());
+  }
+
+  void injectInt32(const uint16_t topic, const int32_t value)
+  {
+    std_msgs::Int32 msg;
+    uint8_t         buffer[8];
+
+    msg.data = value;
+    const int size = msg.serialize(buffer);
+    _nh.getHardware()->injectFrame(topic, buffer, size);
+  }
+
+  TestNodeHandle _nh;
+};
+
+TEST(StaticDispatch, StaticPublisherMatchesVirtual)
+{
+  std_msgs::Int32 msg;
+  ros::Publisher pub("virtual", &msg);
+  ros::StaticPublisher<std_msgs::Int32, TestNodeHandle> static_pub("static", &msg);
+
+  _nh.advertise(pub);
+  _nh.advertise(static_pub);
+  connect();
+
+  msg.data = -123456;
+
+  // Publish via vtable
+  pub.publish(&msg);
+  const uint32_t size = _nh.getHardware()->_tx_size;
+  uint8_t virtual_frame[64];
+  memcpy(virtual_frame, _nh.getHardware()->_tx_buffer, size);
+  _nh.getHardware()->clearTx();
+
+  // Publish statically bound
+  static_pub.publish(msg);
+  CHECK(size == _nh.getHardware()->_tx_size);
+
+  // Frames only differ in topic id and checksum
+  virtual_frame[5] = static_cast<uint8_t>(static_pub.id_ & 0xffu);
+  virtual_frame[size - 1u] -= 1u;
+  MEMCMP_EQUAL(virtual_frame, _nh.getHardware()->_tx_buffer, size);
+}
+
+TEST(StaticDispatch, StaticPublisherNotConnected)
+{
+  std_msgs::Int32 msg;
+  ros::StaticPublisher<std_msgs::Int32, TestNodeHandle> static_pub("static", &msg);
+
+  _nh.advertise(static_pub);
+
+  CHECK(0 == static_pub.publish(msg));
+  CHECK(0u == _nh.getHardware()->_tx_size);
+}
+
+TEST(StaticDispatch, StaticSubscriberCallback)
+{
+  ros::StaticSubscriber<std_msgs::Int32, &int32Callback> sub("static");
+
+  CHECK(_nh.subscribe(sub));
+  connect();
+
+  injectInt32(sub.id_, 4711);
+  _nh.spinOnce();
+
+  CHECK(1u == received_count);
+  CHECK(4711 == received_value);
+}
+
+TEST(StaticDispatch, SubscriberCallback)
+{
+  ros::Subscriber<std_msgs::Int32> sub("virtual", &int32Callback);
+  ros::StaticSubscriber<std_msgs::Int32, &int32Callback> static_sub("static");
+
+  CHECK(_nh.subscribe(sub));
+  CHECK(_nh.subscribe(static_sub));
+  connect();
+
+  injectInt32(sub.id_, -1);
+  injectInt32(static_sub.id_, 2);
+  _nh.spinOnce();
+
+  CHECK(2u == received_count);
+  CHECK(2 == received_value);
+}
+
+TEST(StaticDispatch, OverrideCalledThroughBase)
+{
+  CountingSubscriber                  sub;
+  ros::Subscriber<std_msgs::Int32>&   base = sub;
+
+  CHECK(_nh.subscribe(base));
+  connect();
+
+  injectInt32(sub.id_, 7);
+  _nh.spinOnce();
+
+  CHECK(1u == sub._frames);
+  CHECK(1u == received_count);
+}
+
+TEST(StaticDispatch, SubscribeThroughAbstractBase)
+{
+  ros::StaticSubscriber<std_msgs::Int32, &int32Callback>  sub("static");
+  ros::Subscriber_&                                       base = sub;
+
+  CHECK(_nh.subscribe(base));
+  connect();
+
+  injectInt32(sub.id_, 8);
+  _nh.spinOnce();
+
+  CHECK(1u == received_count);
+  CHECK(8 == received_value);
+}
@@ -0,0 +1,205 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file TestHardware.h
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Host hardware stand-in for NodeHandle_ tests
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+#ifndef ROS_TEST_HARDWARE_H_
+#define ROS_TEST_HARDWARE_H_
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdint.h>
+#include <string.h>
+/* -------------------------------------------------------------------------------*/
+
+/* Test Configuration ------------------------------------------------------------*/
+constexpr uint16_t  TEST_HW_BUF_SIZE  = 4096u; //!< Size of tx/rx buffer
+constexpr int       TEST_HW_ANY_TOPIC = -1;    //!< Topic id matching every frame
+/* -------------------------------------------------------------------------------*/
+
+/**
+ * @brief Hardware for NodeHandle_ which reads from and writes to plain
+ *        buffers, with a manually advanced millisecond clock
+ */
+class TestHardware
+{
+  public:
+
+    TestHardware(void) :
+    _rx_buffer(),
+    _rx_read_pos(0u),
+    _rx_size(0u),
+    _tx_buffer(),
+    _tx_size(0u),
+    _tx_limit(TEST_HW_BUF_SIZE),
+    _time(0u)
+    {
+
+    }
+
+    void init()
+    {
+      _rx_read_pos  = 0u;
+      _rx_size      = 0u;
+      _tx_size      = 0u;
+    }
+
+    int read()
+    {
+      if(_rx_read_pos >= _rx_size)
+      {
+        return -1;
+      }
+
+      return _rx_buffer[_rx_read_pos++];
+    }
+
+    void write(uint8_t* data, int length)
+    {
+      if((_tx_size + length) <= TEST_HW_BUF_SIZE)
+      {
+        memcpy(&_tx_buffer[_tx_size], data, length);
+        _tx_size += length;
+      }
+    }
+
+    /**
+     * @brief Bytes write() takes right now, _tx_limit lets tests run out of
+     *        space like a tx ring which is not drained
+     */
+    int txSpace()
+    {
+      return static_cast<int>(_tx_limit) - static_cast<int>(_tx_size);
+    }
+
+    unsigned long time()
+    {
+      return _time;
+    }
+
+    /**
+     * @brief Append raw bytes to the receive stream
+     */
+    void inject(const uint8_t* data, const uint32_t size)
+    {
+      for(uint32_t idx = 0u; (idx < size) && (_rx_size < TEST_HW_BUF_SIZE); idx++)
+      {
+        _rx_buffer[_rx_size++] = data[idx];
+      }
+    }
+
+    /**
+     * @brief Append a complete rosserial frame to the receive stream
+     * 
+     * @param topic   Topic id of the frame
+     * @param payload Serialized message
+     * @param size    Size of serialized message
+     */
+    void injectFrame(const uint16_t topic, const uint8_t* payload, const uint16_t size)
+    {
+      const uint8_t header[7] = {
+        0xffu, 0xfeu,
+        static_cast<uint8_t>(size & 0xffu), static_cast<uint8_t>(size >> 8u),
+        static_cast<uint8_t>(255u - (((size & 0xffu) + (size >> 8u)) % 256u)),
+        static_cast<uint8_t>(topic & 0xffu), static_cast<uint8_t>(topic >> 8u)
+      };
+
+      uint32_t checksum = header[5] + header[6];
+      for(uint16_t idx = 0u; idx < size; idx++)
+      {
+        checksum += payload[idx];
+      }
+      const uint8_t trailer = static_cast<uint8_t>(255u - (checksum % 256u));
+
+      inject(header, sizeof(header));
+      inject(payload, size);
+      inject(&trailer, 1u);
+    }
+
+    /**
+     * @brief Walk the frames written so far
+     *
+     * @param topic Topic id of the frames to visit, TEST_HW_ANY_TOPIC for all
+     * @param func  Called with payload and payload size of every such frame
+     * @return Number of frames visited
+     */
+    template<typename FuncT>
+    uint32_t forEachFrame(const int topic, FuncT func)
+    {
+      uint32_t pos   = 0u;
+      uint32_t count = 0u;
+
+      while((pos + 8u) <= _tx_size)
+      {
+        const uint32_t size = _tx_buffer[pos + 2u] | (_tx_buffer[pos + 3u] << 8u);
+        const int      id   = _tx_buffer[pos + 5u] | (_tx_buffer[pos + 6u] << 8u);
+
+        if((topic == TEST_HW_ANY_TOPIC) || (id == topic))
+        {
+          func(&_tx_buffer[pos + 7u], size);
+          count++;
+        }
+        pos += size + 8u;
+      }
+
+      return count;
+    }
+
+    /**
+     * @brief Discard everything written so far
+     */
+    void clearTx()
+    {
+      _tx_size = 0u;
+    }
+
+    uint8_t   _rx_buffer[TEST_HW_BUF_SIZE];  //!< Data handed out by read()
+    uint32_t  _rx_read_pos;                  //!< Current read position
+    uint32_t  _rx_size;                      //!< Amount of data in rx buffer
+
+    uint8_t   _tx_buffer[TEST_HW_BUF_SIZE];  //!< Data passed to write()
+    uint32_t  _tx_size;                      //!< Amount of data in tx buffer
+    uint32_t  _tx_limit;                     //!< Size reported full by txSpace()
+
+    unsigned long _time;                     //!< Current time in ms
+};
+
+#endif /* ROS_TEST_HARDWARE_H_ */
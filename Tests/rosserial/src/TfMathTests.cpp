@@ -0,0 +1,196 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file TfMathTests.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Tests of the single precision tf math
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <CppUTest/TestHarness.h>
+#include <cmath>
+#include "tf/tf.h"
+#include "tf/tf_math.h"
+/* -------------------------------------------------------------------------------*/
+
+TEST_GROUP(TfMath)
+{
+  static geometry_msgs::Vector3 vector(const float x, const float y, const float z)
+  {
+    geometry_msgs::Vector3 v;
+    v.x = x;
+    v.y = y;
+    v.z = z;
+    return v;
+  }
+};
+
+TEST(TfMath, SinCosAccuracy)
+{
+  double max_error = 0.0;
+
+  for(float angle = -20.0f; angle <= 20.0f; angle += 0.001f)
+  {
+    float s, c;
+    tf::fastSinCos(angle, s, c);
+    max_error = fmax(max_error, fabs(s - sin(static_cast<double>(angle))));
+    max_error = fmax(max_error, fabs(c - cos(static_cast<double>(angle))));
+  }
+
+  CHECK(max_error < 2e-7);
+}
+
+TEST(TfMath, Atan2Accuracy)
+{
+  double max_error = 0.0;
+
+  for(float angle = -3.14f; angle <= 3.14f; angle += 0.001f)
+  {
+    for(const float radius : {0.01f, 1.0f, 100.0f})
+    {
+      const float y = radius * static_cast<float>(sin(angle));
+      const float x = radius * static_cast<float>(cos(angle));
+      max_error = fmax(max_error, fabs(tf::fastAtan2(y, x) - atan2(static_cast<double>(y), static_cast<double>(x))));
+    }
+  }
+
+  CHECK(max_error < 5e-7);
+  DOUBLES_EQUAL(M_PI_2, tf::fastAtan2(1.0f, 0.0f), 1e-7);
+  DOUBLES_EQUAL(-M_PI_2, tf::fastAtan2(-1.0f, 0.0f), 1e-7);
+  DOUBLES_EQUAL(0.0, tf::fastAtan2(0.0f, 0.0f), 0.0);
+}
+
+TEST(TfMath, RPYRoundTrip)
+{
+  for(float roll = -3.0f; roll <= 3.0f; roll += 0.5f)
+  {
+    for(float pitch = -1.5f; pitch <= 1.5f; pitch += 0.25f)
+    {
+      for(float yaw = -3.0f; yaw <= 3.0f; yaw += 0.5f)
+      {
+        float r, p, y;
+        tf::getRPY(tf::quaternionFromRPY(roll, pitch, yaw), r, p, y);
+        DOUBLES_EQUAL(roll, r, 1e-3);
+        DOUBLES_EQUAL(pitch, p, 1e-3);
+        DOUBLES_EQUAL(yaw, y, 1e-3);
+      }
+    }
+  }
+}
+
+TEST(TfMath, YawQuaternion)
+{
+  const geometry_msgs::Quaternion q = tf::createQuaternionFromYaw(1.25);
+
+  DOUBLES_EQUAL(sin(0.625), q.z, 1e-7);
+  DOUBLES_EQUAL(cos(0.625), q.w, 1e-7);
+  DOUBLES_EQUAL(1.25, tf::getYaw(q), 1e-6);
+}
+
+TEST(TfMath, RotateMatchesMatrix)
+{
+  const geometry_msgs::Quaternion q = tf::quaternionFromRPY(0.3f, -0.7f, 2.1f);
+  const geometry_msgs::Vector3    v = vector(1.0f, -2.0f, 0.5f);
+  float                           m[9];
+
+  tf::toMatrix(q, m);
+  const geometry_msgs::Vector3 r = tf::rotate(q, v);
+
+  DOUBLES_EQUAL(m[0] * v.x + m[1] * v.y + m[2] * v.z, r.x, 1e-5);
+  DOUBLES_EQUAL(m[3] * v.x + m[4] * v.y + m[5] * v.z, r.y, 1e-5);
+  DOUBLES_EQUAL(m[6] * v.x + m[7] * v.y + m[8] * v.z, r.z, 1e-5);
+
+  // Matrix back to quaternion, possibly with flipped sign
+  const geometry_msgs::Quaternion back = tf::fromMatrix(m);
+  const float sign = (back.w * q.w < 0.0f) ? -1.0f : 1.0f;
+  DOUBLES_EQUAL(q.x, sign * back.x, 1e-6);
+  DOUBLES_EQUAL(q.y, sign * back.y, 1e-6);
+  DOUBLES_EQUAL(q.z, sign * back.z, 1e-6);
+  DOUBLES_EQUAL(q.w, sign * back.w, 1e-6);
+}
+
+TEST(TfMath, FromMatrixAllBranches)
+{
+  // Rotations by pi about x, y and z have a negative trace
+  const float angles[][3] = {{3.14159f, 0.0f, 0.0f}, {0.0f, 1.5707f, 3.14159f}, {0.0f, 0.0f, 3.14159f}, {0.1f, 0.2f, 0.3f}};
+
+  for(const auto& rpy : angles)
+  {
+    const geometry_msgs::Quaternion q = tf::quaternionFromRPY(rpy[0], rpy[1], rpy[2]);
+    float m[9];
+    tf::toMatrix(q, m);
+
+    const geometry_msgs::Quaternion back = tf::fromMatrix(m);
+    const float dot = q.x * back.x + q.y * back.y + q.z * back.z + q.w * back.w;
+    DOUBLES_EQUAL(1.0, fabs(dot), 1e-5);
+  }
+}
+
+TEST(TfMath, ComposeInverse)
+{
+  geometry_msgs::Transform t;
+  t.translation = vector(1.0f, 2.0f, 3.0f);
+  t.rotation    = tf::quaternionFromRPY(0.1f, 0.2f, 0.3f);
+
+  const geometry_msgs::Transform identity = tf::compose(t, tf::inverse(t));
+  DOUBLES_EQUAL(0.0, identity.translation.x, 1e-6);
+  DOUBLES_EQUAL(0.0, identity.translation.y, 1e-6);
+  DOUBLES_EQUAL(0.0, identity.translation.z, 1e-6);
+  DOUBLES_EQUAL(1.0, fabs(identity.rotation.w), 1e-6);
+
+  // Point through t and back
+  const geometry_msgs::Vector3 p    = vector(-0.5f, 4.0f, 0.25f);
+  const geometry_msgs::Vector3 back = tf::transformPoint(tf::inverse(t), tf::transformPoint(t, p));
+  DOUBLES_EQUAL(p.x, back.x, 1e-5);
+  DOUBLES_EQUAL(p.y, back.y, 1e-5);
+  DOUBLES_EQUAL(p.z, back.z, 1e-5);
+}
+
+TEST(TfMath, Slerp)
+{
+  const geometry_msgs::Quaternion a = tf::quaternionFromYaw(0.0f);
+  const geometry_msgs::Quaternion b = tf::quaternionFromYaw(2.0f);
+
+  DOUBLES_EQUAL(0.5, tf::getYaw(tf::slerp(a, b, 0.25f)), 1e-6);
+  DOUBLES_EQUAL(2.0, tf::getYaw(tf::slerp(a, b, 1.0f)), 1e-6);
+
+  // Nearly equal rotations are interpolated linearly
+  const geometry_msgs::Quaternion c = tf::quaternionFromYaw(0.01f);
+  DOUBLES_EQUAL(0.005, tf::getYaw(tf::slerp(a, c, 0.5f)), 1e-6);
+}
@@ -0,0 +1,265 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file TopicStatisticsTests.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Tests of the per topic link statistics
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <CppUTest/TestHarness.h>
+#include <cstring>
+#include "ros/node_handle.h"
+#include "std_msgs/Int32.h"
+#include "francor/topic_statistics.h"
+#include "TestHardware.h"
+/* -------------------------------------------------------------------------------*/
+
+typedef ros::NodeHandle_<TestHardware, 5, 5, 256, 256> TestNodeHandle;
+
+// Subscriber and publisher ids in order of registration
+constexpr int STAT_SUB_ID   = 100;
+constexpr int STAT_PUB_ID   = 100 + 5;
+constexpr int STAT_STATS_ID = 100 + 6;
+
+// Frame of an Int32: 7 bytes header, 4 bytes payload, 1 byte checksum
+constexpr uint32_t INT32_FRAME = 12u;
+
+static void int32Callback(const std_msgs::Int32&)
+{
+}
+
+TEST_GROUP(TopicStatistics)
+{
+  void setup()
+  {
+    _nh.initNode();
+    _nh.subscribe(_sub);
+    _nh.advertise(_pub);
+    _stats.init(_nh);
+  }
+
+  void connect()
+  {
+    _nh.getHardware()->injectFrame(rosserial_msgs::TopicInfo::ID_PUBLISHER, nullptr, 0u);
+    _nh.spinOnce();
+    _nh.getHardware()->clearTx();
+    CHECK(_nh.connected());
+  }
+
+  void injectInt32(const int32_t value)
+  {
+    std_msgs::Int32 msg;
+    uint8_t         buffer[8];
+
+    msg.data = value;
+    _nh.getHardware()->injectFrame(STAT_SUB_ID, buffer, msg.serialize(buffer));
+    _nh.spinOnce();
+  }
+
+  void advance(const unsigned long ms)
+  {
+    _nh.getHardware()->_time += ms;
+  }
+
+  /**
+   * @brief Parse the statistics written to the test hardware, returns their
+   *        number and deserializes the one of topic into msg
+   */
+  uint32_t parseStatistics(const char* topic, rosgraph_msgs::TopicStatistics& msg)
+  {
+    const uint32_t count = _nh.getHardware()->forEachFrame(STAT_STATS_ID, [&](uint8_t* payload, const uint32_t size) {
+      // strings are decoded in place, keep the one of topic in _rx
+      rosgraph_msgs::TopicStatistics parsed;
+      memcpy(_scratch, payload, size);
+      CHECK(static_cast<int>(size) == parsed.deserialize(_scratch, size));
+      if(strcmp(parsed.topic, topic) == 0)
+      {
+        memcpy(_rx, payload, size);
+        CHECK(static_cast<int>(size) == msg.deserialize(_rx, size));
+      }
+    });
+
+    _nh.getHardware()->clearTx();
+    return count;
+  }
+
+  TestNodeHandle                            _nh;
+  std_msgs::Int32                           _msg;
+  ros::Subscriber<std_msgs::Int32>          _sub{"cmd", int32Callback};
+  ros::Publisher                            _pub{"state", &_msg};
+  francor::TopicStatistics<TestNodeHandle>  _stats{"device", 1000u};
+  unsigned char                             _rx[256];
+  unsigned char                             _scratch[256];
+};
+
+TEST(TopicStatistics, CountsPublishedFrames)
+{
+  // not connected yet
+  _pub.publish(&_msg);
+  LONGS_EQUAL(1u, _nh.getCounters(STAT_PUB_ID)->drops);
+  LONGS_EQUAL(0u, _nh.getCounters(STAT_PUB_ID)->msgs);
+
+  connect();
+  const unsigned long periods[3] = {10u, 30u, 20u};
+  _pub.publish(&_msg);
+  for(const unsigned long period : periods)
+  {
+    advance(period);
+    _pub.publish(&_msg);
+  }
+
+  const ros::TopicCounters* c = _nh.getCounters(STAT_PUB_ID);
+  LONGS_EQUAL(4u, c->msgs);
+  LONGS_EQUAL(4u * INT32_FRAME, c->bytes);
+  LONGS_EQUAL(3u, c->periods);
+  LONGS_EQUAL(60u, c->period_sum_ms);
+  LONGS_EQUAL(30u, c->period_max_ms);
+  LONGS_EQUAL(1400u, c->period_sq_sum);
+
+  // streamed frames count as well
+  uint8_t payload[4] = {};
+  CHECK(_nh.beginFrame(STAT_PUB_ID, 4));
+  CHECK(_nh.writeFrame(payload, 4));
+  CHECK(_nh.endFrame());
+  LONGS_EQUAL(5u, c->msgs);
+
+  CHECK(_nh.getCounters(99) == nullptr);
+  CHECK(_nh.getCounters(100 + 10) == nullptr);
+  STRCMP_EQUAL("state", _nh.getTopicName(STAT_PUB_ID));
+  STRCMP_EQUAL("cmd", _nh.getTopicName(STAT_SUB_ID));
+  CHECK(_nh.getTopicName(101) == nullptr);
+}
+
+TEST(TopicStatistics, CountsReceivedFrames)
+{
+  connect();
+  injectInt32(1);
+  advance(5u);
+  injectInt32(2);
+
+  const ros::TopicCounters* c = _nh.getCounters(STAT_SUB_ID);
+  LONGS_EQUAL(2u, c->msgs);
+  LONGS_EQUAL(2u * INT32_FRAME, c->bytes);
+  LONGS_EQUAL(5u, c->period_sum_ms);
+
+  // wrong checksum
+  std_msgs::Int32 msg;
+  uint8_t         buffer[8];
+  const int       size = msg.serialize(buffer);
+  _nh.getHardware()->injectFrame(STAT_SUB_ID, buffer, size);
+  _nh.getHardware()->_rx_buffer[_nh.getHardware()->_rx_size - 1u] ^= 0x01u;
+  _nh.spinOnce();
+  LONGS_EQUAL(1u, c->checksum_errors);
+  LONGS_EQUAL(2u, c->msgs);
+
+  // frame cut off after the topic id
+  const uint8_t partial[9] = {0xffu, 0xfeu, 4u, 0u, 251u, STAT_SUB_ID, 0u, 1u, 2u};
+  _nh.getHardware()->inject(partial, sizeof(partial));
+  _nh.spinOnce();
+  advance(ros::SERIAL_MSG_TIMEOUT + 1u);
+  _nh.spinOnce();
+  LONGS_EQUAL(1u, c->drops);
+}
+
+TEST(TopicStatistics, PublishesPerWindow)
+{
+  rosgraph_msgs::TopicStatistics msg;
+
+  connect();
+  advance(500u);
+  _pub.publish(&_msg);
+  advance(100u);
+  _pub.publish(&_msg);
+  injectInt32(1);
+
+  LONGS_EQUAL(0, _stats.update());
+  advance(400u);
+  _nh.getHardware()->clearTx();
+
+  // state and cmd, the statistics topic itself is not reported
+  LONGS_EQUAL(2, _stats.update());
+  LONGS_EQUAL(2u, parseStatistics("state", msg));
+  STRCMP_EQUAL("device", msg.node_pub);
+  STRCMP_EQUAL("", msg.node_sub);
+  LONGS_EQUAL(2, msg.delivered_msgs);
+  LONGS_EQUAL(0, msg.dropped_msgs);
+  LONGS_EQUAL(2 * INT32_FRAME, msg.traffic);
+  DOUBLES_EQUAL(0.1, msg.period_mean.toSec(), 1e-6);
+  DOUBLES_EQUAL(0.0, msg.period_stddev.toSec(), 1e-6);
+  DOUBLES_EQUAL(0.1, msg.period_max.toSec(), 1e-6);
+  DOUBLES_EQUAL(1.0, msg.window_stop.toSec() - msg.window_start.toSec(), 1e-3);
+
+  // counters start over with the next window
+  LONGS_EQUAL(0u, _nh.getCounters(STAT_PUB_ID)->msgs);
+  advance(1000u);
+  LONGS_EQUAL(2, _stats.update());
+  parseStatistics("cmd", msg);
+  STRCMP_EQUAL("", msg.node_pub);
+  STRCMP_EQUAL("device", msg.node_sub);
+  LONGS_EQUAL(0, msg.delivered_msgs);
+}
+
+TEST(TopicStatistics, LimitedMessagesPerUpdate)
+{
+  rosgraph_msgs::TopicStatistics msg;
+
+  connect();
+  advance(1000u);
+  _nh.getHardware()->clearTx();
+
+  // cmd has the lower id and goes first
+  LONGS_EQUAL(1, _stats.update(1));
+  LONGS_EQUAL(1u, parseStatistics("cmd", msg));
+  STRCMP_EQUAL("cmd", msg.topic);
+
+  // frames until its turn count for state
+  _pub.publish(&_msg);
+  LONGS_EQUAL(1, _stats.update(1));
+  LONGS_EQUAL(1u, parseStatistics("state", msg));
+  STRCMP_EQUAL("state", msg.topic);
+  LONGS_EQUAL(1, msg.delivered_msgs);
+
+  // the window is done, the next one ends 1000 ms after the first update
+  LONGS_EQUAL(0, _stats.update(1));
+  advance(999u);
+  LONGS_EQUAL(0, _stats.update(1));
+  advance(1u);
+  LONGS_EQUAL(1, _stats.update(1));
+}
@@ -0,0 +1,242 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file TraceTests.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Tests of the node handle event trace
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <CppUTest/TestHarness.h>
+#include <cstring>
+#include "ros/node_handle.h"
+#include "std_msgs/Int32.h"
+#include "francor/trace_publisher.h"
+#include "STMHardware.h"
+#include "TestHardware.h"
+/* -------------------------------------------------------------------------------*/
+
+typedef ros::TraceRing<ros::STMHardware, 32> TestTrace;
+typedef ros::NodeHandle_<TestHardware, 2, 2, 256, 256, ros::NullProfiler, TestTrace> TracedNodeHandle;
+typedef francor::TracePublisher<TracedNodeHandle, TestTrace, 4> TestTracePublisher;
+
+// Subscriber and publisher ids in order of registration
+constexpr int TRACE_SUB_ID      = 100;
+constexpr int TRACE_PUB_ID      = 100 + 2;
+constexpr int TRACE_DRAIN_ID    = 100 + 3;
+
+static void int32Callback(const std_msgs::Int32&)
+{
+}
+
+TEST_GROUP(Trace)
+{
+  void setup()
+  {
+    DWT->CYCCNT = 0u;
+    _nh.initNode();
+    _nh.subscribe(_sub);
+    _nh.advertise(_pub);
+    _drain.init(_nh);
+    _nh.getHardware()->injectFrame(rosserial_msgs::TopicInfo::ID_PUBLISHER, nullptr, 0u);
+    _nh.spinOnce();
+    _nh.getHardware()->clearTx();
+    _nh.getTracer()->clear();
+  }
+
+  void injectInt32(const uint16_t topic)
+  {
+    std_msgs::Int32 msg;
+    uint8_t         buffer[8];
+
+    _nh.getHardware()->injectFrame(topic, buffer, msg.serialize(buffer));
+  }
+
+  /**
+   * @brief Read the trace and compare event and value of every entry
+   */
+  void checkEvents(const uint8_t (*expected)[2], const int count)
+  {
+    ros::TraceEntry entries[32];
+    LONGS_EQUAL(count, _nh.getTracer()->read(entries, 32));
+    for(int idx = 0; idx < count; idx++)
+    {
+      LONGS_EQUAL(expected[idx][0], entries[idx].event);
+      LONGS_EQUAL(expected[idx][1], entries[idx].value);
+    }
+  }
+
+  TracedNodeHandle                  _nh;
+  std_msgs::Int32                   _msg;
+  ros::Subscriber<std_msgs::Int32>  _sub{"cmd", int32Callback};
+  ros::Publisher                    _pub{"state", &_msg};
+  TestTracePublisher                _drain{"rosserial/trace", *_nh.getTracer()};
+};
+
+TEST(Trace, RingKeepsNewestEntries)
+{
+  TestTrace       ring;
+  ros::TraceEntry entries[32];
+
+  for(uint32_t idx = 0u; idx < 40u; idx++)
+  {
+    DWT->CYCCNT = idx;
+    ring.event(ros::TRACE_FRAME_END, 0u, static_cast<uint16_t>(idx));
+  }
+
+  LONGS_EQUAL(32, ring.available());
+  LONGS_EQUAL(8u, ring.getLost());
+  LONGS_EQUAL(2, ring.read(entries, 2));
+  LONGS_EQUAL(8u, entries[0].stamp);
+  LONGS_EQUAL(9u, entries[1].arg);
+
+  ring.setEnabled(false);
+  ring.event(ros::TRACE_CONNECT);
+  LONGS_EQUAL(30, ring.read(entries, 32));
+  LONGS_EQUAL(39u, entries[29].arg);
+  LONGS_EQUAL(0, ring.available());
+}
+
+TEST(Trace, RecordsReceivedFrame)
+{
+  injectInt32(TRACE_SUB_ID);
+  _nh.spinOnce();
+
+  const uint8_t expected[][2] = {
+    {ros::TRACE_FRAME_BEGIN, 0u},
+    {ros::TRACE_MODE, ros::MODE_PROTOCOL_VER},
+    {ros::TRACE_MODE, ros::MODE_SIZE_L},
+    {ros::TRACE_MODE, ros::MODE_SIZE_H},
+    {ros::TRACE_MODE, ros::MODE_SIZE_CHECKSUM},
+    {ros::TRACE_MODE, ros::MODE_TOPIC_L},
+    {ros::TRACE_MODE, ros::MODE_TOPIC_H},
+    {ros::TRACE_MODE, ros::MODE_MESSAGE},
+    {ros::TRACE_MODE, ros::MODE_MSG_CHECKSUM},
+    {ros::TRACE_MODE, ros::MODE_FIRST_FF},
+    {ros::TRACE_FRAME_END, 0u},
+    {ros::TRACE_CALLBACK_BEGIN, 0u},
+    {ros::TRACE_CALLBACK_END, 0u},
+  };
+  checkEvents(expected, sizeof(expected) / sizeof(expected[0]));
+}
+
+TEST(Trace, RecordsErrors)
+{
+  // wrong message checksum
+  injectInt32(TRACE_SUB_ID);
+  _nh.getHardware()->_rx_buffer[_nh.getHardware()->_rx_size - 1u] ^= 0x01u;
+  // length larger than the input buffer
+  const uint8_t oversize[5] = {0xffu, 0xfeu, 0x00u, 0x02u, 0xfdu};
+  _nh.getHardware()->inject(oversize, sizeof(oversize));
+  _nh.spinOnce();
+
+  ros::TraceEntry entries[32];
+  const int count = _nh.getTracer()->read(entries, 32);
+  int checksum_errors = 0;
+  int resyncs = 0;
+  for(int idx = 0; idx < count; idx++)
+  {
+    if(entries[idx].event == ros::TRACE_CHECKSUM_ERROR)
+    {
+      LONGS_EQUAL(1u, entries[idx].value);
+      LONGS_EQUAL(TRACE_SUB_ID, entries[idx].arg);
+      checksum_errors++;
+    }
+    if(entries[idx].event == ros::TRACE_RESYNC)
+    {
+      LONGS_EQUAL(ros::TRACE_RESYNC_LENGTH, entries[idx].value);
+      resyncs++;
+    }
+    CHECK(entries[idx].event != ros::TRACE_CALLBACK_BEGIN);
+  }
+  LONGS_EQUAL(1, checksum_errors);
+  LONGS_EQUAL(1, resyncs);
+
+  // host stops the link
+  _nh.getHardware()->injectFrame(rosserial_msgs::TopicInfo::ID_TX_STOP, nullptr, 0u);
+  _nh.spinOnce();
+  LONGS_EQUAL(11, _nh.getTracer()->read(entries, 32));
+  LONGS_EQUAL(ros::TRACE_DISCONNECT, entries[10].event);
+  LONGS_EQUAL(ros::TRACE_DISCONNECT_HOST, entries[10].value);
+}
+
+TEST(Trace, RecordsPublish)
+{
+  DWT->CYCCNT = 1000u;
+  _pub.publish(&_msg);
+
+  ros::TraceEntry entries[2];
+  LONGS_EQUAL(2, _nh.getTracer()->read(entries, 2));
+  LONGS_EQUAL(ros::TRACE_PUBLISH_BEGIN, entries[0].event);
+  LONGS_EQUAL(TRACE_PUB_ID, entries[0].arg);
+  LONGS_EQUAL(1000u, entries[0].stamp);
+  LONGS_EQUAL(ros::TRACE_PUBLISH_END, entries[1].event);
+  LONGS_EQUAL(1u, entries[1].value);
+  LONGS_EQUAL(12u, entries[1].arg);
+}
+
+TEST(Trace, PublisherDrainsRing)
+{
+  DWT->CYCCNT = 0x01020304u;
+  _pub.publish(&_msg);
+  _pub.publish(&_msg);
+  _pub.publish(&_msg);
+  _nh.getHardware()->clearTx();
+
+  LONGS_EQUAL(4, _drain.update());
+  LONGS_EQUAL(2, _drain.update());
+  LONGS_EQUAL(0, _drain.update());
+
+  // own publishes are not traced
+  LONGS_EQUAL(0, _nh.getTracer()->available());
+
+  // first drained message: 4 entries
+  TestHardware*             hw = _nh.getHardware();
+  std_msgs::UInt8MultiArray msg;
+  unsigned char             rx[128];
+  const uint32_t            size = hw->_tx_buffer[2] | (hw->_tx_buffer[3] << 8u);
+  LONGS_EQUAL(TRACE_DRAIN_ID, hw->_tx_buffer[5]);
+  memcpy(rx, &hw->_tx_buffer[7], size);
+  CHECK(static_cast<int>(size) == msg.deserialize(rx, size));
+  LONGS_EQUAL(32u, msg.data_length);
+  LONGS_EQUAL(0u, msg.layout.data_offset);
+
+  const uint8_t first[8] = {0x04u, 0x03u, 0x02u, 0x01u, TRACE_PUB_ID, 0u, ros::TRACE_PUBLISH_BEGIN, 0u};
+  MEMCMP_EQUAL(first, msg.data, sizeof(first));
+}
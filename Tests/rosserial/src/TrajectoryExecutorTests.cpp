@@ -0,0 +1,304 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file TrajectoryExecutorTests.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Tests of the joint trajectory executor
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <CppUTest/TestHarness.h>
+#include <cstring>
+#include "ros/node_handle.h"
+#include "francor/trajectory_executor.h"
+#include "TestHardware.h"
+/* -------------------------------------------------------------------------------*/
+
+typedef ros::NodeHandle_<TestHardware, 5, 5, 512, 256> TestNodeHandle;
+typedef francor::TrajectoryExecutor<TestNodeHandle, 2, 4> TestExecutor;
+
+// The executor is the first subscriber, its state publisher the first publisher
+constexpr int TRAJECTORY_ID = 100;
+constexpr int STATE_ID      = 100 + 5;
+
+static const char* joint_names[] = {"shoulder", "elbow"};
+
+TEST_GROUP(TrajectoryExecutor)
+{
+  void setup()
+  {
+    _executor.init(_nh);
+    _nh.initNode();
+    _nh.getHardware()->injectFrame(rosserial_msgs::TopicInfo::ID_PUBLISHER, nullptr, 0u);
+    _nh.spinOnce();
+    _nh.getHardware()->clearTx();
+    CHECK(_nh.connected());
+  }
+
+  /**
+   * @brief Send a trajectory of length points, values per point are given as
+   *        time, positions[2], velocities[2], accelerations[2]
+   */
+  void send(const float values[][7], const uint32_t length, const uint32_t fields = 3u,
+            const char** names = joint_names, const ros::Time stamp = ros::Time())
+  {
+    trajectory_msgs::JointTrajectory msg;
+    uint8_t                          buffer[512];
+
+    msg.header.stamp        = stamp;
+    msg.joint_names_length  = 2u;
+    msg.joint_names         = const_cast<char**>(names);
+    msg.points_length       = length;
+    msg.points              = _points;
+    for(uint32_t idx = 0u; idx < length; idx++)
+    {
+      trajectory_msgs::JointTrajectoryPoint& p = _points[idx];
+
+      memcpy(_values[idx], &values[idx][1], 6u * sizeof(float));
+      p.time_from_start.sec   = static_cast<int32_t>(values[idx][0]);
+      p.time_from_start.nsec  = static_cast<int32_t>((values[idx][0] - p.time_from_start.sec) * 1e9f + 0.5f);
+      p.positions_length      = 2u;
+      p.positions             = &_values[idx][0];
+      p.velocities_length     = (fields > 1u) ? 2u : 0u;
+      p.velocities            = &_values[idx][2];
+      p.accelerations_length  = (fields > 2u) ? 2u : 0u;
+      p.accelerations         = &_values[idx][4];
+      p.effort_length         = 0u;
+    }
+
+    const int size = msg.serialize(buffer);
+
+    _nh.getHardware()->injectFrame(TRAJECTORY_ID, buffer, static_cast<uint16_t>(size));
+    _nh.spinOnce();
+  }
+
+  bool sample(const float time, float* position, float* velocity = nullptr)
+  {
+    const uint32_t sec  = static_cast<uint32_t>(time);
+    const uint32_t nsec = static_cast<uint32_t>((time - sec) * 1e9f + 0.5f);
+    return _executor.sample(ros::Time(100u + sec, nsec), position, velocity);
+  }
+
+  TestNodeHandle                        _nh;
+  TestExecutor                          _executor{"trajectory", "state", joint_names, 2};
+  trajectory_msgs::JointTrajectoryPoint _points[8];
+  float                                 _values[8][6];
+};
+
+TEST(TrajectoryExecutor, LinearWithPositionsOnly)
+{
+  const float points[][7] = {{1.0f, 1.0f, -1.0f}, {2.0f, 3.0f, -3.0f}};
+  float       position[2];
+
+  send(points, 2u, 1u);
+  CHECK(_executor.isRunning());
+
+  CHECK(sample(0.0f, position));
+  DOUBLES_EQUAL(0.0, position[0], 1e-6);
+  CHECK(sample(0.5f, position));
+  DOUBLES_EQUAL(0.5, position[0], 1e-5);
+  DOUBLES_EQUAL(-0.5, position[1], 1e-5);
+  CHECK(sample(1.5f, position));
+  DOUBLES_EQUAL(2.0, position[0], 1e-5);
+
+  CHECK_FALSE(sample(2.5f, position));
+  DOUBLES_EQUAL(3.0, position[0], 1e-5);
+  DOUBLES_EQUAL(-3.0, position[1], 1e-5);
+  CHECK_FALSE(_executor.isRunning());
+}
+
+TEST(TrajectoryExecutor, CubicMatchesPointsAndVelocities)
+{
+  const float points[][7] = {{1.0f, 1.0f, 0.0f, 0.5f, 0.0f}, {2.0f, 2.0f, 0.0f, 0.0f, 0.0f}};
+  float       position[2];
+  float       velocity[2];
+
+  send(points, 2u, 2u);
+  sample(0.0f, position, velocity);
+  DOUBLES_EQUAL(0.0, velocity[0], 1e-6);
+  sample(0.5f, position, velocity);
+  // zero velocity at the start and 0.5 at the end
+  DOUBLES_EQUAL(0.4375, position[0], 1e-5);
+  sample(1.0f, position, velocity);
+  DOUBLES_EQUAL(1.0, position[0], 1e-5);
+  DOUBLES_EQUAL(0.5, velocity[0], 1e-5);
+  sample(1.001f, position, velocity);
+  DOUBLES_EQUAL(0.5, velocity[0], 1e-2);
+  sample(2.0f, position, velocity);
+  DOUBLES_EQUAL(2.0, position[0], 1e-5);
+}
+
+TEST(TrajectoryExecutor, QuinticMatchesBoundaries)
+{
+  const float a[3] = {0.0f, 1.0f, -2.0f};
+  const float b[3] = {2.0f, -1.0f, 3.0f};
+  const float t    = 1.5f;
+  float       c[6];
+
+  TestExecutor::coefficients(5, a, b, t, c);
+  const float p = c[0] + t * (c[1] + t * (c[2] + t * (c[3] + t * (c[4] + t * c[5]))));
+  const float v = c[1] + t * (2.0f * c[2] + t * (3.0f * c[3] + t * (4.0f * c[4] + t * 5.0f * c[5])));
+  const float acc = 2.0f * c[2] + t * (6.0f * c[3] + t * (12.0f * c[4] + t * 20.0f * c[5]));
+  DOUBLES_EQUAL(a[0], c[0], 0.0);
+  DOUBLES_EQUAL(a[1], c[1], 0.0);
+  DOUBLES_EQUAL(a[2], 2.0f * c[2], 0.0);
+  DOUBLES_EQUAL(b[0], p, 1e-4);
+  DOUBLES_EQUAL(b[1], v, 1e-4);
+  DOUBLES_EQUAL(b[2], acc, 1e-4);
+}
+
+TEST(TrajectoryExecutor, JointOrderOfMessage)
+{
+  const char* reversed[]  = {"elbow", "shoulder"};
+  const float points[][7] = {{1.0f, 1.0f, 2.0f}};
+  float       position[2];
+
+  send(points, 1u, 1u, reversed);
+  sample(0.0f, position);
+  sample(1.0f, position);
+  DOUBLES_EQUAL(2.0, position[0], 1e-6);
+  DOUBLES_EQUAL(1.0, position[1], 1e-6);
+}
+
+TEST(TrajectoryExecutor, InvalidTrajectoriesRejected)
+{
+  const char* unknown[]   = {"elbow", "wrist"};
+  const char* twice[]     = {"elbow", "elbow"};
+  const float points[][7] = {{1.0f}, {2.0f}, {3.0f}, {4.0f}, {5.0f}};
+  const float back[][7]   = {{2.0f}, {1.0f}};
+  const float early[][7]  = {{-1.0f}, {1.0f}};
+
+  send(points, 1u, 1u, unknown);
+  CHECK_FALSE(_executor.isRunning());
+  _nh.getHardware()->clearTx();
+  send(points, 1u, 1u, twice);
+  CHECK_FALSE(_executor.isRunning());
+  const char* reason = "duplicate joint";
+  CHECK(nullptr != memmem(_nh.getHardware()->_tx_buffer, _nh.getHardware()->_tx_size, reason, strlen(reason)));
+  send(points, 5u, 1u);
+  CHECK_FALSE(_executor.isRunning());
+  send(back, 2u, 1u);
+  CHECK_FALSE(_executor.isRunning());
+  send(early, 2u, 1u);
+  CHECK_FALSE(_executor.isRunning());
+
+  send(points, 4u, 1u);
+  CHECK(_executor.isRunning());
+}
+
+TEST(TrajectoryExecutor, StartsAtStamp)
+{
+  const float points[][7] = {{1.0f, 1.0f, 1.0f}};
+  float       position[2];
+
+  send(points, 1u, 1u, joint_names, ros::Time(102u, 0u));
+  CHECK(sample(0.0f, position));
+  CHECK(sample(1.5f, position));
+  DOUBLES_EQUAL(0.0, position[0], 0.0);
+  sample(2.5f, position);
+  DOUBLES_EQUAL(0.5, position[0], 1e-5);
+}
+
+TEST(TrajectoryExecutor, NewTrajectoryStartsAtSetpoint)
+{
+  const float first[][7]  = {{1.0f, 2.0f, 0.0f}};
+  const float second[][7] = {{1.0f, 0.0f, 0.0f}};
+  float       position[2];
+
+  send(first, 1u, 1u);
+  sample(0.0f, position);
+  sample(0.5f, position);
+  send(second, 1u, 1u);
+  sample(0.5f, position);
+  DOUBLES_EQUAL(1.0, position[0], 1e-5);
+  sample(1.0f, position);
+  DOUBLES_EQUAL(0.5, position[0], 1e-5);
+}
+
+TEST(TrajectoryExecutor, CancelAndEmptyTrajectoryHold)
+{
+  const float points[][7] = {{1.0f, 2.0f, 0.0f}};
+  float       position[2];
+  float       velocity[2];
+
+  send(points, 1u, 1u);
+  sample(0.0f, position);
+  sample(0.5f, position);
+  _executor.cancel();
+  CHECK_FALSE(sample(0.6f, position, velocity));
+  DOUBLES_EQUAL(1.0, position[0], 1e-5);
+  DOUBLES_EQUAL(0.0, velocity[0], 0.0);
+
+  send(points, 1u, 1u);
+  sample(0.7f, position);
+  send(points, 0u, 1u);
+  CHECK_FALSE(sample(0.8f, position));
+  CHECK_FALSE(_executor.isRunning());
+}
+
+TEST(TrajectoryExecutor, FeedbackDecimated)
+{
+  const float                                 points[][7] = {{1.0f, 1.0f, 0.0f}};
+  const float                                 actual[2]   = {0.25f, 0.0f};
+  float                                       position[2];
+  control_msgs::JointTrajectoryControllerState state;
+  TestHardware*                               hw = _nh.getHardware();
+  uint8_t                                     rx[256];
+
+  send(points, 1u, 1u);
+  hw->clearTx();
+  LONGS_EQUAL(0, _executor.update());
+  for(int idx = 0; idx < 9; idx++)
+  {
+    _executor.sample(ros::Time(100u, 50000000u * idx), position, nullptr, actual);
+  }
+  LONGS_EQUAL(0, _executor.update());
+  _executor.sample(ros::Time(100u, 500000000u), position, nullptr, actual);
+  CHECK(_executor.update() > 0);
+
+  LONGS_EQUAL(STATE_ID, hw->_tx_buffer[5] | (hw->_tx_buffer[6] << 8));
+  const uint32_t size = hw->_tx_buffer[2] | (hw->_tx_buffer[3] << 8);
+  memcpy(rx, &hw->_tx_buffer[7], size);
+  CHECK(static_cast<int>(size) == state.deserialize(rx, size));
+  LONGS_EQUAL(2u, state.joint_names_length);
+  STRCMP_EQUAL("elbow", state.joint_names[1]);
+  DOUBLES_EQUAL(0.5, state.desired.positions[0], 1e-5);
+  DOUBLES_EQUAL(0.25, state.actual.positions[0], 1e-6);
+  DOUBLES_EQUAL(-0.25, state.error.positions[0], 1e-5);
+}
@@ -0,0 +1,209 @@
+/*BSD 3-Clause License
+
+Copyright (c) 2019, Franconian Open Robotics
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file TransformBufferTests.cpp
+ * @author Martin Bauernschmitt (martin.bauernschmitt@posteo.de)
+ * 
+ * @brief Tests of the transform buffer
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2019 Franconian Open Robotics
+ * 
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <CppUTest/TestHarness.h>
+#include <cmath>
+#include <cstring>
+#include "ros/node_handle.h"
+#include "tf/transform_buffer.h"
+#include "TestHardware.h"
+/* -------------------------------------------------------------------------------*/
+
+typedef ros::NodeHandle_<TestHardware, 5, 5, 512, 256> TestNodeHandle;
+typedef tf::TransformBuffer<4, 4> TestBuffer;
+
+TEST_GROUP(TransformBuffer)
+{
+  geometry_msgs::TransformStamped makeTransform(const uint32_t sec, const uint32_t nsec,
+                                                const float x, const float yaw)
+  {
+    geometry_msgs::TransformStamped transform;
+
+    transform.header.frame_id         = "base_link";
+    transform.header.stamp            = ros::Time(sec, nsec);
+    transform.child_frame_id          = "laser";
+    transform.transform.translation.x = x;
+    transform.transform.rotation.z    = sinf(0.5f * yaw);
+    transform.transform.rotation.w    = cosf(0.5f * yaw);
+    return transform;
+  }
+
+  static float yawOf(const geometry_msgs::Transform& transform)
+  {
+    return 2.0f * atan2f(transform.rotation.z, transform.rotation.w);
+  }
+
+  TestBuffer _buffer;
+};
+
+TEST(TransformBuffer, Interpolation)
+{
+  geometry_msgs::Transform transform;
+
+  CHECK(_buffer.setTransform(makeTransform(10u, 0u, 0.0f, 0.0f)));
+  CHECK(_buffer.setTransform(makeTransform(11u, 0u, 2.0f, 1.5f)));
+
+  CHECK(_buffer.lookupTransform("base_link", "laser", ros::Time(10u, 250000000u), transform));
+  DOUBLES_EQUAL(0.5, transform.translation.x, 1e-5);
+  DOUBLES_EQUAL(0.375, yawOf(transform), 1e-5);
+
+  // Exactly on the stamps
+  CHECK(_buffer.lookupTransform("base_link", "laser", ros::Time(10u, 0u), transform));
+  DOUBLES_EQUAL(0.0, transform.translation.x, 1e-6);
+  CHECK(_buffer.lookupTransform("base_link", "laser", ros::Time(11u, 0u), transform));
+  DOUBLES_EQUAL(2.0, transform.translation.x, 1e-6);
+  DOUBLES_EQUAL(1.5, yawOf(transform), 1e-5);
+}
+
+TEST(TransformBuffer, ShorterArc)
+{
+  geometry_msgs::Transform        transform;
+  geometry_msgs::TransformStamped second = makeTransform(11u, 0u, 0.0f, 0.5f);
+
+  // Same rotation with negated quaternion
+  second.transform.rotation.z = -second.transform.rotation.z;
+  second.transform.rotation.w = -second.transform.rotation.w;
+
+  CHECK(_buffer.setTransform(makeTransform(10u, 0u, 0.0f, 0.1f)));
+  CHECK(_buffer.setTransform(second));
+
+  CHECK(_buffer.lookupTransform("base_link", "laser", ros::Time(10u, 500000000u), transform));
+  DOUBLES_EQUAL(0.3, yawOf(transform), 1e-5);
+}
+
+TEST(TransformBuffer, LatestAndRange)
+{
+  geometry_msgs::Transform transform;
+
+  CHECK_FALSE(_buffer.lookupTransform("base_link", "laser", ros::Time(), transform));
+
+  CHECK(_buffer.setTransform(makeTransform(10u, 0u, 1.0f, 0.0f)));
+  CHECK(_buffer.setTransform(makeTransform(11u, 0u, 3.0f, 0.0f)));
+
+  CHECK(_buffer.lookupTransform("base_link", "laser", ros::Time(), transform));
+  DOUBLES_EQUAL(3.0, transform.translation.x, 0.0);
+
+  // No extrapolation
+  CHECK_FALSE(_buffer.lookupTransform("base_link", "laser", ros::Time(9u, 999999999u), transform));
+  CHECK_FALSE(_buffer.lookupTransform("base_link", "laser", ros::Time(11u, 1u), transform));
+  CHECK_FALSE(_buffer.lookupTransform("base_link", "camera", ros::Time(), transform));
+}
+
+TEST(TransformBuffer, RingKeepsNewest)
+{
+  geometry_msgs::Transform transform;
+
+  // Out of order, with uneven spacing
+  const uint32_t secs[] = {10u, 11u, 13u, 12u, 20u, 14u};
+  for(const auto sec : secs)
+  {
+    CHECK(_buffer.setTransform(makeTransform(sec, 0u, static_cast<float>(sec), 0.0f)));
+  }
+
+  // Kept 12, 13, 14, 20
+  CHECK_FALSE(_buffer.lookupTransform("base_link", "laser", ros::Time(11u, 500000000u), transform));
+  CHECK(_buffer.lookupTransform("base_link", "laser", ros::Time(12u, 500000000u), transform));
+  DOUBLES_EQUAL(12.5, transform.translation.x, 1e-5);
+  CHECK(_buffer.lookupTransform("base_link", "laser", ros::Time(17u, 0u), transform));
+  DOUBLES_EQUAL(17.0, transform.translation.x, 1e-5);
+
+  // Same stamp replaces
+  CHECK(_buffer.setTransform(makeTransform(20u, 0u, 0.0f, 0.0f)));
+  CHECK(_buffer.lookupTransform("base_link", "laser", ros::Time(), transform));
+  DOUBLES_EQUAL(0.0, transform.translation.x, 0.0);
+}
+
+TEST(TransformBuffer, StaticTransform)
+{
+  geometry_msgs::Transform transform;
+
+  CHECK(_buffer.setTransform(makeTransform(1u, 0u, 0.25f, 0.0f), true));
+  CHECK(_buffer.lookupTransform("base_link", "laser", ros::Time(1000u, 0u), transform));
+  DOUBLES_EQUAL(0.25, transform.translation.x, 0.0);
+}
+
+TEST(TransformBuffer, PairLimit)
+{
+  geometry_msgs::TransformStamped transform = makeTransform(1u, 0u, 0.0f, 0.0f);
+  const char* children[] = {"a", "b", "c", "d", "e"};
+
+  for(uint32_t idx = 0u; idx < 4u; idx++)
+  {
+    transform.child_frame_id = children[idx];
+    CHECK(_buffer.setTransform(transform));
+  }
+  transform.child_frame_id = children[4];
+  CHECK_FALSE(_buffer.setTransform(transform));
+
+  CHECK(2 == _buffer.findPair("base_link", "c"));
+  CHECK(-1 == _buffer.findPair("base_link", "e"));
+}
+
+TEST(TransformBuffer, FedFromSubscriber)
+{
+  TestNodeHandle                  nh;
+  tf::tfMessage                   msg;
+  geometry_msgs::TransformStamped transforms[2];
+  geometry_msgs::Transform        transform;
+  uint8_t                         buffer[256];
+
+  nh.initNode();
+  CHECK(_buffer.subscribe(nh));
+  nh.getHardware()->injectFrame(rosserial_msgs::TopicInfo::ID_PUBLISHER, nullptr, 0u);
+  nh.spinOnce();
+
+  transforms[0] = makeTransform(5u, 0u, 1.0f, 0.0f);
+  transforms[1] = makeTransform(6u, 0u, 2.0f, 0.0f);
+  msg.transforms        = transforms;
+  msg.transforms_length = 2u;
+  const int size = msg.serialize(buffer);
+
+  // /tf is subscribed first
+  nh.getHardware()->injectFrame(100u, buffer, size);
+  nh.spinOnce();
+
+  CHECK(_buffer.lookupTransform("base_link", "laser", ros::Time(5u, 500000000u), transform));
+  DOUBLES_EQUAL(1.5, transform.translation.x, 1e-6);
+}
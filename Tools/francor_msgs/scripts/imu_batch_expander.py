@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+#
+# Republish francor_msgs/ImuBatch as sensor_msgs/Imu
+#
+# Author: Martin Bauernschmitt
+# Date: 17.10.2026
+#
+# Usage: rosrun francor_msgs imu_batch_expander.py imu_batch:=<batch topic> imu:=<imu topic>
+#
+# Every sample of a batch is published as its own sensor_msgs/Imu, stamped
+# with header.stamp plus its time offset. Batches without orientation are
+# published with orientation_covariance[0] = -1 as sensor_msgs/Imu asks for
+# an unknown orientation. This is the host side counterpart of
+# francor::ImuBatcher.
+
+import rospy
+from francor_msgs.msg import ImuBatch
+from sensor_msgs.msg import Imu
+
+
+def expand(batch):
+  samples = len(batch.time_offset)
+  if len(batch.angular_velocity) < 3 * samples or len(batch.linear_acceleration) < 3 * samples:
+    rospy.logwarn_throttle(10.0, 'dropping ImuBatch with short sample arrays')
+    return []
+
+  with_orientation = len(batch.orientation) >= 4 * samples
+  messages = []
+  for idx in range(samples):
+    imu = Imu()
+    imu.header.seq = batch.header.seq
+    imu.header.frame_id = batch.header.frame_id
+    imu.header.stamp = batch.header.stamp + rospy.Duration(0, batch.time_offset[idx])
+
+    imu.angular_velocity.x, imu.angular_velocity.y, imu.angular_velocity.z = \
+      batch.angular_velocity[3 * idx:3 * idx + 3]
+    imu.linear_acceleration.x, imu.linear_acceleration.y, imu.linear_acceleration.z = \
+      batch.linear_acceleration[3 * idx:3 * idx + 3]
+
+    imu.orientation_covariance = list(batch.orientation_covariance)
+    imu.angular_velocity_covariance = list(batch.angular_velocity_covariance)
+    imu.linear_acceleration_covariance = list(batch.linear_acceleration_covariance)
+
+    if with_orientation:
+      imu.orientation.x, imu.orientation.y, imu.orientation.z, imu.orientation.w = \
+        batch.orientation[4 * idx:4 * idx + 4]
+    else:
+      imu.orientation.w = 1.0
+      imu.orientation_covariance[0] = -1.0
+
+    messages.append(imu)
+  return messages
+
+
+def main():
+  rospy.init_node('imu_batch_expander')
+  queue_size = rospy.get_param('~queue_size', 100)
+  publisher = rospy.Publisher('imu', Imu, queue_size=queue_size)
+
+  def received(batch):
+    for imu in expand(batch):
+      publisher.publish(imu)
+
+  rospy.Subscriber('imu_batch', ImuBatch, received, queue_size=10)
+  rospy.spin()
+
+
+if __name__ == '__main__':
+  main()